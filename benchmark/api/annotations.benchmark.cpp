@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/annotation/annotation.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class AnnotationBenchmark {
+public:
+    AnnotationBenchmark() {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 6);
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource { ":memory:", "." };
+    ThreadPool threadPool { 4 };
+    HeadlessFrontend frontend { { 512, 512 }, 1, fileSource, threadPool };
+    Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, fileSource, threadPool, MapMode::Static };
+};
+
+// Short routes scattered around the viewport.
+LineAnnotation route(std::size_t i) {
+    const double lng = -84 + double(i * 7919 % 2000) / 100;
+    const double lat = 33 + double(i * 104729 % 1600) / 100;
+    LineString<double> line {{ { lng, lat }, { lng + 0.2, lat + 0.1 }, { lng + 0.4, lat } }};
+    LineAnnotation annotation { line };
+    annotation.color = Color::red();
+    return annotation;
+}
+
+std::vector<AnnotationID> addRoutes(Map& map, std::size_t count) {
+    std::vector<AnnotationID> ids;
+    for (std::size_t i = 0; i < count; i++) {
+        ids.push_back(map.addAnnotation(route(i)));
+    }
+    return ids;
+}
+
+} // end namespace
+
+static void API_annotations_add(::benchmark::State& state) {
+    AnnotationBenchmark bench;
+    while (state.KeepRunning()) {
+        const auto ids = addRoutes(bench.map, state.range(0));
+        bench.frontend.render(bench.map);
+
+        state.PauseTiming();
+        for (const auto id : ids) {
+            bench.map.removeAnnotation(id);
+        }
+        bench.frontend.render(bench.map);
+        state.ResumeTiming();
+    }
+}
+
+static void API_annotations_update(::benchmark::State& state) {
+    AnnotationBenchmark bench;
+    const auto ids = addRoutes(bench.map, state.range(0));
+    bench.frontend.render(bench.map);
+
+    std::size_t i = 0;
+    while (state.KeepRunning()) {
+        bench.map.updateAnnotation(ids[i % ids.size()], route(i + ids.size()));
+        bench.frontend.render(bench.map);
+        i++;
+    }
+}
+
+static void API_annotations_remove(::benchmark::State& state) {
+    AnnotationBenchmark bench;
+    addRoutes(bench.map, state.range(0));
+    bench.frontend.render(bench.map);
+
+    std::size_t i = 0;
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        const AnnotationID id = bench.map.addAnnotation(route(i++));
+        bench.frontend.render(bench.map);
+        state.ResumeTiming();
+
+        bench.map.removeAnnotation(id);
+        bench.frontend.render(bench.map);
+    }
+}
+
+BENCHMARK(API_annotations_add)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_annotations_update)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
+BENCHMARK(API_annotations_remove)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
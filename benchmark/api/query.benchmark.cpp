@@ -4,6 +4,7 @@
 #include <mbgl/gl/headless_frontend.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
 #include <mbgl/renderer/renderer.hpp>
+#include <mbgl/renderer/query.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/storage/default_file_source.hpp>
@@ -36,6 +37,17 @@ public:
     HeadlessFrontend frontend { { 1000, 1000 }, 1, fileSource, threadPool };
     Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, fileSource, threadPool, MapMode::Static};
     ScreenBox box{{ 0, 0 }, { 1000, 1000 }};
+
+    // A grid of 10x10 boxes covering the viewport, as used for hit testing.
+    std::vector<ScreenLineString> grid() const {
+        std::vector<ScreenLineString> boxes;
+        for (double y = 0; y < 1000; y += 100) {
+            for (double x = 0; x < 1000; x += 100) {
+                boxes.push_back({ { x, y }, { x + 100, y }, { x + 100, y + 100 }, { x, y + 100 }, { x, y } });
+            }
+        }
+        return boxes;
+    }
 };
 
 } // end namespace
@@ -64,6 +76,39 @@ static void API_queryRenderedFeaturesLayerFromHighDensity(::benchmark::State& st
     }
 }
 
+static void API_queryRenderedFeaturesGrid(::benchmark::State& state) {
+    QueryBenchmark bench;
+    const std::vector<ScreenLineString> boxes = bench.grid();
+
+    while (state.KeepRunning()) {
+        for (const auto& geometry : boxes) {
+            bench.frontend.getRenderer()->queryRenderedFeatures(geometry, {});
+        }
+    }
+}
+
+static void API_queryRenderedFeaturesGridBatch(::benchmark::State& state) {
+    QueryBenchmark bench;
+    const std::vector<ScreenLineString> boxes = bench.grid();
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->queryRenderedFeatures(boxes, {});
+    }
+}
+
+static void API_querySourceFeatures(::benchmark::State& state) {
+    QueryBenchmark bench;
+    SourceQueryOptions options;
+    options.sourceLayers = std::vector<std::string>{ "road", "building", "poi_label" };
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->querySourceFeatures("composite", options);
+    }
+}
+
 BENCHMARK(API_queryRenderedFeaturesAll);
 BENCHMARK(API_queryRenderedFeaturesLayerFromLowDensity);
 BENCHMARK(API_queryRenderedFeaturesLayerFromHighDensity);
+BENCHMARK(API_queryRenderedFeaturesGrid);
+BENCHMARK(API_queryRenderedFeaturesGridBatch);
+BENCHMARK(API_querySourceFeatures);
@@ -44,8 +44,9 @@ static void API_renderStill_reuse_map(::benchmark::State& state) {
     Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Static};
     prepare(map);
 
+    PremultipliedImage image;
     while (state.KeepRunning()) {
-        frontend.render(map);
+        frontend.render(map, image);
     }
 }
 
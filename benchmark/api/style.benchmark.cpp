@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/map/map.hpp>
+#include <mbgl/map/map_observer.hpp>
+#include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace mbgl;
+
+// Creates N maps loading the same style. All but the first one share the parsed style.
+static void API_loadStyle_maps(::benchmark::State& state) {
+    util::RunLoop loop;
+    NetworkStatus::Set(NetworkStatus::Status::Offline);
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    fileSource.setAccessToken("foobar");
+    ThreadPool threadPool { 4 };
+
+    const std::string json = util::read_file("benchmark/fixtures/api/style.json");
+
+    while (state.KeepRunning()) {
+        std::vector<std::unique_ptr<HeadlessFrontend>> frontends;
+        std::vector<std::unique_ptr<Map>> maps;
+
+        for (int64_t i = 0; i < state.range(0); i++) {
+            frontends.push_back(std::make_unique<HeadlessFrontend>(Size { 256, 256 }, 1, fileSource, threadPool));
+            maps.push_back(std::make_unique<Map>(*frontends.back(), MapObserver::nullObserver(), frontends.back()->getSize(),
+                                                 1, fileSource, threadPool, MapMode::Static));
+            maps.back()->getStyle().loadJSON(json);
+        }
+
+        state.PauseTiming();
+        maps.clear();
+        frontends.clear();
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(API_loadStyle_maps)->Arg(1)->Arg(10)->Arg(50);
@@ -5,10 +5,12 @@
 #include <mbgl/style/conversion/function.hpp>
 #include <mbgl/style/conversion/property_value.hpp>
 
+#include <cmath>
+
 using namespace mbgl;
 using namespace mbgl::style;
 
-static std::string createFunctionJSON(size_t stopCount) {
+static std::string createFunctionJSON(size_t stopCount, const std::string& type = R"("exponential", "base": 2)") {
     std::string stops = "[";
     for (size_t i = 0; i < stopCount; i++) {
         std::string value = std::to_string(24.0f / stopCount * i);
@@ -16,7 +18,7 @@ static std::string createFunctionJSON(size_t stopCount) {
         stops += "[" + value + ", " + value + "]";
     }
     stops += "]";
-    return R"({"type": "exponential", "base": 2,  "stops": )" + stops + "}";
+    return R"({"type": )" + type + R"(,  "stops": )" + stops + "}";
 }
 
 static void Parse_CameraFunction(benchmark::State& state) {
@@ -52,10 +54,44 @@ static void Evaluate_CameraFunction(benchmark::State& state) {
     state.SetLabel(std::to_string(stopCount).c_str());
 }
 
+// Evaluates the function the way a zoom animation does: at a slightly different zoom for
+// every frame, and at the zoom levels around it as cross-faded properties do.
+static void evaluateZoomAnimation(benchmark::State& state, const std::string& type) {
+    size_t stopCount = state.range(0);
+    auto doc = createFunctionJSON(stopCount, type);
+    conversion::Error error;
+    optional<PropertyValue<float>> function = conversion::convertJSON<PropertyValue<float>>(doc, error, false, false);
+    if (!function) {
+        state.SkipWithError(error.message.c_str());
+    }
+
+    float z = 0;
+    while (state.KeepRunning()) {
+        z = z < 23.0f ? z + 0.01f : 1.0f;
+        for (float zoom : { z - 1.0f, z, z + 1.0f, std::floor(z) }) {
+            benchmark::DoNotOptimize(function->asExpression().evaluate(zoom));
+        }
+    }
+
+    state.SetLabel(std::to_string(stopCount).c_str());
+}
+
+static void Evaluate_CameraFunctionZoomAnimation(benchmark::State& state) {
+    evaluateZoomAnimation(state, R"("exponential", "base": 2)");
+}
+
+static void Evaluate_IntervalCameraFunctionZoomAnimation(benchmark::State& state) {
+    evaluateZoomAnimation(state, R"("interval")");
+}
+
 BENCHMARK(Parse_CameraFunction)
     ->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8)->Arg(10)->Arg(12);
 
 BENCHMARK(Evaluate_CameraFunction)
     ->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8)->Arg(10)->Arg(12);
 
+BENCHMARK(Evaluate_CameraFunctionZoomAnimation)
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8)->Arg(10)->Arg(12);
 
+BENCHMARK(Evaluate_IntervalCameraFunctionZoomAnimation)
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(6)->Arg(8)->Arg(10)->Arg(12);
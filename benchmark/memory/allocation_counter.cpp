@@ -0,0 +1,76 @@
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocations { 0 };
+std::atomic<std::size_t> allocated { 0 };
+std::atomic<std::size_t> peak { 0 };
+
+constexpr std::size_t header = sizeof(std::max_align_t);
+
+void* allocate(std::size_t size) noexcept {
+    auto* block = static_cast<std::size_t*>(std::malloc(size + header));
+    if (!block) {
+        return nullptr;
+    }
+    *block = size;
+    allocations++;
+    const std::size_t now = allocated += size;
+    std::size_t previous = peak;
+    while (now > previous && !peak.compare_exchange_weak(previous, now)) {
+    }
+    return reinterpret_cast<char*>(block) + header;
+}
+
+void deallocate(void* ptr) noexcept {
+    if (ptr) {
+        auto* block = reinterpret_cast<std::size_t*>(static_cast<char*>(ptr) - header);
+        allocated -= *block;
+        std::free(block);
+    }
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* ptr = allocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    deallocate(ptr);
+}
+
+namespace mbgl {
+
+std::size_t AllocationCounter::allocations() {
+    return ::allocations;
+}
+
+std::size_t AllocationCounter::allocated() {
+    return ::allocated;
+}
+
+std::size_t AllocationCounter::peak() {
+    return ::peak;
+}
+
+void AllocationCounter::resetPeak() {
+    ::peak = ::allocated.load();
+}
+
+} // namespace mbgl
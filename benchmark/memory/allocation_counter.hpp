@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mbgl {
+
+// Counts the memory allocated through operator new, which mbgl-benchmark-memory replaces
+// with a counting version. Replacing operator new affects every benchmark linked into the
+// same binary, so benchmarks using this are built into mbgl-benchmark-memory rather than
+// mbgl-benchmark.
+class AllocationCounter {
+public:
+    // The number of allocations made so far.
+    static std::size_t allocations();
+
+    // The number of bytes currently allocated.
+    static std::size_t allocated();
+
+    // The most bytes allocated at once since the last call to resetPeak().
+    static std::size_t peak();
+    static void resetPeak();
+};
+
+} // namespace mbgl
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+
+#include "allocation_counter.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace mbgl;
+using namespace mbgl::style::conversion;
+
+namespace {
+
+// A feature collection of polygons with a few properties each.
+std::string makeFeatureCollection(int64_t features) {
+    std::ostringstream json;
+    json << R"JSON({"type":"FeatureCollection","features":[)JSON";
+    for (int64_t i = 0; i < features; i++) {
+        json << (i ? "," : "")
+             << R"JSON({"type":"Feature","id":)JSON" << i
+             << R"JSON(,"properties":{"name":"feature )JSON" << i << R"JSON(","rank":)JSON" << i % 10
+             << R"JSON(,"area":)JSON" << i * 0.5
+             << R"JSON(},"geometry":{"type":"Polygon","coordinates":[[)JSON";
+        for (int j = 0; j <= 32; j++) {
+            json << (j ? "," : "") << "[" << (i % 360) - 180 + (j % 32) * 0.01 << "," << (i % 170) - 85 + (j % 16) * 0.01 << "]";
+        }
+        json << "]]}}";
+    }
+    json << "]}";
+    return json.str();
+}
+
+template <class Parse>
+void run(benchmark::State& state, Parse parse) {
+    const std::string json = makeFeatureCollection(state.range(0));
+    std::size_t peakBytes = 0;
+
+    while (state.KeepRunning()) {
+        const std::size_t baseline = AllocationCounter::allocated();
+        AllocationCounter::resetPeak();
+
+        Error error;
+        optional<GeoJSON> geoJSON = parse(json, error);
+        benchmark::DoNotOptimize(geoJSON);
+
+        peakBytes = std::max(peakBytes, AllocationCounter::peak() - baseline);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(json.size()));
+    state.counters["peak_MB"] = double(peakBytes) / (1024 * 1024);
+}
+
+} // namespace
+
+static void Memory_GeoJSON_DOM(benchmark::State& state) {
+    run(state, [](const std::string& json, Error& error) {
+        return convertJSON<GeoJSON>(json, error);
+    });
+}
+
+static void Memory_GeoJSON_Streaming(benchmark::State& state) {
+    run(state, [](const std::string& json, Error& error) {
+        return parseGeoJSON(json, error);
+    });
+}
+
+BENCHMARK(Memory_GeoJSON_DOM)->Arg(1000)->Arg(10000);
+BENCHMARK(Memory_GeoJSON_Streaming)->Arg(1000)->Arg(10000);
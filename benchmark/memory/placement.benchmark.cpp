@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/geometry/anchor.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/buckets/symbol_bucket.hpp>
+#include <mbgl/text/collision_index.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/mat4.hpp>
+
+#include "allocation_counter.hpp"
+
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class PlacementTile {
+public:
+    uint32_t bucketInstanceId;
+    mat4 posMatrix;
+    std::vector<CollisionFeature> features;
+};
+
+// Point labels spread over a 4x4 block of z14 tiles around the center of the world,
+// 400 per tile, placed into the collision index like Placement does.
+class PlacementBenchmark {
+public:
+    PlacementBenchmark() {
+        transform.resize({ 1024, 1024 });
+        transform.setLatLngZoom({ 0, 0 }, 14);
+        const TransformState& state = transform.getState();
+
+        mat4 projMatrix;
+        state.getProjMatrix(projMatrix);
+
+        const uint32_t first = (1u << 14) / 2 - 2;
+        for (uint32_t x = first; x < first + 4; x++) {
+            for (uint32_t y = first; y < first + 4; y++) {
+                PlacementTile tile;
+                tile.bucketInstanceId = uint32_t(tiles.size() + 1);
+                state.matrixFor(tile.posMatrix, UnwrappedTileID(14, x, y));
+                matrix::multiply(tile.posMatrix, projMatrix, tile.posMatrix);
+
+                for (uint32_t i = 0; i < 400; i++) {
+                    const Anchor anchor((i * 7919) % util::EXTENT, (i * 104729) % util::EXTENT, 0, 0);
+                    tile.features.emplace_back(GeometryCoordinates(), anchor, -10.0f, 10.0f, -40.0f, 40.0f, 1.0f, 2.0f,
+                                               style::SymbolPlacementType::Point, IndexedSubfeature(i, 0, 0, i), 1.0f);
+                }
+                tiles.push_back(std::move(tile));
+            }
+        }
+    }
+
+    CollisionIndex place() {
+        CollisionIndex collisionIndex(transform.getState());
+
+        // Point labels use neither the label plane matrix nor the placed symbol.
+        PlacedSymbol placedSymbol({ 0, 0 }, 0, 0, 0, {{ 0, 0 }}, WritingModeType::None, {}, {});
+        const float textPixelRatio = float(util::tileSize) / util::EXTENT;
+
+        for (auto& tile : tiles) {
+            for (auto& feature : tile.features) {
+                if (collisionIndex.placeFeature(feature, tile.posMatrix, tile.posMatrix, textPixelRatio,
+                                                placedSymbol, 1.0f, 16.0f, false, false, false).first) {
+                    collisionIndex.insertFeature(feature, false, tile.bucketInstanceId);
+                }
+            }
+        }
+
+        return collisionIndex;
+    }
+
+    Transform transform;
+    std::vector<PlacementTile> tiles;
+};
+
+} // end namespace
+
+static void Memory_Placement(::benchmark::State& state) {
+    PlacementBenchmark bench;
+    const std::size_t allocations = AllocationCounter::allocations();
+
+    while (state.KeepRunning()) {
+        CollisionIndex collisionIndex = bench.place();
+        ::benchmark::DoNotOptimize(collisionIndex);
+    }
+
+    state.counters["allocations"] = double(AllocationCounter::allocations() - allocations) / state.iterations();
+}
+
+static void Memory_Placement_queryRenderedSymbols(::benchmark::State& state) {
+    PlacementBenchmark bench;
+    const CollisionIndex collisionIndex = bench.place();
+    const ScreenLineString box { { 0, 0 }, { 1024, 0 }, { 1024, 1024 }, { 0, 1024 }, { 0, 0 } };
+    const std::size_t allocations = AllocationCounter::allocations();
+
+    while (state.KeepRunning()) {
+        auto features = collisionIndex.queryRenderedSymbols(box);
+        ::benchmark::DoNotOptimize(features);
+    }
+
+    state.counters["allocations"] = double(AllocationCounter::allocations() - allocations) / state.iterations();
+}
+
+BENCHMARK(Memory_Placement);
+BENCHMARK(Memory_Placement_queryRenderedSymbols);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/map/map.hpp>
+#include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/renderer/renderer.hpp>
+#include <mbgl/renderer/query.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include "allocation_counter.hpp"
+
+using namespace mbgl;
+
+namespace {
+
+class QueryBenchmark {
+public:
+    QueryBenchmark() {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+        fileSource.setAccessToken("foobar");
+
+        map.getStyle().loadJSON(util::read_file("benchmark/fixtures/api/style.json"));
+        map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
+
+        frontend.render(map);
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource{ "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool{ 4 };
+    HeadlessFrontend frontend { { 1000, 1000 }, 1, fileSource, threadPool };
+    Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, fileSource, threadPool, MapMode::Static};
+    ScreenBox box{{ 0, 0 }, { 1000, 1000 }};
+};
+
+} // end namespace
+
+static void Memory_queryRenderedFeaturesAll(::benchmark::State& state) {
+    QueryBenchmark bench;
+    const std::size_t allocations = AllocationCounter::allocations();
+
+    while (state.KeepRunning()) {
+        auto features = bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, {});
+        ::benchmark::DoNotOptimize(features);
+    }
+
+    state.counters["allocations"] = double(AllocationCounter::allocations() - allocations) / state.iterations();
+}
+
+static void Memory_queryRenderedFeaturesPoint(::benchmark::State& state) {
+    QueryBenchmark bench;
+    const std::size_t allocations = AllocationCounter::allocations();
+
+    while (state.KeepRunning()) {
+        auto features = bench.frontend.getRenderer()->queryRenderedFeatures(ScreenCoordinate { 500, 500 }, {});
+        ::benchmark::DoNotOptimize(features);
+    }
+
+    state.counters["allocations"] = double(AllocationCounter::allocations() - allocations) / state.iterations();
+}
+
+static void Memory_querySourceFeatures(::benchmark::State& state) {
+    QueryBenchmark bench;
+    SourceQueryOptions options;
+    options.sourceLayers = std::vector<std::string>{ "road", "building", "poi_label" };
+    const std::size_t allocations = AllocationCounter::allocations();
+
+    while (state.KeepRunning()) {
+        auto features = bench.frontend.getRenderer()->querySourceFeatures("composite", options);
+        ::benchmark::DoNotOptimize(features);
+    }
+
+    state.counters["allocations"] = double(AllocationCounter::allocations() - allocations) / state.iterations();
+}
+
+BENCHMARK(Memory_queryRenderedFeaturesAll);
+BENCHMARK(Memory_queryRenderedFeaturesPoint);
+BENCHMARK(Memory_querySourceFeatures);
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/geometry/dem_data.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+// There are no terrain tiles among the fixtures, so a smooth synthetic terrain is
+// encoded instead. Decoding does not depend on the shape of the data.
+PremultipliedImage terrain(Tileset::DEMEncoding encoding) {
+    const uint32_t dim = 512;
+    PremultipliedImage image({ dim, dim });
+    uint8_t* pixel = image.data.get();
+    for (uint32_t y = 0; y < dim; y++) {
+        for (uint32_t x = 0; x < dim; x++, pixel += 4) {
+            const double elevation = 1500 + 1000 * std::sin(x / 40.0) * std::cos(y / 60.0);
+            if (encoding == Tileset::DEMEncoding::Mapbox) {
+                const uint32_t value = uint32_t((elevation + 10000) * 10);
+                pixel[0] = value >> 16;
+                pixel[1] = value >> 8;
+                pixel[2] = value;
+            } else {
+                const uint32_t value = uint32_t(elevation + 32768);
+                pixel[0] = value >> 8;
+                pixel[1] = value;
+                pixel[2] = 0;
+            }
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+static void Parse_DEMData_Mapbox(benchmark::State& state) {
+    const PremultipliedImage image = terrain(Tileset::DEMEncoding::Mapbox);
+    while (state.KeepRunning()) {
+        DEMData data(image, Tileset::DEMEncoding::Mapbox);
+        benchmark::DoNotOptimize(data.get(0, 0));
+    }
+}
+
+static void Parse_DEMData_Terrarium(benchmark::State& state) {
+    const PremultipliedImage image = terrain(Tileset::DEMEncoding::Terrarium);
+    while (state.KeepRunning()) {
+        DEMData data(image, Tileset::DEMEncoding::Terrarium);
+        benchmark::DoNotOptimize(data.get(0, 0));
+    }
+}
+
+BENCHMARK(Parse_DEMData_Mapbox);
+BENCHMARK(Parse_DEMData_Terrarium);
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+
+#include <sstream>
+
+using namespace mbgl;
+using namespace mbgl::style::conversion;
+
+namespace {
+
+// A feature collection of polygons with a few properties each.
+std::string makeFeatureCollection(int64_t features) {
+    std::ostringstream json;
+    json << R"JSON({"type":"FeatureCollection","features":[)JSON";
+    for (int64_t i = 0; i < features; i++) {
+        json << (i ? "," : "")
+             << R"JSON({"type":"Feature","id":)JSON" << i
+             << R"JSON(,"properties":{"name":"feature )JSON" << i << R"JSON(","rank":)JSON" << i % 10
+             << R"JSON(,"area":)JSON" << i * 0.5
+             << R"JSON(},"geometry":{"type":"Polygon","coordinates":[[)JSON";
+        for (int j = 0; j <= 32; j++) {
+            json << (j ? "," : "") << "[" << (i % 360) - 180 + (j % 32) * 0.01 << "," << (i % 170) - 85 + (j % 16) * 0.01 << "]";
+        }
+        json << "]]}}";
+    }
+    json << "]}";
+    return json.str();
+}
+
+} // namespace
+
+static void Parse_GeoJSON_DOM(benchmark::State& state) {
+    const std::string json = makeFeatureCollection(state.range(0));
+
+    while (state.KeepRunning()) {
+        Error error;
+        optional<GeoJSON> geoJSON = convertJSON<GeoJSON>(json, error);
+        benchmark::DoNotOptimize(geoJSON);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(json.size()));
+}
+
+static void Parse_GeoJSON_Streaming(benchmark::State& state) {
+    const std::string json = makeFeatureCollection(state.range(0));
+
+    while (state.KeepRunning()) {
+        Error error;
+        optional<GeoJSON> geoJSON = parseGeoJSON(json, error);
+        benchmark::DoNotOptimize(geoJSON);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(json.size()));
+}
+
+BENCHMARK(Parse_GeoJSON_DOM)->Arg(1000)->Arg(10000);
+BENCHMARK(Parse_GeoJSON_Streaming)->Arg(1000)->Arg(10000);
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/map/transform_state.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/style/parser.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/geometry_tile.hpp>
+#include <mbgl/tile/tile_observer.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Measures the latency of parsing a single z10 streets tile with the non-symbol
+// layers of the benchmark style, as a function of the worker pool size.
+class GeometryTileBenchmark {
+public:
+    GeometryTileBenchmark(std::size_t threads)
+        : threadPool(threads) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+        style::Parser parser;
+        parser.parse(util::read_file("benchmark/fixtures/api/style.json"));
+        for (const auto& layer : parser.layers) {
+            // Symbol layers wait on glyphs and images, which we don't provide.
+            if (layer->baseImpl->type != style::LayerType::Symbol) {
+                layers.push_back(layer->baseImpl);
+            }
+        }
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool;
+    TransformState transformState;
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transformState,
+        threadPool,
+        fileSource,
+        MapMode::Static,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0
+    };
+
+    std::vector<Immutable<style::Layer::Impl>> layers;
+    std::shared_ptr<const std::string> data = std::make_shared<std::string>(
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf"));
+};
+
+class LoadedObserver : public TileObserver {
+public:
+    void onTileChanged(Tile&) override { loaded = true; }
+    void onTileError(Tile&, std::exception_ptr) override { loaded = true; }
+
+    bool loaded = false;
+};
+
+} // end namespace
+
+static void Parse_GeometryTile(::benchmark::State& state) {
+    GeometryTileBenchmark bench(state.range(0));
+
+    while (state.KeepRunning()) {
+        LoadedObserver observer;
+        GeometryTile tile(OverscaledTileID(10, 163, 395), "composite", bench.tileParameters);
+        tile.setObserver(&observer);
+        tile.setLayers(bench.layers);
+        tile.setData(std::make_unique<VectorTileData>(bench.data));
+
+        while (!observer.loaded) {
+            bench.loop.runOnce();
+        }
+    }
+}
+
+BENCHMARK(Parse_GeometryTile)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/geometry/polygon_tessellator.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+// The tree has no building-heavy z15/z16 tile, so this uses the densest vector tile in the
+// fixtures instead: its water, landuse and park polygons exercise the same tessellation paths
+// as building footprints, with fewer but larger rings.
+static std::vector<GeometryCollection> loadPolygons() {
+    VectorTileData tile(std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    std::vector<GeometryCollection> polygons;
+    for (const auto& name : tile.layerNames()) {
+        if (auto layer = tile.getLayer(name)) {
+            for (std::size_t i = 0; i < layer->featureCount(); i++) {
+                auto feature = layer->getFeature(i);
+                if (feature->getType() != FeatureType::Polygon) {
+                    continue;
+                }
+                for (auto& polygon : classifyRings(feature->getGeometries())) {
+                    limitHoles(polygon, 500);
+                    polygons.push_back(std::move(polygon));
+                }
+            }
+        }
+    }
+    return polygons;
+}
+
+static void Parse_PolygonTessellator(benchmark::State& state) {
+    const std::vector<GeometryCollection> polygons = loadPolygons();
+    PolygonTessellator tessellator;
+
+    while (state.KeepRunning()) {
+        std::size_t length = 0;
+        for (const auto& polygon : polygons) {
+            length += tessellator(polygon).size();
+        }
+        benchmark::DoNotOptimize(length);
+    }
+
+    state.SetItemsProcessed(state.iterations() * polygons.size());
+}
+
+BENCHMARK(Parse_PolygonTessellator);
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/algorithm/generate_clip_ids_impl.hpp>
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/tile_pyramid.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/network_status.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <array>
+
+using namespace mbgl;
+
+namespace {
+
+// A tile that is renderable as soon as it is created, so that the pyramids settle on
+// their ideal tiles right away.
+class StubTile : public Tile {
+public:
+    StubTile(const OverscaledTileID& id_) : Tile(id_) {
+        renderable = true;
+        loaded = true;
+    }
+
+    void upload(gl::Context&) override {}
+    Bucket* getBucket(const style::Layer::Impl&) const override { return nullptr; }
+};
+
+// Measures a frame's worth of render tile updates and clip ID generation for a pitched
+// camera over three vector sources and a raster source.
+class TilePyramidBenchmark {
+public:
+    TilePyramidBenchmark()
+        : threadPool(1) {
+        NetworkStatus::Set(NetworkStatus::Status::Offline);
+
+        transform.resize({ 1000, 1000 });
+        transform.setLatLngZoom({ 37.7749, -122.4194 }, 15);
+        transform.setPitch(60.0 * util::DEG2RAD);
+    }
+
+    void frame() {
+        for (std::size_t i = 0; i < pyramids.size(); i++) {
+            const bool raster = i == pyramids.size() - 1;
+            pyramids[i].update(layers,
+                               true,
+                               false,
+                               tileParameters,
+                               raster ? style::SourceType::Raster : style::SourceType::Vector,
+                               raster ? util::tileSize : 512,
+                               { 0, raster ? uint8_t(18) : uint8_t(14) },
+                               {},
+                               [](const OverscaledTileID& tileID) { return std::make_unique<StubTile>(tileID); });
+        }
+
+        clipIDGenerator.nextFrame();
+        for (auto& pyramid : pyramids) {
+            // All tiles are used by a layer that needs clipping.
+            for (auto& renderTile : pyramid.renderTiles) {
+                renderTile.used = true;
+                renderTile.needsClipping = true;
+            }
+            clipIDGenerator.update(pyramid.getRenderTiles());
+        }
+        benchmark::DoNotOptimize(clipIDGenerator.getClipIDs());
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource { "benchmark/fixtures/api/cache.db", "." };
+    ThreadPool threadPool;
+    Transform transform;
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transform.getState(),
+        threadPool,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        4,
+        {}
+    };
+
+    std::vector<Immutable<style::Layer::Impl>> layers;
+    std::array<TilePyramid, 4> pyramids;
+    algorithm::ClipIDGenerator clipIDGenerator;
+};
+
+} // end namespace
+
+static void TilePyramid_StaticCamera(::benchmark::State& state) {
+    TilePyramidBenchmark bench;
+    bench.frame();
+
+    while (state.KeepRunning()) {
+        bench.frame();
+    }
+}
+
+static void TilePyramid_PanningCamera(::benchmark::State& state) {
+    TilePyramidBenchmark bench;
+    bench.frame();
+
+    while (state.KeepRunning()) {
+        bench.transform.moveBy({ 4, 0 });
+        bench.frame();
+    }
+}
+
+BENCHMARK(TilePyramid_StaticCamera);
+BENCHMARK(TilePyramid_PanningCamera);
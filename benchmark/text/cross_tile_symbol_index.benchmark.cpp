@@ -0,0 +1,129 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/text/cross_tile_symbol_index.hpp>
+#include <mbgl/renderer/buckets/symbol_bucket.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <cmath>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+SymbolInstance makeSymbolInstance(float x, float y, std::u16string key) {
+    GeometryCoordinates line;
+    GlyphPositionMap gpm;
+    const std::pair<Shaping, Shaping> shaping(Shaping{}, Shaping{});
+    style::SymbolLayoutProperties::Evaluated layout_;
+    IndexedSubfeature subfeature(0, 0, 0, 0);
+    Anchor anchor(x, y, 0, 0);
+    return {anchor, line, shaping, {}, layout_, 0, 0, 0, style::SymbolPlacementType::Point, {{0, 0}}, 0, 0, {{0, 0}}, gpm, subfeature, 0, 0, key, 0 };
+}
+
+// Labels spread over a 4x4 block of z14 tiles around the center of the world, about
+// 400 per tile, with names repeating like road shields and house numbers do.
+std::unique_ptr<SymbolBucket> makeBucket(const CanonicalTileID& tileID, uint32_t bucketInstanceId) {
+    const double origin = (1u << 14) / 2 - 2;
+    const double scale = std::pow(2, tileID.z - 14);
+
+    std::vector<SymbolInstance> instances;
+    for (uint32_t i = 0; i < 6400; i++) {
+        // The position of the label in z14 tile units.
+        const double worldX = origin + ((i * 7919) % 4096) / 1024.0;
+        const double worldY = origin + ((i * 104729) % 4096) / 1024.0;
+        const double x = (worldX * scale - tileID.x) * util::EXTENT;
+        const double y = (worldY * scale - tileID.y) * util::EXTENT;
+        if (x < 0 || y < 0 || x >= util::EXTENT || y >= util::EXTENT) {
+            continue;
+        }
+        const std::string name = "Label " + util::toString(i % 150);
+        instances.push_back(makeSymbolInstance(x, y, std::u16string(name.begin(), name.end())));
+    }
+
+    style::SymbolLayoutProperties::PossiblyEvaluated layout;
+    auto bucket = std::make_unique<SymbolBucket>(layout, std::map<std::string, std::pair<style::IconPaintProperties::PossiblyEvaluated, style::TextPaintProperties::PossiblyEvaluated>>(),
+                                                 16.0f, 1.0f, 0, false, false, false, "test", std::move(instances));
+    bucket->bucketInstanceId = bucketInstanceId;
+    return bucket;
+}
+
+struct ZoomLevel {
+    std::vector<OverscaledTileID> tileIDs;
+    std::vector<std::unique_ptr<SymbolBucket>> buckets;
+    std::unordered_set<uint32_t> bucketInstanceIds;
+};
+
+ZoomLevel makeZoomLevel(uint8_t z, uint32_t& maxBucketInstanceId) {
+    ZoomLevel level;
+    // A 4x4 block of tiles around the center of the world.
+    const uint32_t first = (1u << z) / 2 - 2;
+    for (uint32_t x = first; x < first + 4; x++) {
+        for (uint32_t y = first; y < first + 4; y++) {
+            level.tileIDs.emplace_back(z, 0, z, x, y);
+            level.buckets.push_back(makeBucket(level.tileIDs.back().canonical, ++maxBucketInstanceId));
+            level.bucketInstanceIds.insert(maxBucketInstanceId);
+        }
+    }
+    return level;
+}
+
+void addZoomLevel(CrossTileSymbolLayerIndex& index, ZoomLevel& level, uint32_t& maxCrossTileID) {
+    for (std::size_t i = 0; i < level.buckets.size(); i++) {
+        index.addBucket(level.tileIDs[i], *level.buckets[i], maxCrossTileID);
+    }
+}
+
+} // end namespace
+
+// Zooming in and out: the tiles of one zoom level are added while those of the other
+// one are still indexed, and then the latter are removed.
+static void CrossTileSymbolIndex_zoom(::benchmark::State& state) {
+    uint32_t maxBucketInstanceId = 0;
+    uint32_t maxCrossTileID = 0;
+    ZoomLevel parents = makeZoomLevel(14, maxBucketInstanceId);
+    ZoomLevel children = makeZoomLevel(15, maxBucketInstanceId);
+
+    CrossTileSymbolLayerIndex index;
+    addZoomLevel(index, parents, maxCrossTileID);
+
+    while (state.KeepRunning()) {
+        addZoomLevel(index, children, maxCrossTileID);
+        index.removeStaleBuckets(children.bucketInstanceIds);
+        addZoomLevel(index, parents, maxCrossTileID);
+        index.removeStaleBuckets(parents.bucketInstanceIds);
+    }
+}
+
+// Panning: a column of new tiles is added and the one on the opposite side is removed.
+static void CrossTileSymbolIndex_pan(::benchmark::State& state) {
+    uint32_t maxBucketInstanceId = 0;
+    uint32_t maxCrossTileID = 0;
+    ZoomLevel parents = makeZoomLevel(14, maxBucketInstanceId);
+    ZoomLevel children = makeZoomLevel(15, maxBucketInstanceId);
+
+    CrossTileSymbolLayerIndex index;
+    addZoomLevel(index, parents, maxCrossTileID);
+    addZoomLevel(index, children, maxCrossTileID);
+
+    std::size_t column = 0;
+    while (state.KeepRunning()) {
+        std::unordered_set<uint32_t> current = parents.bucketInstanceIds;
+        for (std::size_t i = 0; i < children.buckets.size(); i++) {
+            if (i / 4 != column) {
+                current.insert(children.buckets[i]->bucketInstanceId);
+            }
+        }
+        // Drop a column of children and bring it back.
+        index.removeStaleBuckets(current);
+        for (std::size_t i = column * 4; i < column * 4 + 4; i++) {
+            index.addBucket(children.tileIDs[i], *children.buckets[i], maxCrossTileID);
+        }
+        column = (column + 1) % 4;
+    }
+}
+
+BENCHMARK(CrossTileSymbolIndex_zoom);
+BENCHMARK(CrossTileSymbolIndex_pan);
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// A 512×512 image in which a quarter of the pixels are opaque.
+UnassociatedImage makeImage() {
+    UnassociatedImage image({ 512, 512 });
+    for (std::size_t i = 0; i < image.size.area(); i++) {
+        image.data[i * 4 + 0] = uint8_t(i);
+        image.data[i * 4 + 1] = uint8_t(i >> 3);
+        image.data[i * 4 + 2] = uint8_t(i >> 6);
+        image.data[i * 4 + 3] = (i / 512) % 4 == 0 ? 255 : uint8_t(i * 7);
+    }
+    return image;
+}
+
+} // namespace
+
+static void Image_premultiply(::benchmark::State& state) {
+    const UnassociatedImage source = makeImage();
+    UnassociatedImage image = source.clone();
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        std::memcpy(image.data.get(), source.data.get(), source.bytes());
+        state.ResumeTiming();
+        util::premultiply(image.data.get(), image.size.area());
+    }
+    state.SetBytesProcessed(state.iterations() * source.bytes());
+}
+
+static void Image_unpremultiply(::benchmark::State& state) {
+    const PremultipliedImage source = util::premultiply(makeImage());
+    PremultipliedImage image = source.clone();
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        std::memcpy(image.data.get(), source.data.get(), source.bytes());
+        state.ResumeTiming();
+        util::unpremultiply(image.data.get(), image.size.area());
+    }
+    state.SetBytesProcessed(state.iterations() * source.bytes());
+}
+
+static void Image_flip(::benchmark::State& state) {
+    PremultipliedImage image({ uint32_t(state.range(0)), uint32_t(state.range(0)) });
+    image.fill(128);
+    while (state.KeepRunning()) {
+        image.flip();
+    }
+    state.SetBytesProcessed(state.iterations() * image.bytes());
+}
+
+static void Image_copy(::benchmark::State& state) {
+    PremultipliedImage src({ 512, 512 });
+    PremultipliedImage dst({ 512, 512 });
+    src.fill(128);
+    const uint32_t width = state.range(0);
+    while (state.KeepRunning()) {
+        PremultipliedImage::copy(src, dst, { 0, 0 }, { 0, 0 }, { width, 512 });
+    }
+    state.SetBytesProcessed(state.iterations() * width * 512 * 4);
+}
+
+BENCHMARK(Image_premultiply);
+BENCHMARK(Image_unpremultiply);
+BENCHMARK(Image_flip)->Arg(256)->Arg(1024);
+BENCHMARK(Image_copy)->Arg(256)->Arg(512);
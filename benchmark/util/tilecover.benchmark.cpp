@@ -34,6 +34,38 @@ static void TileCoverPitchedViewport(benchmark::State& state) {
     }
 }
 
+static TransformState highlyPitchedState() {
+    Transform transform;
+    transform.resize({ 2560, 1440 });
+    transform.setLatLng({ 37.7749, -122.4194 });
+    transform.setZoom(15.5);
+    transform.setAngle(0.3);
+    transform.setPitch(60.0 * M_PI / 180.0);
+    return transform.getState();
+}
+
+static void TileCoverHighlyPitchedViewport(benchmark::State& state) {
+    const TransformState transformState = highlyPitchedState();
+
+    std::size_t length = 0;
+    while (state.KeepRunning()) {
+        auto tiles = util::tileCover(transformState, 15);
+        length += tiles.size();
+    }
+    state.counters["tiles"] = double(length) / state.iterations();
+}
+
+static void TileCoverHighlyPitchedViewportLOD(benchmark::State& state) {
+    const TransformState transformState = highlyPitchedState();
+
+    std::size_t length = 0;
+    while (state.KeepRunning()) {
+        auto tiles = util::tileCoverWithLOD(transformState, 15);
+        length += tiles.size();
+    }
+    state.counters["tiles"] = double(length) / state.iterations();
+}
+
 static void TileCoverBounds(benchmark::State& state) {
     std::size_t length = 0;
     while (state.KeepRunning()) {
@@ -91,6 +123,8 @@ static void TileCountPolygon(benchmark::State& state) {
 BENCHMARK(TileCountBounds);
 BENCHMARK(TileCountPolygon);
 BENCHMARK(TileCoverPitchedViewport);
+BENCHMARK(TileCoverHighlyPitchedViewport);
+BENCHMARK(TileCoverHighlyPitchedViewportLOD);
 BENCHMARK(TileCoverBounds);
 BENCHMARK(TileCoverPolygon);
 
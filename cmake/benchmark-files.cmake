@@ -2,8 +2,10 @@
 
 set(MBGL_BENCHMARK_FILES
     # api
+    benchmark/api/annotations.benchmark.cpp
     benchmark/api/query.benchmark.cpp
     benchmark/api/render.benchmark.cpp
+    benchmark/api/style.benchmark.cpp
 
     # benchmark
     benchmark/include/mbgl/benchmark.hpp
@@ -17,12 +19,23 @@ set(MBGL_BENCHMARK_FILES
     benchmark/function/source_function.benchmark.cpp
 
     # parse
+    benchmark/parse/dem_data.benchmark.cpp
     benchmark/parse/filter.benchmark.cpp
+    benchmark/parse/geojson.benchmark.cpp
+    benchmark/parse/geometry_tile.benchmark.cpp
+    benchmark/parse/polygon_tessellator.benchmark.cpp
     benchmark/parse/tile_mask.benchmark.cpp
     benchmark/parse/vector_tile.benchmark.cpp
 
+    # renderer
+    benchmark/renderer/tile_pyramid.benchmark.cpp
+
+    # text
+    benchmark/text/cross_tile_symbol_index.benchmark.cpp
+
     # util
     benchmark/util/dtoa.benchmark.cpp
+    benchmark/util/image.benchmark.cpp
     benchmark/util/tilecover.benchmark.cpp
 
 )
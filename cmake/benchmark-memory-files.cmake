@@ -0,0 +1,11 @@
+# This file is generated. Do not edit. Regenerate this with scripts/generate-cmake-files.js
+
+set(MBGL_BENCHMARK_MEMORY_FILES
+    # memory
+    benchmark/memory/allocation_counter.cpp
+    benchmark/memory/allocation_counter.hpp
+    benchmark/memory/geojson.benchmark.cpp
+    benchmark/memory/placement.benchmark.cpp
+    benchmark/memory/query.benchmark.cpp
+
+)
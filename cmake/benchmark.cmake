@@ -20,8 +20,6 @@ target_add_mason_package(mbgl-benchmark PRIVATE rapidjson)
 target_add_mason_package(mbgl-benchmark PRIVATE protozero)
 target_add_mason_package(mbgl-benchmark PRIVATE vector-tile)
 
-mbgl_platform_benchmark()
-
 create_source_groups(mbgl-benchmark)
 
 set_target_properties(mbgl-benchmark PROPERTIES FOLDER "Executables")
@@ -34,3 +32,37 @@ xcode_create_scheme(
         "--benchmark_filter=Category.*"
         "--benchmark_repetitions=1"
 )
+
+# Benchmarks that replace the global allocator to measure memory use. They are kept out
+# of mbgl-benchmark, where the replacement would slow down every other benchmark.
+add_executable(mbgl-benchmark-memory
+    ${MBGL_BENCHMARK_MEMORY_FILES}
+    benchmark/include/mbgl/benchmark.hpp
+    benchmark/src/mbgl/benchmark/benchmark.cpp
+)
+
+target_include_directories(mbgl-benchmark-memory
+    PRIVATE src
+    PRIVATE benchmark/include
+    PRIVATE benchmark/src
+    PRIVATE platform/default
+)
+
+target_link_libraries(mbgl-benchmark-memory
+    PRIVATE mbgl-core
+)
+
+target_add_mason_package(mbgl-benchmark-memory PRIVATE boost)
+target_add_mason_package(mbgl-benchmark-memory PRIVATE benchmark)
+target_add_mason_package(mbgl-benchmark-memory PRIVATE geojson)
+target_add_mason_package(mbgl-benchmark-memory PRIVATE rapidjson)
+target_add_mason_package(mbgl-benchmark-memory PRIVATE protozero)
+target_add_mason_package(mbgl-benchmark-memory PRIVATE vector-tile)
+
+create_source_groups(mbgl-benchmark-memory)
+
+set_target_properties(mbgl-benchmark-memory PROPERTIES FOLDER "Executables")
+
+initialize_xcode_cxx_build_settings(mbgl-benchmark-memory)
+
+mbgl_platform_benchmark()
@@ -52,6 +52,10 @@ set(MBGL_CORE_FILES
     src/mbgl/geometry/feature_index.hpp
     src/mbgl/geometry/line_atlas.cpp
     src/mbgl/geometry/line_atlas.hpp
+    src/mbgl/geometry/line_simplifier.cpp
+    src/mbgl/geometry/line_simplifier.hpp
+    src/mbgl/geometry/polygon_tessellator.cpp
+    src/mbgl/geometry/polygon_tessellator.hpp
 
     # gl
     src/mbgl/gl/attribute.cpp
@@ -70,11 +74,14 @@ set(MBGL_CORE_FILES
     src/mbgl/gl/extension.hpp
     src/mbgl/gl/features.hpp
     src/mbgl/gl/framebuffer.hpp
+    src/mbgl/gl/framebuffer_reader.cpp
+    src/mbgl/gl/framebuffer_reader.hpp
     src/mbgl/gl/gl.cpp
     src/mbgl/gl/gl.hpp
     src/mbgl/gl/index_buffer.hpp
     src/mbgl/gl/object.cpp
     src/mbgl/gl/object.hpp
+    src/mbgl/gl/pixel_buffer_extension.hpp
     src/mbgl/gl/primitives.hpp
     src/mbgl/gl/program.hpp
     src/mbgl/gl/program_binary_extension.hpp
@@ -83,6 +90,7 @@ set(MBGL_CORE_FILES
     src/mbgl/gl/stencil_mode.cpp
     src/mbgl/gl/stencil_mode.hpp
     src/mbgl/gl/texture.hpp
+    src/mbgl/gl/timer_query_extension.hpp
     src/mbgl/gl/types.hpp
     src/mbgl/gl/uniform.cpp
     src/mbgl/gl/uniform.hpp
@@ -171,7 +179,9 @@ set(MBGL_CORE_FILES
 
     # renderer
     include/mbgl/renderer/backend_scope.hpp
+    include/mbgl/renderer/frame_profile.hpp
     include/mbgl/renderer/mode.hpp
+    include/mbgl/renderer/prefetch_statistics.hpp
     include/mbgl/renderer/query.hpp
     include/mbgl/renderer/renderer.hpp
     include/mbgl/renderer/renderer_backend.hpp
@@ -184,6 +194,9 @@ set(MBGL_CORE_FILES
     src/mbgl/renderer/cross_faded_property_evaluator.cpp
     src/mbgl/renderer/cross_faded_property_evaluator.hpp
     src/mbgl/renderer/data_driven_property_evaluator.hpp
+    src/mbgl/renderer/frame_profile.cpp
+    src/mbgl/renderer/frame_profiler.cpp
+    src/mbgl/renderer/frame_profiler.hpp
     src/mbgl/renderer/group_by_layout.cpp
     src/mbgl/renderer/group_by_layout.hpp
     src/mbgl/renderer/image_atlas.cpp
@@ -285,6 +298,8 @@ set(MBGL_CORE_FILES
     src/mbgl/shaders/background_pattern.hpp
     src/mbgl/shaders/circle.cpp
     src/mbgl/shaders/circle.hpp
+    src/mbgl/shaders/circle_point.cpp
+    src/mbgl/shaders/circle_point.hpp
     src/mbgl/shaders/clipping_mask.cpp
     src/mbgl/shaders/clipping_mask.hpp
     src/mbgl/shaders/collision_box.cpp
@@ -309,6 +324,8 @@ set(MBGL_CORE_FILES
     src/mbgl/shaders/fill_pattern.hpp
     src/mbgl/shaders/heatmap.cpp
     src/mbgl/shaders/heatmap.hpp
+    src/mbgl/shaders/heatmap_point.cpp
+    src/mbgl/shaders/heatmap_point.hpp
     src/mbgl/shaders/heatmap_texture.cpp
     src/mbgl/shaders/heatmap_texture.hpp
     src/mbgl/shaders/hillshade.cpp
@@ -377,6 +394,7 @@ set(MBGL_CORE_FILES
     include/mbgl/style/types.hpp
     include/mbgl/style/undefined.hpp
     src/mbgl/style/collection.hpp
+    src/mbgl/style/collection_journal.hpp
     src/mbgl/style/custom_tile_loader.cpp
     src/mbgl/style/custom_tile_loader.hpp
     src/mbgl/style/filter.cpp
@@ -396,6 +414,8 @@ set(MBGL_CORE_FILES
     src/mbgl/style/paint_property.hpp
     src/mbgl/style/parser.cpp
     src/mbgl/style/parser.hpp
+    src/mbgl/style/parser_cache.cpp
+    src/mbgl/style/parser_cache.hpp
     src/mbgl/style/properties.hpp
     src/mbgl/style/rapidjson_conversion.hpp
     src/mbgl/style/source.cpp
@@ -720,6 +740,9 @@ set(MBGL_CORE_FILES
     src/mbgl/util/http_timeout.hpp
     src/mbgl/util/i18n.cpp
     src/mbgl/util/i18n.hpp
+    src/mbgl/util/image.cpp
+    src/mbgl/util/image_pool.cpp
+    src/mbgl/util/image_pool.hpp
     src/mbgl/util/interpolate.cpp
     src/mbgl/util/intersection_tests.cpp
     src/mbgl/util/intersection_tests.hpp
@@ -738,6 +761,8 @@ set(MBGL_CORE_FILES
     src/mbgl/util/math.hpp
     src/mbgl/util/offscreen_texture.cpp
     src/mbgl/util/offscreen_texture.hpp
+    src/mbgl/util/parallel_for.cpp
+    src/mbgl/util/parallel_for.hpp
     src/mbgl/util/premultiply.cpp
     src/mbgl/util/rapidjson.hpp
     src/mbgl/util/rect.hpp
@@ -745,6 +770,8 @@ set(MBGL_CORE_FILES
     src/mbgl/util/stopwatch.cpp
     src/mbgl/util/stopwatch.hpp
     src/mbgl/util/string.cpp
+    src/mbgl/util/string_indexer.cpp
+    src/mbgl/util/string_indexer.hpp
     src/mbgl/util/thread_local.hpp
     src/mbgl/util/tile_coordinate.hpp
     src/mbgl/util/tile_cover.cpp
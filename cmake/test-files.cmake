@@ -23,6 +23,8 @@ set(MBGL_TEST_FILES
     # geometry
     test/geometry/dem_data.test.cpp
     test/geometry/line_atlas.test.cpp
+    test/geometry/line_simplifier.test.cpp
+    test/geometry/polygon_tessellator.test.cpp
 
     # gl
     test/gl/bucket.test.cpp
@@ -32,6 +34,7 @@ set(MBGL_TEST_FILES
     # map
     test/map/map.test.cpp
     test/map/prefetch.test.cpp
+    test/map/snapshot_pool.test.cpp
     test/map/transform.test.cpp
 
     # math
@@ -45,8 +48,12 @@ set(MBGL_TEST_FILES
 
     # renderer
     test/renderer/backend_scope.test.cpp
+    test/renderer/frame_profiler.test.cpp
     test/renderer/group_by_layout.test.cpp
+    test/renderer/hillshade_prepare.test.cpp
     test/renderer/image_manager.test.cpp
+    test/renderer/style_diff.test.cpp
+    test/renderer/tile_pyramid.test.cpp
 
     # sprite
     test/sprite/sprite_loader.test.cpp
@@ -77,6 +84,7 @@ set(MBGL_TEST_FILES
 
     # style/conversion
     test/style/conversion/function.test.cpp
+    test/style/conversion/geojson.test.cpp
     test/style/conversion/geojson_options.test.cpp
     test/style/conversion/layer.test.cpp
     test/style/conversion/light.test.cpp
@@ -116,6 +124,7 @@ set(MBGL_TEST_FILES
     test/text/quads.test.cpp
 
     # tile
+    test/tile/annotation_tile.test.cpp
     test/tile/custom_geometry_tile.test.cpp
     test/tile/geojson_tile.test.cpp
     test/tile/geometry_tile_data.test.cpp
@@ -137,9 +146,11 @@ set(MBGL_TEST_FILES
     test/util/merge_lines.test.cpp
     test/util/number_conversions.test.cpp
     test/util/offscreen_texture.test.cpp
+    test/util/parallel_for.test.cpp
     test/util/position.test.cpp
     test/util/projection.test.cpp
     test/util/run_loop.test.cpp
+    test/util/string_indexer.test.cpp
     test/util/text_conversions.test.cpp
     test/util/thread.test.cpp
     test/util/thread_local.test.cpp
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+/**
+ * Work submitted to the GPU during a frame or a part of it.
+ */
+class FrameCounters {
+public:
+    uint64_t drawCalls = 0;
+    // Number of vertices referenced by the draw calls, i.e. the index count.
+    uint64_t vertices = 0;
+    // Bytes of buffer and texture data uploaded.
+    uint64_t uploadBytes = 0;
+
+    // Draw calls that used a different program or different textures than the
+    // previous one, and uniform values that had to be uploaded.
+    uint64_t programSwitches = 0;
+    uint64_t textureSwitches = 0;
+    uint64_t uniformUploads = 0;
+
+    // Vertices of the drawn line geometry before and after line simplification.
+    uint64_t lineSourceVertices = 0;
+    uint64_t lineSimplifiedVertices = 0;
+};
+
+/**
+ * Timings of a single rendered frame, collected while frame profiling is enabled
+ * on the Renderer.
+ */
+class FrameProfile {
+public:
+    class Section {
+    public:
+        // The name of a render phase such as "upload" or "opaque", or a layer ID.
+        std::string name;
+
+        // For layers, the phase the layer was rendered in; empty for phases.
+        std::string phase;
+
+        // CPU time, relative to the start of the frame.
+        Duration begin;
+        Duration cpuTime;
+
+        // GPU time, relative to the GPU start of the frame. Only set when the
+        // context supports timer queries and the measurement wasn't invalidated.
+        optional<Duration> gpuBegin;
+        optional<Duration> gpuTime;
+
+        FrameCounters counters;
+    };
+
+    uint64_t frame = 0;
+    TimePoint start;
+
+    Duration cpuTime;
+    optional<Duration> gpuTime;
+
+    FrameCounters counters;
+
+    // Phases and layers in the order they were started.
+    std::vector<Section> sections;
+};
+
+/**
+ * Encodes the profiles as Trace Event Format JSON, as read by chrome://tracing
+ * and similar tools. CPU sections are reported on thread 0, GPU sections on
+ * thread 1.
+ */
+std::string encodeTraceEvents(const std::vector<FrameProfile>&);
+
+} // namespace mbgl
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace mbgl {
+
+/**
+ * Tiles requested ahead of the camera, for the positions along the animation it is
+ * following or where a pan gesture is heading.
+ */
+class PrefetchStatistics {
+public:
+    // Tiles that were requested for a predicted camera position.
+    uint64_t requested = 0;
+    // Prefetched tiles that were rendered later on.
+    uint64_t used = 0;
+    // Prefetched tiles that were dropped before being rendered, because the camera
+    // went elsewhere. Their pending requests are cancelled.
+    uint64_t discarded = 0;
+
+    // The fraction of prefetched tiles that were used, out of those that were either
+    // used or discarded.
+    double hitRate() const {
+        const uint64_t settled = used + discarded;
+        return settled ? double(used) / settled : 0;
+    }
+
+    PrefetchStatistics& operator+=(const PrefetchStatistics& other) {
+        requested += other.requested;
+        used += other.used;
+        discarded += other.discarded;
+        return *this;
+    }
+};
+
+} // namespace mbgl
@@ -2,6 +2,8 @@
 
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/renderer/mode.hpp>
+#include <mbgl/renderer/frame_profile.hpp>
+#include <mbgl/renderer/prefetch_statistics.hpp>
 #include <mbgl/annotation/annotation.hpp>
 #include <mbgl/util/geo.hpp>
 #include <mbgl/util/geo.hpp>
@@ -40,6 +42,12 @@ public:
     std::vector<Feature> queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions& options = {}) const;
+
+    // Batched feature queries, which spread their work over the scheduler. Return one
+    // list of features per geometry or source, in the order they were given.
+    std::vector<std::vector<Feature>> queryRenderedFeatures(const std::vector<ScreenLineString>&, const RenderedQueryOptions& options = {}) const;
+    std::vector<std::vector<Feature>> querySourceFeatures(const std::vector<std::string>& sourceIDs, const SourceQueryOptions& options = {}) const;
+
     AnnotationIDs queryPointAnnotations(const ScreenBox& box) const;
     AnnotationIDs queryShapeAnnotations(const ScreenBox& box) const;
     AnnotationIDs getAnnotationIDs(const std::vector<Feature>&) const;
@@ -47,6 +55,14 @@ public:
     // Debug
     void dumpDebugLogs();
 
+    // Profiling. While enabled, the observer receives a FrameProfile for every
+    // rendered frame, and the most recent ones are kept for inspection.
+    void setFrameProfiling(bool);
+    std::vector<FrameProfile> getRecentFrameProfiles() const;
+
+    // Totals of the tiles prefetched by all sources since the renderer was created.
+    PrefetchStatistics getPrefetchStatistics() const;
+
     // Memory
     void reduceMemoryUse();
 
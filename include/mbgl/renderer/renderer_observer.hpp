@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mbgl/renderer/frame_profile.hpp>
+
 #include <exception>
 
 namespace mbgl {
@@ -30,6 +32,10 @@ public:
 
     // Final frame
     virtual void onDidFinishRenderingMap() {}
+
+    // Timings of a frame rendered with frame profiling enabled. GPU timings are
+    // read back asynchronously, so this may arrive a few frames later.
+    virtual void onDidFinishFrameProfile(const FrameProfile&) {}
 };
 
 } // namespace mbgl
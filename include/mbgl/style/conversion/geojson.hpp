@@ -8,6 +8,7 @@ namespace style {
 namespace conversion {
 
 // Workaround until https://github.com/mapbox/mapbox-gl-native/issues/5623 is done.
+// Converts the document while it is being read, without building a JSON DOM first.
 optional<GeoJSON> parseGeoJSON(const std::string&, Error&);
 
 template <>
@@ -8,6 +8,10 @@
 #include <mbgl/style/expression/find_zoom_curve.hpp>
 #include <mbgl/util/range.hpp>
 
+#include <array>
+#include <memory>
+#include <mutex>
+
 namespace mbgl {
 namespace style {
 
@@ -18,21 +22,49 @@ public:
     PropertyExpression(std::unique_ptr<expression::Expression> expression_, optional<T> defaultValue_ = {})
         : expression(std::move(expression_)),
           defaultValue(std::move(defaultValue_)),
-          zoomCurve(expression::findZoomCurveChecked(expression.get())) {
+          zoomCurve(expression::findZoomCurveChecked(expression.get())),
+          zoomConstant(expression::isZoomConstant(*expression)),
+          featureConstant(expression::isFeatureConstant(*expression)) {
+        if (!zoomConstant && featureConstant) {
+            cache = std::make_shared<ZoomCache>();
+        }
     }
 
-    bool isZoomConstant() const { return expression::isZoomConstant(*expression); }
-    bool isFeatureConstant() const { return expression::isFeatureConstant(*expression); }
+    bool isZoomConstant() const { return zoomConstant; }
+    bool isFeatureConstant() const { return featureConstant; }
 
     T evaluate(float zoom) const {
-        assert(!expression::isZoomConstant(*expression));
-        assert(expression::isFeatureConstant(*expression));
-        const expression::EvaluationResult result = expression->evaluate(expression::EvaluationContext(zoom, nullptr));
-        if (result) {
-            const optional<T> typed = expression::fromExpressionValue<T>(*result);
-            return typed ? *typed : defaultValue ? *defaultValue : T();
+        assert(!zoomConstant);
+        assert(featureConstant);
+
+        // The output of a step curve is the same for every zoom between two stops.
+        const double key = zoomCurve.match(
+            [&](const expression::Step* step) -> double {
+                return step->getCoveringStops(zoom, zoom).min;
+            },
+            [&](const auto&) -> double {
+                return zoom;
+            }
+        );
+
+        if (cache) {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            for (const auto& entry : cache->entries) {
+                if (entry.second && entry.first == key) {
+                    return *entry.second;
+                }
+            }
         }
-        return defaultValue ? *defaultValue : T();
+
+        T value = evaluateUncached(zoom);
+
+        if (cache) {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            cache->entries[cache->next] = { key, value };
+            cache->next = (cache->next + 1) % cache->entries.size();
+        }
+
+        return value;
     }
 
     template <class Feature>
@@ -108,9 +140,32 @@ public:
     }
 
 private:
+    T evaluateUncached(float zoom) const {
+        const expression::EvaluationResult result = expression->evaluate(expression::EvaluationContext(zoom, nullptr));
+        if (result) {
+            const optional<T> typed = expression::fromExpressionValue<T>(*result);
+            return typed ? *typed : defaultValue ? *defaultValue : T();
+        }
+        return defaultValue ? *defaultValue : T();
+    }
+
+    // The most recent results of camera expressions, keyed by zoom. Evaluators ask for the
+    // same zooms repeatedly, e.g. for cross-faded properties, with integer zoom, and for
+    // every frame of a transition. Shared by copies of the expression, which may be
+    // evaluated on several threads.
+    class ZoomCache {
+    public:
+        std::mutex mutex;
+        std::array<std::pair<double, optional<T>>, 4> entries;
+        std::size_t next = 0;
+    };
+
     std::shared_ptr<const expression::Expression> expression;
     optional<T> defaultValue;
     variant<std::nullptr_t, const expression::Interpolate*, const expression::Step*> zoomCurve;
+    bool zoomConstant;
+    bool featureConstant;
+    std::shared_ptr<ZoomCache> cache;
 };
 
 } // namespace style
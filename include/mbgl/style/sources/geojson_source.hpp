@@ -23,6 +23,16 @@ struct GeoJSONOptions {
     bool cluster = false;
     uint16_t clusterRadius = 50;
     uint8_t clusterMaxZoom = 17;
+
+    // Point cloud options
+    // When set, a collection of point features is indexed once along a Hilbert curve,
+    // and tiles are cut from contiguous ranges of that index instead of being tiled
+    // with GeoJSON-VT. Intended for very large point sets drawn with circle or heatmap
+    // layers, which then draw each point as a single point sprite. Sprites always face
+    // the viewport, so "circle-pitch-alignment": "map" has no effect, and sprites larger
+    // than the largest point size supported by the GPU are clamped to it. Other data,
+    // and clustered sources, fall back to GeoJSON-VT.
+    bool pointCloud = false;
 };
 
 class GeoJSONSource : public Source {
@@ -18,6 +18,12 @@ public:
     const variant<std::string, Tileset>& getURLOrTileset() const;
     optional<std::string> getURL() const;
 
+    // Tolerance, in pixels at the tile's (possibly overscaled) zoom level, for simplifying
+    // line geometry before line layers are built. Vertices that are closer than this to the
+    // simplified line are dropped. Defaults to 0, which disables simplification.
+    void setLineSimplificationTolerance(float);
+    float getLineSimplificationTolerance() const;
+
     class Impl;
     const Impl& impl() const;
 
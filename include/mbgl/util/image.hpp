@@ -8,9 +8,17 @@
 #include <cstring>
 #include <memory>
 #include <algorithm>
+#include <functional>
 
 namespace mbgl {
 
+namespace util {
+
+// Reverses the order of `rows` rows of `stride` bytes each, in place.
+void flipRows(uint8_t* data, std::size_t stride, std::size_t rows);
+
+} // namespace util
+
 enum class ImageAlphaMode {
     Unassociated,
     Premultiplied,
@@ -79,6 +87,11 @@ public:
         std::fill(data.get(), data.get() + bytes(), value);
     }
 
+    // Mirrors the image vertically, in place.
+    void flip() {
+        util::flipRows(data.get(), stride(), size.height);
+    }
+
     void resize(Size size_) {
         if (size == size_) {
             return;
@@ -152,6 +165,13 @@ public:
 
         assert(srcData != dstData);
 
+        // Rows spanning both images are contiguous and copied at once.
+        if (size.width == srcImg.size.width && size.width == dstImg.size.width) {
+            std::memcpy(dstData + dstPt.y * dstImg.stride(), srcData + srcPt.y * srcImg.stride(),
+                        size.height * srcImg.stride());
+            return;
+        }
+
         for (uint32_t y = 0; y < size.height; y++) {
             const std::size_t srcOffset = (srcPt.y + y) * srcImg.stride() + srcPt.x * channels;
             const std::size_t dstOffset = (dstPt.y + y) * dstImg.stride() + dstPt.x * channels;
@@ -170,8 +190,46 @@ using UnassociatedImage = Image<ImageAlphaMode::Unassociated>;
 using PremultipliedImage = Image<ImageAlphaMode::Premultiplied>;
 using AlphaImage = Image<ImageAlphaMode::Exclusive>;
 
+enum class ImageEncoding : uint8_t {
+    PNG,
+    JPEG,
+    WebP
+};
+
+class ImageEncoderOptions {
+public:
+    ImageEncoding encoding = ImageEncoding::PNG;
+
+    // From 0 (fastest) to 9 (smallest output).
+    uint8_t effort = 6;
+
+    // From 0 to 100. Only used by lossy encodings.
+    uint8_t quality = 90;
+
+    // PNG only: reduces the image to at most 256 colors and stores it with a palette.
+    // Images that have no more colors than that are stored losslessly.
+    bool palette = false;
+};
+
+// Receives the encoded image in consecutive pieces, as the encoder produces them.
+using ImageEncoderSink = std::function<void (const char* data, std::size_t length)>;
+
 // TODO: don't use std::string for binary data.
 PremultipliedImage decodeImage(const std::string&);
+// Fast, unfiltered PNG. Use encodeImage with a higher effort for smaller files.
 std::string encodePNG(const PremultipliedImage&);
 
+// Encodes the image, streaming the output into the sink. Throws if the encoding isn't
+// supported on this platform:
+//
+// - Linux: PNG, JPEG and WebP, all streamed, with every option applied.
+// - macOS and iOS: PNG is streamed. JPEG goes through ImageIO, which ignores `effort` and
+//   delivers the file in one piece. WebP throws.
+// - Android: PNG only.
+// - Qt: all encodings go through QImageWriter and are delivered in one piece. WebP needs
+//   Qt's WebP image plugin. The PNG palette is Qt's own Indexed8 conversion, which may
+//   dither images with more than 256 colors.
+void encodeImage(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+std::string encodeImage(const PremultipliedImage&, const ImageEncoderOptions&);
+
 } // namespace mbgl
@@ -8,5 +8,9 @@ namespace util {
 PremultipliedImage premultiply(UnassociatedImage&&);
 UnassociatedImage unpremultiply(PremultipliedImage&&);
 
+// Convert tightly packed RGBA pixels in place, using vector instructions where available.
+void premultiply(uint8_t* data, std::size_t pixels);
+void unpremultiply(uint8_t* data, std::size_t pixels);
+
 } // namespace util
 } // namespace mbgl
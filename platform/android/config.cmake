@@ -72,6 +72,8 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/mbgl/gl/headless_frontend.hpp
         PRIVATE platform/default/mbgl/map/map_snapshotter.cpp
         PRIVATE platform/default/mbgl/map/map_snapshotter.hpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.cpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.hpp
         PRIVATE platform/linux/src/headless_backend_egl.cpp
     )
 
@@ -49,6 +49,10 @@ public:
         delegate.invoke(&RendererObserver::onDidFinishRenderingMap);
     }
 
+    void onDidFinishFrameProfile(const FrameProfile& profile) override {
+        delegate.invoke(&RendererObserver::onDidFinishFrameProfile, profile);
+    }
+
 private:
     std::shared_ptr<Mailbox> mailbox;
     ActorRef<RendererObserver> delegate;
@@ -8,6 +8,8 @@
 
 namespace mbgl {
 
+void encodePNG(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+
 PremultipliedImage decodeImage(const std::string& string) {
     auto env{ android::AttachEnv() };
 
@@ -24,4 +26,11 @@ PremultipliedImage decodeImage(const std::string& string) {
     return image;
 }
 
+void encodeImage(const PremultipliedImage& image, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    if (options.encoding != ImageEncoding::PNG) {
+        throw std::runtime_error("unsupported image encoding");
+    }
+    encodePNG(image, options, sink);
+}
+
 } // namespace mbgl
@@ -10,6 +10,10 @@ using CGImageSourceHandle = CFHandle<CGImageSourceRef, CFTypeRef, CFRelease>;
 using CGDataProviderHandle = CFHandle<CGDataProviderRef, CGDataProviderRef, CGDataProviderRelease>;
 using CGColorSpaceHandle = CFHandle<CGColorSpaceRef, CGColorSpaceRef, CGColorSpaceRelease>;
 using CGContextHandle = CFHandle<CGContextRef, CGContextRef, CGContextRelease>;
+using CFMutableDataHandle = CFHandle<CFMutableDataRef, CFTypeRef, CFRelease>;
+using CFDictionaryHandle = CFHandle<CFDictionaryRef, CFTypeRef, CFRelease>;
+using CFNumberHandle = CFHandle<CFNumberRef, CFTypeRef, CFRelease>;
+using CGImageDestinationHandle = CFHandle<CGImageDestinationRef, CFTypeRef, CFRelease>;
 
 CGImageRef CGImageCreateWithMGLPremultipliedImage(mbgl::PremultipliedImage&& src) {
     // We're converting the PremultipliedImage's backing store to a CGDataProvider, and are taking
@@ -71,6 +75,8 @@ mbgl::PremultipliedImage MGLPremultipliedImageFromCGImage(CGImageRef src) {
 
 namespace mbgl {
 
+void encodePNG(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+
 PremultipliedImage decodeImage(const std::string& source) {
     CFDataHandle data(CFDataCreateWithBytesNoCopy(
         kCFAllocatorDefault, reinterpret_cast<const unsigned char*>(source.data()), source.size(),
@@ -92,4 +98,51 @@ PremultipliedImage decodeImage(const std::string& source) {
     return MGLPremultipliedImageFromCGImage(*image);
 }
 
+// PNGs go through the streaming encoder. JPEGs are encoded with ImageIO, which
+// doesn't stream, so the sink receives the whole file at once.
+void encodeImage(const PremultipliedImage& image, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    if (options.encoding == ImageEncoding::PNG) {
+        return encodePNG(image, options, sink);
+    } else if (options.encoding != ImageEncoding::JPEG) {
+        throw std::runtime_error("unsupported image encoding");
+    }
+
+    CGImageHandle cgImage(CGImageCreateWithMGLPremultipliedImage(image.clone()));
+    if (!cgImage) {
+        throw std::runtime_error("CGImageCreateWithMGLPremultipliedImage failed");
+    }
+
+    CFMutableDataHandle data(CFDataCreateMutable(kCFAllocatorDefault, 0));
+    if (!data) {
+        throw std::runtime_error("CFDataCreateMutable failed");
+    }
+
+    CGImageDestinationHandle destination(
+        CGImageDestinationCreateWithData(*data, CFSTR("public.jpeg"), 1, NULL));
+    if (!destination) {
+        throw std::runtime_error("CGImageDestinationCreateWithData failed");
+    }
+
+    const float quality = std::min<float>(options.quality, 100) / 100.0f;
+    CFNumberHandle qualityNumber(CFNumberCreate(kCFAllocatorDefault, kCFNumberFloatType, &quality));
+    if (!qualityNumber) {
+        throw std::runtime_error("CFNumberCreate failed");
+    }
+    const void* keys[] = { kCGImageDestinationLossyCompressionQuality };
+    const void* values[] = { *qualityNumber };
+    CFDictionaryHandle properties(CFDictionaryCreate(kCFAllocatorDefault, keys, values, 1,
+                                                     &kCFTypeDictionaryKeyCallBacks,
+                                                     &kCFTypeDictionaryValueCallBacks));
+    if (!properties) {
+        throw std::runtime_error("CFDictionaryCreate failed");
+    }
+
+    CGImageDestinationAddImage(*destination, *cgImage, *properties);
+    if (!CGImageDestinationFinalize(*destination)) {
+        throw std::runtime_error("CGImageDestinationFinalize failed");
+    }
+
+    sink(reinterpret_cast<const char*>(CFDataGetBytePtr(*data)), CFDataGetLength(*data));
+}
+
 } // namespace mbgl
@@ -11,6 +11,13 @@ PremultipliedImage decodeWebP(const uint8_t*, size_t);
 PremultipliedImage decodePNG(const uint8_t*, size_t);
 PremultipliedImage decodeJPEG(const uint8_t*, size_t);
 
+#if !defined(__ANDROID__) && !defined(__APPLE__)
+void encodeWebP(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+#endif // !defined(__ANDROID__) && !defined(__APPLE__)
+
+void encodePNG(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+void encodeJPEG(const PremultipliedImage&, const ImageEncoderOptions&, const ImageEncoderSink&);
+
 PremultipliedImage decodeImage(const std::string& string) {
     const auto* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
@@ -42,4 +49,21 @@ PremultipliedImage decodeImage(const std::string& string) {
     throw std::runtime_error("unsupported image type");
 }
 
+void encodeImage(const PremultipliedImage& image, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    switch (options.encoding) {
+    case ImageEncoding::PNG:
+        return encodePNG(image, options, sink);
+    case ImageEncoding::JPEG:
+        return encodeJPEG(image, options, sink);
+    case ImageEncoding::WebP:
+#if !defined(__ANDROID__) && !defined(__APPLE__)
+        return encodeWebP(image, options, sink);
+#else
+        break;
+#endif // !defined(__ANDROID__) && !defined(__APPLE__)
+    }
+
+    throw std::runtime_error("unsupported image encoding");
+}
+
 } // namespace mbgl
@@ -1,5 +1,6 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/char_array_buffer.hpp>
+#include <mbgl/util/image_pool.hpp>
 
 #include <istream>
 #include <sstream>
@@ -106,6 +107,13 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     if (ret != JPEG_HEADER_OK)
         throw std::runtime_error("JPEG Reader: failed to read header");
 
+#if defined(JCS_EXTENSIONS)
+    // libjpeg-turbo can convert color images straight into the RGBA rows of the image.
+    if (cinfo.out_color_space == JCS_RGB) {
+        cinfo.out_color_space = JCS_EXT_RGBA;
+    }
+#endif
+
     jpeg_start_decompress(&cinfo);
 
     if (cinfo.out_color_space == JCS_UNKNOWN)
@@ -119,9 +127,20 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     size_t components = cinfo.output_components;
     size_t rowStride = components * width;
 
-    PremultipliedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    auto image = util::ImagePool::acquire<PremultipliedImage>({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
     uint8_t* dst = image.data.get();
 
+#if defined(JCS_EXTENSIONS)
+    if (cinfo.out_color_space == JCS_EXT_RGBA) {
+        while (cinfo.output_scanline < cinfo.output_height) {
+            JSAMPROW row = dst + cinfo.output_scanline * rowStride;
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+        jpeg_finish_decompress(&cinfo);
+        return image;
+    }
+#endif
+
     JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, rowStride, 1);
 
     while (cinfo.output_scanline < cinfo.output_height) {
@@ -0,0 +1,105 @@
+#include <mbgl/util/image.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+extern "C"
+{
+#include <jpeglib.h>
+}
+
+namespace mbgl {
+
+const static unsigned BUF_SIZE = 16384;
+
+struct jpeg_sink_wrapper {
+    jpeg_destination_mgr manager;
+    const ImageEncoderSink* sink;
+    std::array<JOCTET, BUF_SIZE> buffer;
+};
+
+static void init_destination(j_compress_ptr cinfo) {
+    auto* wrap = reinterpret_cast<jpeg_sink_wrapper*>(cinfo->dest);
+    wrap->manager.next_output_byte = wrap->buffer.data();
+    wrap->manager.free_in_buffer = BUF_SIZE;
+}
+
+static boolean empty_output_buffer(j_compress_ptr cinfo) {
+    auto* wrap = reinterpret_cast<jpeg_sink_wrapper*>(cinfo->dest);
+    (*wrap->sink)(reinterpret_cast<const char*>(wrap->buffer.data()), BUF_SIZE);
+    wrap->manager.next_output_byte = wrap->buffer.data();
+    wrap->manager.free_in_buffer = BUF_SIZE;
+    return TRUE;
+}
+
+static void term_destination(j_compress_ptr cinfo) {
+    auto* wrap = reinterpret_cast<jpeg_sink_wrapper*>(cinfo->dest);
+    (*wrap->sink)(reinterpret_cast<const char*>(wrap->buffer.data()), BUF_SIZE - wrap->manager.free_in_buffer);
+}
+
+static void on_error_exit(j_common_ptr cinfo) {
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, buffer);
+    throw std::runtime_error(std::string("JPEG Writer: libjpeg could not write image: ") + buffer);
+}
+
+struct jpeg_compress_guard {
+    jpeg_compress_guard(jpeg_compress_struct* cinfo)
+        : i_(cinfo) {}
+
+    ~jpeg_compress_guard() {
+        jpeg_destroy_compress(i_);
+    }
+
+    jpeg_compress_struct* i_;
+};
+
+// JPEG has no alpha channel. Dropping the alpha of premultiplied pixels composites
+// the image over black.
+void encodeJPEG(const PremultipliedImage& image, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jerr.error_exit = on_error_exit;
+    jpeg_create_compress(&cinfo);
+    jpeg_compress_guard guard(&cinfo);
+
+    jpeg_sink_wrapper wrapper;
+    wrapper.manager.init_destination = init_destination;
+    wrapper.manager.empty_output_buffer = empty_output_buffer;
+    wrapper.manager.term_destination = term_destination;
+    wrapper.sink = &sink;
+    cinfo.dest = &wrapper.manager;
+
+    cinfo.image_width = image.size.width;
+    cinfo.image_height = image.size.height;
+    cinfo.input_components = 3;
+    cinfo.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, std::min<int>(options.quality, 100), TRUE);
+
+    // Low efforts use the fast integer DCT; high efforts compute optimal Huffman tables,
+    // which takes a second pass over the coefficients.
+    cinfo.dct_method = options.effort < 3 ? JDCT_IFAST : JDCT_ISLOW;
+    cinfo.optimize_coding = options.effort > 5 ? TRUE : FALSE;
+
+    jpeg_start_compress(&cinfo, TRUE);
+
+    std::vector<JSAMPLE> row(image.size.width * 3);
+    while (cinfo.next_scanline < cinfo.image_height) {
+        const uint8_t* src = image.data.get() + cinfo.next_scanline * image.stride();
+        for (std::size_t i = 0; i < image.size.width; i++) {
+            row[i * 3 + 0] = src[i * 4 + 0];
+            row[i * 3 + 1] = src[i * 4 + 1];
+            row[i * 3 + 2] = src[i * 4 + 2];
+        }
+        JSAMPROW rows[1] = { row.data() };
+        jpeg_write_scanlines(&cinfo, rows, 1);
+    }
+
+    jpeg_finish_compress(&cinfo);
+}
+
+} // namespace mbgl
@@ -1,5 +1,6 @@
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/gl/framebuffer_reader.hpp>
 #include <mbgl/renderer/backend_scope.hpp>
 
 #include <cassert>
@@ -27,6 +28,7 @@ HeadlessBackend::HeadlessBackend(Size size_)
 
 HeadlessBackend::~HeadlessBackend() {
     BackendScope guard { *this };
+    reader.reset();
     view.reset();
     context.reset();
 }
@@ -78,8 +80,32 @@ void HeadlessBackend::setSize(Size size_) {
     view.reset();
 }
 
-PremultipliedImage HeadlessBackend::readStillImage() {
-    return getContext().readFramebuffer<PremultipliedImage>(size);
+PremultipliedImage HeadlessBackend::readStillImage(bool flip) {
+    PremultipliedImage image;
+    readStillImage(image, flip);
+    return image;
+}
+
+void HeadlessBackend::readStillImage(PremultipliedImage& image, bool flip) {
+    assert(pendingStillImages() == 0);
+    queueStillImage();
+    reader->take(image, flip);
+}
+
+void HeadlessBackend::queueStillImage() {
+    if (!reader) {
+        reader = std::make_unique<gl::FramebufferReader>(getContext());
+    }
+    reader->read(size);
+}
+
+PremultipliedImage HeadlessBackend::takeStillImage(bool flip) {
+    assert(reader);
+    return reader->take(flip);
+}
+
+std::size_t HeadlessBackend::pendingStillImages() const {
+    return reader ? reader->pending() : 0;
 }
 
 } // namespace mbgl
@@ -7,6 +7,10 @@
 
 namespace mbgl {
 
+namespace gl {
+class FramebufferReader;
+} // namespace gl
+
 class HeadlessBackend : public RendererBackend {
 public:
     HeadlessBackend(Size = { 256, 256 });
@@ -17,7 +21,20 @@ public:
     void updateAssumedState() override;
 
     void setSize(Size);
-    PremultipliedImage readStillImage();
+
+    // Reads the rendered frame through the same pooled pixel buffers as queueStillImage(),
+    // and waits for it. Must not be called while queued images are pending.
+    PremultipliedImage readStillImage(bool flip = true);
+
+    // Like readStillImage(), but reuses the storage of `image` when it has the right size.
+    void readStillImage(PremultipliedImage& image, bool flip = true);
+
+    // Queues a readback of the rendered frame without waiting for the GPU, so that the
+    // next frame can be rendered during the transfer. takeStillImage() returns the
+    // queued images in order, waiting for the oldest one if necessary.
+    void queueStillImage();
+    PremultipliedImage takeStillImage(bool flip = true);
+    std::size_t pendingStillImages() const;
 
     class Impl {
     public:
@@ -45,6 +62,8 @@ private:
 
     class View;
     std::unique_ptr<View> view;
+
+    std::unique_ptr<gl::FramebufferReader> reader;
 };
 
 } // namespace mbgl
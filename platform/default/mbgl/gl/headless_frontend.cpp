@@ -63,26 +63,57 @@ void HeadlessFrontend::setSize(Size size_) {
     }
 }
 
-PremultipliedImage HeadlessFrontend::readStillImage() {
-    return backend.readStillImage();
+PremultipliedImage HeadlessFrontend::readStillImage(bool flip) {
+    return backend.readStillImage(flip);
+}
+
+void HeadlessFrontend::readStillImage(PremultipliedImage& image, bool flip) {
+    backend.readStillImage(image, flip);
 }
 
 PremultipliedImage HeadlessFrontend::render(Map& map) {
     PremultipliedImage result;
+    render(map, result);
+    return result;
+}
+
+void HeadlessFrontend::render(Map& map, PremultipliedImage& image) {
+    bool done = false;
 
     map.renderStill([&](std::exception_ptr error) {
         if (error) {
             std::rethrow_exception(error);
         } else {
-            result = backend.readStillImage();
+            backend.readStillImage(image);
+            done = true;
         }
     });
 
-    while (!result.valid()) {
+    while (!done) {
         util::RunLoop::Get()->runOnce();
     }
+}
 
-    return result;
+void HeadlessFrontend::renderQueued(Map& map) {
+    bool done = false;
+
+    map.renderStill([&](std::exception_ptr error) {
+        if (error) {
+            std::rethrow_exception(error);
+        } else {
+            backend.queueStillImage();
+            done = true;
+        }
+    });
+
+    while (!done) {
+        util::RunLoop::Get()->runOnce();
+    }
+}
+
+PremultipliedImage HeadlessFrontend::takeImage(bool flip) {
+    mbgl::BackendScope guard { backend };
+    return backend.takeStillImage(flip);
 }
 
 optional<TransformState> HeadlessFrontend::getTransformState() const {
@@ -33,9 +33,20 @@ public:
     Renderer* getRenderer();
     RendererBackend* getBackend();
 
-    PremultipliedImage readStillImage();
+    PremultipliedImage readStillImage(bool flip = true);
+    void readStillImage(PremultipliedImage& image, bool flip = true);
+
     PremultipliedImage render(Map&);
 
+    // Like render(), but reuses the storage of `image` when it has the right size.
+    void render(Map&, PremultipliedImage& image);
+
+    // Renders a still image and queues its readback instead of waiting for it.
+    // Rendering the next image before calling takeImage() lets the transfer of
+    // this one overlap with it. Images are returned in the order they were rendered.
+    void renderQueued(Map&);
+    PremultipliedImage takeImage(bool flip = true);
+
     optional<TransformState> getTransformState() const;
 
 private:
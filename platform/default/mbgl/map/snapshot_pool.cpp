@@ -0,0 +1,267 @@
+#include <mbgl/map/snapshot_pool.hpp>
+
+#include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/storage/file_source.hpp>
+#include <mbgl/style/style.hpp>
+
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+
+namespace mbgl {
+
+class SnapshotPool::PendingJob {
+public:
+    Job job;
+    Callback callback;
+    TimePoint queued;
+};
+
+// State shared between the pool and its renderers. Renderers take the next job
+// themselves when they finish one, and register as idle when there is none.
+class SnapshotPool::Queue {
+public:
+    Queue(std::size_t maxQueuedJobs_)
+        : maxQueuedJobs(maxQueuedJobs_) {
+    }
+
+    bool push(PendingJob&&, bool block);
+
+    optional<PendingJob> next(ActorRef<Renderer> renderer) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!stopped && !jobs.empty()) {
+            PendingJob job = std::move(jobs.front());
+            jobs.pop_front();
+            notFull.notify_one();
+            return { std::move(job) };
+        }
+
+        idle.push_back(std::move(renderer));
+        return {};
+    }
+
+    // Called once the callback of a job has returned.
+    void done() {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(active > 0);
+        if (--active == 0) {
+            drained.notify_all();
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        drained.wait(lock, [&] { return stopped || active == 0; });
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+        jobs.clear();
+        notFull.notify_all();
+        drained.notify_all();
+    }
+
+private:
+    const std::size_t maxQueuedJobs;
+
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable drained;
+
+    std::deque<PendingJob> jobs;
+    std::vector<ActorRef<Renderer>> idle;
+    std::size_t active = 0;
+    bool stopped = false;
+};
+
+class SnapshotPool::Encoder {
+public:
+    Encoder(std::shared_ptr<Queue> queue_)
+        : queue(std::move(queue_)) {
+    }
+
+    void encode(PendingJob job, Result result) {
+        if (!result.error) {
+            const TimePoint start = Clock::now();
+            try {
+                result.encoded = encodeImage(result.image, *job.job.encoding);
+            } catch (...) {
+                result.error = std::current_exception();
+            }
+            result.encodeTime = Clock::now() - start;
+        }
+
+        job.callback(std::move(result));
+        queue->done();
+    }
+
+private:
+    std::shared_ptr<Queue> queue;
+};
+
+class SnapshotPool::Renderer {
+public:
+    Renderer(ActorRef<Renderer> self_,
+             std::shared_ptr<Queue> queue_,
+             FileSource* fileSource,
+             std::shared_ptr<Scheduler> scheduler_,
+             const std::pair<bool, std::string> style,
+             const float pixelRatio,
+             const optional<std::string> programCacheDir)
+        : self(std::move(self_)),
+          queue(std::move(queue_)),
+          scheduler(std::move(scheduler_)),
+          frontend(pixelRatio, *fileSource, *scheduler, programCacheDir),
+          map(frontend, MapObserver::nullObserver(), frontend.getSize(), pixelRatio, *fileSource, *scheduler, MapMode::Static),
+          encoder("Snapshot Encoder", queue) {
+        if (style.first) {
+            map.getStyle().loadJSON(style.second);
+        } else {
+            map.getStyle().loadURL(style.second);
+        }
+
+        // Registers the renderer as idle.
+        queue->next(self);
+    }
+
+    ~Renderer() {
+        // The pool is being destroyed while the job is waiting for its resources.
+        if (current) {
+            Result result;
+            result.error = std::make_exception_ptr(std::runtime_error("Snapshot pool destroyed while rendering"));
+            result.queueTime = started - current->queued;
+            result.renderTime = Clock::now() - started;
+            current->callback(std::move(result));
+            queue->done();
+        }
+    }
+
+    void render(PendingJob job) {
+        assert(!current);
+        started = Clock::now();
+        current = std::move(job);
+
+        try {
+            if (map.getSize() != current->job.size) {
+                map.setSize(current->job.size);
+                frontend.setSize(current->job.size);
+            }
+            map.jumpTo(current->job.camera);
+        } catch (...) {
+            finish(std::current_exception());
+            return;
+        }
+
+        // The map renders on this thread's run loop once everything the snapshot needs
+        // has loaded, and then invokes the callback.
+        map.renderStill([this](std::exception_ptr error) {
+            finish(error);
+        });
+    }
+
+private:
+    void finish(std::exception_ptr error) {
+        assert(current);
+        PendingJob job = std::move(*current);
+        current = {};
+
+        Result result;
+        result.error = error;
+        result.queueTime = started - job.queued;
+        if (!error) {
+            result.image = frontend.readStillImage();
+        }
+        result.renderTime = Clock::now() - started;
+
+        if (job.job.encoding) {
+            encoder.actor().invoke(&Encoder::encode, std::move(job), std::move(result));
+        } else {
+            job.callback(std::move(result));
+            queue->done();
+        }
+
+        // Start the next job from the mailbox rather than from within the callback,
+        // which may run synchronously from render().
+        auto next = queue->next(self);
+        if (next) {
+            self.invoke(&Renderer::render, std::move(*next));
+        }
+    }
+
+    ActorRef<Renderer> self;
+    std::shared_ptr<Queue> queue;
+    std::shared_ptr<Scheduler> scheduler;
+    HeadlessFrontend frontend;
+    Map map;
+    util::Thread<Encoder> encoder;
+
+    // The job being rendered, and when it started.
+    optional<PendingJob> current;
+    TimePoint started;
+};
+
+bool SnapshotPool::Queue::push(PendingJob&& job, bool block) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!idle.empty()) {
+        auto renderer = idle.back();
+        idle.pop_back();
+        active++;
+        lock.unlock();
+        renderer.invoke(&Renderer::render, std::move(job));
+        return true;
+    }
+
+    if (jobs.size() >= maxQueuedJobs) {
+        if (!block) {
+            return false;
+        }
+        notFull.wait(lock, [&] { return stopped || jobs.size() < maxQueuedJobs; });
+        if (stopped) {
+            return false;
+        }
+    }
+
+    jobs.push_back(std::move(job));
+    active++;
+    return true;
+}
+
+SnapshotPool::SnapshotPool(FileSource* fileSource,
+                           std::shared_ptr<Scheduler> scheduler,
+                           const std::pair<bool, std::string> style,
+                           const float pixelRatio,
+                           std::size_t rendererCount,
+                           std::size_t maxQueuedJobs,
+                           const optional<std::string> programCacheDir)
+    : queue(std::make_shared<Queue>(maxQueuedJobs)) {
+    assert(rendererCount > 0 && maxQueuedJobs > 0);
+    for (std::size_t i = 0; i < rendererCount; i++) {
+        renderers.push_back(std::make_unique<util::Thread<Renderer>>(
+            "Snapshot Renderer", queue, fileSource, scheduler, style, pixelRatio, programCacheDir));
+    }
+}
+
+SnapshotPool::~SnapshotPool() {
+    queue->stop();
+    // Waits for the jobs that are being rendered.
+    renderers.clear();
+}
+
+void SnapshotPool::snapshot(Job job, Callback callback) {
+    queue->push({ std::move(job), std::move(callback), Clock::now() }, true);
+}
+
+bool SnapshotPool::trySnapshot(Job job, Callback callback) {
+    return queue->push({ std::move(job), std::move(callback), Clock::now() }, false);
+}
+
+void SnapshotPool::wait() {
+    queue->wait();
+}
+
+} // namespace mbgl
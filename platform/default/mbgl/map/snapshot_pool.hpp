@@ -0,0 +1,89 @@
+#pragma once
+
+#include <mbgl/map/camera.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
+#include <mbgl/util/thread.hpp>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+class FileSource;
+class Scheduler;
+
+// Renders batches of snapshots with a fixed set of warm renderers. Every renderer
+// has its own thread, Map and headless frontend, and keeps its style, programs,
+// glyphs, sprites and tiles loaded between jobs. The renderers share the file source,
+// and with it its tile cache, and the scheduler running their workers.
+//
+// Jobs wait in a bounded queue until a renderer becomes idle. Submitting a job while
+// the queue is full blocks, which throttles producers to the rendering throughput.
+// Jobs that ask for an encoded image are encoded on a thread next to the renderer's,
+// so that the renderer can go on with the next job in the meantime.
+class SnapshotPool : private util::noncopyable {
+public:
+    class Job {
+    public:
+        CameraOptions camera;
+        Size size;
+
+        // Encodes the image into `Result::encoded` when set.
+        optional<ImageEncoderOptions> encoding;
+    };
+
+    class Result {
+    public:
+        std::exception_ptr error;
+        PremultipliedImage image;
+        std::string encoded;
+
+        // Time the job waited for a renderer, the time it took to render and
+        // read back the image, and the time it took to encode it.
+        Duration queueTime;
+        Duration renderTime;
+        Duration encodeTime = Duration::zero();
+    };
+
+    // Invoked on the thread of the renderer or encoder that completed the job.
+    using Callback = std::function<void (Result)>;
+
+    SnapshotPool(FileSource*,
+                 std::shared_ptr<Scheduler>,
+                 const std::pair<bool, std::string> style,
+                 const float pixelRatio,
+                 std::size_t renderers,
+                 std::size_t maxQueuedJobs,
+                 const optional<std::string> programCacheDir = {});
+
+    // Jobs that haven't started rendering yet are discarded, and jobs that are being
+    // rendered complete with an error.
+    ~SnapshotPool();
+
+    // Queues a job, waiting while `maxQueuedJobs` jobs are already queued.
+    void snapshot(Job, Callback);
+
+    // Queues a job unless the queue is full. Returns whether the job was queued.
+    bool trySnapshot(Job, Callback);
+
+    // Waits until all submitted jobs have been completed.
+    void wait();
+
+private:
+    class PendingJob;
+    class Queue;
+    class Encoder;
+    class Renderer;
+
+    std::shared_ptr<Queue> queue;
+    std::vector<std::unique_ptr<util::Thread<Renderer>>> renderers;
+};
+
+} // namespace mbgl
@@ -1,5 +1,6 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/char_array_buffer.hpp>
 #include <mbgl/util/logging.hpp>
 
@@ -98,7 +99,7 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     int color_type = 0;
     png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr);
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    auto image = util::ImagePool::acquire<UnassociatedImage>({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
 
     if (color_type == PNG_COLOR_TYPE_PALETTE)
         png_set_expand(png_ptr);
@@ -119,24 +120,31 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
 
     if (png_get_interlace_type(png_ptr,info_ptr) == PNG_INTERLACE_ADAM7) {
-        png_set_interlace_handling(png_ptr); // FIXME: libpng bug?
-        // according to docs png_read_image
-        // "..automatically handles interlacing,
-        // so you don't need to call png_set_interlace_handling()"
+        // Interlaced images need all passes before a row is complete.
+        png_set_interlace_handling(png_ptr);
+        png_read_update_info(png_ptr, info_ptr);
+
+        const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
+        for (unsigned row = 0; row < height; ++row)
+            rows[row] = image.data.get() + row * width * 4;
+        png_read_image(png_ptr, rows.get());
+        png_read_end(png_ptr, nullptr);
+
+        return util::premultiply(std::move(image));
     }
 
     png_read_update_info(png_ptr, info_ptr);
 
-    // we can read whole image at once
-    // alloc row pointers
-    const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
-    for (unsigned row = 0; row < height; ++row)
-        rows[row] = image.data.get() + row * width * 4;
-    png_read_image(png_ptr, rows.get());
+    // Premultiply every row while it is still in cache.
+    for (unsigned row = 0; row < height; ++row) {
+        png_bytep data = image.data.get() + row * width * 4;
+        png_read_row(png_ptr, data, nullptr);
+        util::premultiply(data, width);
+    }
 
     png_read_end(png_ptr, nullptr);
 
-    return util::premultiply(std::move(image));
+    return { image.size, std::move(image.data) };
 }
 
 } // namespace mbgl
@@ -1,5 +1,5 @@
-#include <mbgl/util/compression.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/optional.hpp>
 #include <mbgl/util/premultiply.hpp>
 
 #pragma GCC diagnostic push
@@ -7,15 +7,25 @@
 #include <boost/crc.hpp>
 #pragma GCC diagnostic pop
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 #define NETWORK_BYTE_UINT32(value)                                                                 \
     char(value >> 24), char(value >> 16), char(value >> 8), char(value >> 0)
 
+namespace mbgl {
+
 namespace {
 
-void addChunk(std::string& png, const char* type, const char* data = "", const uint32_t size = 0) {
+void addChunk(const ImageEncoderSink& sink, const char* type, const char* data = "", const uint32_t size = 0) {
     assert(strlen(type) == 4);
 
     // Checksum encompasses type + data
@@ -26,54 +36,302 @@ void addChunk(std::string& png, const char* type, const char* data = "", const u
     const char length[4] = { NETWORK_BYTE_UINT32(size) };
     const char crc[4] = { NETWORK_BYTE_UINT32(checksum.checksum()) };
 
-    png.reserve(png.size() + 4 /* length */ + 4 /* type */ + size + 4 /* CRC */);
-    png.append(length, 4);
-    png.append(type, 4);
-    png.append(data, size);
-    png.append(crc, 4);
+    sink(length, 4);
+    sink(type, 4);
+    if (size) {
+        sink(data, size);
+    }
+    sink(crc, 4);
 }
 
-} // namespace
+using Pixel = std::array<uint8_t, 4>;
 
-namespace mbgl {
+uint32_t pack(const uint8_t* pixel) {
+    return uint32_t(pixel[0]) << 24 | uint32_t(pixel[1]) << 16 | uint32_t(pixel[2]) << 8 | pixel[3];
+}
 
-// Encode PNGs without libpng.
-std::string encodePNG(const PremultipliedImage& pre) {
+Pixel unpack(uint32_t color) {
+    return {{ uint8_t(color >> 24), uint8_t(color >> 16), uint8_t(color >> 8), uint8_t(color) }};
+}
+
+// An image reduced to at most 256 colors.
+class Palette {
+public:
+    std::vector<Pixel> colors;
+    std::vector<uint8_t> indices;
+};
+
+// Images with up to 256 distinct colors keep them. Others are reduced with median cut:
+// the box of colors with the widest channel range is split at its weighted median
+// until there are 256 boxes, each of which becomes the average of its colors.
+Palette quantize(const UnassociatedImage& image) {
+    const std::size_t pixels = image.size.area();
+
+    std::unordered_map<uint32_t, uint32_t> histogram;
+    for (std::size_t i = 0; i < pixels; i++) {
+        histogram[pack(image.data.get() + i * 4)]++;
+    }
+
+    using Entry = std::pair<uint32_t, uint32_t>; // color, count
+    std::vector<Entry> entries(histogram.begin(), histogram.end());
+
+    // Boxes are ranges of `entries`.
+    std::vector<std::pair<std::size_t, std::size_t>> boxes { { 0, entries.size() } };
+
+    auto widestChannel = [&](const std::pair<std::size_t, std::size_t>& box) {
+        std::array<uint8_t, 4> min {{ 255, 255, 255, 255 }};
+        std::array<uint8_t, 4> max {{ 0, 0, 0, 0 }};
+        for (std::size_t i = box.first; i < box.second; i++) {
+            const Pixel color = unpack(entries[i].first);
+            for (std::size_t c = 0; c < 4; c++) {
+                min[c] = std::min(min[c], color[c]);
+                max[c] = std::max(max[c], color[c]);
+            }
+        }
+        std::size_t channel = 0;
+        for (std::size_t c = 1; c < 4; c++) {
+            if (max[c] - min[c] > max[channel] - min[channel]) {
+                channel = c;
+            }
+        }
+        return std::make_pair(channel, max[channel] - min[channel]);
+    };
+
+    while (boxes.size() < 256) {
+        std::size_t widest = boxes.size();
+        std::pair<std::size_t, int> widestRange { 0, 0 };
+        for (std::size_t i = 0; i < boxes.size(); i++) {
+            if (boxes[i].second - boxes[i].first < 2) {
+                continue;
+            }
+            const auto range = widestChannel(boxes[i]);
+            if (range.second > widestRange.second) {
+                widest = i;
+                widestRange = range;
+            }
+        }
+        if (widest == boxes.size()) {
+            break;
+        }
+
+        auto& box = boxes[widest];
+        const std::size_t shift = 24 - 8 * widestRange.first;
+        std::sort(entries.begin() + box.first, entries.begin() + box.second, [&](const Entry& a, const Entry& b) {
+            return ((a.first >> shift) & 0xFF) < ((b.first >> shift) & 0xFF);
+        });
+
+        uint64_t total = 0;
+        for (std::size_t i = box.first; i < box.second; i++) {
+            total += entries[i].second;
+        }
+        std::size_t split = box.first + 1;
+        uint64_t count = entries[box.first].second;
+        while (split < box.second - 1 && count * 2 < total) {
+            count += entries[split++].second;
+        }
+
+        const std::size_t end = box.second;
+        box.second = split;
+        boxes.emplace_back(split, end);
+    }
+
+    Palette palette;
+    std::unordered_map<uint32_t, uint8_t> lookup;
+    for (const auto& box : boxes) {
+        if (box.first == box.second) {
+            continue;
+        }
+        std::array<uint64_t, 4> sum {{ 0, 0, 0, 0 }};
+        uint64_t count = 0;
+        for (std::size_t i = box.first; i < box.second; i++) {
+            const Pixel color = unpack(entries[i].first);
+            for (std::size_t c = 0; c < 4; c++) {
+                sum[c] += uint64_t(color[c]) * entries[i].second;
+            }
+            count += entries[i].second;
+            lookup[entries[i].first] = uint8_t(palette.colors.size());
+        }
+        Pixel average;
+        for (std::size_t c = 0; c < 4; c++) {
+            average[c] = uint8_t((sum[c] + count / 2) / count);
+        }
+        palette.colors.push_back(average);
+    }
+
+    palette.indices.resize(pixels);
+    for (std::size_t i = 0; i < pixels; i++) {
+        palette.indices[i] = lookup[pack(image.data.get() + i * 4)];
+    }
+
+    return palette;
+}
+
+uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+    const int p = int(a) + b - c;
+    const int pa = std::abs(p - a);
+    const int pb = std::abs(p - b);
+    const int pc = std::abs(p - c);
+    return (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+}
+
+// Applies one of the PNG filter types to a scanline. `out` holds the filter type
+// followed by the filtered bytes.
+void filterRow(uint8_t type, const uint8_t* row, const uint8_t* previous, std::size_t length,
+               std::size_t bpp, uint8_t* out) {
+    out[0] = type;
+    for (std::size_t i = 0; i < length; i++) {
+        const uint8_t a = i >= bpp ? row[i - bpp] : 0;
+        const uint8_t b = previous ? previous[i] : 0;
+        const uint8_t c = i >= bpp && previous ? previous[i - bpp] : 0;
+        switch (type) {
+        case 0: out[i + 1] = row[i]; break;
+        case 1: out[i + 1] = row[i] - a; break;
+        case 2: out[i + 1] = row[i] - b; break;
+        case 3: out[i + 1] = row[i] - ((a + b) >> 1); break;
+        default: out[i + 1] = row[i] - paeth(a, b, c); break;
+        }
+    }
+}
+
+// Compresses filtered scanlines and emits them as IDAT chunks as the output buffer fills up.
+class IDATWriter {
+public:
+    IDATWriter(const ImageEncoderSink& sink_, int level) : sink(sink_) {
+        std::memset(&stream, 0, sizeof(stream));
+        if (deflateInit(&stream, level) != Z_OK) {
+            throw std::runtime_error("failed to initialize deflate");
+        }
+    }
+
+    ~IDATWriter() {
+        deflateEnd(&stream);
+    }
+
+    void write(const uint8_t* data, std::size_t length, bool finish = false) {
+        stream.next_in = const_cast<Bytef*>(data);
+        stream.avail_in = uInt(length);
+        int code;
+        do {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer.data() + used);
+            stream.avail_out = uInt(buffer.size() - used);
+            code = deflate(&stream, finish ? Z_FINISH : Z_NO_FLUSH);
+            if (code == Z_STREAM_ERROR) {
+                throw std::runtime_error("failed to deflate image data");
+            }
+            used = buffer.size() - stream.avail_out;
+            if (used == buffer.size() || (finish && used > 0)) {
+                addChunk(sink, "IDAT", buffer.data(), uint32_t(used));
+                used = 0;
+            }
+        } while (stream.avail_in > 0 || (finish && code != Z_STREAM_END));
+    }
+
+private:
+    const ImageEncoderSink& sink;
+    z_stream stream;
+    std::array<char, 65536> buffer;
+    std::size_t used = 0;
+};
+
+// Encode PNGs without libpng. Adaptive filtering picks the best of the five filter types
+// for every scanline, which shrinks photographic content but costs five passes per row.
+void writePNG(const PremultipliedImage& pre, bool quantized, int level, bool adaptive, const ImageEncoderSink& sink) {
     // Make copy of the image so that we can unpremultiply it.
     const auto src = util::unpremultiply(pre.clone());
 
+    optional<Palette> palette;
+    if (quantized) {
+        palette = quantize(src);
+    }
+
     // PNG magic bytes
     const char preamble[8] = { char(0x89), 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    sink(preamble, 8);
 
-    // IHDR chunk for our RGBA image.
+    // IHDR chunk for our RGBA or palette image.
     const char ihdr[13] = {
         NETWORK_BYTE_UINT32(src.size.width),  // width
         NETWORK_BYTE_UINT32(src.size.height), // height
         8,                                    // bit depth == 8 bits
-        6,                                    // color type == RGBA
+        char(palette ? 3 : 6),                // color type == palette or RGBA
         0,                                    // compression method == deflate
         0,                                    // filter method == default
         0,                                    // interlace method == none
     };
+    addChunk(sink, "IHDR", ihdr, 13);
+
+    if (palette) {
+        std::string plte;
+        std::string trns;
+        for (const auto& color : palette->colors) {
+            plte.append(reinterpret_cast<const char*>(color.data()), 3);
+            trns.append(1, char(color[3]));
+        }
+        addChunk(sink, "PLTE", plte.data(), uint32_t(plte.size()));
+        // Trailing opaque entries can be omitted.
+        while (!trns.empty() && uint8_t(trns.back()) == 255) {
+            trns.pop_back();
+        }
+        if (!trns.empty()) {
+            addChunk(sink, "tRNS", trns.data(), uint32_t(trns.size()));
+        }
+    }
+
+    IDATWriter writer(sink, level);
 
-    // Prepare the (compressed) data chunk.
-    const auto stride = src.stride();
-    std::string idat;
+    const std::size_t bpp = palette ? 1 : 4;
+    const std::size_t stride = src.size.width * bpp;
+    const uint8_t* pixels = palette ? palette->indices.data() : src.data.get();
+
+    std::vector<uint8_t> filtered(stride + 1);
+    std::vector<uint8_t> candidate(stride + 1);
     for (uint32_t y = 0; y < src.size.height; y++) {
-        // Every scanline needs to be prefixed with one byte that indicates the filter type.
-        idat.append(1, 0); // filter type 0
-        idat.append((const char*)(src.data.get() + y * stride), stride);
+        const uint8_t* row = pixels + y * stride;
+        const uint8_t* previous = y > 0 ? row - stride : nullptr;
+
+        filterRow(0, row, previous, stride, bpp, filtered.data());
+        // Every scanline uses the filter with the smallest sum of absolute differences,
+        // as libpng does.
+        if (adaptive && !palette) {
+            auto cost = [&](const std::vector<uint8_t>& data) {
+                uint64_t sum = 0;
+                for (std::size_t i = 1; i < data.size(); i++) {
+                    sum += std::abs(int8_t(data[i]));
+                }
+                return sum;
+            };
+            uint64_t best = cost(filtered);
+            for (uint8_t type = 1; type <= 4; type++) {
+                filterRow(type, row, previous, stride, bpp, candidate.data());
+                const uint64_t candidateCost = cost(candidate);
+                if (candidateCost < best) {
+                    best = candidateCost;
+                    std::swap(filtered, candidate);
+                }
+            }
+        }
+
+        writer.write(filtered.data(), filtered.size());
     }
-    idat = util::compress(idat);
+    writer.write(nullptr, 0, true);
 
-    // Assemble the PNG.
+    addChunk(sink, "IEND");
+}
+
+} // namespace
+
+void encodePNG(const PremultipliedImage& pre, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    // Palette images and fast encodes aren't filtered.
+    writePNG(pre, options.palette, std::min<int>(options.effort, 9), options.effort > 2, sink);
+}
+
+// Keeps the unfiltered output at zlib's default level that this overload always produced;
+// callers that want smaller files ask for a higher effort through encodeImage.
+std::string encodePNG(const PremultipliedImage& pre) {
     std::string png;
-    png.reserve((8 /* preamble */) + (12 + 13 /* IHDR */) +
-                (12 + idat.size() /* IDAT */) + (12 /* IEND */));
-    png.append(preamble, 8);
-    addChunk(png, "IHDR", ihdr, 13);
-    addChunk(png, "IDAT", idat.data(), static_cast<uint32_t>(idat.size()));
-    addChunk(png, "IEND");
+    writePNG(pre, false, Z_DEFAULT_COMPRESSION, false, [&](const char* data, std::size_t length) {
+        png.append(data, length);
+    });
     return png;
 }
 
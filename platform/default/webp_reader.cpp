@@ -1,5 +1,6 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/logging.hpp>
 
 extern "C"
@@ -15,16 +16,12 @@ PremultipliedImage decodeWebP(const uint8_t* data, size_t size) {
         throw std::runtime_error("failed to retrieve WebP basic header information");
     }
 
-    int stride = width * 4;
-    size_t webpSize = stride * height;
-    auto webp = std::make_unique<uint8_t[]>(webpSize);
+    auto image = util::ImagePool::acquire<UnassociatedImage>({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
 
-    if (!WebPDecodeRGBAInto(data, size, webp.get(), webpSize, stride)) {
+    if (!WebPDecodeRGBAInto(data, size, image.data.get(), image.bytes(), int(image.stride()))) {
         throw std::runtime_error("failed to decode WebP data");
     }
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) },
-                            std::move(webp));
     return util::premultiply(std::move(image));
 }
 
@@ -0,0 +1,68 @@
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/premultiply.hpp>
+
+#include <stdexcept>
+
+extern "C"
+{
+#include <webp/encode.h>
+}
+
+namespace mbgl {
+
+namespace {
+
+int writeToSink(const uint8_t* data, size_t size, const WebPPicture* picture) {
+    const auto& sink = *reinterpret_cast<const ImageEncoderSink*>(picture->custom_ptr);
+    sink(reinterpret_cast<const char*>(data), size);
+    return 1;
+}
+
+struct webp_picture_guard {
+    webp_picture_guard(WebPPicture* picture)
+        : p_(picture) {}
+
+    ~webp_picture_guard() {
+        WebPPictureFree(p_);
+    }
+
+    WebPPicture* p_;
+};
+
+} // namespace
+
+// A quality of 100 selects lossless compression.
+void encodeWebP(const PremultipliedImage& pre, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    const auto src = util::unpremultiply(pre.clone());
+
+    WebPConfig config;
+    if (!WebPConfigInit(&config)) {
+        throw std::runtime_error("failed to initialize WebP encoder");
+    }
+    config.lossless = options.quality >= 100;
+    config.quality = config.lossless ? 75 : options.quality;
+    // WebP methods range from 0 (fastest) to 6 (slowest).
+    config.method = std::min<int>(options.effort, 9) * 6 / 9;
+
+    WebPPicture picture;
+    if (!WebPPictureInit(&picture)) {
+        throw std::runtime_error("failed to initialize WebP picture");
+    }
+    webp_picture_guard guard(&picture);
+
+    picture.use_argb = config.lossless;
+    picture.width = src.size.width;
+    picture.height = src.size.height;
+    if (!WebPPictureImportRGBA(&picture, src.data.get(), static_cast<int>(src.stride()))) {
+        throw std::runtime_error("failed to import WebP picture");
+    }
+
+    picture.writer = writeToSink;
+    picture.custom_ptr = const_cast<ImageEncoderSink*>(&sink);
+
+    if (!WebPEncode(&config, &picture)) {
+        throw std::runtime_error("failed to encode WebP image");
+    }
+}
+
+} // namespace mbgl
@@ -51,6 +51,8 @@ macro(mbgl_platform_core)
         # Snapshotting
         PRIVATE platform/default/mbgl/map/map_snapshotter.cpp
         PRIVATE platform/default/mbgl/map/map_snapshotter.hpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.cpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.hpp
 
         # Thread pool
         PRIVATE platform/default/mbgl/util/shared_thread_pool.cpp
@@ -56,9 +56,11 @@ macro(mbgl_platform_core)
         # Image handling
         PRIVATE platform/default/image.cpp
         PRIVATE platform/default/jpeg_reader.cpp
+        PRIVATE platform/default/jpeg_writer.cpp
         PRIVATE platform/default/png_writer.cpp
         PRIVATE platform/default/png_reader.cpp
         PRIVATE platform/default/webp_reader.cpp
+        PRIVATE platform/default/webp_writer.cpp
 
         # Headless view
         PRIVATE platform/default/mbgl/gl/headless_frontend.cpp
@@ -66,6 +68,10 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/mbgl/gl/headless_backend.cpp
         PRIVATE platform/default/mbgl/gl/headless_backend.hpp
 
+        # Snapshotting
+        PRIVATE platform/default/mbgl/map/snapshot_pool.cpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.hpp
+
         # Thread pool
         PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
         PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
@@ -174,6 +180,10 @@ macro(mbgl_platform_benchmark)
         PRIVATE benchmark/src/main.cpp
     )
 
+    target_sources(mbgl-benchmark-memory
+        PRIVATE benchmark/src/main.cpp
+    )
+
     set_source_files_properties(
         benchmark/src/main.cpp
             PROPERTIES
@@ -184,6 +194,11 @@ macro(mbgl_platform_benchmark)
         PRIVATE mbgl-filesource
         PRIVATE mbgl-loop-uv
     )
+
+    target_link_libraries(mbgl-benchmark-memory
+        PRIVATE mbgl-filesource
+        PRIVATE mbgl-loop-uv
+    )
 endmacro()
 
 
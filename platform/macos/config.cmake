@@ -32,6 +32,8 @@ macro(mbgl_platform_core)
         # Snapshotting
         PRIVATE platform/default/mbgl/map/map_snapshotter.cpp
         PRIVATE platform/default/mbgl/map/map_snapshotter.hpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.cpp
+        PRIVATE platform/default/mbgl/map/snapshot_pool.hpp
 
         # Thread pool
         PRIVATE platform/default/mbgl/util/shared_thread_pool.cpp
@@ -136,6 +138,10 @@ macro(mbgl_platform_benchmark)
         PRIVATE benchmark/src/main.cpp
     )
 
+    target_sources(mbgl-benchmark-memory
+        PRIVATE benchmark/src/main.cpp
+    )
+
     set_source_files_properties(
         benchmark/src/main.cpp
             PROPERTIES
@@ -146,6 +152,11 @@ macro(mbgl_platform_benchmark)
         PRIVATE mbgl-filesource
         PRIVATE mbgl-loop-darwin
     )
+
+    target_link_libraries(mbgl-benchmark-memory
+        PRIVATE mbgl-filesource
+        PRIVATE mbgl-loop-darwin
+    )
 endmacro()
 
 macro(mbgl_platform_node)
@@ -18,6 +18,10 @@ set(MBGL_QT_CORE_FILES
     PRIVATE platform/default/mbgl/gl/headless_backend.hpp
     PRIVATE platform/qt/src/headless_backend_qt.cpp
 
+    # Snapshotting
+    PRIVATE platform/default/mbgl/map/snapshot_pool.cpp
+    PRIVATE platform/default/mbgl/map/snapshot_pool.hpp
+
     # Thread pool
     PRIVATE platform/default/mbgl/util/shared_thread_pool.cpp
     PRIVATE platform/default/mbgl/util/shared_thread_pool.hpp
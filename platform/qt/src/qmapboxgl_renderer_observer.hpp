@@ -45,6 +45,10 @@ public:
         delegate.invoke(&mbgl::RendererObserver::onDidFinishRenderingMap);
     }
 
+    void onDidFinishFrameProfile(const mbgl::FrameProfile& profile) final {
+        delegate.invoke(&mbgl::RendererObserver::onDidFinishFrameProfile, profile);
+    }
+
 private:
     std::shared_ptr<mbgl::Mailbox> mailbox;
     mbgl::ActorRef<mbgl::RendererObserver> delegate;
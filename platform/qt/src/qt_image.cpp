@@ -3,6 +3,9 @@
 #include <QBuffer>
 #include <QByteArray>
 #include <QImage>
+#include <QImageWriter>
+
+#include <algorithm>
 
 namespace mbgl {
 
@@ -19,6 +22,43 @@ std::string encodePNG(const PremultipliedImage& pre) {
     return std::string(array.constData(), array.size());
 }
 
+// Qt's image writers don't stream, so the sink receives the whole file at once.
+void encodeImage(const PremultipliedImage& pre, const ImageEncoderOptions& options, const ImageEncoderSink& sink) {
+    QImage image = QImage(pre.data.get(), pre.size.width, pre.size.height,
+        QImage::Format_ARGB32_Premultiplied).rgbSwapped();
+
+    QByteArray array;
+    QBuffer buffer(&array);
+    buffer.open(QIODevice::WriteOnly);
+
+    QImageWriter writer(&buffer, QByteArray());
+    switch (options.encoding) {
+    case ImageEncoding::PNG:
+        writer.setFormat("PNG");
+        // Qt maps the quality of PNGs to the compression level, inverted.
+        writer.setQuality(100 - std::min<int>(options.effort, 9) * 100 / 9);
+        if (options.palette) {
+            image = image.convertToFormat(QImage::Format_Indexed8);
+        }
+        break;
+    case ImageEncoding::JPEG:
+        writer.setFormat("JPEG");
+        writer.setQuality(std::min<int>(options.quality, 100));
+        writer.setOptimizedWrite(options.effort > 5);
+        break;
+    case ImageEncoding::WebP:
+        writer.setFormat("WEBP");
+        writer.setQuality(std::min<int>(options.quality, 100));
+        break;
+    }
+
+    if (!writer.write(image)) {
+        throw std::runtime_error("unsupported image encoding");
+    }
+
+    sink(array.constData(), array.size());
+}
+
 #if !defined(QT_IMAGE_DECODERS)
 PremultipliedImage decodeJPEG(const uint8_t*, size_t);
 PremultipliedImage decodeWebP(const uint8_t*, size_t);
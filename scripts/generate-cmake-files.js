@@ -26,7 +26,10 @@ generateCMakeListFile('core', /^(?:src|include)\/(?:mbgl\/)?(.+)\/[^\/]+$/,
     [ 'include/*.hpp', 'include/*.h', 'src/*.hpp', 'src/*.cpp', 'src/*.h', 'src/*.c' ]);
 
 generateCMakeListFile('benchmark', /^benchmark\/(?:(?:src|include)\/)?(?:mbgl\/)?(?:(.+)\/)?[^\/]+$/,
-    [ 'benchmark/*.hpp', 'benchmark/*.cpp', 'benchmark/*.h', 'benchmark/*.c' ]);
+    [ 'benchmark/*.hpp', 'benchmark/*.cpp', 'benchmark/*.h', 'benchmark/*.c', ':(exclude)benchmark/memory/*' ]);
+
+generateCMakeListFile('benchmark-memory', /^benchmark\/(.+)\/[^\/]+$/,
+    [ 'benchmark/memory/*.hpp', 'benchmark/memory/*.cpp' ]);
 
 generateCMakeListFile('test', /^test\/(?:(?:src|include)\/)?(?:mbgl\/)?(?:(.+)\/)?[^\/]+$/,
     [ 'test/*.hpp', 'test/*.cpp', 'test/*.h', 'test/*.c' ]);
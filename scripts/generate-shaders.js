@@ -2,6 +2,7 @@
 
 require('flow-remove-types/register');
 
+const fs = require('fs');
 const path = require('path');
 const outputPath = 'src/mbgl/shaders';
 const zlib = require('zlib');
@@ -10,6 +11,86 @@ var shaders = require('../mapbox-gl-js/src/shaders');
 
 delete shaders.lineGradient;
 
+// Shaders that only exist in this repository. They are appended after the GL JS shaders,
+// and their #pragma mapbox directives are expanded the same way GL JS expands its own.
+function expandPragmas(vertexSource, fragmentSource) {
+    const re = /#pragma mapbox: ([\w]+) ([\w]+) ([\w]+) ([\w]+)/g;
+
+    const fragmentPragmas = {};
+
+    fragmentSource = fragmentSource.replace(re, (match, operation, precision, type, name) => {
+        fragmentPragmas[name] = true;
+        if (operation === 'define') {
+            return `
+#ifndef HAS_UNIFORM_u_${name}
+varying ${precision} ${type} ${name};
+#else
+uniform ${precision} ${type} u_${name};
+#endif
+`;
+        } else /* if (operation === 'initialize') */ {
+            return `
+#ifdef HAS_UNIFORM_u_${name}
+    ${precision} ${type} ${name} = u_${name};
+#endif
+`;
+        }
+    });
+
+    vertexSource = vertexSource.replace(re, (match, operation, precision, type, name) => {
+        const attrType = type === 'float' ? 'vec2' : 'vec4';
+        if (fragmentPragmas[name]) {
+            if (operation === 'define') {
+                return `
+#ifndef HAS_UNIFORM_u_${name}
+uniform lowp float a_${name}_t;
+attribute ${precision} ${attrType} a_${name};
+varying ${precision} ${type} ${name};
+#else
+uniform ${precision} ${type} u_${name};
+#endif
+`;
+            } else /* if (operation === 'initialize') */ {
+                return `
+#ifndef HAS_UNIFORM_u_${name}
+    ${name} = unpack_mix_${attrType}(a_${name}, a_${name}_t);
+#else
+    ${precision} ${type} ${name} = u_${name};
+#endif
+`;
+            }
+        } else {
+            if (operation === 'define') {
+                return `
+#ifndef HAS_UNIFORM_u_${name}
+uniform lowp float a_${name}_t;
+attribute ${precision} ${attrType} a_${name};
+#else
+uniform ${precision} ${type} u_${name};
+#endif
+`;
+            } else /* if (operation === 'initialize') */ {
+                return `
+#ifndef HAS_UNIFORM_u_${name}
+    ${precision} ${type} ${name} = unpack_mix_${attrType}(a_${name}, a_${name}_t);
+#else
+    ${precision} ${type} ${name} = u_${name};
+#endif
+`;
+            }
+        }
+    });
+
+    return {vertexSource, fragmentSource};
+}
+
+for (const name of ['circle_point', 'heatmap_point']) {
+    const key = name.replace(/_([a-z])/g, (match, letter) => letter.toUpperCase());
+    shaders[key] = expandPragmas(
+        fs.readFileSync(path.join(outputPath, 'glsl', `${name}.vertex.glsl`), 'utf8'),
+        fs.readFileSync(path.join(outputPath, 'glsl', `${name}.fragment.glsl`), 'utf8'));
+}
+
 require('./style-code');
 
 let concatenated = '';
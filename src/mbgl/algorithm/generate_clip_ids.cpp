@@ -1,5 +1,7 @@
 #include <mbgl/algorithm/generate_clip_ids_impl.hpp>
 #include <mbgl/algorithm/covered_by_children.hpp>
+#include <mbgl/math/log2.hpp>
+#include <mbgl/util/logging.hpp>
 
 #include <mbgl/util/std.hpp>
 
@@ -31,14 +33,138 @@ bool ClipIDGenerator::Leaf::operator==(const Leaf& other) const {
     return children == other.children;
 }
 
-std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
-    std::map<UnwrappedTileID, ClipID> clipIDs;
+bool ClipIDGenerator::Entry::operator==(const Entry& other) const {
+    return id == other.id && used == other.used && needsClipping == other.needsClipping;
+}
+
+ClipIDGenerator::Leaf ClipIDGenerator::makeLeaf(const std::vector<Entry>& entries, std::size_t index, ClipID& clip) const {
+    Leaf leaf{ clip };
+    const UnwrappedTileID& id = entries[index].id;
+
+    // Try to add all remaining ids as children. The entries are sorted by z, so all
+    // preceding items cannot be children of the current tile. We also compute the lower
+    // bound of the next wrap, because items of the next wrap can never be children of
+    // the current wrap.
+    const auto begin = entries.begin() + index + 1;
+    const auto end = std::lower_bound(
+        begin, entries.end(), UnwrappedTileID{ static_cast<int16_t>(id.wrap + 1), { 0, 0, 0 } },
+        [](const Entry& a, const UnwrappedTileID& b) { return a.id < b; });
+    for (auto it = begin; it != end; ++it) {
+        if (it->id.isChildOf(id)) {
+            leaf.add(it->id.canonical);
+        }
+    }
+
+    return leaf;
+}
+
+void ClipIDGenerator::assign(const std::vector<Entry>& entries, const std::vector<ClipID*>& clips) {
+    std::size_t size = 0;
+
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        if (!entries[i].used || !entries[i].needsClipping) {
+            continue;
+        }
+
+        *clips[i] = {};
+        Leaf leaf = makeLeaf(entries, i, *clips[i]);
+
+        // Find a leaf with matching children.
+        for (auto its = pool.equal_range(entries[i].id); its.first != its.second; ++its.first) {
+            auto& existing = its.first->second;
+            if (existing == leaf) {
+                leaf.clip = existing.clip;
+                break;
+            }
+        }
+        if (leaf.clip.reference.none()) {
+            // We haven't found an existing clip ID
+            size++;
+        }
+
+        pool.emplace(entries[i].id, std::move(leaf));
+    }
+
+    if (size > 0) {
+        const uint32_t bit_count = util::ceil_log2(size + 1);
+        const std::bitset<8> mask = uint64_t(((1ul << bit_count) - 1) << bit_offset);
+
+        // We are starting our count with 1 since we need at least 1 bit set to distinguish between
+        // areas without any tiles whatsoever and the current area.
+        uint8_t count = 1;
+        for (std::size_t i = 0; i < entries.size(); i++) {
+            if (!entries[i].used) {
+                continue;
+            }
+            ClipID& clip = *clips[i];
+            clip.mask |= mask;
+
+            // Assign only to clip IDs that have no value yet.
+            if (clip.reference.none()) {
+                clip.reference = uint32_t(count++) << bit_offset;
+            }
+        }
+
+        bit_offset += bit_count;
+    }
+
+    // Prevent this warning from firing on every frame,
+    // which can be expensive in some platforms.
+    static bool warned = false;
+
+    if (!warned && bit_offset > 8) {
+        Log::Error(Event::OpenGL, "stencil mask overflow");
+        warned = true;
+    }
+}
+
+void ClipIDGenerator::addDeferredLeaves() {
+    // Deferred updates are the first ones of the frame.
+    for (std::size_t u = 0; u < deferredClips.size(); u++) {
+        const auto& entries = updates[u].entries;
+        for (std::size_t i = 0; i < entries.size(); i++) {
+            if (entries[i].used && entries[i].needsClipping) {
+                pool.emplace(entries[i].id, makeLeaf(entries, i, *deferredClips[u][i]));
+            }
+        }
+    }
+    deferredClips.clear();
+}
+
+void ClipIDGenerator::nextFrame() {
+    previousUpdates = std::move(updates);
+    updates.clear();
+    deferredClips.clear();
+    repeating = true;
+    pool.clear();
+    bit_offset = 0;
+
+    if (clipIDs) {
+        previousClipIDs = std::move(clipIDs);
+    }
+    clipIDs = {};
+}
+
+const std::map<UnwrappedTileID, ClipID>& ClipIDGenerator::getClipIDs() {
+    if (clipIDs) {
+        return *clipIDs;
+    }
+
+    // When the whole frame repeats the previous one, so does the result.
+    if (repeating && updates.size() == previousUpdates.size() && previousClipIDs) {
+        clipIDs = std::move(previousClipIDs);
+        previousClipIDs = {};
+        return *clipIDs;
+    }
+
+    addDeferredLeaves();
+    clipIDs.emplace();
 
     // Merge everything.
     for (auto& pair : pool) {
         auto& id = pair.first;
         auto& leaf = pair.second;
-        auto res = clipIDs.emplace(id, leaf.clip);
+        auto res = clipIDs->emplace(id, leaf.clip);
         if (!res.second) {
             // Merge with the existing ClipID when there was already an element with the
             // same tile ID.
@@ -46,14 +172,14 @@ std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
         }
     }
 
-    for (auto it = clipIDs.begin(); it != clipIDs.end(); ++it) {
+    for (auto it = clipIDs->begin(); it != clipIDs->end(); ++it) {
         auto& childId = it->first;
         auto& childClip = it->second;
 
         // Loop through all preceding stencils, and find all parents.
 
         for (auto parentIt = std::reverse_iterator<decltype(it)>(it);
-             parentIt != clipIDs.rend(); ++parentIt) {
+             parentIt != clipIDs->rend(); ++parentIt) {
             auto& parentId = parentIt->first;
             if (childId.isChildOf(parentId)) {
                 // Once we have a parent, we add the bits  that this ID hasn't set yet.
@@ -66,11 +192,11 @@ std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
     }
 
     // Remove tiles that are entirely covered by children.
-    util::erase_if(clipIDs, [&](const auto& stencil) {
-        return algorithm::coveredByChildren(stencil.first, clipIDs);
+    util::erase_if(*clipIDs, [&](const auto& stencil) {
+        return algorithm::coveredByChildren(stencil.first, *clipIDs);
     });
 
-    return clipIDs;
+    return *clipIDs;
 }
 
 } // namespace algorithm
@@ -2,6 +2,7 @@
 
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/clip_id.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <set>
 #include <vector>
@@ -21,14 +22,50 @@ private:
         ClipID& clip;
     };
 
+    // A renderable as seen by update().
+    struct Entry {
+        UnwrappedTileID id;
+        bool used;
+        bool needsClipping;
+
+        bool operator==(const Entry& other) const;
+    };
+
+    // The sorted renderables of an update() call, the clip IDs they were given, and
+    // the bit offset afterwards.
+    struct Update {
+        std::vector<Entry> entries;
+        std::vector<ClipID> clips;
+        uint8_t bitOffset = 0;
+    };
+
     uint8_t bit_offset = 0;
     std::multimap<UnwrappedTileID, Leaf> pool;
 
+    // As long as the updates of a frame repeat the ones of the previous frame, their
+    // clip IDs are copied, and their leaves are only added to the pool once a later
+    // update differs.
+    std::vector<Update> previousUpdates;
+    std::vector<Update> updates;
+    std::vector<std::vector<ClipID*>> deferredClips;
+    bool repeating = true;
+
+    optional<std::map<UnwrappedTileID, ClipID>> previousClipIDs;
+    optional<std::map<UnwrappedTileID, ClipID>> clipIDs;
+
+    Leaf makeLeaf(const std::vector<Entry>&, std::size_t index, ClipID&) const;
+    void assign(const std::vector<Entry>&, const std::vector<ClipID*>&);
+    void addDeferredLeaves();
+
 public:
     template <typename Renderable>
     void update(std::vector<std::reference_wrapper<Renderable>> renderables);
 
-    std::map<UnwrappedTileID, ClipID> getClipIDs() const;
+    const std::map<UnwrappedTileID, ClipID>& getClipIDs();
+
+    // Starts a new frame. Renderables that are passed to update() are expected to start
+    // out without a clip ID.
+    void nextFrame();
 };
 
 } // namespace algorithm
@@ -4,6 +4,7 @@
 #include <mbgl/tile/tile_necessity.hpp>
 #include <mbgl/util/range.hpp>
 
+#include <algorithm>
 #include <unordered_set>
 
 namespace mbgl {
@@ -25,13 +26,22 @@ void updateRenderables(GetTileFn getTile,
     bool covered;
     int32_t overscaledZ;
 
+    // The ideal tiles may span several zoom levels when distant parts of a pitched view
+    // are covered with lower zoom levels. Those are overscaled by the same amount as the
+    // tiles of the highest zoom level, which are the ones dataTileZoom refers to.
+    uint8_t idealZoom = 0;
+    for (const auto& idealRenderTileID : idealTileIDs) {
+        idealZoom = std::max(idealZoom, idealRenderTileID.canonical.z);
+    }
+
     // for (all in the set of ideal tiles of the source) {
     for (const auto& idealRenderTileID : idealTileIDs) {
         assert(idealRenderTileID.canonical.z >= zoomRange.min);
         assert(idealRenderTileID.canonical.z <= zoomRange.max);
         assert(dataTileZoom >= idealRenderTileID.canonical.z);
 
-        const OverscaledTileID idealDataTileID(dataTileZoom, idealRenderTileID.wrap, idealRenderTileID.canonical);
+        const uint8_t idealDataTileZoom = dataTileZoom - (idealZoom - idealRenderTileID.canonical.z);
+        const OverscaledTileID idealDataTileID(idealDataTileZoom, idealRenderTileID.wrap, idealRenderTileID.canonical);
         auto tile = getTile(idealDataTileID);
         if (!tile) {
             tile = createTile(idealDataTileID);
@@ -54,7 +64,7 @@ void updateRenderables(GetTileFn getTile,
             // The tile isn't loaded yet, but retain it anyway because it's an ideal tile.
             retainTile(*tile, TileNecessity::Required);
             covered = true;
-            overscaledZ = dataTileZoom + 1;
+            overscaledZ = idealDataTileZoom + 1;
             if (overscaledZ > zoomRange.max) {
                 // We're looking for an overzoomed child tile.
                 const auto childDataTileID = idealDataTileID.scaledTo(overscaledZ);
@@ -83,7 +93,7 @@ void updateRenderables(GetTileFn getTile,
 
             if (!covered) {
                 // We couldn't find child tiles that entirely cover the ideal tile.
-                for (overscaledZ = dataTileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
+                for (overscaledZ = idealDataTileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
                     const auto parentDataTileID = idealDataTileID.scaledTo(overscaledZ);
                     const auto parentRenderTileID = parentDataTileID.toUnwrapped();
 
@@ -10,9 +10,19 @@
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/style/expression/dsl.hpp>
 #include <mbgl/storage/file_source.hpp>
+#include <mbgl/math/clamp.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/projection.hpp>
+
+#include <mapbox/geometry/for_each_point.hpp>
 
 #include <boost/function_output_iterator.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 namespace mbgl {
 
 using namespace style;
@@ -21,6 +31,56 @@ const std::string AnnotationManager::SourceID = "com.mapbox.annotations";
 const std::string AnnotationManager::PointLayerID = "com.mapbox.annotations.points";
 const std::string AnnotationManager::ShapeLayerID = "com.mapbox.annotations.shape.";
 
+namespace {
+
+LatLngBounds symbolBounds(const SymbolAnnotation& annotation) {
+    return LatLngBounds::singleton({ annotation.geometry.y, annotation.geometry.x });
+}
+
+LatLngBounds shapeBounds(const ShapeAnnotationGeometry& geometry) {
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = minX;
+    double maxX = -minX;
+    double maxY = -minX;
+    ShapeAnnotationGeometry::visit(geometry, [&] (const auto& geom) {
+        mapbox::geometry::for_each_point(geom, [&] (const Point<double>& point) {
+            minX = std::min(minX, point.x);
+            minY = std::min(minY, point.y);
+            maxX = std::max(maxX, point.x);
+            maxY = std::max(maxY, point.y);
+        });
+    });
+    if (minX > maxX) {
+        minX = maxX = minY = maxY = 0;
+    }
+    return LatLngBounds::hull({ util::clamp(minY, -util::LATITUDE_MAX, util::LATITUDE_MAX), minX },
+                              { util::clamp(maxY, -util::LATITUDE_MAX, util::LATITUDE_MAX), maxX });
+}
+
+// The area covered by a tile's data: shape annotations are tiled with a buffer of
+// 255 units around the tile.
+LatLngBounds bufferedTileBounds(const CanonicalTileID& tileID) {
+    const double scale = std::pow(2.0, tileID.z);
+    const double buffer = 255.0 / util::EXTENT;
+    auto unproject = [&] (double x, double y) {
+        return Projection::unproject({ x * util::tileSize, y * util::tileSize }, scale);
+    };
+    return LatLngBounds::hull(unproject(tileID.x - buffer, tileID.y + 1 + buffer),
+                              unproject(tileID.x + 1 + buffer, tileID.y - buffer));
+}
+
+// The bounds and their copies in the adjacent worlds. Shapes crossing the antimeridian
+// are also tiled into the tiles on the other side of it.
+std::array<LatLngBounds, 3> worldCopies(const LatLngBounds& bounds) {
+    auto shift = [&] (double offset) {
+        return LatLngBounds::hull({ bounds.south(), bounds.west() + offset },
+                                  { bounds.north(), bounds.east() + offset });
+    };
+    return {{ shift(-util::DEGREES_MAX), bounds, shift(util::DEGREES_MAX) }};
+}
+
+} // namespace
+
 AnnotationManager::AnnotationManager(Style& style_)
         : style(style_) {
 };
@@ -61,19 +121,27 @@ void AnnotationManager::removeAnnotation(const AnnotationID& id) {
 
 void AnnotationManager::add(const AnnotationID& id, const SymbolAnnotation& annotation) {
     auto impl = std::make_shared<SymbolAnnotationImpl>(id, annotation);
-    symbolTree.insert(impl);
+    const LatLngBounds bounds = symbolBounds(annotation);
+    tree.insert({ bounds, id });
+    dirtyBounds.push_back(bounds);
     symbolAnnotations.emplace(id, impl);
 }
 
 void AnnotationManager::add(const AnnotationID& id, const LineAnnotation& annotation) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<LineAnnotationImpl>(id, annotation)).first->second;
+    const LatLngBounds bounds = shapeBounds(impl.geometry());
+    tree.insert({ bounds, id });
+    dirtyBounds.push_back(bounds);
     impl.updateStyle(*style.get().impl);
 }
 
 void AnnotationManager::add(const AnnotationID& id, const FillAnnotation& annotation) {
     ShapeAnnotationImpl& impl = *shapeAnnotations.emplace(id,
         std::make_unique<FillAnnotationImpl>(id, annotation)).first->second;
+    const LatLngBounds bounds = shapeBounds(impl.geometry());
+    tree.insert({ bounds, id });
+    dirtyBounds.push_back(bounds);
     impl.updateStyle(*style.get().impl);
 }
 
@@ -101,6 +169,9 @@ void AnnotationManager::update(const AnnotationID& id, const LineAnnotation& ann
         return;
     }
 
+    const LatLngBounds bounds = shapeBounds(it->second->geometry());
+    tree.remove(std::make_pair(bounds, id));
+    dirtyBounds.push_back(bounds);
     shapeAnnotations.erase(it);
     add(id, annotation);
     dirty = true;
@@ -113,6 +184,9 @@ void AnnotationManager::update(const AnnotationID& id, const FillAnnotation& ann
         return;
     }
 
+    const LatLngBounds bounds = shapeBounds(it->second->geometry());
+    tree.remove(std::make_pair(bounds, id));
+    dirtyBounds.push_back(bounds);
     shapeAnnotations.erase(it);
     add(id, annotation);
     dirty = true;
@@ -120,10 +194,15 @@ void AnnotationManager::update(const AnnotationID& id, const FillAnnotation& ann
 
 void AnnotationManager::remove(const AnnotationID& id) {
     if (symbolAnnotations.find(id) != symbolAnnotations.end()) {
-        symbolTree.remove(symbolAnnotations.at(id));
+        const LatLngBounds bounds = symbolBounds(symbolAnnotations.at(id)->annotation);
+        tree.remove(std::make_pair(bounds, id));
+        dirtyBounds.push_back(bounds);
         symbolAnnotations.erase(id);
     } else if (shapeAnnotations.find(id) != shapeAnnotations.end()) {
         auto it = shapeAnnotations.find(id);
+        const LatLngBounds bounds = shapeBounds(it->second->geometry());
+        tree.remove(std::make_pair(bounds, id));
+        dirtyBounds.push_back(bounds);
         *style.get().impl->removeLayer(it->second->layerID);
         shapeAnnotations.erase(it);
     } else {
@@ -131,6 +210,19 @@ void AnnotationManager::remove(const AnnotationID& id) {
     }
 }
 
+std::vector<AnnotationID> AnnotationManager::query(const LatLngBounds& bounds) const {
+    std::vector<AnnotationID> ids;
+    for (const auto& copy : worldCopies(bounds)) {
+        tree.query(boost::geometry::index::intersects(copy),
+            boost::make_function_output_iterator([&](const auto& value) {
+                ids.push_back(value.second);
+            }));
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
 std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const CanonicalTileID& tileID) {
     if (symbolAnnotations.empty() && shapeAnnotations.empty())
         return nullptr;
@@ -141,13 +233,17 @@ std::unique_ptr<AnnotationTileData> AnnotationManager::getTileData(const Canonic
 
     LatLngBounds tileBounds(tileID);
 
-    symbolTree.query(boost::geometry::index::intersects(tileBounds),
-        boost::make_function_output_iterator([&](const auto& val){
-            val->updateLayer(tileID, *pointLayer);
-        }));
-
-    for (const auto& shape : shapeAnnotations) {
-        shape.second->updateTileData(tileID, *tileData);
+    // Older annotations are added first, so that they are drawn below newer ones.
+    for (const AnnotationID id : query(bufferedTileBounds(tileID))) {
+        auto symbol = symbolAnnotations.find(id);
+        if (symbol != symbolAnnotations.end()) {
+            // Symbols are only added to the tile that contains them.
+            if (boost::geometry::intersects(tileBounds, symbolBounds(symbol->second->annotation))) {
+                symbol->second->updateLayer(tileID, *pointLayer);
+            }
+        } else {
+            shapeAnnotations.at(id)->updateTileData(tileID, *tileData);
+        }
     }
 
     return tileData;
@@ -190,9 +286,19 @@ void AnnotationManager::updateStyle() {
 void AnnotationManager::updateData() {
     std::lock_guard<std::mutex> lock(mutex);
     if (dirty) {
+        // Only tiles intersecting the changed annotations need new data.
+        const boost::geometry::index::rtree<LatLngBounds, boost::geometry::index::rstar<16, 4>> changed(
+            dirtyBounds.begin(), dirtyBounds.end());
         for (auto& tile : tiles) {
-            tile->setData(getTileData(tile->id.canonical));
+            const auto copies = worldCopies(bufferedTileBounds(tile->id.canonical));
+            const bool intersects = std::any_of(copies.begin(), copies.end(), [&](const LatLngBounds& copy) {
+                return changed.qbegin(boost::geometry::index::intersects(copy)) != changed.qend();
+            });
+            if (intersects) {
+                tile->setData(getTileData(tile->id.canonical));
+            }
         }
+        dirtyBounds.clear();
         dirty = false;
     }
 }
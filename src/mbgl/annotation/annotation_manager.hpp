@@ -61,6 +61,10 @@ private:
 
     void updateStyle();
 
+    // Returns the IDs of the annotations whose bounds intersect the given ones, or one of
+    // their copies in the adjacent worlds, in ascending order.
+    std::vector<AnnotationID> query(const LatLngBounds&) const;
+
     std::unique_ptr<AnnotationTileData> getTileData(const CanonicalTileID&);
 
     std::reference_wrapper<style::Style> style;
@@ -68,17 +72,23 @@ private:
     std::mutex mutex;
 
     bool dirty = false;
-    
+
+    // The bounds of the annotations that were added, updated or removed since the last
+    // updateData(). Only the tiles intersecting them get new data.
+    std::vector<LatLngBounds> dirtyBounds;
+
     AnnotationID nextID = 0;
 
-    using SymbolAnnotationTree = boost::geometry::index::rtree<std::shared_ptr<const SymbolAnnotationImpl>, boost::geometry::index::rstar<16, 4>>;
+    // All annotations, indexed by their bounds: the point of a symbol annotation, and the
+    // bounding box of the geometry of a shape annotation.
+    using AnnotationTree = boost::geometry::index::rtree<std::pair<LatLngBounds, AnnotationID>, boost::geometry::index::rstar<16, 4>>;
     // Unlike std::unordered_map, std::map is guaranteed to sort by AnnotationID, ensuring that older annotations are below newer annotations.
     // <https://github.com/mapbox/mapbox-gl-native/issues/5691>
     using SymbolAnnotationMap = std::map<AnnotationID, std::shared_ptr<SymbolAnnotationImpl>>;
     using ShapeAnnotationMap = std::map<AnnotationID, std::unique_ptr<ShapeAnnotationImpl>>;
     using ImageMap = std::unordered_map<std::string, style::Image>;
 
-    SymbolAnnotationTree symbolTree;
+    AnnotationTree tree;
     SymbolAnnotationMap symbolAnnotations;
     ShapeAnnotationMap shapeAnnotations;
     ImageMap images;
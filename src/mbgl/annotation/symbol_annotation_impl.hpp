@@ -81,19 +81,5 @@ struct indexed_access<mbgl::LatLngBounds, max_corner, D>
 
 } // namespace traits
 
-// Tell Boost Geometry how to access a std::shared_ptr<mbgl::SymbolAnnotation> object.
-namespace index {
-
-template <>
-struct indexable<std::shared_ptr<const mbgl::SymbolAnnotationImpl>> {
-    using result_type = mbgl::LatLng;
-    mbgl::LatLng operator()(const std::shared_ptr<const mbgl::SymbolAnnotationImpl>& v) const {
-        const mbgl::Point<double>& p = v->annotation.geometry;
-        return mbgl::LatLng(p.y, p.x);
-    }
-};
-
-} // namespace index
-
 } // namespace geometry
 } // namespace boost
@@ -1,8 +1,106 @@
 #include <mbgl/geometry/dem_data.hpp>
 #include <mbgl/math/clamp.hpp>
 
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace mbgl {
 
+namespace {
+
+// Values are stored offset like DEMData::set() does.
+constexpr int32_t elevationOffset = 65536;
+
+// Decodes `count` RGBA pixels into elevations. The red, green and blue channels of a
+// pixel are its low three bytes when read as a little endian 32 bit integer.
+void decodeMapbox(const uint8_t* src, int32_t* dst, const int32_t count) {
+    // https://www.mapbox.com/help/access-elevation-data/#mapbox-terrain-rgb
+    // The elevation is (r * 256 * 256 + g * 256 + b) / 10 - 10000.
+    constexpr int32_t bias = elevationOffset - 10000;
+    int32_t i = 0;
+
+#if defined(__SSE2__) || defined(__ARM_NEON)
+    // Division by 10 is done by multiplying with ceil(2^27 / 10) and shifting, which is
+    // exact for 24 bit values.
+    constexpr uint32_t magic = 13421773;
+#endif
+
+#if defined(__SSE2__)
+    const __m128i low = _mm_set1_epi32(0xFF);
+    const __m128i middle = _mm_set1_epi32(0xFF00);
+    const __m128i lowHalves = _mm_set_epi32(0, -1, 0, -1);
+    const __m128i magic4 = _mm_set1_epi32(magic);
+    const __m128i bias4 = _mm_set1_epi32(bias);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        const __m128i v = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(p, low), 16), _mm_and_si128(p, middle)),
+                                       _mm_and_si128(_mm_srli_epi32(p, 16), low));
+        // Products of the even and odd lanes, in 64 bits each.
+        const __m128i even = _mm_srli_epi64(_mm_mul_epu32(v, magic4), 27);
+        const __m128i odd = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(v, 32), magic4), 27);
+        const __m128i q = _mm_or_si128(_mm_and_si128(even, lowHalves), _mm_slli_epi64(odd, 32));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(q, bias4));
+    }
+#elif defined(__ARM_NEON)
+    const uint32x4_t low = vdupq_n_u32(0xFF);
+    const uint32x4_t middle = vdupq_n_u32(0xFF00);
+    const uint32x2_t magic2 = vdup_n_u32(magic);
+    const uint32x4_t bias4 = vdupq_n_u32(bias);
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t p = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        const uint32x4_t v = vorrq_u32(vorrq_u32(vshlq_n_u32(vandq_u32(p, low), 16), vandq_u32(p, middle)),
+                                       vandq_u32(vshrq_n_u32(p, 16), low));
+        const uint32x4_t q = vcombine_u32(vshrn_n_u64(vmull_u32(vget_low_u32(v), magic2), 27),
+                                          vshrn_n_u64(vmull_u32(vget_high_u32(v), magic2), 27));
+        vst1q_s32(dst + i, vreinterpretq_s32_u32(vaddq_u32(q, bias4)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        const uint8_t* pixel = src + i * 4;
+        dst[i] = (pixel[0] * 256 * 256 + pixel[1] * 256 + pixel[2]) / 10 + bias;
+    }
+}
+
+void decodeTerrarium(const uint8_t* src, int32_t* dst, const int32_t count) {
+    // https://aws.amazon.com/public-datasets/terrain/
+    // The elevation is r * 256 + g + b / 256 - 32768, where the blue channel only holds
+    // the fractional part, which isn't kept.
+    constexpr int32_t bias = elevationOffset - 32768;
+    int32_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i low = _mm_set1_epi32(0xFF);
+    const __m128i bias4 = _mm_set1_epi32(bias);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        const __m128i v = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(p, low), 8), _mm_and_si128(_mm_srli_epi32(p, 8), low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_add_epi32(v, bias4));
+    }
+#elif defined(__ARM_NEON)
+    const uint32x4_t low = vdupq_n_u32(0xFF);
+    const uint32x4_t bias4 = vdupq_n_u32(bias);
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t p = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        const uint32x4_t v = vorrq_u32(vshlq_n_u32(vandq_u32(p, low), 8), vandq_u32(vshrq_n_u32(p, 8), low));
+        vst1q_s32(dst + i, vreinterpretq_s32_u32(vaddq_u32(v, bias4)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        const uint8_t* pixel = src + i * 4;
+        dst[i] = pixel[0] * 256 + pixel[1] + bias;
+    }
+}
+
+} // namespace
+
 DEMData::DEMData(const PremultipliedImage& _image, Tileset::DEMEncoding encoding):
     dim(_image.size.height),
     border(std::max<int32_t>(std::ceil(_image.size.height / 2), 1)),
@@ -13,52 +111,27 @@ DEMData::DEMData(const PremultipliedImage& _image, Tileset::DEMEncoding encoding
         throw std::runtime_error("raster-dem tiles must be square.");
     }
 
-    auto decodeMapbox = [] (const uint8_t r, const uint8_t g, const uint8_t b){
-        // https://www.mapbox.com/help/access-elevation-data/#mapbox-terrain-rgb
-        return (r * 256 * 256 + g * 256 + b)/10 - 10000;
-    };
-
-    auto decodeTerrarium = [] (const uint8_t r, const uint8_t g, const uint8_t b){
-        // https://aws.amazon.com/public-datasets/terrain/
-        return ((r * 256 + g + b / 256) - 32768);
-    };
-
-    auto decodeRGB = encoding == Tileset::DEMEncoding::Terrarium ? decodeTerrarium : decodeMapbox;
-
-    std::memset(image.data.get(), 0, image.bytes());
+    auto decode = encoding == Tileset::DEMEncoding::Terrarium ? decodeTerrarium : decodeMapbox;
+    int32_t* data = reinterpret_cast<int32_t*>(image.data.get());
 
-    for (int32_t y = 0; y < dim; y++) {
-        for (int32_t x = 0; x < dim; x++) {
-            const int32_t i = y * dim + x;
-            const int32_t j = i * 4;
-            set(x, y, decodeRGB(_image.data[j], _image.data[j+1], _image.data[j+2]));
-        }
-    }
-    
+    // Rows are decoded directly into the bordered image, which starts out zeroed.
+    //
     // in order to avoid flashing seams between tiles, here we are initially populating a 1px border of
     // pixels around the image with the data of the nearest pixel from the image. this data is eventually
     // replaced when the tile's neighboring tiles are loaded and the accurate data can be backfilled using
     // DEMData#backfillBorder
+    for (int32_t y = 0; y < dim; y++) {
+        int32_t* row = data + idx(0, y);
+        decode(_image.data.get() + y * dim * 4, row, dim);
 
-    for (int32_t x = 0; x < dim; x++) {
-        // left vertical border
-        set(-1, x, get(0, x));
-
-        // right vertical border
-        set(dim, x, get(dim - 1, x));
-
-        //left horizontal border
-        set(x, -1, get(x, 0));
-
-        // right horizontal border
-        set(x, dim, get(x, dim - 1));
+        // left and right vertical border
+        row[-1] = row[0];
+        row[dim] = row[dim - 1];
     }
 
-    // corners
-    set(-1, -1, get(0, 0));
-    set(dim, -1, get(dim - 1, 0));
-    set( -1, dim, get(0, dim - 1));
-    set(dim, dim, get(dim - 1, dim - 1));
+    // top and bottom horizontal border, including the corners
+    std::memcpy(data + idx(-1, -1), data + idx(-1, 0), (dim + 2) * sizeof(int32_t));
+    std::memcpy(data + idx(-1, dim), data + idx(-1, dim - 1), (dim + 2) * sizeof(int32_t));
 }
 
 // This function takes the DEMData from a neighboring tile and backfills the edge/corner
@@ -103,4 +176,87 @@ void DEMData::backfillBorder(const DEMData& borderTileData, int8_t dx, int8_t dy
     }
 }
 
+PremultipliedImage DEMData::computeSlopes(const float zoom, const float maxzoom) const {
+    PremultipliedImage slopes({ static_cast<uint32_t>(dim), static_cast<uint32_t>(dim) });
+    for (int32_t y = 0; y < dim; y++) {
+        computeSlopes(slopes, zoom, maxzoom, y, 0, dim);
+    }
+    return slopes;
+}
+
+void DEMData::updateSlopeBorder(PremultipliedImage& slopes, const float zoom, const float maxzoom) const {
+    assert(slopes.size == Size(dim, dim));
+    computeSlopes(slopes, zoom, maxzoom, 0, 0, dim);
+    computeSlopes(slopes, zoom, maxzoom, dim - 1, 0, dim);
+    for (int32_t y = 1; y < dim - 1; y++) {
+        computeSlopes(slopes, zoom, maxzoom, y, 0, 1);
+        computeSlopes(slopes, zoom, maxzoom, y, dim - 1, dim);
+    }
+}
+
+// Mirrors the hillshade_prepare fragment shader, which samples the DEM texture with
+// the elevation in the red, green and blue channels, scaled by 4.
+void DEMData::computeSlopes(PremultipliedImage& slopes, const float zoom, const float maxzoom,
+                            const int32_t y, const int32_t xMin, const int32_t xMax) const {
+    // See hillshade_prepare.fragment.glsl for how this factor is derived.
+    const float exaggeration = zoom < 2.0f ? 0.4f : zoom < 4.5f ? 0.35f : 0.3f;
+    const float scale = 1.0f / (4.0f * std::pow(2.0f, (zoom - maxzoom) * exaggeration + 19.2562f - zoom));
+    // The derivatives are mapped from [-1, 1] to [0, 1], and then to a byte.
+    const float factor = scale / 2.0f * 255.0f;
+    const float offset = 0.5f * 255.0f + 0.5f;
+
+    const int32_t* data = reinterpret_cast<const int32_t*>(image.data.get());
+    const int32_t* above = data + idx(0, y - 1);
+    const int32_t* row = data + idx(0, y);
+    const int32_t* below = data + idx(0, y + 1);
+    uint32_t* out = reinterpret_cast<uint32_t*>(slopes.data.get()) + y * dim;
+
+    int32_t x = xMin;
+
+#if defined(__SSE2__)
+    const __m128i mask = _mm_set1_epi32(0xFFFFFF);
+    const __m128 factor4 = _mm_set1_ps(factor);
+    const __m128 offset4 = _mm_set1_ps(offset);
+    const __m128 max4 = _mm_set1_ps(255.0f + 0.5f);
+    const __m128i opaque = _mm_set1_epi32(int32_t(0xFFFF0000));
+    auto load = [&] (const int32_t* p) {
+        return _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), mask);
+    };
+    auto toBytes = [&] (const __m128i derivative) {
+        const __m128 v = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(derivative), factor4), offset4);
+        return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(v, _mm_set1_ps(0.5f)), max4));
+    };
+    for (; x + 4 <= xMax; x += 4) {
+        const __m128i a = load(above + x - 1), b = load(above + x), c = load(above + x + 1);
+        const __m128i d = load(row + x - 1), f = load(row + x + 1);
+        const __m128i g = load(below + x - 1), h = load(below + x), i = load(below + x + 1);
+
+        const __m128i dx = _mm_sub_epi32(_mm_add_epi32(_mm_add_epi32(c, i), _mm_add_epi32(f, f)),
+                                         _mm_add_epi32(_mm_add_epi32(a, g), _mm_add_epi32(d, d)));
+        const __m128i dy = _mm_sub_epi32(_mm_add_epi32(_mm_add_epi32(g, i), _mm_add_epi32(h, h)),
+                                         _mm_add_epi32(_mm_add_epi32(a, c), _mm_add_epi32(b, b)));
+
+        const __m128i pixels = _mm_or_si128(_mm_or_si128(toBytes(dx), _mm_slli_epi32(toBytes(dy), 8)), opaque);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), pixels);
+    }
+#endif
+
+    auto elevation = [] (const int32_t value) {
+        return value & 0xFFFFFF;
+    };
+    auto toByte = [&] (const int32_t derivative) {
+        return static_cast<uint32_t>(util::clamp(derivative * factor + offset, 0.5f, 255.5f));
+    };
+    for (; x < xMax; x++) {
+        const int32_t a = elevation(above[x - 1]), b = elevation(above[x]), c = elevation(above[x + 1]);
+        const int32_t d = elevation(row[x - 1]), f = elevation(row[x + 1]);
+        const int32_t g = elevation(below[x - 1]), h = elevation(below[x]), i = elevation(below[x + 1]);
+
+        const int32_t dx = (c + f + f + i) - (a + d + d + g);
+        const int32_t dy = (g + h + h + i) - (a + b + b + c);
+
+        out[x] = toByte(dx) | (toByte(dy) << 8) | 0xFFFF0000u;
+    }
+}
+
 } // namespace mbgl
@@ -28,6 +28,15 @@ public:
         return &image;
     }
 
+    // Computes the slopes that the hillshade layer shades, like its prepare pass does on
+    // the GPU, as a dim x dim image with the x and y derivatives in the red and green
+    // channels. `maxzoom` is the maximum zoom level of the source.
+    PremultipliedImage computeSlopes(float zoom, float maxzoom) const;
+
+    // Recomputes the outermost pixels of `slopes`, which depend on the border, after it
+    // has been backfilled.
+    void updateSlopeBorder(PremultipliedImage& slopes, float zoom, float maxzoom) const;
+
     const int32_t dim;
     const int32_t border;
     const int32_t stride;
@@ -36,6 +45,8 @@ public:
     private:
         PremultipliedImage image;
 
+        void computeSlopes(PremultipliedImage& slopes, float zoom, float maxzoom, int32_t y, int32_t xMin, int32_t xMax) const;
+
         size_t idx(const int32_t x, const int32_t y) const {
             assert(x >= -border);
             assert(x < dim + border);
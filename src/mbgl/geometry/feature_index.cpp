@@ -23,17 +23,23 @@ FeatureIndex::FeatureIndex(std::unique_ptr<const GeometryTileData> tileData_)
 
 void FeatureIndex::insert(const GeometryCollection& geometries,
                           std::size_t index,
-                          const std::string& sourceLayerName,
-                          const std::string& bucketLeaderID) {
+                          const StringIdentity sourceLayerName,
+                          const StringIdentity bucketLeaderID) {
     for (const auto& ring : geometries) {
-        auto envelope = mapbox::geometry::envelope(ring);
-        if (envelope.min.x < util::EXTENT &&
-            envelope.min.y < util::EXTENT &&
-            envelope.max.x >= 0 &&
-            envelope.max.y >= 0) {
-            grid.insert(IndexedSubfeature(index, sourceLayerName, bucketLeaderID, sortIndex++),
-                        {convertPoint<float>(envelope.min), convertPoint<float>(envelope.max)});
-        }
+        insert(mapbox::geometry::envelope(ring), index, sourceLayerName, bucketLeaderID);
+    }
+}
+
+void FeatureIndex::insert(const GeometryBox& envelope,
+                          std::size_t index,
+                          const StringIdentity sourceLayerName,
+                          const StringIdentity bucketLeaderID) {
+    if (envelope.min.x < util::EXTENT &&
+        envelope.min.y < util::EXTENT &&
+        envelope.max.x >= 0 &&
+        envelope.max.y >= 0) {
+        grid.insert(IndexedSubfeature(index, sourceLayerName, bucketLeaderID, sortIndex++),
+                    {convertPoint<float>(envelope.min), convertPoint<float>(envelope.max)});
     }
 }
 
@@ -138,7 +144,6 @@ void FeatureIndex::addFeature(
     };
 
     // Lazily calculated.
-    std::unique_ptr<GeometryTileLayer> sourceLayer;
     std::unique_ptr<GeometryTileFeature> geometryTileFeature;
 
     for (const std::string& layerID : bucketLayerIDs.at(indexedFeature.bucketLeaderID)) {
@@ -148,7 +153,7 @@ void FeatureIndex::addFeature(
         }
 
         if (!geometryTileFeature) {
-            sourceLayer = tileData->getLayer(indexedFeature.sourceLayerName);
+            const GeometryTileLayer* sourceLayer = getLayer(strings.get(indexedFeature.sourceLayerName));
             assert(sourceLayer);
 
             geometryTileFeature = sourceLayer->getFeature(indexedFeature.index);
@@ -168,6 +173,15 @@ void FeatureIndex::addFeature(
     }
 }
 
+const GeometryTileLayer* FeatureIndex::getLayer(const std::string& sourceLayerName) const {
+    std::lock_guard<std::mutex> lock(layersMutex);
+    auto it = layers.find(sourceLayerName);
+    if (it == layers.end()) {
+        it = layers.emplace(sourceLayerName, tileData->getLayer(sourceLayerName)).first;
+    }
+    return it->second.get();
+}
+
 optional<GeometryCoordinates> FeatureIndex::translateQueryGeometry(
         const GeometryCoordinates& queryGeometry,
         const std::array<float, 2>& translate,
@@ -191,7 +205,7 @@ optional<GeometryCoordinates> FeatureIndex::translateQueryGeometry(
 }
 
 void FeatureIndex::setBucketLayerIDs(const std::string& bucketLeaderID, const std::vector<std::string>& layerIDs) {
-    bucketLayerIDs[bucketLeaderID] = layerIDs;
+    bucketLayerIDs[intern(bucketLeaderID)] = layerIDs;
 }
 
 } // namespace mbgl
@@ -6,7 +6,9 @@
 #include <mbgl/util/grid_index.hpp>
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/mat4.hpp>
+#include <mbgl/util/string_indexer.hpp>
 
+#include <mutex>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -22,10 +24,10 @@ class CollisionIndex;
 class IndexedSubfeature {
 public:
     IndexedSubfeature() = delete;
-    IndexedSubfeature(std::size_t index_, std::string sourceLayerName_, std::string bucketName_, size_t sortIndex_)
+    IndexedSubfeature(std::size_t index_, StringIdentity sourceLayerName_, StringIdentity bucketLeaderID_, size_t sortIndex_)
         : index(index_)
-        , sourceLayerName(std::move(sourceLayerName_))
-        , bucketLeaderID(std::move(bucketName_))
+        , sourceLayerName(sourceLayerName_)
+        , bucketLeaderID(bucketLeaderID_)
         , sortIndex(sortIndex_)
         , bucketInstanceId(0)
     {}
@@ -39,8 +41,11 @@ public:
         , bucketInstanceId(bucketInstanceId_)
     {}
     size_t index;
-    std::string sourceLayerName;
-    std::string bucketLeaderID;
+    // Interned with FeatureIndex::intern(), so that copying a subfeature into the grid
+    // indexes doesn't copy any strings. Only the feature index of the tile the subfeature
+    // belongs to can turn them back into strings.
+    StringIdentity sourceLayerName;
+    StringIdentity bucketLeaderID;
     size_t sortIndex;
 
     // Only used for symbol features
@@ -52,8 +57,19 @@ public:
     FeatureIndex(std::unique_ptr<const GeometryTileData> tileData_);
 
     const GeometryTileData* getData() { return tileData.get(); }
-    
-    void insert(const GeometryCollection&, std::size_t index, const std::string& sourceLayerName, const std::string& bucketLeaderID);
+
+    // Decodes a source layer the first time it is queried, and keeps it for later queries.
+    // Returns nullptr if the tile has no such layer. Safe to call from several threads at once.
+    const GeometryTileLayer* getLayer(const std::string& sourceLayerName) const;
+
+    // Interns a source layer name or bucket leader ID for the subfeatures of this index.
+    // Only called while the tile is being parsed, before the index is shared.
+    StringIdentity intern(const std::string& name) {
+        return strings.get(name);
+    }
+
+    void insert(const GeometryCollection&, std::size_t index, StringIdentity sourceLayerName, StringIdentity bucketLeaderID);
+    void insert(const GeometryBox& envelope, std::size_t index, StringIdentity sourceLayerName, StringIdentity bucketLeaderID);
 
     void query(
             std::unordered_map<std::string, std::vector<Feature>>& result,
@@ -98,7 +114,11 @@ private:
     GridIndex<IndexedSubfeature> grid;
     unsigned int sortIndex = 0;
 
-    std::unordered_map<std::string, std::vector<std::string>> bucketLayerIDs;
+    StringIndexer strings;
+    std::unordered_map<StringIdentity, std::vector<std::string>> bucketLayerIDs;
     std::unique_ptr<const GeometryTileData> tileData;
+
+    mutable std::mutex layersMutex;
+    mutable std::unordered_map<std::string, std::unique_ptr<const GeometryTileLayer>> layers;
 };
 } // namespace mbgl
@@ -0,0 +1,82 @@
+#include <mbgl/geometry/line_simplifier.hpp>
+
+namespace mbgl {
+
+namespace {
+
+// Squared distance from `p` to the segment between `a` and `b`.
+double squaredSegmentDistance(const GeometryCoordinate& p, const GeometryCoordinate& a, const GeometryCoordinate& b) {
+    double x = a.x;
+    double y = a.y;
+    double dx = b.x - x;
+    double dy = b.y - y;
+
+    if (dx != 0 || dy != 0) {
+        const double t = ((p.x - x) * dx + (p.y - y) * dy) / (dx * dx + dy * dy);
+        if (t > 1) {
+            x = b.x;
+            y = b.y;
+        } else if (t > 0) {
+            x += dx * t;
+            y += dy * t;
+        }
+    }
+
+    dx = p.x - x;
+    dy = p.y - y;
+    return dx * dx + dy * dy;
+}
+
+} // namespace
+
+const GeometryCoordinates& LineSimplifier::operator()(const GeometryCoordinates& line, double tolerance) {
+    result.clear();
+
+    const std::size_t size = line.size();
+    if (size <= 2 || tolerance <= 0) {
+        result.assign(line.begin(), line.end());
+        return result;
+    }
+
+    const double squaredTolerance = tolerance * tolerance;
+
+    keep.assign(size, 0);
+    keep.front() = 1;
+    keep.back() = 1;
+
+    stack.clear();
+    stack.emplace_back(0, size - 1);
+
+    while (!stack.empty()) {
+        const std::size_t first = stack.back().first;
+        const std::size_t last = stack.back().second;
+        stack.pop_back();
+
+        double maxDistance = 0;
+        std::size_t index = 0;
+
+        for (std::size_t i = first + 1; i < last; i++) {
+            const double distance = squaredSegmentDistance(line[i], line[first], line[last]);
+            if (distance > maxDistance) {
+                maxDistance = distance;
+                index = i;
+            }
+        }
+
+        if (maxDistance > squaredTolerance) {
+            keep[index] = 1;
+            if (index - first > 1) stack.emplace_back(first, index);
+            if (last - index > 1) stack.emplace_back(index, last);
+        }
+    }
+
+    for (std::size_t i = 0; i < size; i++) {
+        if (keep[i]) {
+            result.push_back(line[i]);
+        }
+    }
+
+    return result;
+}
+
+} // namespace mbgl
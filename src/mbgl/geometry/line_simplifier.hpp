@@ -0,0 +1,27 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+
+// Reduces the number of vertices of a line with the Douglas-Peucker algorithm. The
+// first and last vertices are always kept; every dropped vertex is closer than the
+// tolerance to the simplified line. A simplifier keeps its scratch state between
+// calls, so a bucket should reuse a single instance for all of its features.
+class LineSimplifier {
+public:
+    // Simplifies `line` with a tolerance given in tile units. The result is only valid
+    // until the next call.
+    const GeometryCoordinates& operator()(const GeometryCoordinates& line, double tolerance);
+
+private:
+    std::vector<uint8_t> keep;
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+    GeometryCoordinates result;
+};
+
+} // namespace mbgl
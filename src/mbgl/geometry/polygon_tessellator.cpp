@@ -0,0 +1,112 @@
+#include <mbgl/geometry/polygon_tessellator.hpp>
+
+#include <mapbox/earcut.hpp>
+
+namespace mapbox {
+namespace util {
+template <> struct nth<0, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
+};
+
+template <> struct nth<1, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
+};
+} // namespace util
+} // namespace mapbox
+
+namespace mbgl {
+
+PolygonTessellator::PolygonTessellator()
+    : earcut(std::make_unique<mapbox::detail::Earcut<uint32_t>>()) {
+}
+
+PolygonTessellator::~PolygonTessellator() = default;
+
+const std::vector<uint32_t>& PolygonTessellator::operator()(const GeometryCollection& polygon) {
+    indices.clear();
+    tessellate(polygon, [&] (uint32_t a, uint32_t b, uint32_t c) {
+        indices.push_back(a);
+        indices.push_back(b);
+        indices.push_back(c);
+    });
+    return indices;
+}
+
+const std::vector<uint32_t>& PolygonTessellator::triangulate(const GeometryCollection& polygon) {
+    (*earcut)(polygon);
+    return earcut->indices;
+}
+
+namespace {
+
+// Counts how often the sign of an edge direction component changes while walking
+// around a ring; a convex ring changes direction at most twice on each axis.
+class DirectionChanges {
+public:
+    void add(int32_t delta) {
+        if (delta == 0) {
+            return;
+        }
+        const int8_t sign = delta > 0 ? 1 : -1;
+        if (first == 0) {
+            first = sign;
+        } else if (sign != last) {
+            changes++;
+        }
+        last = sign;
+    }
+
+    uint32_t total() const {
+        return changes + (last != first ? 1 : 0);
+    }
+
+private:
+    int8_t first = 0;
+    int8_t last = 0;
+    uint32_t changes = 0;
+};
+
+} // namespace
+
+uint32_t PolygonTessellator::convexRingSize(const GeometryCoordinates& ring) {
+    std::size_t n = ring.size();
+    if (n > 1 && ring.front() == ring.back()) {
+        n--; // Vector tile rings repeat their first point at the end.
+    }
+    if (n < 3) {
+        return 0;
+    }
+
+    // A ring is convex when all turns go the same way and it doesn't wind around more
+    // than once. Collinear points and repeated vertices don't affect either property.
+    int8_t turn = 0;
+    DirectionChanges xChanges;
+    DirectionChanges yChanges;
+
+    for (std::size_t i = 0; i < n; i++) {
+        const GeometryCoordinate& a = ring[i];
+        const GeometryCoordinate& b = ring[(i + 1) % n];
+        const GeometryCoordinate& c = ring[(i + 2) % n];
+
+        const int64_t cross = int64_t(b.x - a.x) * (c.y - b.y) - int64_t(b.y - a.y) * (c.x - b.x);
+        if (cross != 0) {
+            const int8_t sign = cross > 0 ? 1 : -1;
+            if (turn == 0) {
+                turn = sign;
+            } else if (sign != turn) {
+                return 0;
+            }
+        }
+
+        xChanges.add(b.x - a.x);
+        yChanges.add(b.y - a.y);
+    }
+
+    if (turn == 0 || xChanges.total() > 2 || yChanges.total() > 2) {
+        return 0; // Degenerate or self-intersecting; let earcut sort it out.
+    }
+
+    return uint32_t(n);
+}
+
+} // namespace mbgl
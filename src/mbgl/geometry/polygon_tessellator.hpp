@@ -0,0 +1,67 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mapbox {
+namespace detail {
+template <typename N> class Earcut;
+} // namespace detail
+} // namespace mapbox
+
+namespace mbgl {
+
+// Triangulates polygons for fill and fill-extrusion buckets. A tessellator keeps its
+// scratch state between calls, so a bucket should reuse a single instance for all of
+// its features instead of allocating per polygon.
+//
+// Simple polygons without holes that are convex (which includes the very common
+// rectangular building footprints) are fanned directly; everything else goes
+// through earcut.
+class PolygonTessellator {
+public:
+    PolygonTessellator();
+    ~PolygonTessellator();
+
+    // Triangulates a polygon given as its outer ring followed by its holes. Returns
+    // triangle indices into the polygon's vertices, numbered consecutively across
+    // rings in order. The result is only valid until the next call.
+    const std::vector<uint32_t>& operator()(const GeometryCollection& polygon);
+
+    // Same as above, but hands each triangle to `emit` as it is produced, so that callers
+    // can write indices straight into their index vector. Convex rings are fanned without
+    // any intermediate storage; earcut results are read from its reused scratch vector.
+    // Returns the number of indices emitted.
+    template <class Emit>
+    std::size_t tessellate(const GeometryCollection& polygon, Emit&& emit) {
+        if (polygon.size() == 1) {
+            if (const uint32_t n = convexRingSize(polygon.front())) {
+                for (uint32_t i = 1; i + 1 < n; i++) {
+                    emit(0, i, i + 1);
+                }
+                return 3 * (n - 2);
+            }
+        }
+
+        const std::vector<uint32_t>& result = triangulate(polygon);
+        for (std::size_t i = 0; i + 2 < result.size(); i += 3) {
+            emit(result[i], result[i + 1], result[i + 2]);
+        }
+        return result.size();
+    }
+
+private:
+    // Returns the number of distinct vertices of a convex ring, or 0 if the ring is not
+    // convex (or degenerate) and needs to go through earcut.
+    static uint32_t convexRingSize(const GeometryCoordinates& ring);
+
+    const std::vector<uint32_t>& triangulate(const GeometryCollection& polygon);
+
+    std::unique_ptr<mapbox::detail::Earcut<uint32_t>> earcut;
+    std::vector<uint32_t> indices;
+};
+
+} // namespace mbgl
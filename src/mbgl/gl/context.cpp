@@ -3,10 +3,14 @@
 #include <mbgl/gl/debugging_extension.hpp>
 #include <mbgl/gl/vertex_array_extension.hpp>
 #include <mbgl/gl/program_binary_extension.hpp>
+#include <mbgl/gl/timer_query_extension.hpp>
+#include <mbgl/gl/pixel_buffer_extension.hpp>
 #include <mbgl/util/traits.hpp>
 #include <mbgl/util/std.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/image.hpp>
 
+#include <algorithm>
 #include <cstring>
 
 namespace mbgl {
@@ -131,6 +135,8 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
 #if MBGL_HAS_BINARY_PROGRAMS
         programBinary = std::make_unique<extension::ProgramBinary>(fn);
 #endif
+        timerQuery = std::make_unique<extension::TimerQuery>(fn);
+        pixelBuffer = std::make_unique<extension::PixelBuffer>(fn);
 
 #if MBGL_USE_GLES2
         constexpr const char* halfFloatExtensionName = "OES_texture_half_float";
@@ -248,12 +254,14 @@ UniqueBuffer Context::createVertexBuffer(const void* data, std::size_t size, con
     // vertexBuffer State<> call set() to glBindBuffer(GL_ARRAY_BUFFER, id)
     vertexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ARRAY_BUFFER, size, data, static_cast<GLenum>(usage)));
+    statistics.uploadBytes += size;
     return result;
 }
 
 void Context::updateVertexBuffer(UniqueBuffer& buffer, const void* data, std::size_t size) {
     vertexBuffer = buffer;
     MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    statistics.uploadBytes += size;
 }
 
 UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size, const BufferUsage usage) {
@@ -264,6 +272,7 @@ UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size, cons
     bindVertexArray = 0;
     globalVertexArrayState.indexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, static_cast<GLenum>(usage)));
+    statistics.uploadBytes += size;
     return result;
 }
 
@@ -273,9 +282,16 @@ void Context::updateIndexBuffer(UniqueBuffer& buffer, const void* data, std::siz
     bindVertexArray = 0;
     globalVertexArrayState.indexBuffer = buffer;
     MBGL_CHECK_ERROR(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, size, data));
+    statistics.uploadBytes += size;
 }
 
 
+std::size_t Context::TextureStorage::bytes() const {
+    return std::size_t(size.width) * size.height *
+        (format == TextureFormat::RGBA ? 4 : 1) *
+        (type == TextureType::UnsignedByte ? 1 : 2);
+}
+
 UniqueTexture Context::createTexture() {
     if (pooledTextures.empty()) {
         pooledTextures.resize(TextureMax);
@@ -284,6 +300,10 @@ UniqueTexture Context::createTexture() {
 
     TextureID id = pooledTextures.back();
     pooledTextures.pop_back();
+    const auto storage = textureStorage.find(id);
+    if (storage != textureStorage.end()) {
+        pooledTextureBytes -= storage->second.bytes();
+    }
     return UniqueTexture{ std::move(id), { this } };
 }
 
@@ -385,28 +405,90 @@ UniqueRenderbuffer Context::createRenderbuffer(const RenderbufferType type, cons
     return renderbuffer;
 }
 
+namespace {
+
+std::size_t rowStride(const Size size, const TextureFormat format) {
+    return size.width * (format == TextureFormat::RGBA ? 4 : 1);
+}
+
+} // namespace
+
 std::unique_ptr<uint8_t[]> Context::readFramebuffer(const Size size, const TextureFormat format, const bool flip) {
-    const size_t stride = size.width * (format == TextureFormat::RGBA ? 4 : 1);
-    auto data = std::make_unique<uint8_t[]>(stride * size.height);
+    auto data = std::make_unique<uint8_t[]>(rowStride(size, format) * size.height);
+    readFramebuffer(size, format, flip, data.get());
+    return data;
+}
+
+void Context::readFramebuffer(const Size size, const TextureFormat format, const bool flip, uint8_t* data) {
+    const size_t stride = rowStride(size, format);
 
     // When reading data from the framebuffer, make sure that we are storing the values
     // tightly packed into the buffer to avoid buffer overruns.
     pixelStorePack = { 1 };
 
     MBGL_CHECK_ERROR(glReadPixels(0, 0, size.width, size.height, static_cast<GLenum>(format),
-                                  GL_UNSIGNED_BYTE, data.get()));
+                                  GL_UNSIGNED_BYTE, data));
 
     if (flip) {
-        auto tmp = std::make_unique<uint8_t[]>(stride);
-        uint8_t* rgba = data.get();
-        for (int i = 0, j = size.height - 1; i < j; i++, j--) {
-            std::memcpy(tmp.get(), rgba + i * stride, stride);
-            std::memcpy(rgba + i * stride, rgba + j * stride, stride);
-            std::memcpy(rgba + j * stride, tmp.get(), stride);
+        util::flipRows(data, stride, size.height);
+    }
+}
+
+bool Context::supportsPixelBuffers() const {
+    return !disablePixelBufferExtension && pixelBuffer && pixelBuffer->supported();
+}
+
+UniqueBuffer Context::createPixelBuffer(const std::size_t size) {
+    assert(supportsPixelBuffers());
+    BufferID id = 0;
+    MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+    UniqueBuffer result { std::move(id), { this } };
+    // Pack buffers aren't tracked as state, so we leave the binding point empty.
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, result.get()));
+    MBGL_CHECK_ERROR(glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+    return result;
+}
+
+void Context::readFramebuffer(const UniqueBuffer& buffer, const Size size, const TextureFormat format) {
+    assert(supportsPixelBuffers());
+    pixelStorePack = { 1 };
+
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.get()));
+    MBGL_CHECK_ERROR(glReadPixels(0, 0, size.width, size.height, static_cast<GLenum>(format),
+                                  GL_UNSIGNED_BYTE, nullptr));
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+}
+
+void Context::readPixelBuffer(const UniqueBuffer& buffer,
+                              const Size size,
+                              const TextureFormat format,
+                              const bool flip,
+                              uint8_t* data) {
+    assert(supportsPixelBuffers());
+    const size_t stride = rowStride(size, format);
+
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.get()));
+    const auto* pixels = reinterpret_cast<const uint8_t*>(MBGL_CHECK_ERROR(
+        pixelBuffer->mapBufferRange(GL_PIXEL_PACK_BUFFER, 0, stride * size.height, GL_MAP_READ_BIT)));
+
+    if (pixels) {
+        // Flipping while copying out of the mapped buffer saves a pass over the image.
+        if (flip) {
+            for (uint32_t row = 0; row < size.height; row++) {
+                std::memcpy(data + row * stride, pixels + (size.height - row - 1) * stride, stride);
+            }
+        } else {
+            std::memcpy(data, pixels, stride * size.height);
         }
+        MBGL_CHECK_ERROR(pixelBuffer->unmapBuffer(GL_PIXEL_PACK_BUFFER));
     }
 
-    return data;
+    MBGL_CHECK_ERROR(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+    if (!pixels) {
+        throw std::runtime_error("Couldn't map pixel buffer");
+    }
 }
 
 #if not MBGL_USE_GLES2
@@ -530,6 +612,16 @@ Context::createFramebuffer(const Texture& color,
 
 UniqueTexture
 Context::createTexture(const Size size, const void* data, TextureFormat format, TextureUnit unit, TextureType type) {
+    // Prefer a pooled texture that already has storage for an image of this size.
+    const TextureStorage required { size, format, type };
+    const auto pooled = std::find_if(pooledTextures.rbegin(), pooledTextures.rend(), [&](const TextureID id) {
+        const auto storage = textureStorage.find(id);
+        return storage != textureStorage.end() && storage->second == required;
+    });
+    if (pooled != pooledTextures.rend()) {
+        std::swap(*pooled, pooledTextures.back());
+    }
+
     auto obj = createTexture();
     pixelStoreUnpack = { 1 };
     updateTexture(obj, size, data, format, unit, type);
@@ -546,9 +638,23 @@ void Context::updateTexture(
     TextureID id, const Size size, const void* data, TextureFormat format, TextureUnit unit, TextureType type) {
     activeTextureUnit = unit;
     texture[unit] = id;
-    MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
-                                  size.height, 0, static_cast<GLenum>(format), static_cast<GLenum>(type),
-                                  data));
+    const TextureStorage required { size, format, type };
+    const auto storage = textureStorage.find(id);
+    if (storage != textureStorage.end() && storage->second == required) {
+        if (data) {
+            MBGL_CHECK_ERROR(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.width, size.height,
+                                             static_cast<GLenum>(format), static_cast<GLenum>(type),
+                                             data));
+        }
+    } else {
+        MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
+                                      size.height, 0, static_cast<GLenum>(format), static_cast<GLenum>(type),
+                                      data));
+        textureStorage[id] = required;
+    }
+    if (data) {
+        statistics.uploadBytes += required.bytes();
+    }
 }
 
 void Context::bindTexture(Texture& obj,
@@ -597,6 +703,7 @@ void Context::bindTexture(Texture& obj,
 void Context::reset() {
     std::copy(pooledTextures.begin(), pooledTextures.end(), std::back_inserter(abandonedTextures));
     pooledTextures.resize(0);
+    pooledTextureBytes = 0;
     performCleanup();
 }
 
@@ -625,7 +732,7 @@ void Context::setDirtyState() {
     pixelStorePack.setDirty();
     pixelStoreUnpack.setDirty();
 #if not MBGL_USE_GLES2
-    pointSize.setDirty();
+    programPointSize.setDirty();
     pixelZoom.setDirty();
     rasterPos.setDirty();
     pixelTransferDepth.setDirty();
@@ -666,11 +773,12 @@ void Context::clear(optional<mbgl::Color> color,
 }
 
 #if not MBGL_USE_GLES2
-void Context::setDrawMode(const Points& points) {
-    pointSize = points.pointSize;
+void Context::setDrawMode(const Points&) {
+    programPointSize = true;
 }
 #else
 void Context::setDrawMode(const Points&) {
+    // OpenGL ES always takes the size of points from gl_PointSize.
 }
 #endif // MBGL_USE_GLES2
 
@@ -742,6 +850,22 @@ void Context::draw(PrimitiveType primitiveType,
         static_cast<GLsizei>(indexLength),
         GL_UNSIGNED_SHORT,
         reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset)));
+    statistics.drawCalls++;
+    countStateChanges();
+    statistics.vertices += indexLength;
+}
+
+void Context::countStateChanges() {
+    if (program.getCurrentValue() != drawnProgram) {
+        drawnProgram = program.getCurrentValue();
+        statistics.programSwitches++;
+    }
+    for (std::size_t unit = 0; unit < drawnTextures.size(); unit++) {
+        if (texture[unit].getCurrentValue() != drawnTextures[unit]) {
+            drawnTextures[unit] = texture[unit].getCurrentValue();
+            statistics.textureSwitches++;
+        }
+    }
 }
 
 void Context::performCleanup() {
@@ -777,6 +901,7 @@ void Context::performCleanup() {
                     binding.setDirty();
                 }
             }
+            textureStorage.erase(id);
         }
         MBGL_CHECK_ERROR(glDeleteTextures(int(abandonedTextures.size()), abandonedTextures.data()));
         abandonedTextures.clear();
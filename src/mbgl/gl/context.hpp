@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <array>
 #include <string>
@@ -28,14 +29,33 @@ namespace mbgl {
 namespace gl {
 
 constexpr size_t TextureMax = 64;
+// Pooled textures keep their storage for reuse, up to this many bytes in total.
+constexpr size_t TexturePoolMaxBytes = 16 * 1024 * 1024;
 using ProcAddress = void (*)();
 
 namespace extension {
 class VertexArray;
 class Debugging;
 class ProgramBinary;
+class TimerQuery;
+class PixelBuffer;
 } // namespace extension
 
+// Running totals of the work submitted through a context. They are never reset;
+// callers that want per-frame numbers take the difference of two snapshots.
+class Statistics {
+public:
+    uint64_t drawCalls = 0;
+    uint64_t vertices = 0;
+    uint64_t uploadBytes = 0;
+
+    // Changes of the program or the bound textures between consecutive draw calls,
+    // and uniform values that differed from the ones cached for their program.
+    uint64_t programSwitches = 0;
+    uint64_t textureSwitches = 0;
+    uint64_t uniformUploads = 0;
+};
+
 class Context {
 public:
     Context();
@@ -117,6 +137,31 @@ public:
         return { size, readFramebuffer(size, format, flip) };
     }
 
+    // Reads into `image`, reusing its storage when it already has the requested size.
+    template <typename Image,
+              TextureFormat format = Image::channels == 4 ? TextureFormat::RGBA
+                                                          : TextureFormat::Alpha>
+    void readFramebuffer(Image& image, const Size size, bool flip = true) {
+        static_assert(Image::channels == (format == TextureFormat::RGBA ? 4 : 1),
+                      "image format mismatch");
+        if (image.size != size || !image.data) {
+            image = Image(size);
+        }
+        readFramebuffer(size, format, flip, image.data.get());
+    }
+
+    // Pixel pack buffers let framebuffer reads complete asynchronously; see FramebufferReader.
+    bool supportsPixelBuffers() const;
+    UniqueBuffer createPixelBuffer(std::size_t size);
+
+    // Starts copying the bound framebuffer into the buffer, without waiting for
+    // rendering to finish.
+    void readFramebuffer(const UniqueBuffer&, Size, TextureFormat);
+
+    // Copies the pixels of a previous read into `data`, waiting for the transfer
+    // if it is still in flight. Rows are bottom-up unless `flip` is set.
+    void readPixelBuffer(const UniqueBuffer&, Size, TextureFormat, bool flip, uint8_t* data);
+
 #if not MBGL_USE_GLES2
     template <typename Image>
     void drawPixels(const Image& image) {
@@ -205,6 +250,19 @@ public:
         return vertexArray.get();
     }
 
+    extension::TimerQuery* getTimerQueryExtension() const {
+        return timerQuery.get();
+    }
+
+    const Statistics& getStatistics() const {
+        return statistics;
+    }
+
+    // Called by programs with the number of uniform values they actually uploaded.
+    void countUniformUploads(std::size_t count) {
+        statistics.uniformUploads += count;
+    }
+
     void setCleanupOnDestruction(bool cleanup) {
         cleanupOnDestruction = cleanup;
     }
@@ -214,6 +272,8 @@ private:
 
     std::unique_ptr<extension::Debugging> debugging;
     std::unique_ptr<extension::VertexArray> vertexArray;
+    std::unique_ptr<extension::TimerQuery> timerQuery;
+    std::unique_ptr<extension::PixelBuffer> pixelBuffer;
 #if MBGL_HAS_BINARY_PROGRAMS
     std::unique_ptr<extension::ProgramBinary> programBinary;
 #endif
@@ -264,7 +324,7 @@ private:
     State<value::LineWidth> lineWidth;
     State<value::BindRenderbuffer> bindRenderbuffer;
 #if not MBGL_USE_GLES2
-    State<value::PointSize> pointSize;
+    State<value::ProgramPointSize> programPointSize;
 #endif // MBGL_USE_GLES2
 
     UniqueBuffer createVertexBuffer(const void* data, std::size_t size, const BufferUsage usage);
@@ -276,12 +336,20 @@ private:
     UniqueFramebuffer createFramebuffer();
     UniqueRenderbuffer createRenderbuffer(RenderbufferType, Size size);
     std::unique_ptr<uint8_t[]> readFramebuffer(Size, TextureFormat, bool flip);
+    void readFramebuffer(Size, TextureFormat, bool flip, uint8_t* data);
 #if not MBGL_USE_GLES2
     void drawPixels(Size size, const void* data, TextureFormat);
 #endif // MBGL_USE_GLES2
 
     bool supportsVertexArrays() const;
 
+    Statistics statistics;
+
+    // The program and textures used by the previous draw call.
+    ProgramID drawnProgram = 0;
+    std::array<TextureID, 2> drawnTextures {{ 0, 0 }};
+    void countStateChanges();
+
     friend detail::ProgramDeleter;
     friend detail::ShaderDeleter;
     friend detail::BufferDeleter;
@@ -292,6 +360,23 @@ private:
 
     std::vector<TextureID> pooledTextures;
 
+    // The storage allocated for each texture. Pooled textures are preferably reused for
+    // images of the same size, whose upload then doesn't need to reallocate it.
+    class TextureStorage {
+    public:
+        Size size;
+        TextureFormat format;
+        TextureType type;
+
+        std::size_t bytes() const;
+
+        bool operator==(const TextureStorage& other) const {
+            return size == other.size && format == other.format && type == other.type;
+        }
+    };
+    std::unordered_map<TextureID, TextureStorage> textureStorage;
+    std::size_t pooledTextureBytes = 0;
+
     std::vector<ProgramID> abandonedPrograms;
     std::vector<ShaderID> abandonedShaders;
     std::vector<BufferID> abandonedBuffers;
@@ -308,6 +393,9 @@ public:
 #else
     bool disableVAOExtension = false;
 #endif
+
+    // For testing the synchronous fallback of FramebufferReader.
+    bool disablePixelBufferExtension = false;
 };
 
 } // namespace gl
@@ -14,10 +14,6 @@ public:
 
     static constexpr std::size_t bufferGroupSize = 1;
     static constexpr PrimitiveType primitiveType = PrimitiveType::Points;
-
-    explicit Points(float pointSize_) : pointSize(pointSize_) {}
-
-    float pointSize;
 };
 
 class Lines {
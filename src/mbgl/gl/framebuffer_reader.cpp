@@ -0,0 +1,69 @@
+#include <mbgl/gl/framebuffer_reader.hpp>
+#include <mbgl/gl/context.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace mbgl {
+namespace gl {
+
+FramebufferReader::FramebufferReader(Context& context_)
+    : context(context_) {
+}
+
+FramebufferReader::~FramebufferReader() = default;
+
+void FramebufferReader::read(const Size size) {
+    Frame frame;
+    frame.size = size;
+
+    if (context.supportsPixelBuffers()) {
+        const std::size_t bytes = size.area() * PremultipliedImage::channels;
+
+        auto it = std::find_if(pool.begin(), pool.end(), [&](const auto& entry) {
+            return entry.second >= bytes;
+        });
+        if (it != pool.end()) {
+            frame.buffer = std::move(it->first);
+            frame.capacity = it->second;
+            pool.erase(it);
+        } else {
+            frame.buffer = context.createPixelBuffer(bytes);
+            frame.capacity = bytes;
+        }
+
+        context.readFramebuffer(*frame.buffer, size, TextureFormat::RGBA);
+    } else {
+        context.readFramebuffer(frame.image, size, false);
+    }
+
+    frames.push_back(std::move(frame));
+}
+
+PremultipliedImage FramebufferReader::take(const bool flip) {
+    PremultipliedImage image;
+    take(image, flip);
+    return image;
+}
+
+void FramebufferReader::take(PremultipliedImage& image, const bool flip) {
+    assert(!frames.empty());
+    Frame frame = std::move(frames.front());
+    frames.pop_front();
+
+    if (frame.buffer) {
+        if (image.size != frame.size || !image.data) {
+            image = PremultipliedImage(frame.size);
+        }
+        context.readPixelBuffer(*frame.buffer, frame.size, TextureFormat::RGBA, flip, image.data.get());
+        pool.emplace_back(std::move(*frame.buffer), frame.capacity);
+    } else {
+        image = std::move(frame.image);
+        if (flip) {
+            image.flip();
+        }
+    }
+}
+
+} // namespace gl
+} // namespace mbgl
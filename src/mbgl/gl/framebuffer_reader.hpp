@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/gl/object.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+namespace gl {
+
+class Context;
+
+// Reads rendered frames back from the GPU. When the context supports pixel pack
+// buffers, read() only queues the transfer, so that the next frame can be rendered
+// while the previous one is copied; take() then waits for the oldest frame. Buffers
+// are pooled and reused. Without pixel buffers, read() is synchronous.
+class FramebufferReader : private util::noncopyable {
+public:
+    FramebufferReader(Context&);
+    ~FramebufferReader();
+
+    // Starts reading the bound framebuffer.
+    void read(Size);
+
+    std::size_t pending() const {
+        return frames.size();
+    }
+
+    // Returns the oldest pending frame. Rows are bottom-up, in the order OpenGL stores
+    // them, unless `flip` is set.
+    PremultipliedImage take(bool flip = true);
+
+    // Like take(), but reuses the storage of `image` when it has the right size.
+    void take(PremultipliedImage& image, bool flip = true);
+
+private:
+    class Frame {
+    public:
+        Size size;
+        std::size_t capacity = 0;
+        optional<UniqueBuffer> buffer;
+        PremultipliedImage image;
+    };
+
+    Context& context;
+    std::deque<Frame> frames;
+
+    // Idle pixel buffers and their capacity in bytes.
+    std::vector<std::pair<UniqueBuffer, std::size_t>> pool;
+};
+
+} // namespace gl
+} // namespace mbgl
@@ -24,10 +24,14 @@ void BufferDeleter::operator()(BufferID id) const {
 
 void TextureDeleter::operator()(TextureID id) const {
     assert(context);
-    if (context->pooledTextures.size() >= TextureMax) {
+    const auto storage = context->textureStorage.find(id);
+    const std::size_t bytes = storage != context->textureStorage.end() ? storage->second.bytes() : 0;
+    if (context->pooledTextures.size() >= TextureMax ||
+        context->pooledTextureBytes + bytes > TexturePoolMaxBytes) {
         context->abandonedTextures.push_back(id);
     } else {
         context->pooledTextures.push_back(id);
+        context->pooledTextureBytes += bytes;
     }
 }
 
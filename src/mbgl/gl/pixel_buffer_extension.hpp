@@ -0,0 +1,51 @@
+#pragma once
+
+#include <mbgl/gl/extension.hpp>
+#include <mbgl/gl/gl.hpp>
+
+#ifndef GL_PIXEL_PACK_BUFFER
+#define GL_PIXEL_PACK_BUFFER              0x88EB
+#endif
+#ifndef GL_STREAM_READ
+#define GL_STREAM_READ                    0x88E1
+#endif
+#ifndef GL_MAP_READ_BIT
+#define GL_MAP_READ_BIT                   0x0001
+#endif
+
+namespace mbgl {
+namespace gl {
+namespace extension {
+
+class PixelBuffer {
+public:
+    template <typename Fn>
+    PixelBuffer(const Fn& loadExtension)
+        : mapBufferRange(
+              loadExtension({ { "GL_ARB_map_buffer_range", "glMapBufferRange" },
+                              { "GL_EXT_map_buffer_range", "glMapBufferRangeEXT" } })),
+          unmapBuffer(
+              loadExtension({ { "GL_ARB_map_buffer_range", "glUnmapBuffer" },
+                              { "GL_OES_mapbuffer", "glUnmapBufferOES" } })),
+          packBuffer(
+              loadExtension({ { "GL_ARB_pixel_buffer_object", "glBindBuffer" },
+                              { "GL_NV_pixel_buffer_object", "glBindBuffer" } }) != nullptr) {
+    }
+
+    bool supported() const {
+        return mapBufferRange && unmapBuffer && packBuffer;
+    }
+
+    const ExtensionFunction<void*(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)>
+        mapBufferRange;
+
+    const ExtensionFunction<GLboolean(GLenum target)> unmapBuffer;
+
+    // Whether buffers can be bound to GL_PIXEL_PACK_BUFFER, which makes glReadPixels
+    // write into the buffer instead of waiting for the GPU to finish rendering.
+    const bool packBuffer;
+};
+
+} // namespace extension
+} // namespace gl
+} // namespace mbgl
@@ -133,7 +133,7 @@ public:
 
         context.program = program;
 
-        Uniforms::bind(uniformsState, uniformValues);
+        context.countUniformUploads(Uniforms::bind(uniformsState, uniformValues));
 
         vertexArray.bind(context,
                         indexBuffer.buffer,
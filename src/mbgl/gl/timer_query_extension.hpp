@@ -0,0 +1,69 @@
+#pragma once
+
+#include <mbgl/gl/extension.hpp>
+#include <mbgl/gl/gl.hpp>
+
+#include <cstdint>
+
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT                   0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE         0x8867
+#endif
+#ifndef GL_TIMESTAMP
+#define GL_TIMESTAMP                      0x8E28
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT               0x8FBB
+#endif
+
+namespace mbgl {
+namespace gl {
+namespace extension {
+
+class TimerQuery {
+public:
+    template <typename Fn>
+    TimerQuery(const Fn& loadExtension)
+        : genQueries(
+              loadExtension({ { "GL_ARB_timer_query", "glGenQueries" },
+                              { "GL_EXT_disjoint_timer_query", "glGenQueriesEXT" } })),
+          deleteQueries(
+              loadExtension({ { "GL_ARB_timer_query", "glDeleteQueries" },
+                              { "GL_EXT_disjoint_timer_query", "glDeleteQueriesEXT" } })),
+          queryCounter(
+              loadExtension({ { "GL_ARB_timer_query", "glQueryCounter" },
+                              { "GL_EXT_disjoint_timer_query", "glQueryCounterEXT" } })),
+          getQueryObjectiv(
+              loadExtension({ { "GL_ARB_timer_query", "glGetQueryObjectiv" },
+                              { "GL_EXT_disjoint_timer_query", "glGetQueryObjectivEXT" } })),
+          getQueryObjectui64v(
+              loadExtension({ { "GL_ARB_timer_query", "glGetQueryObjectui64v" },
+                              { "GL_EXT_disjoint_timer_query", "glGetQueryObjectui64vEXT" } })),
+          disjoint(
+              loadExtension({ { "GL_EXT_disjoint_timer_query", "glGenQueriesEXT" } }) != nullptr) {
+    }
+
+    bool supported() const {
+        return genQueries && deleteQueries && queryCounter && getQueryObjectiv && getQueryObjectui64v;
+    }
+
+    const ExtensionFunction<void(GLsizei n, GLuint* ids)> genQueries;
+
+    const ExtensionFunction<void(GLsizei n, const GLuint* ids)> deleteQueries;
+
+    const ExtensionFunction<void(GLuint id, GLenum target)> queryCounter;
+
+    const ExtensionFunction<void(GLuint id, GLenum pname, GLint* params)> getQueryObjectiv;
+
+    const ExtensionFunction<void(GLuint id, GLenum pname, uint64_t* params)> getQueryObjectui64v;
+
+    // The EXT flavor can report that timings were invalidated, e.g. by a frequency
+    // change or a context switch, through GL_GPU_DISJOINT_EXT.
+    const bool disjoint;
+};
+
+} // namespace extension
+} // namespace gl
+} // namespace mbgl
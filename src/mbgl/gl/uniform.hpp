@@ -51,10 +51,17 @@ public:
         State(UniformLocation location_) : location(std::move(location_)) {}
 
         void operator=(const Value& value) {
+            set(value);
+        }
+
+        // Returns whether the value differed from the current one and was uploaded.
+        bool set(const Value& value) {
             if (location >= 0 && (!current || *current != value.t)) {
                 current = value.t;
                 bindUniform(location, value.t);
+                return true;
             }
+            return false;
         }
 
         UniformLocation location;
@@ -115,8 +122,11 @@ public:
         return NamedLocations{ { Us::name(), state.template get<Us>().location }... };
     }
 
-    static void bind(State& state, const Values& values) {
-        util::ignore({ (state.template get<Us>() = values.template get<Us>(), 0)... });
+    // Returns the number of uniforms that were uploaded.
+    static std::size_t bind(State& state, const Values& values) {
+        std::size_t uploads = 0;
+        util::ignore({ (uploads += state.template get<Us>().set(values.template get<Us>()), 0)... });
+        return uploads;
     }
 };
 
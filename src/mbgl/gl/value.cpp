@@ -413,16 +413,20 @@ PixelStoreUnpack::Type PixelStoreUnpack::Get() {
 
 #if not MBGL_USE_GLES2
 
-const constexpr PointSize::Type PointSize::Default;
+#ifndef GL_VERTEX_PROGRAM_POINT_SIZE
+#define GL_VERTEX_PROGRAM_POINT_SIZE 0x8642
+#endif
+
+const constexpr ProgramPointSize::Type ProgramPointSize::Default;
 
-void PointSize::Set(const Type& value) {
-    MBGL_CHECK_ERROR(glPointSize(value));
+void ProgramPointSize::Set(const Type& value) {
+    MBGL_CHECK_ERROR(value ? glEnable(GL_VERTEX_PROGRAM_POINT_SIZE) : glDisable(GL_VERTEX_PROGRAM_POINT_SIZE));
 }
 
-PointSize::Type PointSize::Get() {
-    GLfloat pointSize;
-    MBGL_CHECK_ERROR(glGetFloatv(GL_POINT_SIZE, &pointSize));
-    return pointSize;
+ProgramPointSize::Type ProgramPointSize::Get() {
+    Type programPointSize;
+    MBGL_CHECK_ERROR(programPointSize = glIsEnabled(GL_VERTEX_PROGRAM_POINT_SIZE));
+    return programPointSize;
 }
 
 const constexpr PixelZoom::Type PixelZoom::Default;
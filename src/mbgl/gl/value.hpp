@@ -262,9 +262,9 @@ struct PixelStoreUnpack {
 
 #if not MBGL_USE_GLES2
 
-struct PointSize {
-    using Type = float;
-    static const constexpr Type Default = 1;
+struct ProgramPointSize {
+    using Type = bool;
+    static const constexpr Type Default = false;
     static void Set(const Type&);
     static Type Get();
 };
@@ -1,6 +1,7 @@
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/layout/merge_lines.hpp>
 #include <mbgl/layout/clip_lines.hpp>
+#include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
@@ -38,10 +39,13 @@ static bool has(const style::SymbolLayoutProperties::PossiblyEvaluated& layout)
 SymbolLayout::SymbolLayout(const BucketParameters& parameters,
                            const std::vector<const RenderLayer*>& layers,
                            std::unique_ptr<GeometryTileLayer> sourceLayer_,
+                           FeatureIndex& featureIndex,
                            ImageDependencies& imageDependencies,
                            GlyphDependencies& glyphDependencies)
     : bucketLeaderID(layers.at(0)->getID()),
       sourceLayer(std::move(sourceLayer_)),
+      indexedSourceLayerName(featureIndex.intern(sourceLayer->getName())),
+      indexedBucketLeaderID(featureIndex.intern(bucketLeaderID)),
       overscaling(parameters.tileID.overscaleFactor()),
       zoom(parameters.tileID.overscaledZ),
       mode(parameters.mode),
@@ -271,7 +275,7 @@ void SymbolLayout::addFeature(const std::size_t layoutFeatureIndex,
                                                   : layout.get<SymbolPlacement>();
 
     const float textRepeatDistance = symbolSpacing / 2;
-    IndexedSubfeature indexedFeature(feature.index, sourceLayer->getName(), bucketLeaderID, symbolInstances.size());
+    IndexedSubfeature indexedFeature(feature.index, indexedSourceLayerName, indexedBucketLeaderID, symbolInstances.size());
 
     auto addSymbolInstance = [&] (const GeometryCoordinates& line, Anchor& anchor) {
         // https://github.com/mapbox/vector-tile-spec/tree/master/2.1#41-layers
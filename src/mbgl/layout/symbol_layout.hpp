@@ -7,6 +7,7 @@
 #include <mbgl/text/bidi.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/programs/symbol_program.hpp>
+#include <mbgl/util/string_indexer.hpp>
 
 #include <memory>
 #include <map>
@@ -16,6 +17,7 @@
 namespace mbgl {
 
 class BucketParameters;
+class FeatureIndex;
 class SymbolBucket;
 class Anchor;
 class RenderLayer;
@@ -30,6 +32,7 @@ public:
     SymbolLayout(const BucketParameters&,
                  const std::vector<const RenderLayer*>&,
                  std::unique_ptr<GeometryTileLayer>,
+                 FeatureIndex&,
                  ImageDependencies&,
                  GlyphDependencies&);
 
@@ -69,6 +72,9 @@ private:
     // Stores the layer so that we can hold on to GeometryTileFeature instances in SymbolFeature,
     // which may reference data from this object.
     const std::unique_ptr<GeometryTileLayer> sourceLayer;
+    // Interned into the tile's feature index once here rather than for every feature.
+    const StringIdentity indexedSourceLayerName;
+    const StringIdentity indexedBucketLeaderID;
     const float overscaling;
     const float zoom;
     const MapMode mode;
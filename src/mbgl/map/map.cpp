@@ -781,8 +781,12 @@ void Map::Impl::onUpdate() {
         style->impl->getImageImpls(),
         style->impl->getSourceImpls(),
         style->impl->getLayerImpls(),
+        style->impl->getImageJournal(),
+        style->impl->getSourceJournal(),
+        style->impl->getLayerJournal(),
         annotationManager,
         prefetchZoomDelta,
+        transform.getPrefetchStates(timePoint),
         bool(stillImageRequest)
     };
 
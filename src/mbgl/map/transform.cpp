@@ -17,6 +17,14 @@
 
 namespace mbgl {
 
+// Number of samples taken along the path of an animation.
+static const int transitionSampleCount = 4;
+
+// How far ahead a pan gesture is extrapolated, and how long a pause in the gesture
+// may be before its velocity is no longer trusted.
+static const Duration gestureLookahead = std::chrono::milliseconds(500);
+static const Duration gestureTimeout = std::chrono::milliseconds(100);
+
 /** Converts the given angle (in radians) to be numerically close to the anchor angle, allowing it to be interpolated properly without sudden jumps. */
 static double _normalizeAngle(double angle, double anchorAngle)
 {
@@ -613,6 +621,8 @@ void Transform::startTransition(const CameraOptions& camera,
         observer.onCameraDidChange(isAnimated ? MapObserver::CameraChangeMode::Animated : MapObserver::CameraChangeMode::Immediate);
     };
 
+    transitionSamples.clear();
+
     if (!isAnimated) {
         auto update = std::move(transitionFrameFn);
         auto finish = std::move(transitionFinishFn);
@@ -620,9 +630,71 @@ void Transform::startTransition(const CameraOptions& camera,
         transitionFrameFn = nullptr;
         transitionFinishFn = nullptr;
 
-        update(Clock::now());
+        const TimePoint now = Clock::now();
+        update(now);
         finish();
+
+        if (state.isGestureInProgress()) {
+            updateGestureVelocity(now);
+        }
+        return;
+    }
+
+    // Evaluate the path ahead of time on the state, and put the state back afterwards.
+    // Both frame functions only modify the state.
+    const TransformState current = state;
+    const util::UnitBezier ease = animation.easing ? *animation.easing : util::DEFAULT_TRANSITION_EASE;
+    for (int i = 1; i <= transitionSampleCount; i++) {
+        const double t = double(i) / transitionSampleCount;
+        frame(i == transitionSampleCount ? 1.0 : ease.solve(t, 0.001));
+        if (anchor) state.moveLatLng(anchorLatLng, *anchor);
+        transitionSamples.emplace_back(transitionStart + std::chrono::duration_cast<Duration>(duration * t), state);
+    }
+    state = current;
+}
+
+void Transform::updateGestureVelocity(const TimePoint& now) {
+    const Point<double> point = Projection::project(state.getLatLng(), 1.0);
+    const double seconds = std::chrono::duration<double>(now - gestureTime).count();
+
+    if (now - gestureTime < gestureTimeout && seconds > 0) {
+        // Smooth out the jitter of individual touch events.
+        const Point<double> velocity = (point - gesturePoint) / seconds;
+        gestureVelocity = (gestureVelocity + velocity) / 2.0;
+    } else {
+        gestureVelocity = {};
+    }
+
+    gesturePoint = point;
+    gestureTime = now;
+}
+
+std::vector<TransformState> Transform::getPrefetchStates(const TimePoint& now) const {
+    std::vector<TransformState> states;
+
+    if (inTransition()) {
+        for (const auto& sample : transitionSamples) {
+            if (sample.first > now) {
+                states.push_back(sample.second);
+            }
+        }
+    } else if (state.isGestureInProgress() && now - gestureTime < gestureTimeout &&
+               (gestureVelocity.x != 0 || gestureVelocity.y != 0)) {
+        Point<double> offset = gestureVelocity * std::chrono::duration<double>(gestureLookahead).count();
+
+        // Don't look further ahead than a screenful.
+        const double distance = ::hypot(offset.x, offset.y);
+        const double maxDistance = std::max(state.size.width, state.size.height) / state.scale;
+        if (distance > maxDistance) {
+            offset = offset * (maxDistance / distance);
+        }
+
+        TransformState predicted = state;
+        predicted.setLatLngZoom(Projection::unproject(gesturePoint + offset, 1.0), state.getZoom());
+        states.push_back(std::move(predicted));
     }
+
+    return states;
 }
 
 bool Transform::inTransition() const {
@@ -12,6 +12,8 @@
 #include <cstdint>
 #include <cmath>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -144,6 +146,13 @@ public:
     void setGestureInProgress(bool);
     bool isGestureInProgress() const { return state.isGestureInProgress(); }
 
+    // Prefetching
+    /** Returns the states the camera is expected to pass through or come to rest at
+        soon, nearest first: the remaining samples of the path of the current
+        animation or, during a gesture, the current state moved on by the velocity
+        of the recent pans. */
+    std::vector<TransformState> getPrefetchStates(const TimePoint& now) const;
+
     // Transform state
     const TransformState& getState() const { return state; }
     bool isRotating() const { return state.isRotating(); }
@@ -163,10 +172,21 @@ private:
                          std::function<void(double)>,
                          const Duration&);
 
+    void updateGestureVelocity(const TimePoint& now);
+
     TimePoint transitionStart;
     Duration transitionDuration;
     std::function<bool(const TimePoint)> transitionFrameFn;
     std::function<void()> transitionFinishFn;
+
+    // States along the path of the current animation, with the time they are reached.
+    std::vector<std::pair<TimePoint, TransformState>> transitionSamples;
+
+    // Position of the center in world coordinates at scale 1 when the gesture last
+    // moved the map, and its velocity in those units per second.
+    TimePoint gestureTime;
+    Point<double> gesturePoint;
+    Point<double> gestureVelocity;
 };
 
 } // namespace mbgl
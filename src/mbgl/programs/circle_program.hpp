@@ -4,6 +4,7 @@
 #include <mbgl/programs/attributes.hpp>
 #include <mbgl/programs/uniforms.hpp>
 #include <mbgl/shaders/circle.hpp>
+#include <mbgl/shaders/circle_point.hpp>
 #include <mbgl/util/geometry.hpp>
 #include <mbgl/style/layers/circle_layer_properties.hpp>
 
@@ -45,6 +46,30 @@ public:
     }
 };
 
+// Draws each circle of a point cloud source as a single point sprite.
+class CirclePointProgram : public Program<
+    shaders::circle_point,
+    gl::Point,
+    gl::Attributes<
+        attributes::a_pos>,
+    gl::Uniforms<
+        uniforms::u_matrix,
+        uniforms::u_scale_with_map,
+        uniforms::u_world,
+        uniforms::u_pixel_ratio,
+        uniforms::u_camera_to_center_distance>,
+    style::CirclePaintProperties>
+{
+public:
+    using Program::Program;
+
+    static LayoutVertex vertex(Point<int16_t> p) {
+        return LayoutVertex {
+            {{ p.x, p.y }}
+        };
+    }
+};
+
 using CircleLayoutVertex = CircleProgram::LayoutVertex;
 using CircleAttributes = CircleProgram::Attributes;
 
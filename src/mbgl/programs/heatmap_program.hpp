@@ -4,6 +4,7 @@
 #include <mbgl/programs/attributes.hpp>
 #include <mbgl/programs/uniforms.hpp>
 #include <mbgl/shaders/heatmap.hpp>
+#include <mbgl/shaders/heatmap_point.hpp>
 #include <mbgl/util/geometry.hpp>
 #include <mbgl/style/layers/heatmap_layer_properties.hpp>
 
@@ -43,6 +44,30 @@ public:
     }
 };
 
+// Draws the kernel of each point of a point cloud source as a single point sprite.
+class HeatmapPointProgram : public Program<
+    shaders::heatmap_point,
+    gl::Point,
+    gl::Attributes<
+        attributes::a_pos>,
+    gl::Uniforms<
+        uniforms::u_intensity,
+        uniforms::u_matrix,
+        uniforms::u_world,
+        uniforms::u_pixel_ratio,
+        uniforms::u_camera_to_center_distance>,
+    style::HeatmapPaintProperties>
+{
+public:
+    using Program::Program;
+
+    static LayoutVertex vertex(Point<int16_t> p) {
+        return LayoutVertex {
+            {{ p.x, p.y }}
+        };
+    }
+};
+
 using HeatmapLayoutVertex = HeatmapProgram::LayoutVertex;
 using HeatmapAttributes = HeatmapProgram::Attributes;
 
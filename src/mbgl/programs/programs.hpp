@@ -25,6 +25,7 @@ public:
         : background(context, programParameters),
           backgroundPattern(context, programParameters),
           circle(context, programParameters),
+          circlePoint(context, programParameters),
           extrusionTexture(context, programParameters),
           fill(context, programParameters),
           fillExtrusion(context, programParameters),
@@ -33,6 +34,7 @@ public:
           fillOutline(context, programParameters),
           fillOutlinePattern(context, programParameters),
           heatmap(context, programParameters),
+          heatmapPoint(context, programParameters),
           heatmapTexture(context, programParameters),
           hillshade(context, programParameters),
           hillshadePrepare(context, programParameters),
@@ -52,6 +54,7 @@ public:
     BackgroundProgram background;
     BackgroundPatternProgram backgroundPattern;
     ProgramMap<CircleProgram> circle;
+    ProgramMap<CirclePointProgram> circlePoint;
     ExtrusionTextureProgram extrusionTexture;
     ProgramMap<FillProgram> fill;
     ProgramMap<FillExtrusionProgram> fillExtrusion;
@@ -60,6 +63,7 @@ public:
     ProgramMap<FillOutlineProgram> fillOutline;
     ProgramMap<FillOutlinePatternProgram> fillOutlinePattern;
     ProgramMap<HeatmapProgram> heatmap;
+    ProgramMap<HeatmapPointProgram> heatmapPoint;
     HeatmapTextureProgram heatmapTexture;
     HillshadeProgram hillshade;
     HillshadePrepareProgram hillshadePrepare;
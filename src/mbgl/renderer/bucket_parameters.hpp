@@ -10,6 +10,14 @@ public:
     const OverscaledTileID tileID;
     const MapMode mode;
     const float pixelRatio;
+
+    // Tolerance, in pixels, for simplifying line geometry before building line buckets.
+    // Zero disables simplification.
+    const float lineSimplificationTolerance = 0;
+
+    // Whether the tile holds only the points of a point cloud source. Circle and heatmap
+    // buckets then emit a single vertex per point, drawn as point sprites.
+    const bool pointCloud = false;
 };
 
 } // namespace mbgl
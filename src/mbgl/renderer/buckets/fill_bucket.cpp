@@ -5,22 +5,8 @@
 #include <mbgl/renderer/layers/render_fill_layer.hpp>
 #include <mbgl/util/math.hpp>
 
-#include <mapbox/earcut.hpp>
-
 #include <cassert>
 
-namespace mapbox {
-namespace util {
-template <> struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
-};
-
-template <> struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 
 using namespace style;
@@ -41,72 +27,74 @@ FillBucket::FillBucket(const BucketParameters& parameters, const std::vector<con
 
 void FillBucket::addFeature(const GeometryTileFeature& feature,
                             const GeometryCollection& geometry) {
-    for (auto& polygon : classifyRings(geometry)) {
-        // Optimize polygons with many interior rings for earcut tesselation.
-        limitHoles(polygon, 500);
-
-        std::size_t totalVertices = 0;
-
-        for (const auto& ring : polygon) {
-            totalVertices += ring.size();
-            if (totalVertices > std::numeric_limits<uint16_t>::max())
-                throw GeometryTooLongException();
+    if (geometry.size() == 1) {
+        // A single ring is a polygon on its own; no need to classify (and copy) it.
+        addPolygon(geometry);
+    } else {
+        for (auto& polygon : classifyRings(geometry)) {
+            // Optimize polygons with many interior rings for earcut tesselation.
+            limitHoles(polygon, 500);
+            addPolygon(polygon);
         }
+    }
 
-        std::size_t startVertices = vertices.vertexSize();
-
-        for (const auto& ring : polygon) {
-            std::size_t nVertices = ring.size();
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertices.vertexSize());
+    }
+}
 
-            if (nVertices == 0)
-                continue;
+void FillBucket::addPolygon(const GeometryCollection& polygon) {
+    std::size_t totalVertices = 0;
 
-            if (lineSegments.empty() || lineSegments.back().vertexLength + nVertices > std::numeric_limits<uint16_t>::max()) {
-                lineSegments.emplace_back(vertices.vertexSize(), lines.indexSize());
-            }
+    for (const auto& ring : polygon) {
+        totalVertices += ring.size();
+        if (totalVertices > std::numeric_limits<uint16_t>::max())
+            throw GeometryTooLongException();
+    }
 
-            auto& lineSegment = lineSegments.back();
-            assert(lineSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-            uint16_t lineIndex = lineSegment.vertexLength;
+    std::size_t startVertices = vertices.vertexSize();
 
-            vertices.emplace_back(FillProgram::layoutVertex(ring[0]));
-            lines.emplace_back(lineIndex + nVertices - 1, lineIndex);
+    for (const auto& ring : polygon) {
+        std::size_t nVertices = ring.size();
 
-            for (uint32_t i = 1; i < nVertices; i++) {
-                vertices.emplace_back(FillProgram::layoutVertex(ring[i]));
-                lines.emplace_back(lineIndex + i - 1, lineIndex + i);
-            }
+        if (nVertices == 0)
+            continue;
 
-            lineSegment.vertexLength += nVertices;
-            lineSegment.indexLength += nVertices * 2;
+        if (lineSegments.empty() || lineSegments.back().vertexLength + nVertices > std::numeric_limits<uint16_t>::max()) {
+            lineSegments.emplace_back(vertices.vertexSize(), lines.indexSize());
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
-
-        std::size_t nIndicies = indices.size();
-        assert(nIndicies % 3 == 0);
-
-        if (triangleSegments.empty() || triangleSegments.back().vertexLength + totalVertices > std::numeric_limits<uint16_t>::max()) {
-            triangleSegments.emplace_back(startVertices, triangles.indexSize());
-        }
+        auto& lineSegment = lineSegments.back();
+        assert(lineSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
+        uint16_t lineIndex = lineSegment.vertexLength;
 
-        auto& triangleSegment = triangleSegments.back();
-        assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-        uint16_t triangleIndex = triangleSegment.vertexLength;
+        vertices.emplace_back(FillProgram::layoutVertex(ring[0]));
+        lines.emplace_back(lineIndex + nVertices - 1, lineIndex);
 
-        for (uint32_t i = 0; i < nIndicies; i += 3) {
-            triangles.emplace_back(triangleIndex + indices[i],
-                                   triangleIndex + indices[i + 1],
-                                   triangleIndex + indices[i + 2]);
+        for (uint32_t i = 1; i < nVertices; i++) {
+            vertices.emplace_back(FillProgram::layoutVertex(ring[i]));
+            lines.emplace_back(lineIndex + i - 1, lineIndex + i);
         }
 
-        triangleSegment.vertexLength += totalVertices;
-        triangleSegment.indexLength += nIndicies;
+        lineSegment.vertexLength += nVertices;
+        lineSegment.indexLength += nVertices * 2;
     }
 
-    for (auto& pair : paintPropertyBinders) {
-        pair.second.populateVertexVectors(feature, vertices.vertexSize());
+    if (triangleSegments.empty() || triangleSegments.back().vertexLength + totalVertices > std::numeric_limits<uint16_t>::max()) {
+        triangleSegments.emplace_back(startVertices, triangles.indexSize());
     }
+
+    auto& triangleSegment = triangleSegments.back();
+    assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
+    uint16_t triangleIndex = triangleSegment.vertexLength;
+
+    std::size_t nIndicies = tessellator.tessellate(polygon, [&] (uint32_t a, uint32_t b, uint32_t c) {
+        triangles.emplace_back(triangleIndex + a, triangleIndex + b, triangleIndex + c);
+    });
+    assert(nIndicies % 3 == 0);
+
+    triangleSegment.vertexLength += totalVertices;
+    triangleSegment.indexLength += nIndicies;
 }
 
 void FillBucket::upload(gl::Context& context) {
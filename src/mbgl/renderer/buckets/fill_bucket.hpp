@@ -2,6 +2,7 @@
 
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/geometry/polygon_tessellator.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/programs/segment.hpp>
@@ -37,6 +38,11 @@ public:
     optional<gl::IndexBuffer<gl::Triangles>> triangleIndexBuffer;
 
     std::map<std::string, FillProgram::PaintPropertyBinders> paintPropertyBinders;
+
+private:
+    void addPolygon(const GeometryCollection&);
+
+    PolygonTessellator tessellator;
 };
 
 template <>
@@ -6,28 +6,8 @@
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/constants.hpp>
 
-#include <mapbox/earcut.hpp>
-
 #include <cassert>
 
-namespace mapbox {
-namespace util {
-template <>
-struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) {
-        return t.x;
-    };
-};
-
-template <>
-struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) {
-        return t.y;
-    };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 
 using namespace style;
@@ -47,104 +27,107 @@ FillExtrusionBucket::FillExtrusionBucket(const BucketParameters& parameters, con
 
 void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
                                      const GeometryCollection& geometry) {
-    for (auto& polygon : classifyRings(geometry)) {
-        // Optimize polygons with many interior rings for earcut tesselation.
-        limitHoles(polygon, 500);
+    if (geometry.size() == 1) {
+        // A single ring is a polygon on its own; no need to classify (and copy) it.
+        addPolygon(geometry);
+    } else {
+        for (auto& polygon : classifyRings(geometry)) {
+            // Optimize polygons with many interior rings for earcut tesselation.
+            limitHoles(polygon, 500);
+            addPolygon(polygon);
+        }
+    }
 
-        std::size_t totalVertices = 0;
+    for (auto& pair : paintPropertyBinders) {
+        pair.second.populateVertexVectors(feature, vertices.vertexSize());
+    }
+}
 
-        for (const auto& ring : polygon) {
-            totalVertices += ring.size();
-            if (totalVertices > std::numeric_limits<uint16_t>::max())
-                throw GeometryTooLongException();
-        }
+void FillExtrusionBucket::addPolygon(const GeometryCollection& polygon) {
+    std::size_t totalVertices = 0;
 
-        if (totalVertices == 0) continue;
+    for (const auto& ring : polygon) {
+        totalVertices += ring.size();
+        if (totalVertices > std::numeric_limits<uint16_t>::max())
+            throw GeometryTooLongException();
+    }
 
-        std::vector<uint32_t> flatIndices;
-        flatIndices.reserve(totalVertices);
+    if (totalVertices == 0) return;
 
-        std::size_t startVertices = vertices.vertexSize();
+    flatIndices.clear();
+    flatIndices.reserve(totalVertices);
 
-        if (triangleSegments.empty() ||
-            triangleSegments.back().vertexLength + (5 * (totalVertices - 1) + 1) >
-                std::numeric_limits<uint16_t>::max()) {
-            triangleSegments.emplace_back(startVertices, triangles.indexSize());
-        }
+    std::size_t startVertices = vertices.vertexSize();
 
-        auto& triangleSegment = triangleSegments.back();
-        assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-        uint16_t triangleIndex = triangleSegment.vertexLength;
+    if (triangleSegments.empty() ||
+        triangleSegments.back().vertexLength + (5 * (totalVertices - 1) + 1) >
+            std::numeric_limits<uint16_t>::max()) {
+        triangleSegments.emplace_back(startVertices, triangles.indexSize());
+    }
 
-        assert(triangleIndex + (5 * (totalVertices - 1) + 1) <=
-               std::numeric_limits<uint16_t>::max());
+    auto& triangleSegment = triangleSegments.back();
+    assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
+    uint16_t triangleIndex = triangleSegment.vertexLength;
 
-        for (const auto& ring : polygon) {
-            std::size_t nVertices = ring.size();
+    assert(triangleIndex + (5 * (totalVertices - 1) + 1) <=
+           std::numeric_limits<uint16_t>::max());
 
-            if (nVertices == 0)
-                continue;
+    for (const auto& ring : polygon) {
+        std::size_t nVertices = ring.size();
 
-            std::size_t edgeDistance = 0;
+        if (nVertices == 0)
+            continue;
 
-            for (uint32_t i = 0; i < nVertices; i++) {
-                const auto& p1 = ring[i];
+        std::size_t edgeDistance = 0;
 
-                vertices.emplace_back(
-                    FillExtrusionProgram::layoutVertex(p1, 0, 0, 1, 1, edgeDistance));
-                flatIndices.emplace_back(triangleIndex);
-                triangleIndex++;
-
-                if (i != 0) {
-                    const auto& p2 = ring[i - 1];
-
-                    const auto d1 = convertPoint<double>(p1);
-                    const auto d2 = convertPoint<double>(p2);
-
-                    const Point<double> perp = util::unit(util::perp(d1 - d2));
-                    const auto dist = util::dist<int16_t>(d1, d2);
-                    if (edgeDistance + dist > std::numeric_limits<int16_t>::max()) {
-                        edgeDistance = 0;
-                    }
-
-                    vertices.emplace_back(
-                        FillExtrusionProgram::layoutVertex(p1, perp.x, perp.y, 0, 0, edgeDistance));
-                    vertices.emplace_back(
-                        FillExtrusionProgram::layoutVertex(p1, perp.x, perp.y, 0, 1, edgeDistance));
-
-                    edgeDistance += dist;
-
-                    vertices.emplace_back(
-                        FillExtrusionProgram::layoutVertex(p2, perp.x, perp.y, 0, 0, edgeDistance));
-                    vertices.emplace_back(
-                        FillExtrusionProgram::layoutVertex(p2, perp.x, perp.y, 0, 1, edgeDistance));
-
-                    triangles.emplace_back(triangleIndex, triangleIndex + 1, triangleIndex + 2);
-                    triangles.emplace_back(triangleIndex + 1, triangleIndex + 2, triangleIndex + 3);
-                    triangleIndex += 4;
-                    triangleSegment.vertexLength += 4;
-                    triangleSegment.indexLength += 6;
+        for (uint32_t i = 0; i < nVertices; i++) {
+            const auto& p1 = ring[i];
+
+            vertices.emplace_back(
+                FillExtrusionProgram::layoutVertex(p1, 0, 0, 1, 1, edgeDistance));
+            flatIndices.emplace_back(triangleIndex);
+            triangleIndex++;
+
+            if (i != 0) {
+                const auto& p2 = ring[i - 1];
+
+                const auto d1 = convertPoint<double>(p1);
+                const auto d2 = convertPoint<double>(p2);
+
+                const Point<double> perp = util::unit(util::perp(d1 - d2));
+                const auto dist = util::dist<int16_t>(d1, d2);
+                if (edgeDistance + dist > std::numeric_limits<int16_t>::max()) {
+                    edgeDistance = 0;
                 }
-            }
-        }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+                vertices.emplace_back(
+                    FillExtrusionProgram::layoutVertex(p1, perp.x, perp.y, 0, 0, edgeDistance));
+                vertices.emplace_back(
+                    FillExtrusionProgram::layoutVertex(p1, perp.x, perp.y, 0, 1, edgeDistance));
 
-        std::size_t nIndices = indices.size();
-        assert(nIndices % 3 == 0);
+                edgeDistance += dist;
 
-        for (uint32_t i = 0; i < nIndices; i += 3) {
-            triangles.emplace_back(flatIndices[indices[i]], flatIndices[indices[i + 1]],
-                                   flatIndices[indices[i + 2]]);
-        }
+                vertices.emplace_back(
+                    FillExtrusionProgram::layoutVertex(p2, perp.x, perp.y, 0, 0, edgeDistance));
+                vertices.emplace_back(
+                    FillExtrusionProgram::layoutVertex(p2, perp.x, perp.y, 0, 1, edgeDistance));
 
-        triangleSegment.vertexLength += totalVertices;
-        triangleSegment.indexLength += nIndices;
+                triangles.emplace_back(triangleIndex, triangleIndex + 1, triangleIndex + 2);
+                triangles.emplace_back(triangleIndex + 1, triangleIndex + 2, triangleIndex + 3);
+                triangleIndex += 4;
+                triangleSegment.vertexLength += 4;
+                triangleSegment.indexLength += 6;
+            }
+        }
     }
 
-    for (auto& pair : paintPropertyBinders) {
-        pair.second.populateVertexVectors(feature, vertices.vertexSize());
-    }
+    std::size_t nIndices = tessellator.tessellate(polygon, [&] (uint32_t a, uint32_t b, uint32_t c) {
+        triangles.emplace_back(flatIndices[a], flatIndices[b], flatIndices[c]);
+    });
+    assert(nIndices % 3 == 0);
+
+    triangleSegment.vertexLength += totalVertices;
+    triangleSegment.indexLength += nIndices;
 }
 
 void FillExtrusionBucket::upload(gl::Context& context) {
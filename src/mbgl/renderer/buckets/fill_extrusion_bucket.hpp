@@ -2,6 +2,7 @@
 
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/geometry/polygon_tessellator.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/programs/segment.hpp>
@@ -32,6 +33,12 @@ public:
     optional<gl::IndexBuffer<gl::Triangles>> indexBuffer;
     
     std::unordered_map<std::string, FillExtrusionProgram::PaintPropertyBinders> paintPropertyBinders;
+
+private:
+    void addPolygon(const GeometryCollection&);
+
+    PolygonTessellator tessellator;
+    std::vector<uint32_t> flatIndices;
 };
 
 template <>
@@ -12,7 +12,8 @@ using namespace style;
 
 HeatmapBucket::HeatmapBucket(const BucketParameters& parameters, const std::vector<const RenderLayer*>& layers)
     : Bucket(LayerType::Heatmap),
-      mode(parameters.mode) {
+      mode(parameters.mode),
+      pointCloud(parameters.pointCloud) {
     for (const auto& layer : layers) {
         paintPropertyBinders.emplace(
             std::piecewise_construct,
@@ -25,7 +26,11 @@ HeatmapBucket::HeatmapBucket(const BucketParameters& parameters, const std::vect
 
 void HeatmapBucket::upload(gl::Context& context) {
     vertexBuffer = context.createVertexBuffer(std::move(vertices));
-    indexBuffer = context.createIndexBuffer(std::move(triangles));
+    if (pointCloud) {
+        spriteIndexBuffer = context.createIndexBuffer(std::move(sprites));
+    } else {
+        indexBuffer = context.createIndexBuffer(std::move(triangles));
+    }
 
     for (auto& pair : paintPropertyBinders) {
         pair.second.upload(context);
@@ -40,7 +45,7 @@ bool HeatmapBucket::hasData() const {
 
 void HeatmapBucket::addFeature(const GeometryTileFeature& feature,
                               const GeometryCollection& geometry) {
-    constexpr const uint16_t vertexLength = 4;
+    const uint16_t vertexLength = pointCloud ? 1 : 4;
 
     for (auto& points : geometry) {
         for(auto& point : points) {
@@ -55,7 +60,18 @@ void HeatmapBucket::addFeature(const GeometryTileFeature& feature,
 
             if (segments.empty() || segments.back().vertexLength + vertexLength > std::numeric_limits<uint16_t>::max()) {
                 // Move to a new segments because the old one can't hold the geometry.
-                segments.emplace_back(vertices.vertexSize(), triangles.indexSize());
+                segments.emplace_back(vertices.vertexSize(), pointCloud ? sprites.indexSize() : triangles.indexSize());
+            }
+
+            if (pointCloud) {
+                // A single vertex, drawn as a point sprite.
+                auto& segment = segments.back();
+                sprites.emplace_back(segment.vertexLength);
+                vertices.emplace_back(HeatmapPointProgram::vertex(point));
+
+                segment.vertexLength += 1;
+                segment.indexLength += 1;
+                continue;
             }
 
             // this geometry will be of the Point type, and we'll derive
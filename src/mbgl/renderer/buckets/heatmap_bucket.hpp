@@ -27,14 +27,18 @@ public:
 
     gl::VertexVector<HeatmapLayoutVertex> vertices;
     gl::IndexVector<gl::Triangles> triangles;
+    // Used instead of triangles for point cloud tiles, where each point is a single vertex.
+    gl::IndexVector<gl::Points> sprites;
     SegmentVector<HeatmapAttributes> segments;
 
     optional<gl::VertexBuffer<HeatmapLayoutVertex>> vertexBuffer;
     optional<gl::IndexBuffer<gl::Triangles>> indexBuffer;
+    optional<gl::IndexBuffer<gl::Points>> spriteIndexBuffer;
 
     std::map<std::string, HeatmapProgram::PaintPropertyBinders> paintPropertyBinders;
 
     const MapMode mode;
+    const bool pointCloud;
 };
 
 template <>
@@ -26,16 +26,46 @@ DEMData& HillshadeBucket::getDEMData() {
     return demdata;
 }
 
+void HillshadeBucket::prepare(const uint8_t zoom, const uint8_t maxzoom) {
+    slopes = Slopes { demdata.computeSlopes(zoom, maxzoom), zoom, maxzoom };
+}
+
+void HillshadeBucket::backfilled() {
+    if (slopes) {
+        // Only the outermost pixels depend on the border.
+        demdata.updateSlopeBorder(slopes->image, slopes->zoom, slopes->maxzoom);
+    } else {
+        // Runs through the prepare pass again with the backfilled DEM data.
+        prepared = false;
+    }
+    uploaded = false;
+}
+
 void HillshadeBucket::upload(gl::Context& context) {
     if (!hasData()) {
         return;
     }
 
 
-    const PremultipliedImage* image = demdata.getImage();
-    dem = context.createTexture(*image);
+    if (slopes) {
+        // Only the prepared texture is drawn, so the DEM data doesn't need to be uploaded.
+        if (texture) {
+            context.updateTexture(*texture, slopes->image);
+        } else {
+            texture = context.createTexture(slopes->image);
+        }
+        prepared = true;
+    } else {
+        const PremultipliedImage* image = demdata.getImage();
+        if (dem) {
+            context.updateTexture(*dem, *image);
+        } else {
+            dem = context.createTexture(*image);
+        }
+    }
 
-    if (!segments.empty()) {
+    // Buffers are kept when the bucket is only uploaded again for its textures.
+    if (!segments.empty() && !vertexBuffer) {
         vertexBuffer = context.createVertexBuffer(std::move(vertices));
         indexBuffer = context.createIndexBuffer(std::move(indices));
     }
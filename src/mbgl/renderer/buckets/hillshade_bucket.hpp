@@ -44,6 +44,14 @@ public:
         prepared = preparedState;
     }
 
+    // Computes the output of the prepare pass on the CPU. The bucket then uploads it as
+    // its texture instead of going through the pass. `maxzoom` is the maximum zoom level
+    // of the source.
+    void prepare(uint8_t zoom, uint8_t maxzoom);
+
+    // Called after the border of the DEM data has been backfilled from a neighboring tile.
+    void backfilled();
+
     // Raster-DEM Tile Sources use the default buffers from Painter
     gl::VertexVector<HillshadeLayoutVertex> vertices;
     gl::IndexVector<gl::Triangles> indices;
@@ -54,6 +62,14 @@ public:
 private: 
     DEMData demdata;
     bool prepared = false;
+
+    // Set if the bucket was prepared on the CPU.
+    struct Slopes {
+        PremultipliedImage image;
+        uint8_t zoom;
+        uint8_t maxzoom;
+    };
+    optional<Slopes> slopes;
 };
 
 template <>
@@ -17,7 +17,8 @@ LineBucket::LineBucket(const BucketParameters& parameters,
     : Bucket(LayerType::Line),
       layout(layout_.evaluate(PropertyEvaluationParameters(parameters.tileID.overscaledZ))),
       overscaling(parameters.tileID.overscaleFactor()),
-      zoom(parameters.tileID.overscaledZ) {
+      zoom(parameters.tileID.overscaledZ),
+      simplificationTolerance(parameters.lineSimplificationTolerance * (double(util::EXTENT) / (util::tileSize * overscaling))) {
     for (const auto& layer : layers) {
         paintPropertyBinders.emplace(
             std::piecewise_construct,
@@ -31,6 +32,19 @@ LineBucket::LineBucket(const BucketParameters& parameters,
 void LineBucket::addFeature(const GeometryTileFeature& feature,
                             const GeometryCollection& geometryCollection) {
     for (auto& line : geometryCollection) {
+        sourceVertexCount += line.size();
+
+        if (simplificationTolerance > 0) {
+            const GeometryCoordinates& simplified = simplifier(line, simplificationTolerance);
+            // Keep rings that would collapse into a spike as they are.
+            if (feature.getType() != FeatureType::Polygon || simplified.size() >= 4) {
+                simplifiedVertexCount += simplified.size();
+                addGeometry(simplified, feature);
+                continue;
+            }
+        }
+
+        simplifiedVertexCount += line.size();
         addGeometry(line, feature);
     }
 
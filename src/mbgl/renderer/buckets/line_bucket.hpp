@@ -2,6 +2,7 @@
 
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/geometry/line_simplifier.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/programs/segment.hpp>
@@ -40,6 +41,11 @@ public:
 
     std::map<std::string, LineProgram::PaintPropertyBinders> paintPropertyBinders;
 
+    // Number of line vertices before and after simplification. They are equal when
+    // simplification is disabled. Reported in the frame profile.
+    std::size_t sourceVertexCount = 0;
+    std::size_t simplifiedVertexCount = 0;
+
 private:
     void addGeometry(const GeometryCoordinates&, const GeometryTileFeature&);
 
@@ -61,6 +67,10 @@ private:
     const uint32_t overscaling;
     const float zoom;
 
+    // In tile units; zero if simplification is disabled.
+    const double simplificationTolerance;
+    LineSimplifier simplifier;
+
     float getLineWidth(const RenderLineLayer& layer) const;
 };
 
@@ -2,6 +2,7 @@
 #include <mbgl/renderer/layers/render_raster_layer.hpp>
 #include <mbgl/programs/raster_program.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/util/image_pool.hpp>
 
 namespace mbgl {
 
@@ -17,6 +18,14 @@ RasterBucket::RasterBucket(std::shared_ptr<PremultipliedImage> image_)
       image(image_) {
 }
 
+RasterBucket::~RasterBucket() {
+    // Images decoded for raster tiles aren't referenced elsewhere, and their buffers are
+    // reused for the tiles decoded next.
+    if (image && image.use_count() == 1) {
+        util::ImagePool::release(std::move(*image));
+    }
+}
+
 void RasterBucket::upload(gl::Context& context) {
     if (!hasData()) {
         return;
@@ -16,6 +16,7 @@ class RasterBucket : public Bucket {
 public:
     RasterBucket(PremultipliedImage&&);
     RasterBucket(std::shared_ptr<PremultipliedImage>);
+    ~RasterBucket() override;
 
     void upload(gl::Context&) override;
     bool hasData() const override;
@@ -0,0 +1,104 @@
+#include <mbgl/renderer/frame_profile.hpp>
+
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+namespace mbgl {
+
+namespace {
+
+using Writer = rapidjson::Writer<rapidjson::StringBuffer>;
+
+double microseconds(Duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void writeEvent(Writer& writer,
+                const std::string& name,
+                const char* category,
+                uint32_t thread,
+                double timestamp,
+                Duration duration,
+                const FrameProfile& profile,
+                const FrameCounters& counters) {
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(name);
+    writer.Key("cat");
+    writer.String(category);
+    writer.Key("ph");
+    writer.String("X");
+    writer.Key("pid");
+    writer.Uint(0);
+    writer.Key("tid");
+    writer.Uint(thread);
+    writer.Key("ts");
+    writer.Double(timestamp);
+    writer.Key("dur");
+    writer.Double(microseconds(duration));
+    writer.Key("args");
+    writer.StartObject();
+    writer.Key("frame");
+    writer.Uint64(profile.frame);
+    writer.Key("drawCalls");
+    writer.Uint64(counters.drawCalls);
+    writer.Key("vertices");
+    writer.Uint64(counters.vertices);
+    writer.Key("uploadBytes");
+    writer.Uint64(counters.uploadBytes);
+    writer.Key("programSwitches");
+    writer.Uint64(counters.programSwitches);
+    writer.Key("textureSwitches");
+    writer.Uint64(counters.textureSwitches);
+    writer.Key("uniformUploads");
+    writer.Uint64(counters.uniformUploads);
+    writer.Key("lineSourceVertices");
+    writer.Uint64(counters.lineSourceVertices);
+    writer.Key("lineSimplifiedVertices");
+    writer.Uint64(counters.lineSimplifiedVertices);
+    writer.EndObject();
+    writer.EndObject();
+}
+
+} // namespace
+
+std::string encodeTraceEvents(const std::vector<FrameProfile>& profiles) {
+    rapidjson::StringBuffer buffer;
+    Writer writer(buffer);
+
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+
+    if (!profiles.empty()) {
+        // Timestamps are relative to the first frame. GPU sections are aligned with
+        // the CPU start of their frame, since the two clocks aren't related.
+        const TimePoint origin = profiles.front().start;
+
+        for (const auto& profile : profiles) {
+            const double start = microseconds(profile.start - origin);
+
+            writeEvent(writer, "frame", "frame", 0, start, profile.cpuTime, profile, profile.counters);
+            if (profile.gpuTime) {
+                writeEvent(writer, "frame", "frame", 1, start, *profile.gpuTime, profile, profile.counters);
+            }
+
+            for (const auto& section : profile.sections) {
+                const char* category = section.phase.empty() ? "phase" : "layer";
+                writeEvent(writer, section.name, category, 0, start + microseconds(section.begin),
+                           section.cpuTime, profile, section.counters);
+                if (section.gpuBegin && section.gpuTime) {
+                    writeEvent(writer, section.name, category, 1, start + microseconds(*section.gpuBegin),
+                               *section.gpuTime, profile, section.counters);
+                }
+            }
+        }
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+
+    return buffer.GetString();
+}
+
+} // namespace mbgl
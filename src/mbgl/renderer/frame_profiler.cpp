@@ -0,0 +1,240 @@
+#include <mbgl/renderer/frame_profiler.hpp>
+#include <mbgl/gl/timer_query_extension.hpp>
+
+#include <cassert>
+
+namespace mbgl {
+
+namespace {
+
+// Frames whose GPU timings aren't available after this many frames are finished
+// without them, so that a GPU that never reports back doesn't make us leak.
+constexpr std::size_t maxPendingFrames = 4;
+
+constexpr GLsizei queryBatchSize = 32;
+
+} // namespace
+
+FrameProfiler::FrameProfiler(gl::Context& context_)
+    : context(context_) {
+    auto extension = context.getTimerQueryExtension();
+    if (extension && extension->supported()) {
+        timerQuery = extension;
+    }
+}
+
+FrameProfiler::~FrameProfiler() {
+    if (current) {
+        release(*current);
+    }
+    for (auto& frame : pending) {
+        release(frame);
+    }
+    if (!queryPool.empty()) {
+        MBGL_CHECK_ERROR(timerQuery->deleteQueries(GLsizei(queryPool.size()), queryPool.data()));
+    }
+}
+
+void FrameProfiler::beginFrame() {
+    if (current) {
+        release(*current);
+    }
+    openSections.clear();
+
+    current = std::make_unique<Frame>();
+    current->profile.frame = frameCount++;
+    current->frame = begin();
+    current->profile.start = current->frame.start;
+}
+
+void FrameProfiler::endFrame() {
+    if (!current) {
+        return;
+    }
+
+    while (!openSections.empty()) {
+        endSection(openSections.back());
+    }
+
+    end(current->frame, current->profile.cpuTime, current->profile.counters);
+    pending.push_back(std::move(*current));
+    current.reset();
+
+    const bool valid = gpuTimingsValid();
+    while (!pending.empty()) {
+        if (!valid || pending.size() > maxPendingFrames) {
+            release(pending.front());
+        } else if (!resolve(pending.front())) {
+            break;
+        }
+        finish(std::move(pending.front()));
+        pending.pop_front();
+    }
+}
+
+std::vector<FrameProfile> FrameProfiler::takeFinishedFrames() {
+    std::vector<FrameProfile> result;
+    std::swap(result, finished);
+    return result;
+}
+
+std::vector<FrameProfile> FrameProfiler::getRecentFrames() const {
+    return { recent.begin(), recent.end() };
+}
+
+void FrameProfiler::countLineVertices(std::size_t sourceVertices, std::size_t simplifiedVertices) {
+    lineSourceVertices += sourceVertices;
+    lineSimplifiedVertices += simplifiedVertices;
+}
+
+FrameProfiler::Scope::Scope(FrameProfiler* profiler_, const std::string& name)
+    : profiler(profiler_ && profiler_->current ? profiler_ : nullptr),
+      index(profiler ? profiler->beginSection(name) : 0) {
+}
+
+FrameProfiler::Scope::~Scope() {
+    if (profiler) {
+        profiler->endSection(index);
+    }
+}
+
+std::size_t FrameProfiler::beginSection(const std::string& name) {
+    assert(current);
+
+    FrameProfile::Section section;
+    section.name = name;
+    if (!openSections.empty()) {
+        section.phase = current->profile.sections[openSections.front()].name;
+    }
+
+    const std::size_t index = current->profile.sections.size();
+    current->sections.push_back(begin());
+    section.begin = current->sections.back().start - current->profile.start;
+    current->profile.sections.push_back(std::move(section));
+    openSections.push_back(index);
+    return index;
+}
+
+void FrameProfiler::endSection(std::size_t index) {
+    // endFrame() closes sections whose scope outlives the frame.
+    if (!current || openSections.empty() || openSections.back() != index) {
+        return;
+    }
+    openSections.pop_back();
+
+    auto& section = current->profile.sections[index];
+    end(current->sections[index], section.cpuTime, section.counters);
+}
+
+FrameProfiler::Measurement FrameProfiler::begin() {
+    Measurement measurement;
+    measurement.beginQuery = timestamp();
+    measurement.statistics = context.getStatistics();
+    measurement.lineSourceVertices = lineSourceVertices;
+    measurement.lineSimplifiedVertices = lineSimplifiedVertices;
+    measurement.start = Clock::now();
+    return measurement;
+}
+
+void FrameProfiler::end(Measurement& measurement, Duration& cpuTime, FrameCounters& counters) {
+    cpuTime = Clock::now() - measurement.start;
+
+    const gl::Statistics& statistics = context.getStatistics();
+    counters.drawCalls = statistics.drawCalls - measurement.statistics.drawCalls;
+    counters.vertices = statistics.vertices - measurement.statistics.vertices;
+    counters.uploadBytes = statistics.uploadBytes - measurement.statistics.uploadBytes;
+    counters.programSwitches = statistics.programSwitches - measurement.statistics.programSwitches;
+    counters.textureSwitches = statistics.textureSwitches - measurement.statistics.textureSwitches;
+    counters.uniformUploads = statistics.uniformUploads - measurement.statistics.uniformUploads;
+    counters.lineSourceVertices = lineSourceVertices - measurement.lineSourceVertices;
+    counters.lineSimplifiedVertices = lineSimplifiedVertices - measurement.lineSimplifiedVertices;
+
+    measurement.endQuery = timestamp();
+}
+
+uint32_t FrameProfiler::timestamp() {
+    if (!timerQuery) {
+        return 0;
+    }
+
+    if (queryPool.empty()) {
+        queryPool.resize(queryBatchSize);
+        MBGL_CHECK_ERROR(timerQuery->genQueries(queryBatchSize, queryPool.data()));
+    }
+
+    const uint32_t query = queryPool.back();
+    queryPool.pop_back();
+    MBGL_CHECK_ERROR(timerQuery->queryCounter(query, GL_TIMESTAMP));
+    return query;
+}
+
+bool FrameProfiler::gpuTimingsValid() {
+    if (!timerQuery || !timerQuery->disjoint) {
+        return true;
+    }
+
+    // Reading the flag clears it, so it covers everything since the last check.
+    GLint disjoint = 0;
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint));
+    return !disjoint;
+}
+
+bool FrameProfiler::resolve(Frame& frame) {
+    if (!frame.frame.endQuery) {
+        return true;
+    }
+
+    // Queries complete in order, so the frame's last query tells us about all of them.
+    GLint available = 0;
+    MBGL_CHECK_ERROR(timerQuery->getQueryObjectiv(frame.frame.endQuery, GL_QUERY_RESULT_AVAILABLE, &available));
+    if (!available) {
+        return false;
+    }
+
+    auto read = [&](uint32_t query) {
+        uint64_t result = 0;
+        MBGL_CHECK_ERROR(timerQuery->getQueryObjectui64v(query, GL_QUERY_RESULT, &result));
+        return result;
+    };
+
+    const uint64_t frameBegin = read(frame.frame.beginQuery);
+    frame.profile.gpuTime = std::chrono::duration_cast<Duration>(
+        std::chrono::nanoseconds(read(frame.frame.endQuery) - frameBegin));
+
+    for (std::size_t i = 0; i < frame.sections.size(); i++) {
+        const uint64_t sectionBegin = read(frame.sections[i].beginQuery);
+        const uint64_t sectionEnd = read(frame.sections[i].endQuery);
+        auto& section = frame.profile.sections[i];
+        section.gpuBegin = std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(sectionBegin - frameBegin));
+        section.gpuTime = std::chrono::duration_cast<Duration>(std::chrono::nanoseconds(sectionEnd - sectionBegin));
+    }
+
+    release(frame);
+    return true;
+}
+
+void FrameProfiler::finish(Frame&& frame) {
+    if (recent.size() == maxRecentFrames) {
+        recent.pop_front();
+    }
+    recent.push_back(frame.profile);
+    finished.push_back(std::move(frame.profile));
+}
+
+void FrameProfiler::release(Frame& frame) {
+    auto recycle = [&](Measurement& measurement) {
+        for (uint32_t* query : { &measurement.beginQuery, &measurement.endQuery }) {
+            if (*query) {
+                queryPool.push_back(*query);
+                *query = 0;
+            }
+        }
+    };
+
+    recycle(frame.frame);
+    for (auto& section : frame.sections) {
+        recycle(section);
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <mbgl/renderer/frame_profile.hpp>
+#include <mbgl/gl/context.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+
+// Collects FrameProfiles while the renderer draws a frame. Sections must be strictly
+// nested; a section opened while another one is open is attributed to that phase.
+//
+// GPU timings are taken with timestamp queries when the context supports them and
+// are read back without stalling once the GPU has caught up, so a frame's profile
+// is usually finished a few frames after the frame was rendered.
+class FrameProfiler : private util::noncopyable {
+public:
+    FrameProfiler(gl::Context&);
+    ~FrameProfiler();
+
+    // Starts a new frame. An unfinished previous frame is discarded.
+    void beginFrame();
+    void endFrame();
+
+    // Returns the profiles finished since the last call, oldest first.
+    std::vector<FrameProfile> takeFinishedFrames();
+
+    // Returns up to the last `maxRecentFrames` finished profiles, oldest first.
+    std::vector<FrameProfile> getRecentFrames() const;
+
+    static constexpr std::size_t maxRecentFrames = 120;
+
+    // Adds the vertex counts of a drawn line bucket, before and after simplification,
+    // to the current frame and its open sections.
+    void countLineVertices(std::size_t sourceVertices, std::size_t simplifiedVertices);
+
+    // Times the lifetime of the object as a section of the current frame. Does
+    // nothing when constructed without a profiler, or outside of a frame.
+    class Scope {
+    public:
+        Scope(FrameProfiler*, const std::string& name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FrameProfiler* profiler;
+        std::size_t index;
+    };
+
+private:
+    class Measurement {
+    public:
+        TimePoint start;
+        gl::Statistics statistics;
+        uint64_t lineSourceVertices = 0;
+        uint64_t lineSimplifiedVertices = 0;
+        uint32_t beginQuery = 0;
+        uint32_t endQuery = 0;
+    };
+
+    class Frame {
+    public:
+        FrameProfile profile;
+        Measurement frame;
+        std::vector<Measurement> sections;
+    };
+
+    std::size_t beginSection(const std::string& name);
+    void endSection(std::size_t index);
+
+    Measurement begin();
+    void end(Measurement&, Duration& cpuTime, FrameCounters&);
+
+    uint32_t timestamp();
+    bool gpuTimingsValid();
+    bool resolve(Frame&);
+    void finish(Frame&&);
+    void release(Frame&);
+
+    gl::Context& context;
+    gl::extension::TimerQuery* timerQuery = nullptr;
+
+    uint64_t frameCount = 0;
+
+    // Running totals, like gl::Statistics.
+    uint64_t lineSourceVertices = 0;
+    uint64_t lineSimplifiedVertices = 0;
+    std::unique_ptr<Frame> current;
+    std::vector<std::size_t> openSections;
+
+    std::deque<Frame> pending;
+    std::vector<uint32_t> queryPool;
+
+    std::vector<FrameProfile> finished;
+    std::deque<FrameProfile> recent;
+};
+
+} // namespace mbgl
@@ -2,6 +2,7 @@
 #include <mbgl/renderer/buckets/circle_bucket.hpp>
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
+#include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/programs/programs.hpp>
 #include <mbgl/programs/circle_program.hpp>
 #include <mbgl/tile/tile.hpp>
@@ -64,50 +65,70 @@ void RenderCircleLayer::render(PaintParameters& parameters, RenderSource*) {
 
         const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
 
-        auto& programInstance = parameters.programs.circle.get(evaluated);
-   
-        const auto allUniformValues = programInstance.computeAllUniformValues(
-            CircleProgram::UniformValues {
-                uniforms::u_matrix::Value{
-                    tile.translatedMatrix(evaluated.get<CircleTranslate>(),
-                                          evaluated.get<CircleTranslateAnchor>(),
-                                          parameters.state)
-                },
-                uniforms::u_scale_with_map::Value{ scaleWithMap },
-                uniforms::u_extrude_scale::Value{ pitchWithMap
-                    ? std::array<float, 2> {{
-                        tile.id.pixelsToTileUnits(1, parameters.state.getZoom()),
-                        tile.id.pixelsToTileUnits(1, parameters.state.getZoom()) }}
-                    : parameters.pixelsToGLUnits },
-                uniforms::u_camera_to_center_distance::Value{ parameters.state.getCameraToCenterDistance() },
-                uniforms::u_pitch_with_map::Value{ pitchWithMap }
-            },
-            paintPropertyBinders,
-            evaluated,
-            parameters.state.getZoom()
-        );
-        const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-            *bucket.vertexBuffer,
-            paintPropertyBinders,
-            evaluated
-        );
-
-        checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-        programInstance.draw(
-            parameters.context,
-            gl::Triangles(),
-            parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-            parameters.mapMode != MapMode::Continuous
-                ? parameters.stencilModeForClipping(tile.clip)
-                : gl::StencilMode::disabled(),
-            parameters.colorModeForRenderPass(),
-            *bucket.indexBuffer,
-            bucket.segments,
-            allUniformValues,
-            allAttributeBindings,
-            getID()
-        );
+        auto draw = [&](auto& programInstance, auto&& drawMode, const auto& indexBuffer, auto&& uniformValues) {
+            const auto allUniformValues = programInstance.computeAllUniformValues(
+                std::move(uniformValues),
+                paintPropertyBinders,
+                evaluated,
+                parameters.state.getZoom()
+            );
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.vertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.draw(
+                parameters.context,
+                std::move(drawMode),
+                parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
+                parameters.mapMode != MapMode::Continuous
+                    ? parameters.stencilModeForClipping(tile.clip)
+                    : gl::StencilMode::disabled(),
+                parameters.colorModeForRenderPass(),
+                indexBuffer,
+                bucket.segments,
+                allUniformValues,
+                allAttributeBindings,
+                getID()
+            );
+        };
+
+        const mat4 posMatrix = tile.translatedMatrix(evaluated.get<CircleTranslate>(),
+                                                     evaluated.get<CircleTranslateAnchor>(),
+                                                     parameters.state);
+
+        if (bucket.pointCloud) {
+            // Point sprites always face the viewport, so circles aligned with the map are
+            // drawn as if they were aligned with the viewport.
+            draw(parameters.programs.circlePoint.get(evaluated),
+                 gl::Points(),
+                 *bucket.spriteIndexBuffer,
+                 CirclePointProgram::UniformValues {
+                     uniforms::u_matrix::Value{ posMatrix },
+                     uniforms::u_scale_with_map::Value{ scaleWithMap },
+                     uniforms::u_world::Value{ parameters.staticData.backendSize },
+                     uniforms::u_pixel_ratio::Value{ parameters.pixelRatio },
+                     uniforms::u_camera_to_center_distance::Value{ parameters.state.getCameraToCenterDistance() }
+                 });
+        } else {
+            draw(parameters.programs.circle.get(evaluated),
+                 gl::Triangles(),
+                 *bucket.indexBuffer,
+                 CircleProgram::UniformValues {
+                     uniforms::u_matrix::Value{ posMatrix },
+                     uniforms::u_scale_with_map::Value{ scaleWithMap },
+                     uniforms::u_extrude_scale::Value{ pitchWithMap
+                         ? std::array<float, 2> {{
+                             tile.id.pixelsToTileUnits(1, parameters.state.getZoom()),
+                             tile.id.pixelsToTileUnits(1, parameters.state.getZoom()) }}
+                         : parameters.pixelsToGLUnits },
+                     uniforms::u_camera_to_center_distance::Value{ parameters.state.getCameraToCenterDistance() },
+                     uniforms::u_pitch_with_map::Value{ pitchWithMap }
+                 });
+        }
     }
 }
 
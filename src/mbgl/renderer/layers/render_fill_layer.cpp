@@ -59,79 +59,88 @@ bool RenderFillLayer::hasTransition() const {
 }
 
 void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
+    // Fills of all tiles are drawn before their outlines, so that we switch programs
+    // once per layer rather than once per tile. Every tile is clipped to its own stencil
+    // area, so the order in which different tiles are drawn doesn't affect the result.
     if (evaluated.get<FillPattern>().from.empty()) {
-        for (const RenderTile& tile : renderTiles) {
-            auto bucket_ = tile.tile.getBucket<FillBucket>(*baseImpl);
-            if (!bucket_) {
-                continue;
-            }
-            FillBucket& bucket = *bucket_;
-
-            auto draw = [&] (auto& program,
-                             const auto& drawMode,
-                             const auto& depthMode,
-                             const auto& indexBuffer,
-                             const auto& segments) {
-                auto& programInstance = program.get(evaluated);
-
-                const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
-
-                const auto allUniformValues = programInstance.computeAllUniformValues(
-                    FillProgram::UniformValues {
-                        uniforms::u_matrix::Value{
-                            tile.translatedMatrix(evaluated.get<FillTranslate>(),
-                                                  evaluated.get<FillTranslateAnchor>(),
-                                                  parameters.state)
-                        },
-                        uniforms::u_world::Value{ parameters.context.viewport.getCurrentValue().size },
+        auto draw = [&] (const RenderTile& tile,
+                         FillBucket& bucket,
+                         auto& program,
+                         const auto& drawMode,
+                         const auto& depthMode,
+                         const auto& indexBuffer,
+                         const auto& segments) {
+            auto& programInstance = program.get(evaluated);
+
+            const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
+
+            const auto allUniformValues = programInstance.computeAllUniformValues(
+                FillProgram::UniformValues {
+                    uniforms::u_matrix::Value{
+                        tile.translatedMatrix(evaluated.get<FillTranslate>(),
+                                              evaluated.get<FillTranslateAnchor>(),
+                                              parameters.state)
                     },
-                    paintPropertyBinders,
-                    evaluated,
-                    parameters.state.getZoom()
-                );
-                const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                    *bucket.vertexBuffer,
-                    paintPropertyBinders,
-                    evaluated
-                );
-
-                checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-                programInstance.draw(
-                    parameters.context,
-                    drawMode,
-                    depthMode,
-                    parameters.stencilModeForClipping(tile.clip),
-                    parameters.colorModeForRenderPass(),
-                    indexBuffer,
-                    segments,
-                    allUniformValues,
-                    allAttributeBindings,
-                    getID()
-                );
-            };
-
-            // Only draw the fill when it's opaque and we're drawing opaque fragments,
-            // or when it's translucent and we're drawing translucent fragments.
-            if ((evaluated.get<FillColor>().constantOr(Color()).a >= 1.0f
-              && evaluated.get<FillOpacity>().constantOr(0) >= 1.0f) == (parameters.pass == RenderPass::Opaque)) {
-                draw(parameters.programs.fill,
-                     gl::Triangles(),
-                     parameters.depthModeForSublayer(1, parameters.pass == RenderPass::Opaque
-                        ? gl::DepthMode::ReadWrite
-                        : gl::DepthMode::ReadOnly),
-                     *bucket.triangleIndexBuffer,
-                     bucket.triangleSegments);
+                    uniforms::u_world::Value{ parameters.context.viewport.getCurrentValue().size },
+                },
+                paintPropertyBinders,
+                evaluated,
+                parameters.state.getZoom()
+            );
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.vertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.draw(
+                parameters.context,
+                drawMode,
+                depthMode,
+                parameters.stencilModeForClipping(tile.clip),
+                parameters.colorModeForRenderPass(),
+                indexBuffer,
+                segments,
+                allUniformValues,
+                allAttributeBindings,
+                getID()
+            );
+        };
+
+        // Only draw the fill when it's opaque and we're drawing opaque fragments,
+        // or when it's translucent and we're drawing translucent fragments.
+        if ((evaluated.get<FillColor>().constantOr(Color()).a >= 1.0f
+          && evaluated.get<FillOpacity>().constantOr(0) >= 1.0f) == (parameters.pass == RenderPass::Opaque)) {
+            for (const RenderTile& tile : renderTiles) {
+                if (auto bucket = tile.tile.getBucket<FillBucket>(*baseImpl)) {
+                    draw(tile,
+                         *bucket,
+                         parameters.programs.fill,
+                         gl::Triangles(),
+                         parameters.depthModeForSublayer(1, parameters.pass == RenderPass::Opaque
+                            ? gl::DepthMode::ReadWrite
+                            : gl::DepthMode::ReadOnly),
+                         *bucket->triangleIndexBuffer,
+                         bucket->triangleSegments);
+                }
             }
+        }
 
-            if (evaluated.get<FillAntialias>() && parameters.pass == RenderPass::Translucent) {
-                draw(parameters.programs.fillOutline,
-                     gl::Lines{ 2.0f },
-                     parameters.depthModeForSublayer(
-                         unevaluated.get<FillOutlineColor>().isUndefined() ? 2 : 0,
-                         gl::DepthMode::ReadOnly),
-                     *bucket.lineIndexBuffer,
-                     bucket.lineSegments);
+        if (evaluated.get<FillAntialias>() && parameters.pass == RenderPass::Translucent) {
+            for (const RenderTile& tile : renderTiles) {
+                if (auto bucket = tile.tile.getBucket<FillBucket>(*baseImpl)) {
+                    draw(tile,
+                         *bucket,
+                         parameters.programs.fillOutline,
+                         gl::Lines{ 2.0f },
+                         parameters.depthModeForSublayer(
+                             unevaluated.get<FillOutlineColor>().isUndefined() ? 2 : 0,
+                             gl::DepthMode::ReadOnly),
+                         *bucket->lineIndexBuffer,
+                         bucket->lineSegments);
+                }
             }
         }
     } else {
@@ -148,73 +157,79 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
 
         parameters.imageManager.bind(parameters.context, 0);
 
+        auto draw = [&] (const RenderTile& tile,
+                         FillBucket& bucket,
+                         auto& program,
+                         const auto& drawMode,
+                         const auto& depthMode,
+                         const auto& indexBuffer,
+                         const auto& segments) {
+            auto& programInstance = program.get(evaluated);
+
+            const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
+
+            const auto allUniformValues = programInstance.computeAllUniformValues(
+                FillPatternUniforms::values(
+                    tile.translatedMatrix(evaluated.get<FillTranslate>(),
+                                          evaluated.get<FillTranslateAnchor>(),
+                                          parameters.state),
+                    parameters.context.viewport.getCurrentValue().size,
+                    parameters.imageManager.getPixelSize(),
+                    *imagePosA,
+                    *imagePosB,
+                    evaluated.get<FillPattern>(),
+                    tile.id,
+                    parameters.state
+                ),
+                paintPropertyBinders,
+                evaluated,
+                parameters.state.getZoom()
+            );
+            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                *bucket.vertexBuffer,
+                paintPropertyBinders,
+                evaluated
+            );
+
+            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+            programInstance.draw(
+                parameters.context,
+                drawMode,
+                depthMode,
+                parameters.stencilModeForClipping(tile.clip),
+                parameters.colorModeForRenderPass(),
+                indexBuffer,
+                segments,
+                allUniformValues,
+                allAttributeBindings,
+                getID()
+            );
+        };
+
         for (const RenderTile& tile : renderTiles) {
-            auto bucket_ = tile.tile.getBucket<FillBucket>(*baseImpl);
-            if (!bucket_) {
-                continue;
+            if (auto bucket = tile.tile.getBucket<FillBucket>(*baseImpl)) {
+                draw(tile,
+                     *bucket,
+                     parameters.programs.fillPattern,
+                     gl::Triangles(),
+                     parameters.depthModeForSublayer(1, gl::DepthMode::ReadWrite),
+                     *bucket->triangleIndexBuffer,
+                     bucket->triangleSegments);
             }
-            FillBucket& bucket = *bucket_;
-
-            auto draw = [&] (auto& program,
-                             const auto& drawMode,
-                             const auto& depthMode,
-                             const auto& indexBuffer,
-                             const auto& segments) {
-                auto& programInstance = program.get(evaluated);
-
-                const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
+        }
 
-                const auto allUniformValues = programInstance.computeAllUniformValues(
-                    FillPatternUniforms::values(
-                        tile.translatedMatrix(evaluated.get<FillTranslate>(),
-                                              evaluated.get<FillTranslateAnchor>(),
-                                              parameters.state),
-                        parameters.context.viewport.getCurrentValue().size,
-                        parameters.imageManager.getPixelSize(),
-                        *imagePosA,
-                        *imagePosB,
-                        evaluated.get<FillPattern>(),
-                        tile.id,
-                        parameters.state
-                    ),
-                    paintPropertyBinders,
-                    evaluated,
-                    parameters.state.getZoom()
-                );
-                const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                    *bucket.vertexBuffer,
-                    paintPropertyBinders,
-                    evaluated
-                );
-
-                checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-                programInstance.draw(
-                    parameters.context,
-                    drawMode,
-                    depthMode,
-                    parameters.stencilModeForClipping(tile.clip),
-                    parameters.colorModeForRenderPass(),
-                    indexBuffer,
-                    segments,
-                    allUniformValues,
-                    allAttributeBindings,
-                    getID()
-                );
-            };
-
-            draw(parameters.programs.fillPattern,
-                 gl::Triangles(),
-                 parameters.depthModeForSublayer(1, gl::DepthMode::ReadWrite),
-                 *bucket.triangleIndexBuffer,
-                 bucket.triangleSegments);
-
-            if (evaluated.get<FillAntialias>() && unevaluated.get<FillOutlineColor>().isUndefined()) {
-                draw(parameters.programs.fillOutlinePattern,
-                     gl::Lines { 2.0f },
-                     parameters.depthModeForSublayer(2, gl::DepthMode::ReadOnly),
-                     *bucket.lineIndexBuffer,
-                     bucket.lineSegments);
+        if (evaluated.get<FillAntialias>() && unevaluated.get<FillOutlineColor>().isUndefined()) {
+            for (const RenderTile& tile : renderTiles) {
+                if (auto bucket = tile.tile.getBucket<FillBucket>(*baseImpl)) {
+                    draw(tile,
+                         *bucket,
+                         parameters.programs.fillOutlinePattern,
+                         gl::Lines { 2.0f },
+                         parameters.depthModeForSublayer(2, gl::DepthMode::ReadOnly),
+                         *bucket->lineIndexBuffer,
+                         bucket->lineSegments);
+                }
             }
         }
     }
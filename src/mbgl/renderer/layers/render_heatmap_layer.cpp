@@ -97,38 +97,57 @@ void RenderHeatmapLayer::render(PaintParameters& parameters, RenderSource*) {
 
             const auto& paintPropertyBinders = bucket.paintPropertyBinders.at(getID());
 
-            auto& programInstance = parameters.programs.heatmap.get(evaluated);
-       
-            const auto allUniformValues = programInstance.computeAllUniformValues(
-                HeatmapProgram::UniformValues {
-                    uniforms::u_intensity::Value{ evaluated.get<style::HeatmapIntensity>() },
-                    uniforms::u_matrix::Value{ tile.matrix },
-                    uniforms::heatmap::u_extrude_scale::Value{ extrudeScale }
-                },
-                paintPropertyBinders,
-                evaluated,
-                parameters.state.getZoom()
-            );
-            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                *bucket.vertexBuffer,
-                paintPropertyBinders,
-                evaluated
-            );
-
-            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-            programInstance.draw(
-                parameters.context,
-                gl::Triangles(),
-                parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-                stencilMode,
-                gl::ColorMode::additive(),
-                *bucket.indexBuffer,
-                bucket.segments,
-                allUniformValues,
-                allAttributeBindings,
-                getID()
-            );
+            auto draw = [&](auto& programInstance, auto&& drawMode, const auto& indexBuffer, auto&& uniformValues) {
+                const auto allUniformValues = programInstance.computeAllUniformValues(
+                    std::move(uniformValues),
+                    paintPropertyBinders,
+                    evaluated,
+                    parameters.state.getZoom()
+                );
+                const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+                    *bucket.vertexBuffer,
+                    paintPropertyBinders,
+                    evaluated
+                );
+
+                checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
+
+                programInstance.draw(
+                    parameters.context,
+                    std::move(drawMode),
+                    parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
+                    stencilMode,
+                    gl::ColorMode::additive(),
+                    indexBuffer,
+                    bucket.segments,
+                    allUniformValues,
+                    allAttributeBindings,
+                    getID()
+                );
+            };
+
+            if (bucket.pointCloud) {
+                // The kernels are drawn into the texture, which is smaller than the viewport.
+                draw(parameters.programs.heatmapPoint.get(evaluated),
+                     gl::Points(),
+                     *bucket.spriteIndexBuffer,
+                     HeatmapPointProgram::UniformValues {
+                         uniforms::u_intensity::Value{ evaluated.get<style::HeatmapIntensity>() },
+                         uniforms::u_matrix::Value{ tile.matrix },
+                         uniforms::u_world::Value{ size },
+                         uniforms::u_pixel_ratio::Value{ float(size.width) / parameters.state.getSize().width },
+                         uniforms::u_camera_to_center_distance::Value{ parameters.state.getCameraToCenterDistance() }
+                     });
+            } else {
+                draw(parameters.programs.heatmap.get(evaluated),
+                     gl::Triangles(),
+                     *bucket.indexBuffer,
+                     HeatmapProgram::UniformValues {
+                         uniforms::u_intensity::Value{ evaluated.get<style::HeatmapIntensity>() },
+                         uniforms::u_matrix::Value{ tile.matrix },
+                         uniforms::heatmap::u_extrude_scale::Value{ extrudeScale }
+                     });
+            }
         }
 
     } else if (parameters.pass == RenderPass::Translucent) {
@@ -56,6 +56,59 @@ bool RenderHillshadeLayer::hasTransition() const {
     return unevaluated.hasTransition();
 }
 
+void RenderHillshadeLayer::prepare(gl::Context& context,
+                                   HillshadePrepareProgram& programInstance,
+                                   const RenderStaticData& staticData,
+                                   HillshadeBucket& bucket,
+                                   const uint8_t zoom,
+                                   const uint8_t maxzoom,
+                                   const std::string& layerID) {
+    mat4 mat;
+    matrix::ortho(mat, 0, util::EXTENT, -util::EXTENT, 0, 0, 1);
+    matrix::translate(mat, mat, 0, -util::EXTENT, 0);
+
+    const uint16_t tilesize = bucket.getDEMData().dim;
+    OffscreenTexture view(context, { tilesize, tilesize });
+    view.bind();
+
+    context.bindTexture(*bucket.dem, 0, gl::TextureFilter::Nearest, gl::TextureMipMap::No, gl::TextureWrap::Clamp, gl::TextureWrap::Clamp);
+    const Properties<>::PossiblyEvaluated properties;
+    const HillshadePrepareProgram::PaintPropertyBinders paintAttributeData{ properties, 0 };
+
+    const auto allUniformValues = programInstance.computeAllUniformValues(
+        HillshadePrepareProgram::UniformValues {
+            uniforms::u_matrix::Value { mat },
+            uniforms::u_dimension::Value { {{uint16_t(tilesize * 2), uint16_t(tilesize * 2) }} },
+            uniforms::u_zoom::Value{ float(zoom) },
+            uniforms::u_maxzoom::Value{ float(maxzoom) },
+            uniforms::u_image::Value{ 0 }
+        },
+        paintAttributeData,
+        properties,
+        zoom
+    );
+    const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
+        staticData.rasterVertexBuffer,
+        paintAttributeData,
+        properties
+    );
+
+    programInstance.draw(
+        context,
+        gl::Triangles(),
+        gl::DepthMode::disabled(),
+        gl::StencilMode::disabled(),
+        gl::ColorMode::unblended(),
+        staticData.quadTriangleIndexBuffer,
+        staticData.rasterSegments,
+        allUniformValues,
+        allAttributeBindings,
+        layerID
+    );
+    bucket.texture = std::move(view.getTexture());
+    bucket.setPrepared(true);
+}
+
 void RenderHillshadeLayer::render(PaintParameters& parameters, RenderSource* src) {
     if (parameters.pass != RenderPass::Translucent && parameters.pass != RenderPass::Pass3D)
         return;
@@ -109,10 +162,6 @@ void RenderHillshadeLayer::render(PaintParameters& parameters, RenderSource* src
         );
     };
 
-    mat4 mat;
-    matrix::ortho(mat, 0, util::EXTENT, -util::EXTENT, 0, 0, 1);
-    matrix::translate(mat, mat, 0, -util::EXTENT, 0);
-
     for (const RenderTile& tile : renderTiles) {
         auto bucket_ = tile.tile.getBucket<HillshadeBucket>(*baseImpl);
         if (!bucket_) {
@@ -125,50 +174,8 @@ void RenderHillshadeLayer::render(PaintParameters& parameters, RenderSource* src
         }
 
         if (!bucket.isPrepared() && parameters.pass == RenderPass::Pass3D) {
-            const uint16_t tilesize = bucket.getDEMData().dim;
-            OffscreenTexture view(parameters.context, { tilesize, tilesize });
-            view.bind();
-            
-            parameters.context.bindTexture(*bucket.dem, 0, gl::TextureFilter::Nearest, gl::TextureMipMap::No, gl::TextureWrap::Clamp, gl::TextureWrap::Clamp);
-            const Properties<>::PossiblyEvaluated properties;
-            const HillshadePrepareProgram::PaintPropertyBinders paintAttributeData{ properties, 0 };
-            
-            auto& programInstance = parameters.programs.hillshadePrepare;
-
-            const auto allUniformValues = programInstance.computeAllUniformValues(
-                HillshadePrepareProgram::UniformValues {
-                    uniforms::u_matrix::Value { mat },
-                    uniforms::u_dimension::Value { {{uint16_t(tilesize * 2), uint16_t(tilesize * 2) }} },
-                    uniforms::u_zoom::Value{ float(tile.id.canonical.z) },
-                    uniforms::u_maxzoom::Value{ float(maxzoom) },
-                    uniforms::u_image::Value{ 0 }
-                },
-                paintAttributeData,
-                properties,
-                parameters.state.getZoom()
-            );
-            const auto allAttributeBindings = programInstance.computeAllAttributeBindings(
-                parameters.staticData.rasterVertexBuffer,
-                paintAttributeData,
-                properties
-            );
-
-            checkRenderability(parameters, programInstance.activeBindingCount(allAttributeBindings));
-
-            programInstance.draw(
-                parameters.context,
-                gl::Triangles(),
-                parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-                gl::StencilMode::disabled(),
-                parameters.colorModeForRenderPass(),
-                parameters.staticData.quadTriangleIndexBuffer,
-                parameters.staticData.rasterSegments,
-                allUniformValues,
-                allAttributeBindings,
-                getID()
-            );
-            bucket.texture = std::move(view.getTexture());
-            bucket.setPrepared(true);
+            prepare(parameters.context, parameters.programs.hillshadePrepare, parameters.staticData,
+                    bucket, tile.id.canonical.z, maxzoom, getID());
         } else if (parameters.pass == RenderPass::Translucent) {
             assert(bucket.texture);
             parameters.context.bindTexture(*bucket.texture, 0, gl::TextureFilter::Linear, gl::TextureMipMap::No, gl::TextureWrap::Clamp, gl::TextureWrap::Clamp);
@@ -7,6 +7,14 @@
 
 namespace mbgl {
 
+class HillshadeBucket;
+class HillshadePrepareProgram;
+class RenderStaticData;
+
+namespace gl {
+class Context;
+} // namespace gl
+
 class RenderHillshadeLayer: public RenderLayer {
 public:
     RenderHillshadeLayer(Immutable<style::HillshadeLayer::Impl>);
@@ -18,6 +26,17 @@ public:
 
     void render(PaintParameters&, RenderSource* src) override;
 
+    // Renders the slopes of the bucket's DEM texture into its hillshade texture, for
+    // buckets that weren't prepared on the worker. `maxzoom` is the maximum zoom level of
+    // the source.
+    static void prepare(gl::Context&,
+                        HillshadePrepareProgram&,
+                        const RenderStaticData&,
+                        HillshadeBucket&,
+                        uint8_t zoom,
+                        uint8_t maxzoom,
+                        const std::string& layerID);
+
     std::unique_ptr<Bucket> createBucket(const BucketParameters&, const std::vector<const RenderLayer*>&) const override;
 
     // Paint properties
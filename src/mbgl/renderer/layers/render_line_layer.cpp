@@ -2,6 +2,7 @@
 #include <mbgl/renderer/buckets/line_bucket.hpp>
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
+#include <mbgl/renderer/frame_profiler.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/programs/programs.hpp>
 #include <mbgl/programs/line_program.hpp>
@@ -64,6 +65,10 @@ void RenderLineLayer::render(PaintParameters& parameters, RenderSource*) {
         }
         LineBucket& bucket = *bucket_;
 
+        if (parameters.frameProfiler) {
+            parameters.frameProfiler->countLineVertices(bucket.sourceVertexCount, bucket.simplifiedVertexCount);
+        }
+
         auto draw = [&] (auto& program, auto&& uniformValues) {
             auto& programInstance = program.get(evaluated);
 
@@ -39,11 +39,13 @@ std::unique_ptr<Bucket> RenderSymbolLayer::createBucket(const BucketParameters&,
 std::unique_ptr<SymbolLayout> RenderSymbolLayer::createLayout(const BucketParameters& parameters,
                                                               const std::vector<const RenderLayer*>& group,
                                                               std::unique_ptr<GeometryTileLayer> layer,
+                                                              FeatureIndex& featureIndex,
                                                               GlyphDependencies& glyphDependencies,
                                                               ImageDependencies& imageDependencies) const {
     return std::make_unique<SymbolLayout>(parameters,
                                           group,
                                           std::move(layer),
+                                          featureIndex,
                                           imageDependencies,
                                           glyphDependencies);
 }
@@ -53,6 +53,7 @@ public:
 } // namespace style
 
 class BucketParameters;
+class FeatureIndex;
 class SymbolLayout;
 class GeometryTileLayer;
 
@@ -76,6 +77,7 @@ public:
     std::unique_ptr<SymbolLayout> createLayout(const BucketParameters&,
                                                const std::vector<const RenderLayer*>&,
                                                std::unique_ptr<GeometryTileLayer>,
+                                               FeatureIndex&,
                                                GlyphDependencies&,
                                                ImageDependencies&) const;
 
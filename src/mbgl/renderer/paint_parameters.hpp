@@ -22,6 +22,7 @@ class TransformState;
 class ImageManager;
 class LineAtlas;
 class UnwrappedTileID;
+class FrameProfiler;
 
 class PaintParameters {
 public:
@@ -33,7 +34,8 @@ public:
                     const EvaluatedLight&,
                     RenderStaticData&,
                     ImageManager&,
-                    LineAtlas&);
+                    LineAtlas&,
+                    algorithm::ClipIDGenerator&);
 
     gl::Context& context;
     RendererBackend& backend;
@@ -53,10 +55,13 @@ public:
 
     float pixelRatio;
     std::array<float, 2> pixelsToGLUnits;
-    algorithm::ClipIDGenerator clipIDGenerator;
+    algorithm::ClipIDGenerator& clipIDGenerator;
 
     Programs& programs;
 
+    // Set while frame profiling is enabled.
+    FrameProfiler* frameProfiler = nullptr;
+
     gl::DepthMode depthModeForSublayer(uint8_t n, gl::DepthMode::Mask) const;
     gl::DepthMode depthModeFor3D(gl::DepthMode::Mask) const;
     gl::StencilMode stencilModeForClipping(const ClipID&) const;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/renderer/prefetch_statistics.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/util/mat4.hpp>
@@ -72,6 +73,11 @@ public:
 
     virtual void reduceMemoryUse() = 0;
 
+    // Sources whose tiles are loaded from elsewhere request them ahead of the camera.
+    virtual PrefetchStatistics getPrefetchStatistics() const {
+        return {};
+    }
+
     virtual void dumpDebugLogs() const = 0;
 
     void setObserver(RenderSourceObserver*);
@@ -90,10 +90,30 @@ std::vector<Feature> Renderer::querySourceFeatures(const std::string& sourceID,
     return impl->querySourceFeatures(sourceID, options);
 }
 
+std::vector<std::vector<Feature>> Renderer::queryRenderedFeatures(const std::vector<ScreenLineString>& geometries, const RenderedQueryOptions& options) const {
+    return impl->queryRenderedFeatures(geometries, options);
+}
+
+std::vector<std::vector<Feature>> Renderer::querySourceFeatures(const std::vector<std::string>& sourceIDs, const SourceQueryOptions& options) const {
+    return impl->querySourceFeatures(sourceIDs, options);
+}
+
 void Renderer::dumpDebugLogs() {
     impl->dumDebugLogs();
 }
 
+void Renderer::setFrameProfiling(bool enabled) {
+    impl->setFrameProfiling(enabled);
+}
+
+std::vector<FrameProfile> Renderer::getRecentFrameProfiles() const {
+    return impl->getRecentFrameProfiles();
+}
+
+PrefetchStatistics Renderer::getPrefetchStatistics() const {
+    return impl->getPrefetchStatistics();
+}
+
 void Renderer::reduceMemoryUse() {
     BackendScope guard { impl->backend };
     impl->reduceMemoryUse();
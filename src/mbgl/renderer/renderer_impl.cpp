@@ -3,6 +3,7 @@
 #include <mbgl/renderer/renderer_backend.hpp>
 #include <mbgl/renderer/renderer_observer.hpp>
 #include <mbgl/renderer/render_source.hpp>
+#include <mbgl/renderer/frame_profiler.hpp>
 #include <mbgl/renderer/render_layer.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
@@ -27,6 +28,7 @@
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/tile/tile.hpp>
 #include <mbgl/util/math.hpp>
+#include <mbgl/util/parallel_for.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
@@ -69,6 +71,8 @@ Renderer::Impl::Impl(RendererBackend& backend_,
 Renderer::Impl::~Impl() {
     assert(BackendScope::exists());
 
+    frameProfiler.reset();
+
     if (contextLost) {
         // Signal all RenderCustomLayers that the context was lost
         // before cleaning up
@@ -85,6 +89,15 @@ void Renderer::Impl::setObserver(RendererObserver* observer_) {
     observer = observer_ ? observer_ : &nullObserver();
 }
 
+void Renderer::Impl::setFrameProfiling(bool enabled) {
+    // The profiler owns GL objects, so it is created and destroyed while rendering.
+    frameProfiling = enabled;
+}
+
+std::vector<FrameProfile> Renderer::Impl::getRecentFrameProfiles() const {
+    return frameProfiler ? frameProfiler->getRecentFrames() : std::vector<FrameProfile>();
+}
+
 void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     if (updateParameters.mode != MapMode::Continuous) {
         // Reset zoom history state.
@@ -92,7 +105,18 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
     
     assert(BackendScope::exists());
-    
+
+    if (frameProfiling && !frameProfiler) {
+        frameProfiler = std::make_unique<FrameProfiler>(backend.getContext());
+    } else if (!frameProfiling) {
+        frameProfiler.reset();
+    }
+
+    // Frames that return early below are discarded when the next frame begins.
+    if (frameProfiler) {
+        frameProfiler->beginFrame();
+    }
+
     updateParameters.annotationManager.updateData();
 
     const bool zoomChanged = zoomHistory.update(updateParameters.transformState.getZoom(), updateParameters.timePoint);
@@ -118,7 +142,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         updateParameters.annotationManager,
         *imageManager,
         *glyphManager,
-        updateParameters.prefetchZoomDelta
+        updateParameters.prefetchZoomDelta,
+        updateParameters.prefetchStates
     };
 
     glyphManager->setURL(updateParameters.glyphURL);
@@ -136,8 +161,10 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
 
 
-    const ImageDifference imageDiff = diffImages(imageImpls, updateParameters.images);
+    const ImageDifference imageDiff = diffImages(imageImpls, updateParameters.images,
+                                                 imageJournal, updateParameters.imageJournal);
     imageImpls = updateParameters.images;
+    imageJournal = updateParameters.imageJournal;
 
     // Remove removed images from sprite atlas.
     for (const auto& entry : imageDiff.removed) {
@@ -157,12 +184,15 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     imageManager->setLoaded(updateParameters.spriteLoaded);
 
 
-    const LayerDifference layerDiff = diffLayers(layerImpls, updateParameters.layers);
+    const LayerDifference layerDiff = diffLayers(layerImpls, updateParameters.layers,
+                                                 layerJournal, updateParameters.layerJournal);
     layerImpls = updateParameters.layers;
+    layerJournal = updateParameters.layerJournal;
 
     // Remove render layers for removed layers.
     for (const auto& entry : layerDiff.removed) {
         renderLayers.erase(entry.first);
+        transitioningLayers.erase(entry.first);
     }
 
     // Create render layers for newly added layers.
@@ -176,12 +206,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     }
 
     // Update layers for class and zoom changes.
-    for (const auto& entry : renderLayers) {
-        RenderLayer& layer = *entry.second;
-        const bool layerAdded = layerDiff.added.count(entry.first);
-        const bool layerChanged = layerDiff.changed.count(entry.first);
-
-        if (layerAdded || layerChanged) {
+    auto updateLayer = [&] (RenderLayer& layer, const bool layerAddedOrChanged) {
+        if (layerAddedOrChanged) {
             layer.transition(transitionParameters);
 
             if (layer.is<RenderHeatmapLayer>()) {
@@ -189,14 +215,53 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
             }
         }
 
-        if (layerAdded || layerChanged || zoomChanged || layer.hasTransition()) {
+        if (layerAddedOrChanged || zoomChanged || layer.hasTransition()) {
             layer.evaluate(evaluationParameters);
         }
+
+        if (layer.hasTransition()) {
+            transitioningLayers.insert(layer.getID());
+        } else {
+            transitioningLayers.erase(layer.getID());
+        }
+    };
+
+    if (zoomChanged) {
+        for (const auto& entry : renderLayers) {
+            RenderLayer& layer = *entry.second;
+            const bool layerAddedOrChanged = layerDiff.added.count(entry.first) || layerDiff.changed.count(entry.first);
+
+            // Layers outside of their zoom range aren't rendered, and are evaluated again
+            // once the zoom changes back into it.
+            if (!layerAddedOrChanged && !layer.hasTransition() &&
+                (zoomHistory.lastZoom < layer.baseImpl->minZoom || zoomHistory.lastZoom > layer.baseImpl->maxZoom)) {
+                continue;
+            }
+
+            updateLayer(layer, layerAddedOrChanged);
+        }
+    } else {
+        // Other layers would evaluate to the same properties as before.
+        std::vector<std::string> layerIDs(transitioningLayers.begin(), transitioningLayers.end());
+        for (const auto& entry : layerDiff.added) {
+            layerIDs.push_back(entry.first);
+        }
+        for (const auto& entry : layerDiff.changed) {
+            layerIDs.push_back(entry.first);
+        }
+        std::sort(layerIDs.begin(), layerIDs.end());
+        layerIDs.erase(std::unique(layerIDs.begin(), layerIDs.end()), layerIDs.end());
+
+        for (const auto& layerID : layerIDs) {
+            updateLayer(*renderLayers.at(layerID), layerDiff.added.count(layerID) || layerDiff.changed.count(layerID));
+        }
     }
 
 
-    const SourceDifference sourceDiff = diffSources(sourceImpls, updateParameters.sources);
+    const SourceDifference sourceDiff = diffSources(sourceImpls, updateParameters.sources,
+                                                    sourceJournal, updateParameters.sourceJournal);
     sourceImpls = updateParameters.sources;
+    sourceJournal = updateParameters.sourceJournal;
 
     // Remove render layers for removed sources.
     for (const auto& entry : sourceDiff.removed) {
@@ -212,34 +277,41 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
 
     const bool hasImageDiff = !(imageDiff.added.empty() && imageDiff.removed.empty() && imageDiff.changed.empty());
 
-    // Update all sources.
-    for (const auto& source : *sourceImpls) {
-        std::vector<Immutable<Layer::Impl>> filteredLayers;
-        bool needsRendering = false;
-        bool needsRelayout = false;
-
-        for (const auto& layer : *layerImpls) {
-            if (layer->type == LayerType::Background ||
-                layer->type == LayerType::Custom ||
-                layer->source != source->id) {
-                continue;
-            }
-
-            if (!needsRendering && getRenderLayer(layer->id)->needsRendering(zoomHistory.lastZoom)) {
-                needsRendering = true;
-            }
+    // Only the layers that were added or changed can have a different layout.
+    std::unordered_set<std::string> relayoutSources;
+    for (const auto& entry : layerDiff.added) {
+        relayoutSources.insert(entry.second->source);
+    }
+    for (const auto& entry : layerDiff.changed) {
+        if (hasLayoutDifference(layerDiff, entry.first)) {
+            relayoutSources.insert(entry.second.after->source);
+        }
+    }
 
-            if (!needsRelayout && (hasImageDiff || hasLayoutDifference(layerDiff, layer->id))) {
-                needsRelayout = true;
-            }
+    // Group the layers by source in a single pass over the layers.
+    std::unordered_map<std::string, std::vector<Immutable<Layer::Impl>>> sourceLayers;
+    std::unordered_set<std::string> renderedSources;
+    for (const auto& layer : *layerImpls) {
+        if (layer->type == LayerType::Background ||
+            layer->type == LayerType::Custom) {
+            continue;
+        }
 
-            filteredLayers.push_back(layer);
+        if (getRenderLayer(layer->id)->needsRendering(zoomHistory.lastZoom)) {
+            renderedSources.insert(layer->source);
         }
 
+        sourceLayers[layer->source].push_back(layer);
+    }
+
+    // Update all sources.
+    for (const auto& source : *sourceImpls) {
+        const std::vector<Immutable<Layer::Impl>>& filteredLayers = sourceLayers[source->id];
+
         renderSources.at(source->id)->update(source,
                                              filteredLayers,
-                                             needsRendering,
-                                             needsRelayout,
+                                             renderedSources.count(source->id),
+                                             !filteredLayers.empty() && (hasImageDiff || relayoutSources.count(source->id)),
                                              tileParameters);
     }
 
@@ -258,8 +330,10 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         renderLight.getEvaluated(),
         *staticData,
         *imageManager,
-        *lineAtlas
+        *lineAtlas,
+        clipIDGenerator
     };
+    parameters.frameProfiler = frameProfiler.get();
 
     bool loaded = updateParameters.styleLoaded && isLoaded();
     if (updateParameters.mode != MapMode::Continuous && !loaded) {
@@ -288,133 +362,141 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
 
     std::vector<RenderItem> order;
 
-    for (auto& layerImpl : *layerImpls) {
-        RenderLayer* layer = getRenderLayer(layerImpl->id);
-        assert(layer);
+    {
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "prepare" };
 
-        if (!parameters.staticData.has3D && (
-                layer->is<RenderFillExtrusionLayer>() ||
-                layer->is<RenderHillshadeLayer>() ||
-                layer->is<RenderHeatmapLayer>())) {
+        for (auto& layerImpl : *layerImpls) {
+            RenderLayer* layer = getRenderLayer(layerImpl->id);
+            assert(layer);
 
-            parameters.staticData.has3D = true;
-        }
+            if (!parameters.staticData.has3D && (
+                    layer->is<RenderFillExtrusionLayer>() ||
+                    layer->is<RenderHillshadeLayer>() ||
+                    layer->is<RenderHeatmapLayer>())) {
 
-        if (!layer->needsRendering(zoomHistory.lastZoom)) {
-            continue;
-        }
+                parameters.staticData.has3D = true;
+            }
 
-        if (const RenderBackgroundLayer* background = layer->as<RenderBackgroundLayer>()) {
-            const BackgroundPaintProperties::PossiblyEvaluated& paint = background->evaluated;
-            if (parameters.contextMode == GLContextMode::Unique
-                    && layerImpl.get() == layerImpls->at(0).get()
-                    && paint.get<BackgroundPattern>().from.empty()) {
-                // This is a solid background. We can use glClear().
-                backgroundColor = paint.get<BackgroundColor>() * paint.get<BackgroundOpacity>();
-            } else {
-                // This is a textured background, or not the bottommost layer. We need to render it with a quad.
-                order.emplace_back(RenderItem { *layer, nullptr });
+            if (!layer->needsRendering(zoomHistory.lastZoom)) {
+                continue;
             }
-            continue;
-        }
 
-        if (layer->is<RenderCustomLayer>()) {
-            order.emplace_back(RenderItem { *layer, nullptr });
-            continue;
-        }
+            if (const RenderBackgroundLayer* background = layer->as<RenderBackgroundLayer>()) {
+                const BackgroundPaintProperties::PossiblyEvaluated& paint = background->evaluated;
+                if (parameters.contextMode == GLContextMode::Unique
+                        && layerImpl.get() == layerImpls->at(0).get()
+                        && paint.get<BackgroundPattern>().from.empty()) {
+                    // This is a solid background. We can use glClear().
+                    backgroundColor = paint.get<BackgroundColor>() * paint.get<BackgroundOpacity>();
+                } else {
+                    // This is a textured background, or not the bottommost layer. We need to render it with a quad.
+                    order.emplace_back(RenderItem { *layer, nullptr });
+                }
+                continue;
+            }
 
-        RenderSource* source = getRenderSource(layer->baseImpl->source);
-        if (!source) {
-            Log::Warning(Event::Render, "can't find source for layer '%s'", layer->getID().c_str());
-            continue;
-        }
+            if (layer->is<RenderCustomLayer>()) {
+                order.emplace_back(RenderItem { *layer, nullptr });
+                continue;
+            }
 
-        const bool symbolLayer = layer->is<RenderSymbolLayer>();
+            RenderSource* source = getRenderSource(layer->baseImpl->source);
+            if (!source) {
+                Log::Warning(Event::Render, "can't find source for layer '%s'", layer->getID().c_str());
+                continue;
+            }
 
-        auto sortedTiles = source->getRenderTiles();
-        if (symbolLayer) {
-            // Sort symbol tiles in opposite y position, so tiles with overlapping symbols are drawn
-            // on top of each other, with lower symbols being drawn on top of higher symbols.
-            std::sort(sortedTiles.begin(), sortedTiles.end(), [&](const RenderTile& a, const RenderTile& b) {
-                Point<float> pa(a.id.canonical.x, a.id.canonical.y);
-                Point<float> pb(b.id.canonical.x, b.id.canonical.y);
+            const bool symbolLayer = layer->is<RenderSymbolLayer>();
 
-                auto par = util::rotate(pa, parameters.state.getAngle());
-                auto pbr = util::rotate(pb, parameters.state.getAngle());
+            auto sortedTiles = source->getRenderTiles();
+            if (symbolLayer) {
+                // Sort symbol tiles in opposite y position, so tiles with overlapping symbols are drawn
+                // on top of each other, with lower symbols being drawn on top of higher symbols.
+                std::sort(sortedTiles.begin(), sortedTiles.end(), [&](const RenderTile& a, const RenderTile& b) {
+                    Point<float> pa(a.id.canonical.x, a.id.canonical.y);
+                    Point<float> pb(b.id.canonical.x, b.id.canonical.y);
 
-                return std::tie(b.id.canonical.z, par.y, par.x) < std::tie(a.id.canonical.z, pbr.y, pbr.x);
-            });
-        } else {
-            std::sort(sortedTiles.begin(), sortedTiles.end(),
-                      [](const auto& a, const auto& b) { return a.get().id < b.get().id; });
-            // Don't render non-symbol layers for tiles that we're only holding on to for symbol fading
-            sortedTiles.erase(std::remove_if(sortedTiles.begin(), sortedTiles.end(),
-                                             [](const auto& tile) { return tile.get().tile.holdForFade(); }),
-                              sortedTiles.end());
-        }
-
-        std::vector<std::reference_wrapper<RenderTile>> sortedTilesForInsertion;
-        for (auto& sortedTile : sortedTiles) {
-            auto& tile = sortedTile.get();
-            if (!tile.tile.isRenderable()) {
-                continue;
+                    auto par = util::rotate(pa, parameters.state.getAngle());
+                    auto pbr = util::rotate(pb, parameters.state.getAngle());
+
+                    return std::tie(b.id.canonical.z, par.y, par.x) < std::tie(a.id.canonical.z, pbr.y, pbr.x);
+                });
+            } else {
+                std::sort(sortedTiles.begin(), sortedTiles.end(),
+                          [](const auto& a, const auto& b) { return a.get().id < b.get().id; });
+                // Don't render non-symbol layers for tiles that we're only holding on to for symbol fading
+                sortedTiles.erase(std::remove_if(sortedTiles.begin(), sortedTiles.end(),
+                                                 [](const auto& tile) { return tile.get().tile.holdForFade(); }),
+                                  sortedTiles.end());
             }
 
-            auto bucket = tile.tile.getBucket(*layer->baseImpl);
-            if (bucket) {
-                sortedTilesForInsertion.emplace_back(tile);
-                tile.used = true;
+            std::vector<std::reference_wrapper<RenderTile>> sortedTilesForInsertion;
+            for (auto& sortedTile : sortedTiles) {
+                auto& tile = sortedTile.get();
+                if (!tile.tile.isRenderable()) {
+                    continue;
+                }
+
+                auto bucket = tile.tile.getBucket(*layer->baseImpl);
+                if (bucket) {
+                    sortedTilesForInsertion.emplace_back(tile);
+                    tile.used = true;
 
-                // We only need clipping when we're _not_ drawing a symbol layer.
-                if (!symbolLayer) {
-                    tile.needsClipping = true;
+                    // We only need clipping when we're _not_ drawing a symbol layer.
+                    if (!symbolLayer) {
+                        tile.needsClipping = true;
+                    }
                 }
             }
+            layer->setRenderTiles(std::move(sortedTilesForInsertion));
+            order.emplace_back(RenderItem { *layer, source });
         }
-        layer->setRenderTiles(std::move(sortedTilesForInsertion));
-        order.emplace_back(RenderItem { *layer, source });
     }
 
     bool symbolBucketsChanged = false;
-    if (parameters.mapMode != MapMode::Continuous) {
-        // TODO: Think about right way for symbol index to handle still rendering
-        crossTileSymbolIndex.reset();
-    }
-    for (auto it = order.rbegin(); it != order.rend(); ++it) {
-        if (it->layer.is<RenderSymbolLayer>()) {
-            const float lng = parameters.state.getLatLng().longitude();
-            if (crossTileSymbolIndex.addLayer(*it->layer.as<RenderSymbolLayer>(), lng)) symbolBucketsChanged = true;
-        }
-    }
-
     bool placementChanged = false;
-    if (!placement->stillRecent(parameters.timePoint)) {
-        placementChanged = true;
+    {
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "placement" };
 
-        auto newPlacement = std::make_unique<Placement>(parameters.state, parameters.mapMode);
-        std::set<std::string> usedSymbolLayers;
+        if (parameters.mapMode != MapMode::Continuous) {
+            // TODO: Think about right way for symbol index to handle still rendering
+            crossTileSymbolIndex.reset();
+        }
         for (auto it = order.rbegin(); it != order.rend(); ++it) {
             if (it->layer.is<RenderSymbolLayer>()) {
-                usedSymbolLayers.insert(it->layer.getID());
-                newPlacement->placeLayer(*it->layer.as<RenderSymbolLayer>(), parameters.projMatrix, parameters.debugOptions & MapDebugOptions::Collision);
+                const float lng = parameters.state.getLatLng().longitude();
+                if (crossTileSymbolIndex.addLayer(*it->layer.as<RenderSymbolLayer>(), lng)) symbolBucketsChanged = true;
             }
         }
 
-        newPlacement->commit(*placement, parameters.timePoint);
-        crossTileSymbolIndex.pruneUnusedLayers(usedSymbolLayers);
-        placement = std::move(newPlacement);
+        if (!placement->stillRecent(parameters.timePoint)) {
+            placementChanged = true;
+
+            auto newPlacement = std::make_unique<Placement>(parameters.state, parameters.mapMode);
+            std::set<std::string> usedSymbolLayers;
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                if (it->layer.is<RenderSymbolLayer>()) {
+                    usedSymbolLayers.insert(it->layer.getID());
+                    newPlacement->placeLayer(*it->layer.as<RenderSymbolLayer>(), parameters.projMatrix, parameters.debugOptions & MapDebugOptions::Collision);
+                }
+            }
+
+            newPlacement->commit(*placement, parameters.timePoint);
+            crossTileSymbolIndex.pruneUnusedLayers(usedSymbolLayers);
+            placement = std::move(newPlacement);
         
-        updateFadingTiles();
-    } else {
-        placement->setStale();
-    }
+            updateFadingTiles();
+        } else {
+            placement->setStale();
+        }
 
-    parameters.symbolFadeChange = placement->symbolFadeChange(parameters.timePoint);
+        parameters.symbolFadeChange = placement->symbolFadeChange(parameters.timePoint);
 
-    if (placementChanged || symbolBucketsChanged) {
-        for (auto it = order.rbegin(); it != order.rend(); ++it) {
-            if (it->layer.is<RenderSymbolLayer>()) {
-                placement->updateLayerOpacities(*it->layer.as<RenderSymbolLayer>());
+        if (placementChanged || symbolBucketsChanged) {
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                if (it->layer.is<RenderSymbolLayer>()) {
+                    placement->updateLayerOpacities(*it->layer.as<RenderSymbolLayer>());
+                }
             }
         }
     }
@@ -423,11 +505,14 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     // Uploads all required buffers and images before we do any actual rendering.
     {
         MBGL_DEBUG_GROUP(parameters.context, "upload");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "upload" };
 
         parameters.imageManager.upload(parameters.context, 0);
         parameters.lineAtlas.upload(parameters.context, 0);
         
-        // Update all clipping IDs + upload buckets.
+        // Update all clipping IDs + upload buckets. Clip IDs of sources whose tiles are
+        // unchanged since the last frame are reused.
+        parameters.clipIDGenerator.nextFrame();
         for (const auto& entry : renderSources) {
             if (entry.second->isEnabled()) {
                 entry.second->startRender(parameters);
@@ -442,6 +527,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         parameters.staticData.backendSize = parameters.backend.getFramebufferSize();
 
         MBGL_DEBUG_GROUP(parameters.context, "3d");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "3d" };
         parameters.pass = RenderPass::Pass3D;
 
         if (!parameters.staticData.depthRenderbuffer ||
@@ -456,6 +542,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
             parameters.currentLayer = i;
             if (it->layer.hasRenderPass(parameters.pass)) {
                 MBGL_DEBUG_GROUP(parameters.context, it->layer.getID());
+                FrameProfiler::Scope profileScope { frameProfiler.get(), it->layer.getID() };
                 it->layer.render(parameters, it->source);
             }
         }
@@ -468,6 +555,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         using namespace gl::value;
 
         MBGL_DEBUG_GROUP(parameters.context, "clear");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "clear" };
         parameters.backend.bind();
         if (parameters.debugOptions & MapDebugOptions::Overdraw) {
             parameters.context.clear(Color::black(), ClearDepth::Default, ClearStencil::Default);
@@ -482,6 +570,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     // Draws the clipping masks to the stencil buffer.
     {
         MBGL_DEBUG_GROUP(parameters.context, "clipping masks");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "clipping masks" };
 
         static const Properties<>::PossiblyEvaluated properties {};
         static const ClippingMaskProgram::PaintPropertyBinders paintAttributeData(properties, 0);
@@ -562,12 +651,14 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     {
         parameters.pass = RenderPass::Opaque;
         MBGL_DEBUG_GROUP(parameters.context, "opaque");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "opaque" };
 
         uint32_t i = 0;
         for (auto it = order.rbegin(); it != order.rend(); ++it, ++i) {
             parameters.currentLayer = i;
             if (it->layer.hasRenderPass(parameters.pass)) {
                 MBGL_DEBUG_GROUP(parameters.context, it->layer.getID());
+                FrameProfiler::Scope profileScope { frameProfiler.get(), it->layer.getID() };
                 it->layer.render(parameters, it->source);
             }
         }
@@ -578,12 +669,14 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     {
         parameters.pass = RenderPass::Translucent;
         MBGL_DEBUG_GROUP(parameters.context, "translucent");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "translucent" };
 
         uint32_t i = static_cast<uint32_t>(order.size()) - 1;
         for (auto it = order.begin(); it != order.end(); ++it, --i) {
             parameters.currentLayer = i;
             if (it->layer.hasRenderPass(parameters.pass)) {
                 MBGL_DEBUG_GROUP(parameters.context, it->layer.getID());
+                FrameProfiler::Scope profileScope { frameProfiler.get(), it->layer.getID() };
                 it->layer.render(parameters, it->source);
             }
         }
@@ -593,6 +686,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     // Renders debug overlays.
     {
         MBGL_DEBUG_GROUP(parameters.context, "debug");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "debug" };
 
         // Finalize the rendering, e.g. by calling debug render calls per tile.
         // This guarantees that we have at least one function per tile called.
@@ -632,6 +726,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     // unnecessary bind(0)/bind(N) sequences.
     {
         MBGL_DEBUG_GROUP(parameters.context, "cleanup");
+        FrameProfiler::Scope profileScope { frameProfiler.get(), "cleanup" };
 
         parameters.context.activeTextureUnit = 1;
         parameters.context.texture[1] = 0;
@@ -641,6 +736,13 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         parameters.context.bindVertexArray = 0;
     }
 
+    if (frameProfiler) {
+        frameProfiler->endFrame();
+        for (const auto& profile : frameProfiler->takeFinishedFrames()) {
+            observer->onDidFinishFrameProfile(profile);
+        }
+    }
+
     observer->onDidFinishRenderingFrame(
         loaded ? RendererObserver::RenderMode::Full : RendererObserver::RenderMode::Partial,
         updateParameters.mode == MapMode::Continuous && hasTransitions(parameters.timePoint)
@@ -657,7 +759,7 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
     parameters.context.performCleanup();
 }
 
-std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options) const {
+std::vector<const RenderLayer*> Renderer::Impl::getQueriedLayers(const RenderedQueryOptions& options) const {
     std::vector<const RenderLayer*> layers;
     if (options.layerIDs) {
         for (const auto& layerID : *options.layerIDs) {
@@ -670,8 +772,15 @@ std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineStrin
             layers.emplace_back(entry.second.get());
         }
     }
+    return layers;
+}
 
-    return queryRenderedFeatures(geometry, options, layers);
+std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options) const {
+    return std::move(queryRenderedFeatures(std::vector<ScreenLineString>{ geometry }, options, getQueriedLayers(options)).front());
+}
+
+std::vector<std::vector<Feature>> Renderer::Impl::queryRenderedFeatures(const std::vector<ScreenLineString>& geometries, const RenderedQueryOptions& options) const {
+    return queryRenderedFeatures(geometries, options, getQueriedLayers(options));
 }
     
 void Renderer::Impl::queryRenderedSymbols(std::unordered_map<std::string, std::vector<Feature>>& resultsByLayer,
@@ -707,44 +816,63 @@ void Renderer::Impl::queryRenderedSymbols(std::unordered_map<std::string, std::v
     }
 }
 
-std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options, const std::vector<const RenderLayer*>& layers) const {
+std::vector<std::vector<Feature>> Renderer::Impl::queryRenderedFeatures(const std::vector<ScreenLineString>& geometries, const RenderedQueryOptions& options, const std::vector<const RenderLayer*>& layers) const {
     std::unordered_set<std::string> sourceIDs;
+    std::vector<const RenderSource*> sources;
     for (const RenderLayer* layer : layers) {
-        sourceIDs.emplace(layer->baseImpl->source);
+        if (sourceIDs.emplace(layer->baseImpl->source).second) {
+            if (const RenderSource* renderSource = getRenderSource(layer->baseImpl->source)) {
+                sources.push_back(renderSource);
+            }
+        }
     }
 
     mat4 projMatrix;
     transformState.getProjMatrix(projMatrix);
 
-    std::unordered_map<std::string, std::vector<Feature>> resultsByLayer;
-    for (const auto& sourceID : sourceIDs) {
-        if (RenderSource* renderSource = getRenderSource(sourceID)) {
-            auto sourceResults = renderSource->queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
-            std::move(sourceResults.begin(), sourceResults.end(), std::inserter(resultsByLayer, resultsByLayer.begin()));
+    // The last query for every geometry is the one for symbols.
+    const std::size_t queriesPerGeometry = sources.size() + 1;
+    std::vector<std::unordered_map<std::string, std::vector<Feature>>> resultsByQuery(geometries.size() * queriesPerGeometry);
+
+    util::parallelFor(scheduler, resultsByQuery.size(), [&] (std::size_t index) {
+        const ScreenLineString& geometry = geometries[index / queriesPerGeometry];
+        const std::size_t source = index % queriesPerGeometry;
+        if (source < sources.size()) {
+            resultsByQuery[index] = sources[source]->queryRenderedFeatures(geometry, transformState, layers, options, projMatrix);
+        } else {
+            queryRenderedSymbols(resultsByQuery[index], geometry, layers, options);
         }
-    }
-    
-    queryRenderedSymbols(resultsByLayer, geometry, layers, options);
+    });
 
-    std::vector<Feature> result;
+    std::vector<std::vector<Feature>> results(geometries.size());
 
-    if (resultsByLayer.empty()) {
-        return result;
-    }
+    for (std::size_t i = 0; i < geometries.size(); i++) {
+        std::unordered_map<std::string, std::vector<Feature>> resultsByLayer;
+        for (std::size_t index = i * queriesPerGeometry; index < (i + 1) * queriesPerGeometry; index++) {
+            for (auto& entry : resultsByQuery[index]) {
+                auto& layerFeatures = resultsByLayer[entry.first];
+                std::move(entry.second.begin(), entry.second.end(), std::back_inserter(layerFeatures));
+            }
+        }
 
-    // Combine all results based on the style layer order.
-    for (const auto& layerImpl : *layerImpls) {
-        const RenderLayer* layer = getRenderLayer(layerImpl->id);
-        if (!layer->needsRendering(zoomHistory.lastZoom)) {
+        if (resultsByLayer.empty()) {
             continue;
         }
-        auto it = resultsByLayer.find(layer->baseImpl->id);
-        if (it != resultsByLayer.end()) {
-            std::move(it->second.begin(), it->second.end(), std::back_inserter(result));
+
+        // Combine all results based on the style layer order.
+        for (const auto& layerImpl : *layerImpls) {
+            const RenderLayer* layer = getRenderLayer(layerImpl->id);
+            if (!layer->needsRendering(zoomHistory.lastZoom)) {
+                continue;
+            }
+            auto it = resultsByLayer.find(layer->baseImpl->id);
+            if (it != resultsByLayer.end()) {
+                std::move(it->second.begin(), it->second.end(), std::back_inserter(results[i]));
+            }
         }
     }
 
-    return result;
+    return results;
 }
 
 std::vector<Feature> Renderer::Impl::queryShapeAnnotations(const ScreenLineString& geometry) const {
@@ -759,7 +887,7 @@ std::vector<Feature> Renderer::Impl::queryShapeAnnotations(const ScreenLineStrin
         }
     }
 
-    return queryRenderedFeatures(geometry, options, shapeAnnotationLayers);
+    return std::move(queryRenderedFeatures(std::vector<ScreenLineString>{ geometry }, options, shapeAnnotationLayers).front());
 }
 
 std::vector<Feature> Renderer::Impl::querySourceFeatures(const std::string& sourceID, const SourceQueryOptions& options) const {
@@ -769,6 +897,22 @@ std::vector<Feature> Renderer::Impl::querySourceFeatures(const std::string& sour
     return source->querySourceFeatures(options);
 }
 
+std::vector<std::vector<Feature>> Renderer::Impl::querySourceFeatures(const std::vector<std::string>& sourceIDs, const SourceQueryOptions& options) const {
+    std::vector<std::vector<Feature>> results(sourceIDs.size());
+    util::parallelFor(scheduler, sourceIDs.size(), [&] (std::size_t index) {
+        results[index] = querySourceFeatures(sourceIDs[index], options);
+    });
+    return results;
+}
+
+PrefetchStatistics Renderer::Impl::getPrefetchStatistics() const {
+    PrefetchStatistics statistics;
+    for (const auto& entry : renderSources) {
+        statistics += entry.second->getPrefetchStatistics();
+    }
+    return statistics;
+}
+
 void Renderer::Impl::reduceMemoryUse() {
     assert(BackendScope::exists());
     for (const auto& entry : renderSources) {
@@ -806,10 +950,8 @@ bool Renderer::Impl::hasTransitions(TimePoint timePoint) const {
         return true;
     }
 
-    for (const auto& entry : renderLayers) {
-        if (entry.second->hasTransition()) {
-            return true;
-        }
+    if (!transitioningLayers.empty()) {
+        return true;
     }
 
     if (placement->hasTransitions(timePoint)) {
@@ -7,14 +7,17 @@
 #include <mbgl/style/image.hpp>
 #include <mbgl/style/source.hpp>
 #include <mbgl/style/layer.hpp>
+#include <mbgl/style/collection_journal.hpp>
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/map/zoom_history.hpp>
 #include <mbgl/text/cross_tile_symbol_index.hpp>
 #include <mbgl/text/glyph_manager_observer.hpp>
 #include <mbgl/text/placement.hpp>
+#include <mbgl/algorithm/generate_clip_ids.hpp>
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace mbgl {
@@ -33,6 +36,7 @@ class GlyphManager;
 class ImageManager;
 class LineAtlas;
 class CrossTileSymbolIndex;
+class FrameProfiler;
 
 class Renderer::Impl : public GlyphManagerObserver,
                        public RenderSourceObserver{
@@ -47,10 +51,17 @@ public:
 
     void setObserver(RendererObserver*);
 
+    void setFrameProfiling(bool);
+    std::vector<FrameProfile> getRecentFrameProfiles() const;
+
+    PrefetchStatistics getPrefetchStatistics() const;
+
     void render(const UpdateParameters&);
 
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&) const;
+    std::vector<std::vector<Feature>> queryRenderedFeatures(const std::vector<ScreenLineString>&, const RenderedQueryOptions&) const;
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions&) const;
+    std::vector<std::vector<Feature>> querySourceFeatures(const std::vector<std::string>& sourceIDs, const SourceQueryOptions&) const;
     std::vector<Feature> queryShapeAnnotations(const ScreenLineString&) const;
 
     void reduceMemoryUse();
@@ -70,7 +81,11 @@ private:
                               const std::vector<const RenderLayer*>& layers,
                               const RenderedQueryOptions& options) const;
     
-    std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&, const std::vector<const RenderLayer*>&) const;
+    std::vector<const RenderLayer*> getQueriedLayers(const RenderedQueryOptions&) const;
+
+    // Queries every geometry against each source and against the placed symbols. These
+    // queries only read from the tiles, and run in parallel on the scheduler.
+    std::vector<std::vector<Feature>> queryRenderedFeatures(const std::vector<ScreenLineString>&, const RenderedQueryOptions&, const std::vector<const RenderLayer*>&) const;
 
     // GlyphManagerObserver implementation.
     void onGlyphsError(const FontStack&, const GlyphRange&, std::exception_ptr) override;
@@ -107,18 +122,29 @@ private:
     std::unique_ptr<ImageManager> imageManager;
     std::unique_ptr<LineAtlas> lineAtlas;
     std::unique_ptr<RenderStaticData> staticData;
+    algorithm::ClipIDGenerator clipIDGenerator;
 
     Immutable<std::vector<Immutable<style::Image::Impl>>> imageImpls;
     Immutable<std::vector<Immutable<style::Source::Impl>>> sourceImpls;
     Immutable<std::vector<Immutable<style::Layer::Impl>>> layerImpls;
 
+    // The journals that came with the collections above.
+    std::shared_ptr<const style::CollectionJournal> imageJournal;
+    std::shared_ptr<const style::CollectionJournal> sourceJournal;
+    std::shared_ptr<const style::CollectionJournal> layerJournal;
+
     std::unordered_map<std::string, std::unique_ptr<RenderSource>> renderSources;
     std::unordered_map<std::string, std::unique_ptr<RenderLayer>> renderLayers;
+    // The render layers that were still transitioning when they were last evaluated.
+    std::unordered_set<std::string> transitioningLayers;
     RenderLight renderLight;
 
     CrossTileSymbolIndex crossTileSymbolIndex;
     std::unique_ptr<Placement> placement;
 
+    bool frameProfiling = false;
+    std::unique_ptr<FrameProfiler> frameProfiler;
+
     bool contextLost = false;
     bool fadingTiles = false;
 };
@@ -80,6 +80,10 @@ void RenderCustomGeometrySource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
 
+PrefetchStatistics RenderCustomGeometrySource::getPrefetchStatistics() const {
+    return tilePyramid.prefetchStatistics;
+}
+
 void RenderCustomGeometrySource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
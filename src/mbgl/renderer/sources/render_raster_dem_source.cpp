@@ -159,6 +159,10 @@ void RenderRasterDEMSource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
 
+PrefetchStatistics RenderRasterDEMSource::getPrefetchStatistics() const {
+    return tilePyramid.prefetchStatistics;
+}
+
 void RenderRasterDEMSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
@@ -34,6 +34,7 @@ public:
     querySourceFeatures(const SourceQueryOptions&) const final;
 
     void reduceMemoryUse() final;
+    PrefetchStatistics getPrefetchStatistics() const final;
     void dumpDebugLogs() const final;
 
     uint8_t getMaxZoom() const {
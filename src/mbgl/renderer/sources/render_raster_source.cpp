@@ -89,6 +89,10 @@ void RenderRasterSource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
 
+PrefetchStatistics RenderRasterSource::getPrefetchStatistics() const {
+    return tilePyramid.prefetchStatistics;
+}
+
 void RenderRasterSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
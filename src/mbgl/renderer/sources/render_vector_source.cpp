@@ -33,9 +33,11 @@ void RenderVectorSource::update(Immutable<style::Source::Impl> baseImpl_,
     enabled = needsRendering;
 
     optional<Tileset> _tileset = impl().getTileset();
+    const float _lineSimplificationTolerance = impl().getLineSimplificationTolerance();
 
-    if (tileset != _tileset) {
+    if (tileset != _tileset || lineSimplificationTolerance != _lineSimplificationTolerance) {
         tileset = _tileset;
+        lineSimplificationTolerance = _lineSimplificationTolerance;
 
         // TODO: this removes existing buckets, and will cause flickering.
         // Should instead refresh tile data in place.
@@ -58,7 +60,7 @@ void RenderVectorSource::update(Immutable<style::Source::Impl> baseImpl_,
                        tileset->zoomRange,
                        tileset->bounds,
                        [&] (const OverscaledTileID& tileID) {
-                           return std::make_unique<VectorTile>(tileID, impl().id, parameters, *tileset);
+                           return std::make_unique<VectorTile>(tileID, impl().id, parameters, *tileset, lineSimplificationTolerance);
                        });
 }
 
@@ -92,6 +94,10 @@ void RenderVectorSource::reduceMemoryUse() {
     tilePyramid.reduceMemoryUse();
 }
 
+PrefetchStatistics RenderVectorSource::getPrefetchStatistics() const {
+    return tilePyramid.prefetchStatistics;
+}
+
 void RenderVectorSource::dumpDebugLogs() const {
     tilePyramid.dumpDebugLogs();
 }
@@ -34,6 +34,7 @@ public:
     querySourceFeatures(const SourceQueryOptions&) const final;
 
     void reduceMemoryUse() final;
+    PrefetchStatistics getPrefetchStatistics() const final;
     void dumpDebugLogs() const final;
 
 private:
@@ -41,6 +42,7 @@ private:
 
     TilePyramid tilePyramid;
     optional<Tileset> tileset;
+    float lineSimplificationTolerance = 0;
 };
 
 template <>
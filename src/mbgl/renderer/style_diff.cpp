@@ -4,6 +4,8 @@
 #include <mbgl/util/variant.hpp>
 #include <mbgl/util/longest_common_subsequence.hpp>
 
+#include <cassert>
+
 namespace mbgl {
 
 template <class T, class Eq>
@@ -44,6 +46,38 @@ StyleDifference<T> diff(const Immutable<std::vector<T>>& a,
     return result;
 }
 
+template <class T, class Eq>
+StyleDifference<T> diff(const Immutable<std::vector<T>>& a,
+                        const Immutable<std::vector<T>>& b,
+                        const ImmutableJournal& aJournal,
+                        const ImmutableJournal& bJournal,
+                        const Eq& eq) {
+    if (a == b || !aJournal || !bJournal) {
+        return diff(a, b, eq);
+    }
+
+    StyleDifference<T> result;
+
+    for (const style::CollectionJournal* entry = bJournal.get(); entry != aJournal.get(); entry = entry->previous.get()) {
+        if (!entry || !entry->updated) {
+            // Elements were added, removed or moved since `a`.
+            return diff(a, b, eq);
+        }
+
+        const std::size_t i = *entry->updated;
+        assert(i < a->size() && i < b->size());
+        const T& before = a->at(i);
+        const T& after = b->at(i);
+        assert(eq(before, after));
+
+        if (before.get() != after.get()) {
+            result.changed.emplace(after->id, StyleChange<T> { before, after });
+        }
+    }
+
+    return result;
+}
+
 ImageDifference diffImages(const Immutable<std::vector<ImmutableImage>>& a,
                            const Immutable<std::vector<ImmutableImage>>& b) {
     return diff(a, b, [] (const ImmutableImage& lhs, const ImmutableImage& rhs) {
@@ -51,6 +85,15 @@ ImageDifference diffImages(const Immutable<std::vector<ImmutableImage>>& a,
     });
 }
 
+ImageDifference diffImages(const Immutable<std::vector<ImmutableImage>>& a,
+                           const Immutable<std::vector<ImmutableImage>>& b,
+                           const ImmutableJournal& aJournal,
+                           const ImmutableJournal& bJournal) {
+    return diff(a, b, aJournal, bJournal, [] (const ImmutableImage& lhs, const ImmutableImage& rhs) {
+        return lhs->id == rhs->id;
+    });
+}
+
 SourceDifference diffSources(const Immutable<std::vector<ImmutableSource>>& a,
                              const Immutable<std::vector<ImmutableSource>>& b) {
     return diff(a, b, [] (const ImmutableSource& lhs, const ImmutableSource& rhs) {
@@ -59,6 +102,16 @@ SourceDifference diffSources(const Immutable<std::vector<ImmutableSource>>& a,
     });
 }
 
+SourceDifference diffSources(const Immutable<std::vector<ImmutableSource>>& a,
+                             const Immutable<std::vector<ImmutableSource>>& b,
+                             const ImmutableJournal& aJournal,
+                             const ImmutableJournal& bJournal) {
+    return diff(a, b, aJournal, bJournal, [] (const ImmutableSource& lhs, const ImmutableSource& rhs) {
+        return std::tie(lhs->id, lhs->type)
+            == std::tie(rhs->id, rhs->type);
+    });
+}
+
 LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>& a,
                            const Immutable<std::vector<ImmutableLayer>>& b) {
     return diff(a, b, [] (const ImmutableLayer& lhs, const ImmutableLayer& rhs) {
@@ -67,6 +120,16 @@ LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>& a,
     });
 }
 
+LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>& a,
+                           const Immutable<std::vector<ImmutableLayer>>& b,
+                           const ImmutableJournal& aJournal,
+                           const ImmutableJournal& bJournal) {
+    return diff(a, b, aJournal, bJournal, [] (const ImmutableLayer& lhs, const ImmutableLayer& rhs) {
+        return std::tie(lhs->id, lhs->type)
+            == std::tie(rhs->id, rhs->type);
+    });
+}
+
 bool hasLayoutDifference(const LayerDifference& layerDiff, const std::string& layerID) {
     if (layerDiff.added.count(layerID))
         return true;
@@ -3,6 +3,7 @@
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/collection_journal.hpp>
 #include <mbgl/util/immutable.hpp>
 #include <mbgl/util/variant.hpp>
 
@@ -25,24 +26,45 @@ public:
     std::unordered_map<std::string, StyleChange<T>> changed;
 };
 
+using ImmutableJournal = std::shared_ptr<const style::CollectionJournal>;
+
+// The overloads below that take the journals of both collections only compare the elements
+// that were updated in between, if the journal of `b` leads back to that of `a`. Otherwise
+// they compare the collections in full.
+
 using ImmutableImage = Immutable<style::Image::Impl>;
 using ImageDifference = StyleDifference<ImmutableImage>;
 
 ImageDifference diffImages(const Immutable<std::vector<ImmutableImage>>&,
                            const Immutable<std::vector<ImmutableImage>>&);
 
+ImageDifference diffImages(const Immutable<std::vector<ImmutableImage>>&,
+                           const Immutable<std::vector<ImmutableImage>>&,
+                           const ImmutableJournal&,
+                           const ImmutableJournal&);
+
 using ImmutableSource = Immutable<style::Source::Impl>;
 using SourceDifference = StyleDifference<ImmutableSource>;
 
 SourceDifference diffSources(const Immutable<std::vector<ImmutableSource>>&,
                              const Immutable<std::vector<ImmutableSource>>&);
 
+SourceDifference diffSources(const Immutable<std::vector<ImmutableSource>>&,
+                             const Immutable<std::vector<ImmutableSource>>&,
+                             const ImmutableJournal&,
+                             const ImmutableJournal&);
+
 using ImmutableLayer = Immutable<style::Layer::Impl>;
 using LayerDifference = StyleDifference<ImmutableLayer>;
 
 LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>&,
                            const Immutable<std::vector<ImmutableLayer>>&);
 
+LayerDifference diffLayers(const Immutable<std::vector<ImmutableLayer>>&,
+                           const Immutable<std::vector<ImmutableLayer>>&,
+                           const ImmutableJournal&,
+                           const ImmutableJournal&);
+
 bool hasLayoutDifference(const LayerDifference&, const std::string& layerID);
 
 } // namespace mbgl
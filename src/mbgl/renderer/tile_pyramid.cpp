@@ -24,12 +24,22 @@ using namespace style;
 
 static TileObserver nullObserver;
 
+// Upper bound on the number of prefetched tiles that are loading at the same time, so
+// that they don't hold up the tiles that are needed right now for long.
+static const std::size_t maxLoadingPrefetches = 16;
+
 TilePyramid::TilePyramid()
     : observer(&nullObserver) {
 }
 
 TilePyramid::~TilePyramid() = default;
 
+bool TilePyramid::Cover::operator==(const Cover& other) const {
+    return projMatrix == other.projMatrix && size == other.size && zoom == other.zoom &&
+           zoomRange == other.zoomRange && tileSize == other.tileSize && bounds == other.bounds &&
+           prefetchZoomDelta == other.prefetchZoomDelta && mode == other.mode;
+}
+
 bool TilePyramid::isLoaded() const {
     for (const auto& pair : tiles) {
         if (!pair.second->isComplete()) {
@@ -87,18 +97,50 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
         tiles.clear();
         renderTiles.clear();
 
+        prefetchStatistics.discarded += prefetchedTiles.size();
+        prefetchedTiles.clear();
+
+        cover = {};
         return;
     }
 
     handleWrapJump(parameters.transformState.getLatLng().longitude());
 
+    Cover nextCover { {}, parameters.transformState.getSize(), parameters.transformState.getZoom(),
+                      zoomRange, tileSize, bounds, parameters.prefetchZoomDelta, parameters.mode };
+    parameters.transformState.getProjMatrix(nextCover.projMatrix);
+    const bool coverChanged = !cover || !(*cover == nextCover);
+
+    // When neither the cover nor any of the tiles changed, updating the render tiles
+    // would yield the ones of the last update again. Tiles that are held for fading
+    // change without notifying us, and prefetching depends on the camera's motion, so
+    // both always take the full update, as does a pyramid whose tiles were cleared.
+    if (!coverChanged && !needsRelayout && !tilesChanged && !holdingTiles && !prefetching &&
+        parameters.prefetchStates.empty() && !tiles.empty()) {
+        for (auto& renderTile : renderTiles) {
+            renderTile.clip = {};
+            renderTile.used = false;
+            renderTile.needsClipping = false;
+        }
+        for (auto& pair : tiles) {
+            pair.second->setShowCollisionBoxes(parameters.debugOptions & MapDebugOptions::Collision);
+        }
+        return;
+    }
+
+    tilesChanged = false;
+    holdingTiles = false;
+    prefetching = parameters.mode == MapMode::Continuous && !parameters.prefetchStates.empty();
+
     // Determine the overzooming/underzooming amounts and required tiles.
     int32_t overscaledZoom = util::coveringZoomLevel(parameters.transformState.getZoom(), type, tileSize);
     int32_t tileZoom = overscaledZoom;
     int32_t panZoom = zoomRange.max;
 
-    std::vector<UnwrappedTileID> idealTiles;
-    std::vector<UnwrappedTileID> panTiles;
+    if (coverChanged) {
+        idealTiles.clear();
+        panTiles.clear();
+    }
 
     if (overscaledZoom >= zoomRange.min) {
         int32_t idealZoom = std::min<int32_t>(zoomRange.max, overscaledZoom);
@@ -117,14 +159,18 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
                 panZoom = std::max<int32_t>(tileZoom - parameters.prefetchZoomDelta, zoomRange.min);
             }
 
-            if (panZoom < idealZoom) {
+            if (panZoom < idealZoom && coverChanged) {
                 panTiles = util::tileCover(parameters.transformState, panZoom);
             }
         }
 
-        idealTiles = util::tileCover(parameters.transformState, idealZoom);
+        if (coverChanged) {
+            idealTiles = util::tileCoverWithLOD(parameters.transformState, idealZoom, zoomRange.min);
+        }
     }
 
+    cover = std::move(nextCover);
+
     // Stores a list of all the tiles that we're definitely going to retain. There are two
     // kinds of tiles we need: the ideal tiles determined by the tile cover. They may not yet be in
     // use because they're still loading. In addition to that, we also need to retain all tiles that
@@ -161,7 +207,7 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
         if (!tile) {
             tile = createTile(tileID);
             if (tile) {
-                tile->setObserver(observer);
+                tile->setObserver(this);
                 tile->setLayers(layers);
             }
         }
@@ -181,6 +227,9 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
         rendered.emplace(tileID);
         previouslyRenderedTiles.erase(tileID); // Still rendering this tile, no need for special fading logic.
         tile.markRenderedIdeal();
+        if (prefetchedTiles.erase(tile.id)) {
+            prefetchStatistics.used++;
+        }
     };
 
     renderTiles.clear();
@@ -192,7 +241,65 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
 
     algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
                                  idealTiles, zoomRange, tileZoom);
-    
+
+    // Request the tiles for where the camera is headed, after the ones that are needed
+    // now. Prefetched tiles that are no longer on the predicted path aren't retained, so
+    // they are moved to the cache below, which cancels their requests.
+    if (parameters.mode == MapMode::Continuous && !parameters.prefetchStates.empty() &&
+        type != SourceType::GeoJSON && type != SourceType::Annotations) {
+        std::size_t loading = 0;
+        for (const auto& tileID : prefetchedTiles) {
+            auto it = tiles.find(tileID);
+            if (it != tiles.end() && !it->second->isRenderable()) {
+                loading++;
+            }
+        }
+
+        optional<util::TileRange> prefetchRange;
+        if (bounds) {
+            prefetchRange = util::TileRange::fromLatLngBounds(*bounds, zoomRange.min, zoomRange.max);
+        }
+
+        for (const auto& state : parameters.prefetchStates) {
+            const int32_t prefetchOverscaledZoom = util::coveringZoomLevel(state.getZoom(), type, tileSize);
+            if (prefetchOverscaledZoom < zoomRange.min) {
+                continue;
+            }
+            const int32_t prefetchIdealZoom = std::min<int32_t>(zoomRange.max, prefetchOverscaledZoom);
+            const int32_t prefetchTileZoom = type == SourceType::Raster ? prefetchIdealZoom : prefetchOverscaledZoom;
+
+            for (const auto& idealTileID : util::tileCoverWithLOD(state, prefetchIdealZoom, zoomRange.min)) {
+                const OverscaledTileID tileID = idealTileID.overscaleTo(
+                    prefetchTileZoom - (prefetchIdealZoom - idealTileID.canonical.z));
+                if (Tile* tile = getTileFn(tileID)) {
+                    retainTileFn(*tile, TileNecessity::Required);
+                    continue;
+                }
+                if (loading >= maxLoadingPrefetches ||
+                    (prefetchRange && !prefetchRange->contains(tileID.canonical))) {
+                    continue;
+                }
+                std::unique_ptr<Tile> tile = cache.pop(tileID);
+                const bool cached = bool(tile);
+                if (!tile) {
+                    tile = createTile(tileID);
+                    if (!tile) {
+                        continue;
+                    }
+                    tile->setObserver(this);
+                    tile->setLayers(layers);
+                }
+                Tile& prefetched = *tiles.emplace(tileID, std::move(tile)).first->second;
+                retainTileFn(prefetched, TileNecessity::Required);
+                if (!cached) {
+                    prefetchedTiles.insert(tileID);
+                    prefetchStatistics.requested++;
+                    loading++;
+                }
+            }
+        }
+    }
+
     for (auto previouslyRenderedTile : previouslyRenderedTiles) {
         Tile& tile = *previouslyRenderedTile.second;
         tile.markRenderedPreviously();
@@ -202,6 +309,7 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
             retainTileFn(tile, TileNecessity::Optional);
             renderTiles.emplace_back(previouslyRenderedTile.first, tile);
             rendered.emplace(previouslyRenderedTile.first);
+            holdingTiles = true;
         }
     }
 
@@ -221,6 +329,9 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
         auto retainIt = retain.begin();
         while (tilesIt != tiles.end()) {
             if (retainIt == retain.end() || tilesIt->first < *retainIt) {
+                if (prefetchedTiles.erase(tilesIt->first)) {
+                    prefetchStatistics.discarded++;
+                }
                 if (!needsRelayout) {
                     tilesIt->second->setNecessity(TileNecessity::Optional);
                     cache.add(tilesIt->first, std::move(tilesIt->second));
@@ -274,6 +385,12 @@ void TilePyramid::handleWrapJump(float lng) {
         for (auto& renderTile : renderTiles) {
             renderTile.id = renderTile.id.unwrapTo(renderTile.id.wrap + wrapDelta);
         }
+
+        std::set<OverscaledTileID> newPrefetchedTiles;
+        for (OverscaledTileID tileID : prefetchedTiles) {
+            newPrefetchedTiles.insert(tileID.unwrapTo(tileID.wrap + wrapDelta));
+        }
+        prefetchedTiles = std::move(newPrefetchedTiles);
     }
 }
 
@@ -359,6 +476,16 @@ void TilePyramid::setObserver(TileObserver* observer_) {
     observer = observer_;
 }
 
+void TilePyramid::onTileChanged(Tile& tile) {
+    tilesChanged = true;
+    observer->onTileChanged(tile);
+}
+
+void TilePyramid::onTileError(Tile& tile, std::exception_ptr error) {
+    tilesChanged = true;
+    observer->onTileError(tile, error);
+}
+
 void TilePyramid::dumpDebugLogs() const {
     for (const auto& pair : tiles) {
         pair.second->dumpDebugLogs();
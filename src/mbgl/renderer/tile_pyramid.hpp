@@ -6,15 +6,21 @@
 #include <mbgl/tile/tile_cache.hpp>
 #include <mbgl/style/types.hpp>
 #include <mbgl/style/layer_impl.hpp>
+#include <mbgl/renderer/prefetch_statistics.hpp>
 
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/range.hpp>
+#include <mbgl/util/geo.hpp>
+#include <mbgl/util/size.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/map/mode.hpp>
 
 #include <memory>
 #include <unordered_map>
 #include <vector>
 #include <map>
+#include <set>
 
 namespace mbgl {
 
@@ -26,10 +32,10 @@ class RenderedQueryOptions;
 class SourceQueryOptions;
 class TileParameters;
 
-class TilePyramid {
+class TilePyramid : private TileObserver {
 public:
     TilePyramid();
-    ~TilePyramid();
+    ~TilePyramid() override;
 
     bool isLoaded() const;
 
@@ -73,9 +79,41 @@ public:
 
     std::vector<RenderTile> renderTiles;
 
+    // Tiles that were created for a predicted camera position and haven't been
+    // rendered yet.
+    std::set<OverscaledTileID> prefetchedTiles;
+    PrefetchStatistics prefetchStatistics;
+
     TileObserver* observer = nullptr;
 
     float prevLng = 0;
+
+private:
+    void onTileChanged(Tile&) override;
+    void onTileError(Tile&, std::exception_ptr) override;
+
+    // The inputs that determine the tile cover of an update.
+    struct Cover {
+        mat4 projMatrix;
+        Size size;
+        double zoom;
+        Range<uint8_t> zoomRange;
+        uint16_t tileSize;
+        optional<LatLngBounds> bounds;
+        uint8_t prefetchZoomDelta;
+        MapMode mode;
+
+        bool operator==(const Cover&) const;
+    };
+
+    // The render tiles of the last update are kept as they are while its cover and
+    // the state of its tiles stay the same.
+    optional<Cover> cover;
+    std::vector<UnwrappedTileID> idealTiles;
+    std::vector<UnwrappedTileID> panTiles;
+    bool tilesChanged = true;
+    bool holdingTiles = false;
+    bool prefetching = false;
 };
 
 } // namespace mbgl
@@ -6,6 +6,7 @@
 #include <mbgl/style/image.hpp>
 #include <mbgl/style/source.hpp>
 #include <mbgl/style/layer.hpp>
+#include <mbgl/style/collection_journal.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/immutable.hpp>
 
@@ -32,9 +33,19 @@ public:
     const Immutable<std::vector<Immutable<style::Source::Impl>>> sources;
     const Immutable<std::vector<Immutable<style::Layer::Impl>>> layers;
 
+    // Journals of the collections above, which tell the renderer which elements were
+    // updated since the previous frame.
+    const std::shared_ptr<const style::CollectionJournal> imageJournal;
+    const std::shared_ptr<const style::CollectionJournal> sourceJournal;
+    const std::shared_ptr<const style::CollectionJournal> layerJournal;
+
     AnnotationManager& annotationManager;
 
     const uint8_t prefetchZoomDelta;
+
+    // Where the camera is expected to be soon, nearest first. Tiles for these states
+    // are requested before they are needed.
+    const std::vector<TransformState> prefetchStates;
     
     // For still image requests, render requested
     const bool stillImageRequest;
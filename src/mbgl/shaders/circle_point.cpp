@@ -0,0 +1,14 @@
+// NOTE: DO NOT CHANGE THIS FILE. IT IS AUTOMATICALLY GENERATED.
+
+#include <mbgl/shaders/circle_point.hpp>
+#include <mbgl/shaders/source.hpp>
+
+namespace mbgl {
+namespace shaders {
+
+const char* circle_point::name = "circle_point";
+const char* circle_point::vertexSource = source() + 71436;
+const char* circle_point::fragmentSource = source() + 75030;
+
+} // namespace shaders
+} // namespace mbgl
@@ -0,0 +1,52 @@
+uniform mat4 u_matrix;
+uniform bool u_scale_with_map;
+uniform vec2 u_world;
+uniform float u_pixel_ratio;
+uniform highp float u_camera_to_center_distance;
+
+attribute vec2 a_pos;
+
+#pragma mapbox: define highp vec4 color
+#pragma mapbox: define mediump float radius
+#pragma mapbox: define lowp float blur
+#pragma mapbox: define lowp float opacity
+#pragma mapbox: define highp vec4 stroke_color
+#pragma mapbox: define mediump float stroke_width
+#pragma mapbox: define lowp float stroke_opacity
+
+varying highp vec2 v_center;
+varying highp float v_size;
+varying lowp float v_antialiasblur;
+
+// Draws each circle as a single point sprite. Unlike the quads of the circle shader,
+// sprites always face the viewport, so circles aligned with the map aren't foreshortened
+// when the map is pitched.
+void main(void) {
+    #pragma mapbox: initialize highp vec4 color
+    #pragma mapbox: initialize mediump float radius
+    #pragma mapbox: initialize lowp float blur
+    #pragma mapbox: initialize lowp float opacity
+    #pragma mapbox: initialize highp vec4 stroke_color
+    #pragma mapbox: initialize mediump float stroke_width
+    #pragma mapbox: initialize lowp float stroke_opacity
+
+    gl_Position = u_matrix * vec4(a_pos, 0, 1);
+
+    // The radius of the sprite in framebuffer pixels.
+    highp float size = (radius + stroke_width) * u_pixel_ratio;
+    if (u_scale_with_map) {
+        size *= u_camera_to_center_distance / gl_Position.w;
+    }
+
+    gl_PointSize = 2.0 * size;
+
+    // The center of the sprite in window coordinates, for the fragment shader to compare
+    // gl_FragCoord with.
+    v_center = (gl_Position.xy / gl_Position.w * 0.5 + 0.5) * u_world;
+    v_size = size;
+
+    // This is a minimum blur distance that serves as a faux-antialiasing for
+    // the circle. since blur is a ratio of the circle's size and the intent is
+    // to keep the blur at roughly 1px, the two are inversely related.
+    v_antialiasblur = 1.0 / DEVICE_PIXEL_RATIO / (radius + stroke_width);
+}
@@ -0,0 +1,28 @@
+#pragma mapbox: define highp float weight
+
+uniform highp float u_intensity;
+
+varying highp vec2 v_center;
+varying highp float v_size;
+varying float v_scale;
+
+// Gaussian kernel coefficient: 1 / sqrt(2 * PI)
+#define GAUSS_COEF 0.3989422804014327
+
+void main() {
+    #pragma mapbox: initialize highp float weight
+
+    // gl_PointCoord isn't available in desktop GLSL 1.10, so the extrusion is derived
+    // from the window coordinates of the fragment instead.
+    highp vec2 extrude = v_scale * (gl_FragCoord.xy - v_center) / v_size;
+
+    // Kernel density estimation with a Gaussian kernel of size 5x5
+    float d = -0.5 * 3.0 * 3.0 * dot(extrude, extrude);
+    float val = weight * u_intensity * GAUSS_COEF * exp(d);
+
+    gl_FragColor = vec4(val, 1.0, 1.0, 1.0);
+
+#ifdef OVERDRAW_INSPECTOR
+    gl_FragColor = vec4(1.0);
+#endif
+}
@@ -0,0 +1,43 @@
+#pragma mapbox: define highp float weight
+#pragma mapbox: define mediump float radius
+
+uniform mat4 u_matrix;
+uniform vec2 u_world;
+uniform float u_pixel_ratio;
+uniform float u_intensity;
+uniform highp float u_camera_to_center_distance;
+
+attribute vec2 a_pos;
+
+varying highp vec2 v_center;
+varying highp float v_size;
+varying float v_scale;
+
+// Effective "0" in the kernel density texture to adjust the kernel size to;
+// this empirically chosen number minimizes artifacts on overlapping kernels
+// for typical heatmap cases (assuming clustered source)
+const highp float ZERO = 1.0 / 255.0 / 16.0;
+
+// Gaussian kernel coefficient: 1 / sqrt(2 * PI)
+#define GAUSS_COEF 0.3989422804014327
+
+// Draws the kernel of each point as a single point sprite, sized like the quads of the
+// heatmap shader but always facing the viewport.
+void main(void) {
+    #pragma mapbox: initialize highp float weight
+    #pragma mapbox: initialize mediump float radius
+
+    // The scale, in units of radius, at which the kernel falls effectively to zero.
+    // See the heatmap shader.
+    float S = sqrt(-2.0 * log(ZERO / weight / u_intensity / GAUSS_COEF)) / 3.0;
+
+    gl_Position = u_matrix * vec4(a_pos, 0, 1);
+
+    // The radius of the sprite in framebuffer pixels, shrinking into the distance like
+    // the kernel does on the pitched tile plane.
+    v_size = S * radius * u_pixel_ratio * u_camera_to_center_distance / gl_Position.w;
+    v_center = (gl_Position.xy / gl_Position.w * 0.5 + 0.5) * u_world;
+    v_scale = S;
+
+    gl_PointSize = 2.0 * v_size;
+}
@@ -0,0 +1,14 @@
+// NOTE: DO NOT CHANGE THIS FILE. IT IS AUTOMATICALLY GENERATED.
+
+#include <mbgl/shaders/heatmap_point.hpp>
+#include <mbgl/shaders/source.hpp>
+
+namespace mbgl {
+namespace shaders {
+
+const char* heatmap_point::name = "heatmap_point";
+const char* heatmap_point::vertexSource = source() + 77211;
+const char* heatmap_point::fragmentSource = source() + 79155;
+
+} // namespace shaders
+} // namespace mbgl
@@ -10,1455 +10,1634 @@ namespace shaders {
 
 const char* source() {
     static const uint8_t compressed[] = {
-        0x78, 0xda, 0xed, 0x7d, 0x6b, 0x73, 0x1b, 0x37,
-        0xb2, 0xe8, 0x7e, 0xf6, 0xaf, 0x40, 0x36, 0x55,
-        0xc7, 0xa4, 0xcc, 0xb7, 0x24, 0x5b, 0x96, 0x56,
-        0x27, 0xe5, 0x93, 0x38, 0x39, 0xbe, 0x37, 0x9b,
-        0xb8, 0x22, 0x67, 0xb3, 0x75, 0x5c, 0x5e, 0xd6,
-        0x0c, 0x39, 0x24, 0x67, 0x3d, 0x9c, 0x61, 0x66,
-        0x86, 0xa2, 0xe4, 0x73, 0xf3, 0xdf, 0x6f, 0x3f,
-        0xf0, 0x9c, 0x97, 0x28, 0x59, 0x92, 0x65, 0x87,
-        0x5b, 0xab, 0x58, 0x1a, 0x00, 0x8d, 0x06, 0xd0,
-        0x68, 0x74, 0x37, 0x1a, 0xdd, 0x5f, 0x87, 0xb3,
-        0x69, 0x30, 0x13, 0x3f, 0xfc, 0x38, 0x7e, 0x79,
-        0xf6, 0x68, 0x95, 0x06, 0x93, 0x30, 0x0b, 0x93,
-        0x58, 0x2c, 0xc2, 0xf9, 0x62, 0x25, 0x66, 0x51,
-        0xe2, 0xe5, 0x27, 0x8f, 0xbe, 0x0e, 0xa2, 0x2c,
-        0x78, 0xf4, 0xe8, 0xeb, 0x70, 0x26, 0xbe, 0x82,
-        0xca, 0x61, 0x1c, 0x4c, 0x5b, 0x51, 0xb2, 0x59,
-        0xb5, 0x1f, 0x7d, 0xcd, 0x7f, 0x0a, 0xfc, 0x0b,
-        0xaa, 0xc5, 0xd3, 0x70, 0x56, 0xa8, 0xb7, 0x0c,
-        0xa6, 0xe1, 0x7a, 0x69, 0x55, 0x95, 0x1f, 0xaa,
-        0x6b, 0x53, 0xb7, 0xa6, 0x2e, 0xfd, 0x69, 0x6a,
-        0xca, 0x7f, 0xfb, 0x7d, 0xf1, 0x6b, 0xbc, 0xf2,
-        0x26, 0xef, 0x85, 0x27, 0x56, 0x5e, 0x98, 0x8a,
-        0x64, 0x26, 0xce, 0xbd, 0x68, 0x1d, 0x64, 0x22,
-        0x5f, 0x78, 0xb9, 0x58, 0x78, 0xe7, 0x81, 0xf0,
-        0x83, 0x20, 0x16, 0x58, 0x29, 0x98, 0x8a, 0x30,
-        0xce, 0x13, 0xa8, 0x9b, 0x85, 0xf1, 0x3c, 0x0a,
-        0x78, 0x50, 0x3d, 0x84, 0xf2, 0x66, 0x11, 0xa8,
-        0x2a, 0xb2, 0xbd, 0x97, 0x06, 0xc2, 0xcb, 0xb2,
-        0x35, 0x20, 0x29, 0xa0, 0x8d, 0x1f, 0x88, 0xa3,
-        0xae, 0x1f, 0xe6, 0x62, 0x1d, 0x67, 0xe1, 0x3c,
-        0x66, 0x50, 0xc1, 0x3c, 0x48, 0xb3, 0x8e, 0xf0,
-        0xe2, 0x29, 0x56, 0x47, 0x38, 0x12, 0x46, 0x14,
-        0xbe, 0x0f, 0x44, 0x96, 0x1c, 0x9b, 0x4f, 0xff,
-        0x40, 0xa8, 0xe2, 0x14, 0xbb, 0x4c, 0xd2, 0x56,
-        0x18, 0xaf, 0xd6, 0xf9, 0xdb, 0xc1, 0xbb, 0xb6,
-        0xd8, 0x13, 0xa3, 0xc3, 0xa7, 0xe2, 0x89, 0xe0,
-        0x2f, 0xc3, 0x77, 0x9d, 0x47, 0xe7, 0xc1, 0x64,
-        0x04, 0xbd, 0x60, 0xb3, 0x31, 0x21, 0xd8, 0x9a,
-        0x24, 0x71, 0x96, 0x33, 0xb2, 0x36, 0xb4, 0xb6,
-        0xf8, 0xdf, 0x47, 0x02, 0xfe, 0x07, 0x88, 0xc8,
-        0xcf, 0xaf, 0xe2, 0x5c, 0xf5, 0x03, 0x1f, 0x5b,
-        0x76, 0xdd, 0x13, 0x5d, 0xf5, 0x7c, 0x00, 0xc5,
-        0x85, 0xfa, 0x7d, 0xc4, 0x82, 0xab, 0xa4, 0x41,
-        0xbe, 0x4e, 0x63, 0x81, 0x58, 0xb4, 0xce, 0x07,
-        0x9d, 0x62, 0xcd, 0x2e, 0xb6, 0x27, 0xa4, 0x01,
-        0xe4, 0x1f, 0x8f, 0x1c, 0x6c, 0x13, 0xf8, 0x6f,
-        0x98, 0x5f, 0x56, 0xe0, 0xfb, 0x33, 0x97, 0xd8,
-        0x18, 0xc3, 0x8f, 0xfc, 0xea, 0x60, 0xab, 0x6b,
-        0x02, 0x4a, 0x65, 0x84, 0x78, 0x3e, 0x4c, 0x53,
-        0xac, 0x36, 0x1c, 0x3d, 0xeb, 0x01, 0x9e, 0xcb,
-        0x64, 0xea, 0x82, 0xe8, 0x88, 0x51, 0x6f, 0xd0,
-        0x66, 0x2c, 0x71, 0x85, 0x13, 0xb1, 0x0c, 0xe3,
-        0x70, 0x19, 0x7e, 0x08, 0x80, 0x36, 0x02, 0x11,
-        0xaf, 0x97, 0x7e, 0x40, 0x04, 0xe3, 0xe5, 0x79,
-        0x1a, 0xfa, 0xeb, 0x1c, 0x16, 0x3d, 0x0e, 0x82,
-        0x69, 0x30, 0xed, 0x88, 0x4d, 0x20, 0x82, 0x78,
-        0x92, 0x4c, 0x81, 0x04, 0xc4, 0x41, 0x77, 0x92,
-        0x2c, 0x57, 0x49, 0x1c, 0xc4, 0x39, 0xc2, 0x99,
-        0x24, 0x51, 0x92, 0x2a, 0x3a, 0x52, 0x34, 0x47,
-        0x78, 0x65, 0xa2, 0x15, 0xf6, 0x82, 0x1e, 0x7c,
-        0x46, 0x5c, 0xdb, 0x40, 0x3d, 0x62, 0x96, 0x44,
-        0xb0, 0x1f, 0x32, 0xa2, 0x83, 0xb7, 0x72, 0xed,
-        0x09, 0x40, 0x2f, 0xa5, 0x49, 0x3c, 0x34, 0x04,
-        0xc0, 0x9f, 0xe7, 0xfc, 0xb9, 0x83, 0x0d, 0x84,
-        0xd3, 0xc0, 0x6f, 0x6c, 0x20, 0xde, 0xe1, 0x4a,
-        0x1c, 0x88, 0x69, 0x80, 0x58, 0x8f, 0xa9, 0x4c,
-        0xae, 0x03, 0xad, 0x10, 0x8f, 0x66, 0xfa, 0x2d,
-        0x7e, 0x57, 0xab, 0x60, 0x26, 0xf6, 0xa0, 0x45,
-        0x1f, 0xf0, 0x7f, 0x0e, 0xe1, 0xd9, 0xad, 0x88,
-        0x5a, 0x91, 0x4e, 0x0e, 0x61, 0xb6, 0xb7, 0xa8,
-        0x3e, 0x34, 0xd5, 0xa9, 0xb6, 0x5e, 0x88, 0xd2,
-        0x86, 0x85, 0x7f, 0x91, 0x2c, 0xe5, 0xb6, 0x8b,
-        0x79, 0x67, 0xa5, 0xab, 0x24, 0xf2, 0x72, 0xdc,
-        0xbc, 0xf9, 0x06, 0xf7, 0x2f, 0x2c, 0xd9, 0xb2,
-        0xf7, 0x88, 0x69, 0x4a, 0x76, 0xba, 0x0c, 0x2f,
-        0xc6, 0x44, 0x15, 0xd6, 0x38, 0x2d, 0x92, 0xef,
-        0x08, 0x9b, 0x0e, 0xf3, 0xc2, 0xa8, 0xa1, 0xb1,
-        0xbd, 0x3f, 0x60, 0x74, 0x1d, 0xbb, 0x31, 0xee,
-        0x44, 0x68, 0x73, 0x1b, 0x38, 0xd3, 0xba, 0xb8,
-        0x28, 0x1f, 0x18, 0x94, 0x0f, 0x64, 0xaf, 0x34,
-        0x69, 0x59, 0x0d, 0xce, 0x54, 0x0f, 0xa8, 0x97,
-        0x2a, 0xc1, 0x76, 0x71, 0x56, 0x99, 0xa6, 0xc0,
-        0x06, 0x62, 0x8d, 0x45, 0x7e, 0x80, 0xb5, 0x90,
-        0x0c, 0x80, 0x21, 0x79, 0x17, 0x5b, 0x42, 0x1a,
-        0x15, 0x21, 0xed, 0x6b, 0x48, 0xd6, 0x3c, 0x2a,
-        0xcc, 0x3a, 0x1a, 0xb2, 0x3d, 0x77, 0xc8, 0x5a,
-        0x93, 0xd9, 0x2c, 0x0b, 0x72, 0xe8, 0x6d, 0x05,
-        0x8c, 0x3b, 0x13, 0x78, 0xaa, 0x24, 0x1b, 0xa8,
-        0x1d, 0x5f, 0x8a, 0x55, 0x78, 0x01, 0x67, 0x0a,
-        0xb1, 0x5b, 0x6b, 0xde, 0xc4, 0x26, 0x49, 0xa3,
-        0xa9, 0x48, 0xd2, 0x70, 0x1e, 0xc6, 0x34, 0xc1,
-        0xf8, 0x31, 0x98, 0xce, 0x11, 0x16, 0xfd, 0x9e,
-        0x87, 0x51, 0x40, 0xfb, 0x8a, 0xd6, 0x5d, 0x76,
-        0x70, 0xca, 0x6c, 0x00, 0x41, 0xc2, 0x98, 0x92,
-        0x14, 0xb6, 0x72, 0x06, 0x1b, 0xbe, 0x0d, 0xf5,
-        0xb0, 0xea, 0x8b, 0x9c, 0xce, 0x11, 0xf1, 0x21,
-        0x49, 0x96, 0x22, 0x0a, 0xce, 0xb1, 0x63, 0x80,
-        0x85, 0x9c, 0x1e, 0x7f, 0x80, 0xcf, 0xc7, 0xb4,
-        0xb8, 0x8c, 0xd2, 0xb5, 0xd1, 0xd1, 0x27, 0xc9,
-        0x3c, 0xca, 0x22, 0x91, 0xad, 0x82, 0x09, 0x8c,
-        0x34, 0xba, 0x14, 0xf3, 0xb5, 0x97, 0x7a, 0x40,
-        0x1f, 0x40, 0x2a, 0xc3, 0xa7, 0x02, 0x0e, 0x91,
-        0x8c, 0x7a, 0xd1, 0x27, 0xec, 0x0c, 0x96, 0xc2,
-        0x3a, 0x65, 0xb3, 0x9e, 0xf8, 0x2d, 0x20, 0x56,
-        0x04, 0xa3, 0x49, 0x91, 0x5b, 0x79, 0x31, 0x1d,
-        0x67, 0x3d, 0x39, 0x0c, 0x3a, 0xac, 0xcc, 0x18,
-        0x45, 0x98, 0xc1, 0x22, 0x65, 0x19, 0x9d, 0x49,
-        0xc8, 0x75, 0xf2, 0x4d, 0x22, 0x3b, 0x92, 0x14,
-        0xca, 0xe7, 0x90, 0x69, 0x31, 0x5e, 0xaf, 0x56,
-        0x41, 0xaa, 0x4f, 0x23, 0x1b, 0x16, 0x6c, 0xd9,
-        0x7f, 0x0d, 0x9f, 0xb6, 0x8b, 0x0d, 0x80, 0x8b,
-        0x51, 0x83, 0xd2, 0xf4, 0xaa, 0xda, 0x85, 0x95,
-        0x06, 0x94, 0x26, 0x5e, 0x34, 0x59, 0xe3, 0x7e,
-        0x60, 0xb4, 0x44, 0x16, 0xa4, 0x61, 0x40, 0x23,
-        0xcf, 0xf2, 0x60, 0x25, 0x0f, 0xe8, 0x6c, 0x91,
-        0xac, 0x61, 0x62, 0x61, 0x2e, 0xa0, 0xf8, 0x1c,
-        0xc7, 0x8a, 0x83, 0x51, 0x33, 0x73, 0xcc, 0xc7,
-        0xcb, 0x3c, 0xc8, 0xc7, 0x2b, 0xe0, 0xd2, 0x41,
-        0x1a, 0x8f, 0x57, 0x49, 0xe6, 0xec, 0xf7, 0xe2,
-        0xa0, 0xd4, 0x0e, 0x2a, 0x95, 0xd2, 0x08, 0x98,
-        0x71, 0x39, 0xfc, 0x82, 0xc1, 0x22, 0x95, 0x14,
-        0x36, 0x1f, 0x2c, 0xe8, 0x78, 0x1d, 0xc3, 0x62,
-        0x8d, 0xf3, 0x64, 0xcc, 0x24, 0xe1, 0x02, 0x4f,
-        0x32, 0xdc, 0x9f, 0x6a, 0x5b, 0x15, 0x68, 0x50,
-        0xfd, 0x54, 0x20, 0x68, 0xf7, 0x29, 0xd9, 0x79,
-        0x6f, 0x50, 0xf3, 0x19, 0xf8, 0x7c, 0x79, 0x10,
-        0x6e, 0x55, 0x67, 0x3b, 0xb6, 0xaa, 0xd0, 0x06,
-        0x60, 0x80, 0x2c, 0x80, 0x62, 0x0c, 0x91, 0x2f,
-        0xdb, 0x10, 0x70, 0xa3, 0xfe, 0xe5, 0xeb, 0x6a,
-        0xe1, 0x4f, 0x8a, 0x68, 0x0f, 0x53, 0xfc, 0xfb,
-        0x8b, 0x3e, 0xb9, 0x79, 0x01, 0x3c, 0xa4, 0x8e,
-        0x93, 0x47, 0x8f, 0x60, 0xf8, 0xb0, 0xa5, 0x96,
-        0xc0, 0x5f, 0x72, 0xe0, 0xbc, 0x63, 0xf8, 0x27,
-        0x0d, 0x2f, 0xe0, 0xfb, 0x79, 0x12, 0xc2, 0x96,
-        0x02, 0xce, 0xdd, 0x52, 0x8c, 0x75, 0x1e, 0x8d,
-        0x5f, 0x27, 0x59, 0x98, 0xe3, 0x50, 0x4f, 0x75,
-        0x55, 0x98, 0x2f, 0x62, 0xd2, 0x04, 0xaf, 0x23,
-        0x60, 0x6d, 0x86, 0xc4, 0xcd, 0xfe, 0xa2, 0x00,
-        0x33, 0x4b, 0x67, 0xae, 0x79, 0xa2, 0xbb, 0x93,
-        0x87, 0x93, 0x12, 0x83, 0xea, 0x3a, 0xfc, 0x3e,
-        0xf5, 0xe6, 0x8a, 0xfd, 0x4a, 0x18, 0xd0, 0xa1,
-        0xdd, 0x4c, 0xae, 0xc5, 0xcf, 0xff, 0x78, 0xf9,
-        0xcb, 0x77, 0xbf, 0xbc, 0xf8, 0x6d, 0xfc, 0xea,
-        0xa7, 0xb3, 0xd7, 0x2f, 0xbf, 0x7d, 0xf3, 0xf3,
-        0x2f, 0x55, 0x20, 0x08, 0xd3, 0x21, 0x48, 0x3a,
-        0x27, 0x6a, 0x5a, 0x2c, 0x44, 0x0b, 0x33, 0x60,
-        0xe1, 0x0f, 0x42, 0xdb, 0xd8, 0x26, 0x82, 0xb1,
-        0xd7, 0x5c, 0xec, 0x97, 0x8b, 0x8b, 0x94, 0xdd,
-        0x58, 0x83, 0x28, 0xb7, 0x3c, 0x57, 0x19, 0x70,
-        0x09, 0xa7, 0x6f, 0xb7, 0xc0, 0x2f, 0x17, 0x54,
-        0x11, 0x38, 0xcc, 0x59, 0x0d, 0x29, 0x9c, 0x7b,
-        0xe9, 0x25, 0xc8, 0xfa, 0xfc, 0xf1, 0x1c, 0x3f,
-        0x62, 0x67, 0x15, 0x5f, 0xfd, 0x8f, 0xa6, 0x0f,
-        0x66, 0x04, 0xdc, 0x05, 0x54, 0x2e, 0x32, 0xad,
-        0x8a, 0x09, 0xeb, 0x54, 0xcd, 0x51, 0xc7, 0xcc,
-        0x0a, 0x91, 0x85, 0xbb, 0x48, 0x9d, 0x9a, 0x19,
-        0xe8, 0xf0, 0x88, 0xd5, 0x29, 0xcf, 0x43, 0xba,
-        0x15, 0x2c, 0xfc, 0x32, 0x16, 0xfe, 0xd5, 0x58,
-        0xb8, 0x9b, 0xc5, 0xa6, 0xa6, 0x3c, 0x6a, 0x20,
-        0x35, 0x3f, 0x6d, 0x28, 0x84, 0x96, 0x7e, 0x53,
-        0xcb, 0x72, 0x61, 0x1e, 0x5c, 0x30, 0x83, 0x2b,
-        0x12, 0xd1, 0xd2, 0xde, 0x0d, 0xe5, 0x7d, 0xab,
-        0x4a, 0x32, 0x6f, 0xb9, 0x8a, 0x82, 0x74, 0xf4,
-        0x1d, 0x94, 0x86, 0x4b, 0x6f, 0x1e, 0x7c, 0x3c,
-        0x45, 0x51, 0x05, 0x82, 0xc5, 0xe7, 0x2d, 0x9f,
-        0x16, 0x12, 0x0e, 0x10, 0x12, 0x6d, 0x64, 0x5d,
-        0x11, 0xd9, 0xf6, 0x29, 0xc9, 0x58, 0xee, 0x04,
-        0x02, 0x07, 0xd7, 0xa3, 0xeb, 0x14, 0xe6, 0xcf,
-        0x2d, 0x33, 0x5d, 0xd9, 0x12, 0x20, 0x71, 0x9d,
-        0x21, 0x80, 0x86, 0x7a, 0x70, 0x6e, 0x04, 0xa3,
-        0xef, 0x5a, 0x72, 0x84, 0x1d, 0xc1, 0x0b, 0x58,
-        0x85, 0x2c, 0x51, 0x94, 0x41, 0xd7, 0xaf, 0x42,
-        0x77, 0x54, 0x85, 0xaf, 0xdf, 0x80, 0xaf, 0x5f,
-        0x87, 0xef, 0xd8, 0x2f, 0x61, 0x3c, 0xaa, 0xc5,
-        0x78, 0xa4, 0x50, 0x2e, 0x70, 0x47, 0x44, 0x85,
-        0x07, 0xdb, 0x91, 0x20, 0x3a, 0xbc, 0xfc, 0xed,
-        0xfb, 0xe6, 0xb9, 0x7e, 0x92, 0x44, 0x7a, 0x53,
-        0x6d, 0xc2, 0x7c, 0x01, 0x35, 0x56, 0xa5, 0xe2,
-        0x55, 0x98, 0x4f, 0x16, 0x15, 0xc5, 0x92, 0xa0,
-        0x61, 0xec, 0xe9, 0x1a, 0xe4, 0x75, 0x82, 0x62,
-        0x4a, 0x2d, 0xe1, 0x11, 0x8f, 0x14, 0x6f, 0x19,
-        0xa4, 0x1e, 0xee, 0xca, 0x49, 0x80, 0x5a, 0xc9,
-        0x78, 0x1a, 0x66, 0xb9, 0x17, 0x4f, 0x82, 0x7a,
-        0x36, 0x89, 0xc3, 0x8f, 0x71, 0xfc, 0xff, 0xfd,
-        0xe2, 0x6c, 0xfc, 0xeb, 0x4f, 0xaf, 0xbe, 0xff,
-        0xf9, 0x97, 0xbf, 0x8f, 0xe5, 0xe1, 0xa4, 0x7b,
-        0xc1, 0xa3, 0x5d, 0x76, 0xe2, 0x71, 0xd1, 0x18,
-        0x44, 0x02, 0x03, 0x91, 0xb1, 0xa0, 0xd5, 0xf2,
-        0xd4, 0xd9, 0xa8, 0xf6, 0x85, 0x55, 0x26, 0x4b,
-        0x58, 0x94, 0x70, 0x47, 0xe0, 0x9e, 0xab, 0xea,
-        0xb4, 0xaf, 0x41, 0x2e, 0xf5, 0x40, 0x7c, 0xc8,
-        0xaa, 0xb1, 0xe3, 0x32, 0x17, 0x3d, 0x25, 0xca,
-        0xc8, 0x81, 0x73, 0x15, 0x83, 0xa1, 0x23, 0xe9,
-        0x08, 0x55, 0xea, 0x62, 0xe9, 0xd6, 0x59, 0x8f,
-        0x4d, 0xad, 0x46, 0x4c, 0xfd, 0x68, 0x5d, 0x33,
-        0x8b, 0x58, 0xe2, 0x62, 0x49, 0xc5, 0x12, 0x45,
-        0x2c, 0x35, 0x08, 0x5a, 0x0d, 0xb9, 0xc0, 0xc5,
-        0xcd, 0x2a, 0x5e, 0x8f, 0x55, 0x85, 0x46, 0xb4,
-        0x24, 0xf1, 0x57, 0x63, 0x26, 0x0b, 0xeb, 0x91,
-        0xd3, 0x5b, 0xa7, 0x02, 0x3f, 0x5d, 0xd6, 0x80,
-        0xa2, 0x55, 0xa7, 0x11, 0xcb, 0x2c, 0x4f, 0x93,
-        0xf7, 0x41, 0x13, 0x29, 0xda, 0x35, 0x1a, 0x28,
-        0xd2, 0xae, 0x56, 0x49, 0x98, 0x6e, 0x85, 0x06,
-        0xfa, 0x2c, 0x56, 0xdc, 0x06, 0xff, 0x4d, 0x38,
-        0xcd, 0x17, 0x8d, 0xf8, 0x53, 0x8d, 0x46, 0x92,
-        0xb5, 0x2b, 0xd6, 0x11, 0xae, 0x5b, 0xa7, 0x99,
-        0x7c, 0x8b, 0x75, 0xb7, 0x19, 0x47, 0x23, 0xd1,
-        0xb8, 0x75, 0xea, 0x69, 0xc7, 0xad, 0x57, 0x49,
-        0x42, 0xc5, 0x2a, 0x0d, 0x94, 0x54, 0xae, 0x2a,
-        0x07, 0x62, 0x1d, 0xca, 0xfb, 0x70, 0x28, 0x4f,
-        0xbd, 0xdc, 0x73, 0xce, 0x64, 0xfc, 0x4d, 0x9d,
-        0xcb, 0x8d, 0x1c, 0x90, 0x95, 0x46, 0x29, 0xb2,
-        0x17, 0x2c, 0x39, 0x92, 0xd5, 0x75, 0x0c, 0x4f,
-        0x6c, 0x2b, 0x6c, 0xb1, 0x59, 0x91, 0xf1, 0x19,
-        0xa1, 0xdf, 0x20, 0xda, 0xd0, 0xbf, 0x64, 0x72,
-        0xa4, 0xe1, 0xd1, 0xaf, 0x25, 0x0c, 0x46, 0x2d,
-        0xc5, 0xcb, 0x3a, 0x16, 0xe3, 0x73, 0x70, 0xa8,
-        0x62, 0x6d, 0x84, 0x47, 0x91, 0x7f, 0x35, 0x20,
-        0x42, 0x3c, 0x0c, 0xcb, 0xf1, 0x97, 0x4a, 0x24,
-        0xb0, 0xa0, 0xa3, 0x79, 0x9a, 0x83, 0x40, 0x81,
-        0x75, 0x51, 0xdf, 0x2e, 0x8b, 0x6a, 0xe8, 0x59,
-        0x51, 0x1c, 0x56, 0x49, 0xb4, 0xc5, 0xb8, 0xdc,
-        0x7f, 0xa2, 0xcc, 0xbe, 0x16, 0xf3, 0xaa, 0xc3,
-        0xc2, 0x82, 0x53, 0xa6, 0x9b, 0x06, 0x5c, 0x1c,
-        0x66, 0x84, 0xf5, 0xec, 0x0f, 0x95, 0xc4, 0x61,
-        0x57, 0xe8, 0x94, 0x98, 0x55, 0x1d, 0xa9, 0x14,
-        0xc1, 0xd6, 0xb0, 0x9c, 0xab, 0x31, 0x65, 0xb6,
-        0x63, 0x61, 0x4a, 0x1f, 0x2a, 0xe7, 0xcf, 0xae,
-        0xd0, 0x29, 0xb1, 0xa5, 0x06, 0x82, 0x2a, 0x42,
-        0xae, 0xe1, 0x2b, 0x57, 0x23, 0x6b, 0xaf, 0xb4,
-        0xfb, 0xa9, 0x09, 0x61, 0x6b, 0xdd, 0x8b, 0xfc,
-        0xa7, 0x6e, 0xf9, 0xcb, 0xc0, 0xeb, 0x99, 0x08,
-        0x36, 0xed, 0x83, 0x88, 0x1a, 0xcb, 0x0b, 0x01,
-        0x32, 0xfc, 0xa1, 0x18, 0x46, 0xf6, 0x11, 0x40,
-        0x25, 0x87, 0x25, 0x22, 0x5b, 0xd6, 0x26, 0x10,
-        0x59, 0xbc, 0x9e, 0xbc, 0xe7, 0xcb, 0x01, 0xac,
-        0x47, 0xe2, 0x95, 0xac, 0x63, 0xa4, 0x64, 0x29,
-        0xc4, 0xb1, 0x1c, 0x39, 0x22, 0x2b, 0x91, 0xd4,
-        0x24, 0xf1, 0xc2, 0x02, 0x2d, 0x3f, 0xbd, 0x81,
-        0xe8, 0x4a, 0xd9, 0x5a, 0xf5, 0xbf, 0x5c, 0x47,
-        0x79, 0xb8, 0x8a, 0x2e, 0x25, 0x4c, 0xff, 0x52,
-        0x0c, 0x7a, 0x87, 0x68, 0xdd, 0x04, 0xb9, 0x0e,
-        0x7b, 0x5e, 0x78, 0x53, 0x11, 0xe6, 0xd8, 0x18,
-        0xad, 0x6d, 0x20, 0x3e, 0x07, 0x29, 0x5e, 0x5b,
-        0x65, 0x71, 0xe0, 0xbd, 0x57, 0x30, 0xa0, 0xc0,
-        0x60, 0x8e, 0xdc, 0xd0, 0xe0, 0x34, 0x09, 0xd3,
-        0x09, 0xc8, 0xa5, 0x2c, 0x30, 0x6a, 0xc3, 0x20,
-        0xf7, 0xb5, 0x87, 0x5d, 0xa9, 0x0b, 0xa4, 0x99,
-        0x68, 0x15, 0xa5, 0x54, 0xc5, 0x42, 0x0d, 0xb0,
-        0x24, 0x8d, 0x41, 0xec, 0x5c, 0x19, 0xcd, 0xd9,
-        0x01, 0x7f, 0xa2, 0x6b, 0x33, 0x34, 0x57, 0x24,
-        0xb6, 0xa1, 0x31, 0xdf, 0x75, 0x81, 0x3d, 0x39,
-        0xd5, 0x13, 0xb8, 0x27, 0x5a, 0x92, 0x99, 0x3d,
-        0x71, 0x88, 0x90, 0x65, 0xfb, 0x82, 0xac, 0xac,
-        0xe0, 0xfd, 0x21, 0x90, 0x22, 0x0a, 0x9d, 0xc0,
-        0xe4, 0xbc, 0xc6, 0x31, 0xe1, 0x69, 0x81, 0x0b,
-        0xc7, 0xf8, 0x0a, 0xc4, 0x89, 0xfe, 0x06, 0xbc,
-        0x44, 0x30, 0x9b, 0xc1, 0x42, 0x86, 0xe7, 0x01,
-        0x2c, 0x02, 0xc1, 0xcc, 0x70, 0xc2, 0xed, 0x2a,
-        0x45, 0x90, 0x6f, 0x12, 0xc0, 0x7e, 0x8d, 0x43,
-        0xf6, 0x26, 0x39, 0x13, 0x0e, 0xc1, 0x20, 0x83,
-        0x2f, 0xcd, 0x61, 0x97, 0x00, 0x1d, 0x8b, 0xf3,
-        0x30, 0xd8, 0xac, 0x92, 0x34, 0xa7, 0x9b, 0xa7,
-        0x34, 0xa0, 0xaf, 0xd8, 0xa0, 0x08, 0x71, 0xb3,
-        0x48, 0x22, 0x8d, 0x9d, 0xef, 0xa1, 0xc9, 0x37,
-        0x61, 0x03, 0x35, 0x81, 0x23, 0xbc, 0x70, 0x0c,
-        0xb2, 0x1f, 0x20, 0x4a, 0x34, 0x36, 0xe3, 0xb4,
-        0xa7, 0x5e, 0x04, 0x7a, 0x12, 0x50, 0xa6, 0x03,
-        0x92, 0x2f, 0x20, 0xd2, 0xe4, 0xdf, 0x50, 0x3b,
-        0x98, 0x9a, 0xe5, 0x2f, 0x5a, 0x3a, 0x9c, 0xf5,
-        0xd3, 0x16, 0x8f, 0xdb, 0x5f, 0x26, 0xac, 0x5b,
-        0x44, 0xa7, 0xb7, 0x21, 0x0d, 0xb1, 0x56, 0xab,
-        0xb1, 0x10, 0xf9, 0xe3, 0x91, 0xfe, 0xb5, 0xd9,
-        0x72, 0x53, 0xc0, 0xd6, 0x19, 0x51, 0x89, 0x40,
-        0xae, 0x00, 0x55, 0x39, 0x35, 0xd7, 0x22, 0x71,
-        0xab, 0x83, 0xde, 0xc5, 0xe5, 0xcd, 0xa7, 0xae,
-        0x51, 0xf5, 0x6b, 0xa4, 0xff, 0xdb, 0xc2, 0xc0,
-        0x86, 0xb3, 0xb1, 0xd7, 0xc5, 0x5a, 0x1d, 0xba,
-        0x28, 0x08, 0x33, 0xbc, 0x22, 0xf0, 0xf8, 0x4a,
-        0x76, 0xbd, 0x64, 0xb1, 0x40, 0x21, 0x2b, 0xaf,
-        0x06, 0xf0, 0x42, 0x20, 0xc3, 0xfb, 0x0c, 0x4f,
-        0xcc, 0xbc, 0xf5, 0x45, 0xd7, 0x8b, 0xf3, 0x10,
-        0xc8, 0xdb, 0xc3, 0xcb, 0x7b, 0xdc, 0x42, 0x0a,
-        0x9a, 0xd9, 0xb0, 0x3d, 0xc9, 0x0f, 0x09, 0x1a,
-        0xc1, 0x4f, 0x3d, 0xc0, 0x45, 0xdd, 0xd1, 0x70,
-        0xa5, 0xc7, 0x19, 0xdd, 0x09, 0xe9, 0x5b, 0x1c,
-        0xbc, 0xb9, 0xc3, 0xfb, 0xe8, 0x4c, 0xc3, 0x4b,
-        0xc4, 0xfb, 0x20, 0x58, 0x51, 0x21, 0x41, 0x42,
-        0xa1, 0x29, 0x59, 0xcf, 0x17, 0xb0, 0xf1, 0x87,
-        0xab, 0x8b, 0x0e, 0xdf, 0xf7, 0x6c, 0x12, 0xba,
-        0x34, 0x0a, 0xe3, 0xf3, 0x20, 0xcd, 0x90, 0x27,
-        0xa4, 0x01, 0x5d, 0x76, 0xf4, 0x8a, 0x87, 0x8d,
-        0x46, 0x5b, 0x8a, 0x3e, 0xc0, 0xd7, 0x81, 0xa0,
-        0xbf, 0x7b, 0xf9, 0x8f, 0x57, 0xdf, 0xbe, 0x1c,
-        0xbf, 0x7e, 0xf5, 0xcf, 0x97, 0x3f, 0x8e, 0x7f,
-        0x79, 0xf1, 0xe6, 0xd5, 0xcf, 0xf0, 0xb1, 0x66,
-        0xaa, 0xb5, 0x6d, 0x11, 0x79, 0x36, 0x1f, 0x1b,
-        0xfb, 0x2d, 0x39, 0xf5, 0x3d, 0xc0, 0x47, 0xfd,
-        0x8a, 0x67, 0xa0, 0xdd, 0x19, 0xdb, 0xe1, 0x1a,
-        0x25, 0xdb, 0xbb, 0xd7, 0xcf, 0xef, 0x4b, 0xbf,
-        0xbe, 0x73, 0x35, 0xf9, 0x3e, 0xf5, 0xdc, 0x4f,
-        0xa3, 0x9d, 0x7e, 0x5a, 0x8d, 0xf2, 0x13, 0x29,
-        0x81, 0xb6, 0x02, 0xd8, 0xa4, 0xff, 0x5d, 0x47,
-        0x91, 0x6b, 0xd4, 0xe3, 0xae, 0xad, 0x8d, 0x35,
-        0x28, 0x63, 0xdb, 0x2b, 0x56, 0xcd, 0x7a, 0xd5,
-        0x75, 0x55, 0xa3, 0x2d, 0x34, 0xa3, 0x9b, 0x6b,
-        0x33, 0x5b, 0x28, 0x33, 0x1f, 0xa5, 0x80, 0x6c,
-        0xa5, 0x7f, 0x7c, 0x84, 0xb6, 0x50, 0x14, 0xf2,
-        0x89, 0xe6, 0xe0, 0x58, 0xe5, 0xf3, 0x90, 0x61,
-        0xaa, 0x83, 0x33, 0x0a, 0xe2, 0x39, 0x21, 0xcd,
-        0xbf, 0x28, 0xae, 0xae, 0x58, 0x7e, 0xc3, 0x31,
-        0x22, 0xc1, 0x7e, 0xb0, 0xa1, 0xea, 0x3a, 0x20,
-        0x3c, 0xc9, 0x6a, 0xdd, 0xa5, 0x77, 0xd1, 0x92,
-        0xaa, 0x79, 0xe1, 0x6c, 0xb0, 0x1a, 0x6a, 0x8d,
-        0x09, 0x5a, 0x64, 0xcb, 0x24, 0xc9, 0x17, 0x78,
-        0x47, 0xdf, 0x1a, 0xe0, 0xbd, 0x74, 0x11, 0x68,
-        0xa7, 0x88, 0xbc, 0xa3, 0xaa, 0x30, 0x3c, 0xa9,
-        0xde, 0x22, 0x34, 0x7b, 0x6d, 0xfe, 0x06, 0x9a,
-        0xc4, 0x60, 0x28, 0xbe, 0xc1, 0x7f, 0xc4, 0xb1,
-        0xdd, 0x93, 0x16, 0x15, 0x4a, 0xbd, 0xe9, 0x92,
-        0x81, 0xed, 0x77, 0x54, 0x42, 0x41, 0xee, 0xa3,
-        0xda, 0x33, 0x54, 0xf9, 0x20, 0x55, 0x99, 0xf3,
-        0xcd, 0xe8, 0xf7, 0xcc, 0x85, 0x01, 0xfc, 0xae,
-        0x35, 0x4b, 0x87, 0x80, 0xf7, 0x44, 0x51, 0xf1,
-        0x34, 0xca, 0xfc, 0x2d, 0x5c, 0x23, 0xdc, 0xf7,
-        0x9d, 0xf6, 0x95, 0x77, 0xd4, 0x16, 0x96, 0xf5,
-        0xd2, 0xc4, 0x26, 0x80, 0xed, 0x9e, 0x57, 0x5b,
-        0x05, 0xb9, 0xac, 0xc6, 0x32, 0x3b, 0xd2, 0x15,
-        0x8a, 0x36, 0x59, 0x6e, 0xae, 0xca, 0xaa, 0x0e,
-        0x3c, 0xc5, 0xfb, 0x4d, 0x9d, 0xfb, 0xb8, 0x30,
-        0xb8, 0xa6, 0xc8, 0x72, 0xc5, 0xb5, 0x90, 0x6a,
-        0x57, 0x73, 0xb3, 0x53, 0x92, 0x22, 0x8a, 0x05,
-        0x24, 0xbd, 0x66, 0x7c, 0x87, 0xb5, 0xdd, 0x1d,
-        0xb8, 0xec, 0xe9, 0x84, 0x9c, 0xb3, 0x5e, 0x2a,
-        0xa5, 0x56, 0xfc, 0x75, 0xf0, 0x57, 0x34, 0x10,
-        0xa0, 0x6c, 0xfb, 0x3e, 0x00, 0xed, 0x28, 0x12,
-        0x53, 0x06, 0xac, 0x6e, 0xdc, 0x50, 0x2e, 0xf6,
-        0xa6, 0xff, 0x5e, 0x67, 0xb9, 0x5d, 0x89, 0x44,
-        0xe9, 0x3c, 0x39, 0x79, 0x44, 0x82, 0x38, 0xc8,
-        0xdc, 0xc1, 0x72, 0x15, 0xa6, 0x21, 0x8c, 0x02,
-        0x44, 0xe2, 0xc9, 0x22, 0xc9, 0x82, 0x58, 0xb9,
-        0x5a, 0x2a, 0xf7, 0x4b, 0x74, 0xf6, 0xca, 0xc3,
-        0x19, 0xe8, 0xc4, 0xe4, 0x09, 0x96, 0x80, 0x00,
-        0x1d, 0x79, 0xab, 0x15, 0xa2, 0xc8, 0x40, 0x33,
-        0x04, 0x86, 0x3a, 0x72, 0x7e, 0xb9, 0x42, 0x48,
-        0x62, 0x11, 0x78, 0x39, 0xaa, 0xe0, 0x13, 0x60,
-        0x0b, 0x99, 0x68, 0x91, 0x5b, 0x2e, 0x56, 0x9f,
-        0x44, 0x80, 0x4d, 0x90, 0x82, 0x16, 0x9c, 0x25,
-        0xeb, 0x14, 0x54, 0xc1, 0x47, 0xec, 0x9f, 0x63,
-        0x93, 0xc7, 0xff, 0xbc, 0xfc, 0xe5, 0x67, 0x2d,
-        0x75, 0x93, 0x3b, 0x22, 0xfa, 0x8c, 0x3e, 0xed,
-        0x0d, 0x78, 0x02, 0x7e, 0xf0, 0xd6, 0x59, 0x16,
-        0x7a, 0xb1, 0x1a, 0xcf, 0x24, 0x01, 0xdd, 0x39,
-        0x9c, 0x84, 0xa0, 0x12, 0x1c, 0x8b, 0x21, 0x54,
-        0xcd, 0x7e, 0x4f, 0xf3, 0xd6, 0x08, 0xb6, 0xcf,
-        0xeb, 0x57, 0xc6, 0x1d, 0xe5, 0x87, 0x17, 0xbf,
-        0x9e, 0x9d, 0x8d, 0xbf, 0xfd, 0xf9, 0xe5, 0xf7,
-        0xc0, 0x96, 0xf6, 0x9f, 0x1f, 0x3d, 0x3f, 0x18,
-        0x8d, 0x8e, 0x06, 0x07, 0x83, 0xe1, 0xc1, 0xfe,
-        0xe8, 0xd9, 0x35, 0x4d, 0xcc, 0x72, 0xeb, 0x60,
-        0x0d, 0xfe, 0xb5, 0xd2, 0xd8, 0xc5, 0x45, 0x1d,
-        0x6b, 0x3b, 0x55, 0xd8, 0x0e, 0xed, 0x2d, 0x43,
-        0x7b, 0xbf, 0xb8, 0x33, 0xb6, 0xb3, 0x34, 0xd7,
-        0x49, 0x28, 0x77, 0x66, 0x77, 0xbe, 0x03, 0x23,
-        0xdb, 0x3a, 0xa6, 0x9d, 0x34, 0x1d, 0xdf, 0xc8,
-        0xda, 0x46, 0x0a, 0xea, 0x63, 0xd9, 0xf4, 0x31,
-        0x10, 0xc5, 0x12, 0xad, 0x3d, 0x31, 0x8c, 0x21,
-        0x9e, 0x93, 0xf6, 0x99, 0x26, 0x4b, 0xf1, 0xb6,
-        0x3b, 0xec, 0x88, 0x2e, 0x39, 0x8a, 0x26, 0xe2,
-        0x2d, 0xfc, 0x3e, 0x7c, 0xd7, 0x13, 0xe2, 0xb7,
-        0xe0, 0x71, 0x14, 0x89, 0xb5, 0x9c, 0x02, 0xb4,
-        0xba, 0xe5, 0x58, 0xbe, 0x4a, 0x93, 0xe9, 0x7a,
-        0xc2, 0x23, 0x03, 0x82, 0xcf, 0xc3, 0x09, 0xfb,
-        0xc2, 0x79, 0x40, 0x60, 0x6b, 0x54, 0x24, 0xa1,
-        0x87, 0x05, 0xc0, 0xf5, 0x96, 0xca, 0x06, 0x45,
-        0xd6, 0x1a, 0x31, 0x03, 0xd2, 0x87, 0xcd, 0xa7,
-        0x80, 0x6d, 0x82, 0xc7, 0xe8, 0xa9, 0x38, 0x9d,
-        0x52, 0xad, 0xa4, 0x61, 0xbb, 0x6a, 0x54, 0xbc,
-        0x28, 0x4b, 0xc8, 0x3f, 0x10, 0x31, 0xf1, 0xb4,
-        0x96, 0xeb, 0x09, 0xc9, 0x17, 0xe0, 0x78, 0x4b,
-        0x78, 0x6e, 0x11, 0x18, 0x60, 0x30, 0x5f, 0xa2,
-        0x3e, 0x9c, 0x2d, 0x3c, 0xb4, 0x21, 0x4e, 0x60,
-        0x6b, 0x4c, 0x03, 0xd8, 0x64, 0x4b, 0xa4, 0x7b,
-        0xac, 0xa1, 0xb5, 0xf4, 0x64, 0xa6, 0x60, 0x05,
-        0xde, 0x64, 0x61, 0x5a, 0xd2, 0xe4, 0x94, 0x46,
-        0xd0, 0x53, 0x95, 0xff, 0x2b, 0x98, 0xa1, 0x57,
-        0x23, 0x2c, 0xe4, 0x34, 0x81, 0xae, 0xc9, 0xe4,
-        0x45, 0xce, 0x8e, 0x68, 0xae, 0x24, 0x3b, 0x02,
-        0x7a, 0xd9, 0xaf, 0x44, 0xb6, 0x56, 0x1b, 0x11,
-        0x0d, 0x6e, 0x06, 0x45, 0x05, 0x47, 0x0e, 0x7b,
-        0x06, 0x9c, 0x26, 0x73, 0x8c, 0x73, 0x00, 0xe7,
-        0x43, 0x90, 0x26, 0x42, 0x8e, 0xc8, 0xf6, 0xd2,
-        0xc4, 0x49, 0xee, 0x99, 0x45, 0x46, 0xfb, 0x58,
-        0x46, 0x08, 0x6c, 0x40, 0xee, 0x20, 0xc5, 0x3f,
-        0x4e, 0x36, 0xe2, 0x0c, 0xfa, 0x9e, 0x2c, 0xa8,
-        0x43, 0x33, 0xef, 0xb4, 0xa7, 0xf6, 0x6c, 0x8e,
-        0x0b, 0x7f, 0x59, 0x7c, 0x60, 0x0f, 0x08, 0x76,
-        0xd5, 0xea, 0x0e, 0x7a, 0x87, 0xf0, 0xeb, 0x7e,
-        0x6f, 0xf0, 0x2f, 0xe4, 0x19, 0x67, 0xff, 0x1a,
-        0xb5, 0xc5, 0xe9, 0x29, 0x31, 0x21, 0x05, 0xea,
-        0xb7, 0x45, 0x88, 0x96, 0xba, 0x24, 0x42, 0xeb,
-        0x46, 0x9e, 0x1c, 0xab, 0xef, 0x67, 0x28, 0x2d,
-        0x21, 0xb3, 0xe9, 0x22, 0x45, 0xee, 0xc1, 0xf9,
-        0x34, 0x6f, 0x11, 0xf3, 0x02, 0x99, 0xe6, 0xca,
-        0xee, 0xdb, 0x6d, 0xf4, 0xea, 0xdb, 0x97, 0xbe,
-        0xd6, 0xbc, 0xe1, 0x1a, 0x00, 0x4a, 0x78, 0x7d,
-        0x07, 0x5e, 0xdf, 0x81, 0xc7, 0xe0, 0xcc, 0x96,
-        0x78, 0x8d, 0x14, 0x44, 0xd4, 0x2b, 0x8f, 0x13,
-        0xd8, 0x0e, 0xe4, 0xfe, 0x83, 0x73, 0x6b, 0x31,
-        0x8f, 0x73, 0x6b, 0xc7, 0x9d, 0x21, 0xc6, 0x85,
-        0x8d, 0x68, 0x20, 0x9e, 0xd1, 0x62, 0xfb, 0x97,
-        0x8a, 0x33, 0x28, 0x83, 0x0c, 0x7a, 0xe7, 0x76,
-        0xd9, 0xb8, 0xc9, 0xf4, 0x80, 0x47, 0x45, 0x92,
-        0xda, 0xbb, 0x08, 0x3e, 0xac, 0xbd, 0x48, 0xdb,
-        0xc6, 0x71, 0xeb, 0x28, 0x5b, 0x5e, 0xb5, 0x08,
-        0x6e, 0xcc, 0x59, 0xb2, 0xb3, 0x0a, 0x0b, 0xf1,
-        0xbd, 0x98, 0xda, 0x0f, 0xa4, 0x4f, 0x0f, 0x49,
-        0x55, 0x65, 0x2b, 0x3b, 0x88, 0xad, 0x12, 0x2b,
-        0xd7, 0x94, 0x58, 0x2b, 0xd4, 0xd1, 0x11, 0x7f,
-        0xa5, 0x5c, 0x76, 0x6b, 0x92, 0x55, 0x75, 0x35,
-        0x4b, 0x08, 0x69, 0x12, 0x36, 0xee, 0xf8, 0xac,
-        0x6d, 0xd6, 0xe4, 0xad, 0x63, 0x76, 0xcb, 0xc3,
-        0x52, 0xad, 0xe5, 0xff, 0x75, 0xf9, 0x6b, 0x90,
-        0xe5, 0xe1, 0xd2, 0xa3, 0x95, 0x20, 0xe3, 0xbf,
-        0x57, 0x1a, 0x17, 0xba, 0x38, 0xa3, 0x58, 0x74,
-        0x78, 0x71, 0x68, 0x6d, 0x47, 0xf4, 0xf5, 0x32,
-        0xec, 0x41, 0xff, 0x77, 0x9a, 0xe4, 0x2d, 0x3d,
-        0x4f, 0x1d, 0x33, 0x65, 0x6d, 0x5b, 0xb1, 0x3b,
-        0x07, 0x21, 0xe8, 0x74, 0x6b, 0x26, 0x34, 0xad,
-        0xd1, 0x73, 0x88, 0xe6, 0x00, 0x14, 0xf9, 0x6d,
-        0x99, 0xff, 0xb4, 0xef, 0xd1, 0xe5, 0x94, 0xfc,
-        0xe8, 0x4f, 0x6a, 0x24, 0xd5, 0xb2, 0x13, 0xdd,
-        0x4d, 0x15, 0x1c, 0x9a, 0x23, 0xea, 0xab, 0xc2,
-        0x3d, 0xb3, 0x77, 0x01, 0xcd, 0x3c, 0xfe, 0xcd,
-        0xf2, 0x97, 0xec, 0x5d, 0x4a, 0x31, 0xb1, 0x2b,
-        0x0b, 0x2f, 0x1d, 0x37, 0xc6, 0x0a, 0x5f, 0xc0,
-        0xaa, 0x22, 0xd6, 0x05, 0xe1, 0x18, 0x5f, 0x35,
-        0x08, 0xf1, 0x5b, 0x0e, 0x54, 0x3a, 0xa2, 0x57,
-        0x3b, 0xbd, 0x51, 0xb3, 0x76, 0x2f, 0x2d, 0xfa,
-        0xc8, 0x15, 0x6a, 0x1b, 0x7c, 0x3a, 0x2c, 0x00,
-        0x81, 0x0c, 0x89, 0x8c, 0x46, 0x92, 0x57, 0x61,
-        0x65, 0x6f, 0xc7, 0x1b, 0x79, 0xb0, 0x95, 0x4a,
-        0x5b, 0xfa, 0x0a, 0x42, 0xc5, 0x22, 0x49, 0x6b,
-        0x0a, 0x35, 0x23, 0x29, 0x03, 0x8b, 0xbc, 0x49,
-        0x30, 0x3d, 0xb9, 0x52, 0xd3, 0x6a, 0x76, 0xa1,
-        0xdb, 0xc6, 0x79, 0x4e, 0x2d, 0x9b, 0xdc, 0x93,
-        0xba, 0xe7, 0xe2, 0xf7, 0x38, 0xc9, 0x7f, 0xcd,
-        0x08, 0xa5, 0x4a, 0xff, 0x4f, 0xeb, 0xc6, 0xed,
-        0x35, 0x49, 0x48, 0x55, 0x44, 0x6c, 0x26, 0xc3,
-        0xb9, 0x9c, 0xb2, 0x59, 0x97, 0x41, 0x55, 0x56,
-        0xd6, 0x92, 0xd9, 0x69, 0xa1, 0x07, 0x75, 0x17,
-        0xe3, 0xb4, 0x4e, 0xa2, 0x88, 0x7c, 0xfc, 0xc7,
-        0xab, 0x20, 0xc5, 0xb7, 0x2a, 0x28, 0x3d, 0x8d,
-        0xf9, 0xbe, 0x04, 0x08, 0x21, 0x02, 0x8a, 0x69,
-        0x59, 0xb6, 0x97, 0x43, 0x38, 0x99, 0x98, 0x79,
-        0xb5, 0x1a, 0x26, 0x09, 0x78, 0x78, 0x2d, 0x56,
-        0x6d, 0xd7, 0x94, 0x43, 0x32, 0x45, 0x1a, 0x9c,
-        0x03, 0x80, 0x8c, 0x74, 0x40, 0x64, 0x99, 0x53,
-        0x90, 0x04, 0xbd, 0xb4, 0x3b, 0x0b, 0x83, 0x68,
-        0x2a, 0xfc, 0xe4, 0x82, 0xa5, 0x6e, 0xba, 0xdb,
-        0x0c, 0xa6, 0x7d, 0xac, 0x85, 0xc2, 0x01, 0xca,
-        0x8a, 0x61, 0x14, 0x64, 0x1a, 0xde, 0x81, 0x11,
-        0xde, 0xb7, 0xb3, 0x7e, 0x18, 0xce, 0x57, 0x7d,
-        0xfb, 0xe5, 0x59, 0x02, 0xc3, 0x15, 0xb7, 0x5c,
-        0xf0, 0x77, 0xc3, 0x54, 0x1a, 0xbe, 0x43, 0xb4,
-        0xc2, 0x8c, 0x87, 0x7e, 0x35, 0xbc, 0x47, 0x92,
-        0x8b, 0x5d, 0xc6, 0xac, 0xe7, 0xa3, 0x09, 0xce,
-        0x36, 0x0d, 0x46, 0xab, 0x05, 0xde, 0x1d, 0xc1,
-        0x1a, 0x1a, 0x49, 0xe7, 0x17, 0xea, 0x55, 0xa3,
-        0xdf, 0x01, 0x02, 0x81, 0x21, 0x47, 0x9e, 0x1f,
-        0x44, 0x4d, 0x7c, 0x5f, 0x4e, 0xa0, 0x9e, 0x45,
-        0x98, 0x02, 0x02, 0x6f, 0x00, 0xff, 0x17, 0x3f,
-        0x42, 0x8d, 0x13, 0x1b, 0x38, 0xc1, 0xc5, 0x6b,
-        0xb9, 0x6c, 0x91, 0x6c, 0x00, 0x7d, 0xed, 0x50,
-        0xa0, 0x67, 0xe7, 0x3f, 0x59, 0x06, 0x72, 0xae,
-        0x5e, 0xab, 0xb8, 0x8b, 0xe9, 0x9b, 0x99, 0x99,
-        0x41, 0xc0, 0xba, 0x67, 0x64, 0xc8, 0x6a, 0x72,
-        0x4b, 0xa0, 0x95, 0x96, 0x07, 0x54, 0x06, 0x78,
-        0xe6, 0xa8, 0xb1, 0xc1, 0x61, 0x31, 0x03, 0xa5,
-        0x07, 0x85, 0xbb, 0x64, 0x9d, 0x57, 0x23, 0xb1,
-        0x77, 0x2a, 0x7a, 0x43, 0xd5, 0xcf, 0x1f, 0x7f,
-        0x5e, 0xd6, 0x56, 0x2c, 0x50, 0x2a, 0x7d, 0xad,
-        0x00, 0x58, 0xfd, 0x5d, 0xcb, 0xde, 0x3b, 0x4e,
-        0xf9, 0x11, 0x9c, 0x92, 0x2f, 0xb6, 0xef, 0x9c,
-        0x57, 0x96, 0x66, 0x66, 0xc5, 0x86, 0x88, 0xb1,
-        0x54, 0xd0, 0x50, 0x7c, 0x1a, 0x9d, 0xb0, 0xb2,
-        0x38, 0x75, 0x2d, 0x1d, 0x59, 0x84, 0xa2, 0x2b,
-        0x2b, 0xe7, 0x4b, 0xef, 0x7d, 0x20, 0x52, 0x7c,
-        0x82, 0x89, 0x36, 0x3e, 0x34, 0xf8, 0x77, 0xc9,
-        0xe2, 0x2f, 0xf4, 0xb5, 0xd6, 0x75, 0x19, 0x72,
-        0x01, 0x8f, 0x7b, 0xe2, 0xd0, 0x5c, 0xa6, 0xcd,
-        0x5a, 0x9e, 0x9f, 0xb5, 0x34, 0x9a, 0xbd, 0xcb,
-        0x36, 0x4d, 0xc4, 0x6f, 0x68, 0xe5, 0x88, 0x1f,
-        0xe7, 0xd2, 0x3f, 0xc7, 0x78, 0x21, 0x64, 0x64,
-        0x76, 0xf1, 0x13, 0x50, 0x20, 0xb4, 0x16, 0x5d,
-        0x69, 0xf5, 0x42, 0xdb, 0x50, 0xf0, 0x3b, 0x68,
-        0xbb, 0xb8, 0xba, 0x20, 0xfa, 0x41, 0x65, 0x9c,
-        0x06, 0x69, 0xfb, 0x91, 0x8a, 0x77, 0x49, 0xf3,
-        0xb6, 0xe7, 0xcb, 0x9d, 0x9d, 0x13, 0xb7, 0xae,
-        0x9c, 0xc3, 0xd3, 0xeb, 0xb9, 0x93, 0x5c, 0x35,
-        0xa5, 0x96, 0xdc, 0xac, 0x85, 0x5f, 0x24, 0x5c,
-        0x72, 0x83, 0x51, 0x78, 0xdc, 0x1e, 0xd3, 0xb9,
-        0x35, 0x9e, 0xf3, 0x11, 0x67, 0xa5, 0x23, 0x81,
-        0xdf, 0xff, 0x49, 0x39, 0xf9, 0xa4, 0x47, 0xe4,
-        0x44, 0x9f, 0x8d, 0x23, 0xa7, 0x03, 0xf7, 0xb2,
-        0x93, 0x97, 0xbf, 0x78, 0xe5, 0x59, 0x58, 0x97,
-        0xf6, 0x36, 0xd7, 0xa4, 0x46, 0x4b, 0x26, 0x95,
-        0xb7, 0x0c, 0xde, 0x06, 0x52, 0xb8, 0x1e, 0x1e,
-        0x1e, 0x92, 0xde, 0x5d, 0x89, 0x54, 0xbf, 0x92,
-        0x50, 0x0d, 0x28, 0xbd, 0xd9, 0xf5, 0xbe, 0xaf,
-        0xeb, 0xde, 0x56, 0xfc, 0xe5, 0xa6, 0xc1, 0x7d,
-        0x44, 0xc6, 0x48, 0xe6, 0x15, 0x35, 0x57, 0x98,
-        0xce, 0xf8, 0x6b, 0xee, 0x65, 0xbb, 0xae, 0xaf,
-        0x2e, 0xad, 0x74, 0xb7, 0xd8, 0xcd, 0x16, 0x97,
-        0x9d, 0xf2, 0x02, 0xfe, 0x8f, 0x4f, 0xf7, 0x92,
-        0xb6, 0xca, 0xaf, 0x68, 0xeb, 0x67, 0xb3, 0x37,
-        0xc1, 0xfc, 0x73, 0x7c, 0xe9, 0xf4, 0xd0, 0x1e,
-        0xea, 0x54, 0x9b, 0xdc, 0x1e, 0xe0, 0xeb, 0x89,
-        0x7b, 0x7f, 0x3a, 0x70, 0x93, 0xad, 0xf0, 0xa9,
-        0xfc, 0xf3, 0x6e, 0xdd, 0xaf, 0xed, 0xbe, 0x7d,
-        0xaa, 0x6e, 0xe2, 0xc0, 0xd4, 0x64, 0xf4, 0xba,
-        0xcd, 0xc7, 0xa0, 0xd7, 0xe3, 0x4a, 0xd5, 0x46,
-        0xd2, 0x6a, 0x33, 0x61, 0xdd, 0x6a, 0xae, 0xf3,
-        0x28, 0x8c, 0x1b, 0xdf, 0xc9, 0x39, 0x55, 0x1a,
-        0x18, 0x9a, 0x53, 0xaf, 0x92, 0xb1, 0x15, 0x6a,
-        0x34, 0x90, 0x62, 0xa9, 0xe6, 0x97, 0xc9, 0xe8,
-        0xdc, 0xd9, 0x27, 0x76, 0x63, 0x7f, 0xa9, 0x64,
-        0x7c, 0x4e, 0x8d, 0x4e, 0x79, 0x7d, 0xea, 0x18,
-        0x61, 0x09, 0x72, 0xdd, 0x24, 0x7f, 0xd6, 0x8c,
-        0x51, 0x9b, 0xe5, 0xa1, 0x66, 0xab, 0xa0, 0x0f,
-        0xf6, 0x0b, 0xfa, 0xdd, 0x13, 0x96, 0xad, 0xfb,
-        0x82, 0xef, 0x39, 0xf5, 0x06, 0xaa, 0x67, 0xae,
-        0xee, 0x7a, 0x7d, 0x02, 0x0a, 0xbf, 0x3d, 0x12,
-        0xdd, 0xee, 0x2a, 0xa1, 0x86, 0x83, 0x96, 0xc8,
-        0xf6, 0x63, 0xe8, 0xec, 0x16, 0x39, 0xb4, 0x11,
-        0x9c, 0x6d, 0x99, 0x1f, 0xa9, 0xa1, 0x6b, 0xd8,
-        0x6f, 0x92, 0x82, 0x8a, 0x7e, 0xe9, 0xc8, 0xcb,
-        0x4a, 0x73, 0xe3, 0x6b, 0x9c, 0xa2, 0x27, 0x23,
-        0x29, 0x43, 0x08, 0xb4, 0xfa, 0xf2, 0xc3, 0x1d,
-        0xf0, 0x9e, 0x68, 0x31, 0x34, 0x7d, 0x30, 0x7c,
-        0x82, 0x7b, 0xb2, 0x5d, 0xc0, 0x96, 0xa6, 0xf0,
-        0x1a, 0xd7, 0x3a, 0x1f, 0x3f, 0xdb, 0xa3, 0xe5,
-        0xc1, 0xb3, 0xea, 0x5d, 0xe0, 0x1b, 0x0b, 0x8b,
-        0xdb, 0x3a, 0xb8, 0x1e, 0x7c, 0xf4, 0x9c, 0x5b,
-        0x0b, 0x92, 0x73, 0x93, 0x5d, 0x7c, 0xef, 0x3a,
-        0xcb, 0x8d, 0x4f, 0xb2, 0x5d, 0xbc, 0x9f, 0xbb,
-        0x8d, 0xf7, 0x83, 0x9e, 0xc2, 0x61, 0x3c, 0xb5,
-        0xde, 0x0e, 0x26, 0xea, 0x20, 0xe7, 0xeb, 0x05,
-        0x3a, 0xc3, 0x4d, 0x74, 0x4e, 0xf4, 0x10, 0xbb,
-        0x27, 0x11, 0xe3, 0xfa, 0x01, 0x89, 0x0a, 0x02,
-        0xc7, 0x2e, 0x14, 0xdc, 0x27, 0x0b, 0x05, 0xb7,
-        0x93, 0x22, 0x76, 0x52, 0xc4, 0x2e, 0x7c, 0xde,
-        0xfd, 0x08, 0x00, 0xbb, 0xc3, 0x7e, 0x77, 0xd8,
-        0xdf, 0x7e, 0x70, 0xbf, 0xfb, 0x3d, 0x43, 0xf7,
-        0xe1, 0x33, 0xb9, 0x38, 0x14, 0x62, 0xc2, 0x2a,
-        0xf6, 0xaf, 0xcb, 0xe9, 0x2c, 0xaa, 0xa4, 0x57,
-        0x2a, 0xbe, 0xfa, 0x39, 0x97, 0xf3, 0x15, 0xcd,
-        0xb5, 0x31, 0x40, 0xf2, 0xa2, 0x71, 0x50, 0xb0,
-        0x18, 0x1f, 0xc0, 0x06, 0x53, 0x17, 0x6a, 0x75,
-        0xef, 0xe6, 0xbd, 0xea, 0xbd, 0xe3, 0x51, 0x49,
-        0x43, 0x5c, 0x3a, 0x28, 0xad, 0x8e, 0x4b, 0x47,
-        0x05, 0x4d, 0x0f, 0xee, 0x65, 0x85, 0x46, 0x1b,
-        0xd9, 0xa2, 0xe1, 0x2d, 0xe1, 0xa2, 0xe2, 0x2d,
-        0xa1, 0x8d, 0xda, 0xa2, 0xf0, 0x94, 0xd0, 0x6a,
-        0xbc, 0xa8, 0xf4, 0x77, 0x77, 0xd0, 0x5b, 0x14,
-        0x3d, 0xc0, 0x1f, 0xf6, 0x6d, 0xe1, 0xd6, 0xa7,
-        0x3f, 0x2d, 0x34, 0x05, 0xef, 0x82, 0x5f, 0xaa,
-        0x83, 0x77, 0x41, 0x41, 0x47, 0x2f, 0x7c, 0x6d,
-        0xf0, 0x2e, 0xd9, 0xbc, 0xb0, 0x8e, 0x0d, 0x3d,
-        0x2f, 0x2c, 0xaf, 0xfb, 0xfa, 0xc7, 0x6d, 0x0b,
-        0xfd, 0xb8, 0x6d, 0x51, 0xf5, 0xb8, 0xad, 0xb4,
-        0x88, 0x84, 0xc3, 0x62, 0xfb, 0xb7, 0x6d, 0xf7,
-        0x72, 0x0f, 0xa9, 0xd8, 0xd9, 0xbe, 0xe0, 0x1d,
-        0x49, 0x5e, 0x38, 0x7a, 0x73, 0x82, 0x1a, 0xf1,
-        0x41, 0x72, 0x31, 0x39, 0x8b, 0xf8, 0x30, 0x9b,
-        0x74, 0x06, 0xfc, 0x5b, 0x39, 0xad, 0xa9, 0xe1,
-        0xe9, 0x42, 0xfe, 0xe2, 0xbe, 0xae, 0x56, 0x31,
-        0xc6, 0x19, 0x38, 0x46, 0x00, 0x19, 0x5d, 0xd3,
-        0xa9, 0x2b, 0x27, 0x67, 0x8f, 0x81, 0xf8, 0x46,
-        0xf5, 0x78, 0x2c, 0x98, 0x02, 0x86, 0x6d, 0xdb,
-        0xe3, 0x05, 0xf5, 0xa5, 0x73, 0xd8, 0x60, 0xf8,
-        0xda, 0x92, 0x94, 0xab, 0x16, 0x86, 0xed, 0x9f,
-        0x7a, 0xe9, 0xfb, 0xbe, 0x9f, 0x52, 0xbb, 0x90,
-        0xdf, 0x04, 0x65, 0xeb, 0x74, 0xe6, 0x41, 0x39,
-        0x4d, 0xc9, 0x37, 0xed, 0xe2, 0x4b, 0xf0, 0x73,
-        0x99, 0x94, 0xc4, 0xa4, 0xbe, 0x18, 0xf4, 0x46,
-        0xc3, 0x91, 0x9b, 0xc5, 0x62, 0xd0, 0x7b, 0x36,
-        0x3c, 0x1c, 0xe9, 0x4f, 0x3e, 0x7d, 0x1a, 0x3c,
-        0x1b, 0x8d, 0xb4, 0x6c, 0x58, 0xe3, 0xe3, 0x52,
-        0xf4, 0x50, 0xc3, 0x40, 0xff, 0xd3, 0xa9, 0x74,
-        0x39, 0x13, 0xde, 0xd2, 0xc7, 0x07, 0x26, 0x42,
-        0xb2, 0xd7, 0x39, 0xba, 0x5d, 0xc5, 0x89, 0xf1,
-        0xb3, 0xe2, 0xd4, 0x03, 0x79, 0x92, 0xd3, 0x8b,
-        0x55, 0x3f, 0x02, 0xb2, 0x30, 0x07, 0x93, 0x6c,
-        0x1c, 0xc9, 0x55, 0x51, 0x1d, 0xef, 0x53, 0xa7,
-        0xfa, 0xbf, 0xe6, 0xa0, 0x64, 0x0c, 0xd1, 0x5f,
-        0xcd, 0x6a, 0x68, 0xd0, 0xfa, 0x56, 0x85, 0xc4,
-        0x87, 0x8a, 0x59, 0x0b, 0x26, 0x2e, 0xf7, 0xda,
-        0x1d, 0xb1, 0xa1, 0x0c, 0x04, 0xf4, 0x97, 0x9a,
-        0x4f, 0x8f, 0xd2, 0xd3, 0xa8, 0x04, 0x04, 0x6a,
-        0x76, 0x25, 0x5d, 0x79, 0xa4, 0xee, 0xce, 0x66,
-        0x6b, 0x20, 0x23, 0xc6, 0x2c, 0xf5, 0x2e, 0x1d,
-        0x9d, 0x36, 0x45, 0x6f, 0xac, 0x24, 0x26, 0x1a,
-        0x64, 0xff, 0x44, 0x7c, 0x65, 0x22, 0x9b, 0xe3,
-        0xeb, 0xd7, 0xfd, 0xa3, 0x03, 0x9c, 0x34, 0x73,
-        0x26, 0xb5, 0x6b, 0xa6, 0x91, 0x9e, 0xfb, 0xda,
-        0x00, 0xe5, 0x43, 0x3c, 0x3b, 0xf6, 0x0e, 0x3e,
-        0x8a, 0x0c, 0xac, 0xcc, 0x3b, 0x2a, 0x9d, 0x01,
-        0xc1, 0xee, 0xe3, 0x3b, 0x42, 0x7a, 0x2e, 0x96,
-        0x89, 0xd8, 0x4b, 0x53, 0x94, 0x8e, 0xf5, 0xa3,
-        0x3a, 0x7c, 0x3e, 0xc3, 0x99, 0x05, 0x78, 0x1c,
-        0xfa, 0xf4, 0xd3, 0x8f, 0x14, 0x61, 0xa8, 0x5c,
-        0x0b, 0xcb, 0x83, 0x54, 0x92, 0x1d, 0x34, 0x70,
-        0x28, 0x8e, 0xbd, 0x1b, 0xdd, 0x71, 0xa3, 0x70,
-        0xd0, 0x62, 0x25, 0xbd, 0x78, 0xb6, 0xb6, 0x29,
-        0x51, 0x85, 0x2a, 0xb5, 0x28, 0xf4, 0x49, 0x55,
-        0x55, 0x9c, 0x92, 0x8e, 0x0d, 0xbc, 0x40, 0x67,
-        0x73, 0xf4, 0xdb, 0x41, 0x0a, 0xf3, 0xa2, 0x04,
-        0xc6, 0xf9, 0x41, 0x78, 0x17, 0x21, 0xa7, 0x39,
-        0x40, 0x07, 0x31, 0x89, 0x67, 0xa6, 0xfd, 0xad,
-        0xe4, 0xa6, 0xbd, 0x14, 0x5f, 0xa1, 0x83, 0xd9,
-        0xc0, 0xf6, 0xb7, 0xb2, 0x07, 0xb0, 0xa7, 0x56,
-        0xae, 0x95, 0x03, 0x5a, 0xc4, 0x22, 0xe8, 0xb5,
-        0xd7, 0xa6, 0xb5, 0x50, 0x6f, 0xf7, 0x86, 0x87,
-        0x03, 0xe5, 0xdd, 0xd5, 0xa1, 0xe1, 0xc2, 0x0e,
-        0xc2, 0x3f, 0x9f, 0x1f, 0x75, 0x44, 0xed, 0xc0,
-        0x0d, 0xad, 0x9a, 0x70, 0x4c, 0x2f, 0x32, 0x4c,
-        0x69, 0x84, 0x76, 0x14, 0x2f, 0x92, 0x24, 0xac,
-        0x63, 0x8b, 0xa9, 0x79, 0x7e, 0xe2, 0x6e, 0x24,
-        0x21, 0xd9, 0xa5, 0x4b, 0x87, 0xd6, 0x00, 0x38,
-        0x2b, 0x92, 0x55, 0xb7, 0x62, 0xd1, 0xfd, 0x64,
-        0x8d, 0xd9, 0x40, 0xf8, 0x51, 0x39, 0x3f, 0x00,
-        0x5d, 0xac, 0x89, 0x92, 0x22, 0x7d, 0x6a, 0x40,
-        0x0b, 0xf5, 0xf6, 0xd3, 0xa2, 0x24, 0x1a, 0xd2,
-        0xd4, 0x04, 0x5f, 0xc3, 0x0c, 0x3d, 0x51, 0x80,
-        0xaf, 0x4f, 0xe1, 0x5c, 0x15, 0xad, 0x64, 0x45,
-        0xaf, 0x01, 0x61, 0xca, 0x78, 0x34, 0xd2, 0x59,
-        0xb2, 0x88, 0x8d, 0xe4, 0x28, 0x3d, 0xda, 0xb1,
-        0x3c, 0xdb, 0x86, 0x43, 0x39, 0x8b, 0xe1, 0x48,
-        0x77, 0xbd, 0x54, 0x4d, 0x37, 0xcd, 0xfe, 0x7e,
-        0x61, 0xb6, 0x65, 0x1d, 0x67, 0xae, 0x55, 0x4f,
-        0xf3, 0x62, 0x4f, 0xf3, 0xe6, 0x9e, 0xe6, 0x5b,
-        0xf4, 0x34, 0xaf, 0xec, 0xc9, 0x2f, 0xf6, 0xe4,
-        0x37, 0xf7, 0xe4, 0x6f, 0xd1, 0x93, 0xaf, 0x7b,
-        0xc2, 0xb8, 0x11, 0xd5, 0xa2, 0x66, 0x83, 0x00,
-        0x72, 0xd7, 0x02, 0xe3, 0x2d, 0xc9, 0x7c, 0x77,
-        0xee, 0x8e, 0xb3, 0xad, 0x1a, 0xaa, 0xa5, 0xb6,
-        0xed, 0x25, 0xb0, 0x46, 0x01, 0xec, 0x7a, 0x62,
-        0xd4, 0xc7, 0xfa, 0xed, 0x54, 0x2a, 0x57, 0x36,
-        0x99, 0xec, 0xec, 0x9a, 0xd7, 0xb3, 0x6b, 0x16,
-        0x6b, 0x49, 0x51, 0x59, 0x7b, 0x53, 0x3f, 0x68,
-        0x6d, 0xf4, 0x3a, 0xb7, 0x40, 0xc8, 0x4e, 0x94,
-        0xb4, 0x56, 0xf6, 0xf9, 0xb6, 0x78, 0xd8, 0x4e,
-        0xb3, 0xbd, 0x39, 0x97, 0xdb, 0xe9, 0x8e, 0xa5,
-        0xa7, 0xde, 0x57, 0xe8, 0x6e, 0x96, 0x57, 0xfa,
-        0x74, 0x1e, 0x58, 0x2f, 0x88, 0xec, 0x9a, 0x9b,
-        0xbb, 0xd6, 0xf1, 0x4c, 0x8d, 0x0f, 0x68, 0x2f,
-        0xab, 0xd6, 0xe3, 0xae, 0xa3, 0x0a, 0x7e, 0xb0,
-        0xcd, 0xef, 0xc6, 0x2c, 0xa9, 0xfa, 0xc5, 0xe8,
-        0x15, 0x28, 0x0a, 0xfc, 0xc7, 0x7f, 0x08, 0x2d,
-        0xb9, 0x9e, 0x92, 0xe4, 0x6a, 0x7d, 0xfa, 0x40,
-        0xb5, 0x58, 0xab, 0xd0, 0xd2, 0xec, 0x37, 0x32,
-        0x7e, 0x02, 0xc6, 0x07, 0xd1, 0x8f, 0x5a, 0xf2,
-        0xc4, 0x44, 0xc9, 0x3d, 0xe6, 0x07, 0xc9, 0xf6,
+        0x78, 0xda, 0xed, 0x7d, 0xfb, 0x73, 0xdb, 0x46,
+        0x92, 0xf0, 0xfe, 0xec, 0xbf, 0x02, 0x9b, 0x54,
+        0x9d, 0x49, 0x19, 0x7c, 0x4a, 0xf2, 0x4b, 0xeb,
+        0x4b, 0xf9, 0x12, 0x27, 0xe7, 0xbb, 0x6c, 0xe2,
+        0x8a, 0x92, 0xcd, 0xd6, 0xa6, 0xbc, 0x2c, 0x90,
+        0x18, 0x92, 0x88, 0x41, 0x80, 0x01, 0x40, 0x51,
+        0xf2, 0x7d, 0xf9, 0xdf, 0xbf, 0x7e, 0xcc, 0x13,
+        0x2f, 0x51, 0xb2, 0x24, 0xcb, 0x09, 0xb7, 0x56,
+        0xb1, 0x84, 0x99, 0xe9, 0xe9, 0x99, 0xe9, 0xe9,
+        0xe9, 0xee, 0xe9, 0xe9, 0xfe, 0x3c, 0x9a, 0x87,
+        0x62, 0xee, 0x7d, 0xf3, 0xed, 0xe4, 0xd5, 0xe9,
+        0x83, 0x75, 0x26, 0x66, 0x51, 0x1e, 0xa5, 0x89,
+        0xb7, 0x8c, 0x16, 0xcb, 0xb5, 0x37, 0x8f, 0xd3,
+        0xa0, 0x38, 0x79, 0xf0, 0xb9, 0x88, 0x73, 0xf1,
+        0xe0, 0xc1, 0xe7, 0xd1, 0xdc, 0xfb, 0x2b, 0x54,
+        0x8e, 0x12, 0x11, 0x76, 0xe2, 0x74, 0xbb, 0xee,
+        0x3e, 0xf8, 0x9c, 0xff, 0xf4, 0xf0, 0x2f, 0xa8,
+        0x96, 0x84, 0xd1, 0xbc, 0x54, 0x6f, 0x25, 0xc2,
+        0x68, 0xb3, 0xb2, 0xaa, 0xca, 0x0f, 0xf5, 0xb5,
+        0xa9, 0x5b, 0x53, 0x97, 0xfe, 0x34, 0x35, 0xe5,
+        0xbf, 0x83, 0x81, 0xf7, 0x53, 0xb2, 0x0e, 0x66,
+        0xef, 0xbc, 0xc0, 0x5b, 0x07, 0x51, 0xe6, 0xa5,
+        0x73, 0xef, 0x2c, 0x88, 0x37, 0x22, 0xf7, 0x8a,
+        0x65, 0x50, 0x78, 0xcb, 0xe0, 0x4c, 0x78, 0x53,
+        0x21, 0x12, 0x0f, 0x2b, 0x89, 0xd0, 0x8b, 0x92,
+        0x22, 0x85, 0xba, 0x79, 0x94, 0x2c, 0x62, 0xc1,
+        0x83, 0xea, 0x23, 0x94, 0x1f, 0x97, 0x42, 0x55,
+        0x91, 0xed, 0x83, 0x4c, 0x78, 0x41, 0x9e, 0x6f,
+        0x00, 0x49, 0x0f, 0xda, 0x4c, 0x85, 0xf7, 0xb4,
+        0x37, 0x8d, 0x0a, 0x6f, 0x93, 0xe4, 0xd1, 0x22,
+        0x61, 0x50, 0x62, 0x21, 0xb2, 0xdc, 0xf7, 0x82,
+        0x24, 0xc4, 0xea, 0x08, 0x47, 0xc2, 0x88, 0xa3,
+        0x77, 0xc2, 0xcb, 0xd3, 0xe7, 0xe6, 0xd3, 0x3f,
+        0x10, 0xaa, 0xf7, 0x02, 0xbb, 0x4c, 0xb3, 0x4e,
+        0x94, 0xac, 0x37, 0xc5, 0x2f, 0xc3, 0xb7, 0x5d,
+        0xef, 0xc0, 0x1b, 0x1f, 0x3f, 0xf6, 0x1e, 0x79,
+        0xfc, 0x65, 0xf4, 0xd6, 0x7f, 0x70, 0x26, 0x66,
+        0x63, 0xe8, 0x05, 0x9b, 0x4d, 0x08, 0xc1, 0xce,
+        0x2c, 0x4d, 0xf2, 0x82, 0x91, 0xb5, 0xa1, 0x75,
+        0xbd, 0xff, 0x7b, 0xe0, 0xc1, 0xff, 0x00, 0x11,
+        0xf9, 0xf9, 0x75, 0x52, 0xa8, 0x7e, 0xe0, 0x63,
+        0xc7, 0xae, 0x7b, 0xa2, 0xab, 0x9e, 0x0d, 0xa1,
+        0xb8, 0x54, 0x7f, 0x80, 0x58, 0x70, 0x95, 0x4c,
+        0x14, 0x9b, 0x2c, 0xf1, 0x10, 0x8b, 0xce, 0xd9,
+        0xd0, 0x2f, 0xd7, 0xec, 0x61, 0x7b, 0x42, 0x1a,
+        0x40, 0xfe, 0xfe, 0xc0, 0xc1, 0x36, 0x85, 0xff,
+        0x46, 0xc5, 0x45, 0x0d, 0xbe, 0xdf, 0x73, 0x89,
+        0x8d, 0x31, 0xfc, 0xc8, 0xaf, 0x0e, 0xb6, 0xba,
+        0x26, 0xa0, 0x54, 0x45, 0x88, 0xe7, 0xc3, 0x34,
+        0xc5, 0x6a, 0xa3, 0xf1, 0x93, 0x3e, 0xe0, 0xb9,
+        0x4a, 0x43, 0x17, 0x84, 0xef, 0x8d, 0xfb, 0xc3,
+        0x2e, 0x63, 0x89, 0x2b, 0x9c, 0x7a, 0xab, 0x28,
+        0x89, 0x56, 0xd1, 0x7b, 0x01, 0xb4, 0x21, 0xbc,
+        0x64, 0xb3, 0x9a, 0x0a, 0x22, 0x98, 0xa0, 0x28,
+        0xb2, 0x68, 0xba, 0x29, 0x60, 0xd1, 0x13, 0x21,
+        0x42, 0x11, 0xfa, 0xde, 0x56, 0x78, 0x22, 0x99,
+        0xa5, 0x21, 0x90, 0x80, 0x77, 0xd4, 0x9b, 0xa5,
+        0xab, 0x75, 0x9a, 0x88, 0xa4, 0x40, 0x38, 0xb3,
+        0x34, 0x4e, 0x33, 0x45, 0x47, 0x8a, 0xe6, 0x08,
+        0xaf, 0xdc, 0xeb, 0x44, 0x7d, 0xd1, 0x87, 0xcf,
+        0x88, 0x6b, 0x17, 0xa8, 0xc7, 0x9b, 0xa7, 0x31,
+        0xec, 0x87, 0x9c, 0xe8, 0xe0, 0x17, 0xb9, 0xf6,
+        0x04, 0xa0, 0x9f, 0xd1, 0x24, 0x1e, 0x1b, 0x02,
+        0xe0, 0xcf, 0x0b, 0xfe, 0xec, 0x63, 0x03, 0xcf,
+        0x69, 0x30, 0x6d, 0x6d, 0xe0, 0xbd, 0xc5, 0x95,
+        0x38, 0xf2, 0x42, 0x81, 0x58, 0x4f, 0xa8, 0x4c,
+        0xae, 0x03, 0xad, 0x10, 0x8f, 0x26, 0xfc, 0x12,
+        0xbf, 0xab, 0x55, 0x30, 0x13, 0x7b, 0xd4, 0xa1,
+        0x0f, 0xf8, 0x3f, 0x87, 0xf0, 0xec, 0x56, 0x44,
+        0xad, 0x48, 0x27, 0xc7, 0x30, 0xdb, 0x3b, 0x54,
+        0x1f, 0x99, 0xea, 0x54, 0x5b, 0x2f, 0x44, 0x65,
+        0xc3, 0xc2, 0xbf, 0x48, 0x96, 0x72, 0xdb, 0x25,
+        0xbc, 0xb3, 0xb2, 0x75, 0x1a, 0x07, 0x05, 0x6e,
+        0xde, 0x62, 0x8b, 0xfb, 0x17, 0x96, 0x6c, 0xd5,
+        0x7f, 0xc0, 0x34, 0x25, 0x3b, 0x5d, 0x45, 0xe7,
+        0x13, 0xa2, 0x0a, 0x6b, 0x9c, 0x16, 0xc9, 0xfb,
+        0x9e, 0x4d, 0x87, 0x45, 0x69, 0xd4, 0xd0, 0xd8,
+        0xde, 0x1f, 0x30, 0x3a, 0xdf, 0x6e, 0x8c, 0x3b,
+        0x11, 0xda, 0xdc, 0x04, 0xce, 0xb4, 0x2e, 0x2e,
+        0xca, 0x47, 0x06, 0xe5, 0x23, 0xd9, 0x2b, 0x4d,
+        0x5a, 0xde, 0x80, 0x33, 0xd5, 0x03, 0xea, 0xa5,
+        0x4a, 0xb0, 0x5d, 0x9c, 0x55, 0xa6, 0x29, 0xb0,
+        0x81, 0x58, 0x63, 0x91, 0x1f, 0x60, 0x2d, 0x24,
+        0x03, 0x60, 0x48, 0xc1, 0xf9, 0x8e, 0x90, 0xc6,
+        0x65, 0x48, 0x87, 0x1a, 0x92, 0x35, 0x8f, 0x0a,
+        0x33, 0x5f, 0x43, 0xb6, 0xe7, 0x0e, 0x59, 0x6b,
+        0x3a, 0x9f, 0xe7, 0xa2, 0x80, 0xde, 0xd6, 0xc0,
+        0xb8, 0x73, 0x0f, 0x4f, 0x95, 0x74, 0x0b, 0xb5,
+        0x93, 0x0b, 0x6f, 0x1d, 0x9d, 0xc3, 0x99, 0x42,
+        0xec, 0xd6, 0x9a, 0x37, 0x6f, 0x9b, 0x66, 0x71,
+        0xe8, 0xa5, 0x59, 0xb4, 0x88, 0x12, 0x9a, 0x60,
+        0xfc, 0x28, 0xc2, 0x05, 0xc2, 0xa2, 0xdf, 0x8b,
+        0x28, 0x16, 0xb4, 0xaf, 0x68, 0xdd, 0x65, 0x07,
+        0x2f, 0x98, 0x0d, 0x20, 0x48, 0x18, 0x53, 0x9a,
+        0xc1, 0x56, 0xce, 0x61, 0xc3, 0x77, 0xa1, 0x1e,
+        0x56, 0x7d, 0x59, 0xd0, 0x39, 0xe2, 0xbd, 0x4f,
+        0xd3, 0x95, 0x17, 0x8b, 0x33, 0xec, 0x18, 0x60,
+        0x21, 0xa7, 0xc7, 0x1f, 0xe0, 0xf3, 0x09, 0x2d,
+        0x2e, 0xa3, 0x74, 0x65, 0x74, 0xf4, 0x49, 0xb2,
+        0x88, 0xf3, 0xd8, 0xcb, 0xd7, 0x62, 0x06, 0x23,
+        0x8d, 0x2f, 0xbc, 0xc5, 0x26, 0xc8, 0x02, 0xa0,
+        0x0f, 0x20, 0x95, 0xd1, 0x63, 0x0f, 0x0e, 0x91,
+        0x9c, 0x7a, 0xd1, 0x27, 0xec, 0x1c, 0x96, 0xc2,
+        0x3a, 0x65, 0xf3, 0xbe, 0xf7, 0xb3, 0x20, 0x56,
+        0x04, 0xa3, 0xc9, 0x90, 0x5b, 0x05, 0x09, 0x1d,
+        0x67, 0x7d, 0x39, 0x0c, 0x3a, 0xac, 0xcc, 0x18,
+        0xbd, 0x28, 0x87, 0x45, 0xca, 0x73, 0x3a, 0x93,
+        0x90, 0xeb, 0x14, 0xdb, 0x54, 0x76, 0x24, 0x29,
+        0x94, 0xcf, 0x21, 0xd3, 0x62, 0xb2, 0x59, 0xaf,
+        0x45, 0xa6, 0x4f, 0x23, 0x1b, 0x16, 0x6c, 0xd9,
+        0x7f, 0x8f, 0x1e, 0x77, 0xcb, 0x0d, 0x80, 0x8b,
+        0x51, 0x83, 0xca, 0xf4, 0xaa, 0xda, 0xa5, 0x95,
+        0x06, 0x94, 0x66, 0x41, 0x3c, 0xdb, 0xe0, 0x7e,
+        0x60, 0xb4, 0xbc, 0x5c, 0x64, 0x91, 0xa0, 0x91,
+        0xe7, 0x85, 0x58, 0xcb, 0x03, 0x3a, 0x5f, 0xa6,
+        0x1b, 0x98, 0x58, 0x98, 0x0b, 0x28, 0x3e, 0xc3,
+        0xb1, 0xe2, 0x60, 0xd4, 0xcc, 0x3c, 0xe7, 0xe3,
+        0x65, 0x21, 0x8a, 0xc9, 0x1a, 0xb8, 0xb4, 0xc8,
+        0x92, 0xc9, 0x3a, 0xcd, 0x9d, 0xfd, 0x5e, 0x1e,
+        0x94, 0xda, 0x41, 0x95, 0x52, 0x1a, 0x01, 0x33,
+        0x2e, 0x87, 0x5f, 0x30, 0x58, 0xa4, 0x92, 0xd2,
+        0xe6, 0x83, 0x05, 0x9d, 0x6c, 0x12, 0x58, 0xac,
+        0x49, 0x91, 0x4e, 0x98, 0x24, 0x5c, 0xe0, 0x69,
+        0x8e, 0xfb, 0x53, 0x6d, 0xab, 0x12, 0x0d, 0xaa,
+        0x9f, 0x1a, 0x04, 0xed, 0x3e, 0x25, 0x3b, 0xef,
+        0x0f, 0x1b, 0x3e, 0x03, 0x9f, 0xaf, 0x0e, 0xc2,
+        0xad, 0xea, 0x6c, 0xc7, 0x4e, 0x1d, 0xda, 0x00,
+        0x0c, 0x90, 0x05, 0x50, 0x8c, 0x21, 0xf2, 0x65,
+        0x1b, 0x02, 0x6e, 0xd4, 0xbf, 0x7c, 0x5e, 0x2f,
+        0xfc, 0x49, 0x11, 0xed, 0x7e, 0x8a, 0x7f, 0x7f,
+        0xd1, 0x27, 0x37, 0x2f, 0x40, 0x80, 0xd4, 0x71,
+        0xf2, 0xe0, 0x01, 0x0c, 0x1f, 0xb6, 0xd4, 0x0a,
+        0xf8, 0x4b, 0x01, 0x9c, 0x77, 0x02, 0xff, 0x64,
+        0xd1, 0x39, 0x7c, 0x3f, 0x4b, 0x23, 0xd8, 0x52,
+        0xc0, 0xb9, 0x3b, 0x8a, 0xb1, 0x2e, 0xe2, 0xc9,
+        0x9b, 0x34, 0x8f, 0x0a, 0x1c, 0xea, 0x0b, 0x5d,
+        0x15, 0xe6, 0x8b, 0x98, 0x34, 0xc1, 0xf3, 0x3d,
+        0x58, 0x9b, 0x11, 0x71, 0xb3, 0xbf, 0x28, 0xc0,
+        0xcc, 0xd2, 0x99, 0x6b, 0x9e, 0xe8, 0xee, 0xe4,
+        0xe1, 0xa4, 0xc4, 0xa0, 0xa6, 0x0e, 0xbf, 0xce,
+        0x82, 0x85, 0x62, 0xbf, 0x12, 0x06, 0x74, 0x68,
+        0x37, 0x93, 0x6b, 0xf1, 0xfd, 0x3f, 0x5e, 0xfd,
+        0xf0, 0xd5, 0x0f, 0x2f, 0x7f, 0x9e, 0xbc, 0xfe,
+        0xee, 0xf4, 0xcd, 0xab, 0x2f, 0x7f, 0xfc, 0xfe,
+        0x87, 0x3a, 0x10, 0x84, 0xe9, 0x08, 0x24, 0x9d,
+        0x13, 0x35, 0x2d, 0x16, 0xa2, 0xa5, 0x19, 0xb0,
+        0xf0, 0x07, 0xa1, 0x6d, 0x62, 0x13, 0xc1, 0x24,
+        0x68, 0x2f, 0x9e, 0x56, 0x8b, 0xcb, 0x94, 0xdd,
+        0x5a, 0x83, 0x28, 0xb7, 0x3a, 0x57, 0x39, 0x70,
+        0x09, 0xa7, 0x6f, 0xb7, 0x60, 0x5a, 0x2d, 0xa8,
+        0x23, 0x70, 0x98, 0xb3, 0x06, 0x52, 0x38, 0x0b,
+        0xb2, 0x0b, 0x90, 0xf5, 0xf9, 0xe3, 0x19, 0x7e,
+        0xc4, 0xce, 0x6a, 0xbe, 0x4e, 0x3f, 0x98, 0x3e,
+        0x98, 0x11, 0x70, 0x17, 0x50, 0xb9, 0xcc, 0xb4,
+        0x6a, 0x26, 0xcc, 0xaf, 0x9b, 0x23, 0xdf, 0xcc,
+        0x0a, 0x91, 0x85, 0xbb, 0x48, 0x7e, 0xc3, 0x0c,
+        0xf8, 0x3c, 0x62, 0x75, 0xca, 0xf3, 0x90, 0x6e,
+        0x04, 0x8b, 0x69, 0x15, 0x8b, 0xe9, 0xe5, 0x58,
+        0xb8, 0x9b, 0xc5, 0xa6, 0xa6, 0x22, 0x6e, 0x21,
+        0xb5, 0x69, 0xd6, 0x52, 0x08, 0x2d, 0xa7, 0x6d,
+        0x2d, 0xab, 0x85, 0x85, 0x38, 0x67, 0x06, 0x57,
+        0x26, 0xa2, 0x95, 0xbd, 0x1b, 0xaa, 0xfb, 0x56,
+        0x95, 0xe4, 0xc1, 0x6a, 0x1d, 0x8b, 0x6c, 0xfc,
+        0x15, 0x94, 0x46, 0xab, 0x60, 0x21, 0x3e, 0x9c,
+        0xa2, 0xa8, 0x02, 0xc1, 0xe2, 0xf3, 0x96, 0x4f,
+        0x0b, 0x09, 0x07, 0x08, 0x89, 0x36, 0xb2, 0xae,
+        0x88, 0x6c, 0xfb, 0x05, 0xc9, 0x58, 0xee, 0x04,
+        0x02, 0x07, 0xd7, 0xa3, 0xf3, 0x4b, 0xf3, 0xe7,
+        0x96, 0x99, 0xae, 0x6c, 0x09, 0x90, 0xb8, 0xce,
+        0x08, 0x40, 0x43, 0x3d, 0x38, 0x37, 0xc4, 0xf8,
+        0xab, 0x8e, 0x1c, 0xa1, 0xef, 0xf1, 0x02, 0xd6,
+        0x21, 0x4b, 0x14, 0x65, 0xd0, 0x9d, 0xd6, 0xa1,
+        0x3b, 0xae, 0xc3, 0x77, 0xda, 0x82, 0xef, 0xb4,
+        0x09, 0xdf, 0xc9, 0xb4, 0x82, 0xf1, 0xb8, 0x11,
+        0xe3, 0xb1, 0x42, 0xb9, 0xc4, 0x1d, 0x11, 0x15,
+        0x1e, 0xac, 0x2f, 0x41, 0xf8, 0xbc, 0xfc, 0xdd,
+        0xbb, 0xe6, 0xb9, 0xd3, 0x34, 0x8d, 0xf5, 0xa6,
+        0xda, 0x46, 0xc5, 0x12, 0x6a, 0xac, 0x2b, 0xc5,
+        0xeb, 0xa8, 0x98, 0x2d, 0x6b, 0x8a, 0x25, 0x41,
+        0xc3, 0xd8, 0xb3, 0x0d, 0xc8, 0xeb, 0x04, 0xc5,
+        0x94, 0x5a, 0xc2, 0x23, 0x1e, 0x29, 0xc1, 0x4a,
+        0x64, 0x01, 0xee, 0xca, 0x99, 0x40, 0xad, 0x64,
+        0x12, 0x46, 0x79, 0x11, 0x24, 0x33, 0xd1, 0xcc,
+        0x26, 0x71, 0xf8, 0x09, 0x8e, 0xff, 0xbf, 0x5f,
+        0x9e, 0x4e, 0x7e, 0xfa, 0xee, 0xf5, 0xd7, 0xdf,
+        0xff, 0xf0, 0xf7, 0x89, 0x3c, 0x9c, 0x74, 0x2f,
+        0x78, 0xb4, 0xcb, 0x4e, 0x02, 0x2e, 0x9a, 0x80,
+        0x48, 0x60, 0x20, 0x32, 0x16, 0xb4, 0x5a, 0x81,
+        0x3a, 0x1b, 0xd5, 0xbe, 0xb0, 0xca, 0x64, 0x09,
+        0x8b, 0x12, 0xee, 0x08, 0xdc, 0x73, 0x55, 0x9d,
+        0xf6, 0x0d, 0xc8, 0x65, 0x01, 0x88, 0x0f, 0x79,
+        0x3d, 0x76, 0x5c, 0xe6, 0xa2, 0xa7, 0x44, 0x19,
+        0x39, 0x70, 0xae, 0x62, 0x30, 0x74, 0x24, 0x1d,
+        0x4f, 0x95, 0xba, 0x58, 0xba, 0x75, 0x36, 0x13,
+        0x53, 0xab, 0x15, 0xd3, 0x69, 0xbc, 0x69, 0x98,
+        0x45, 0x2c, 0x71, 0xb1, 0xa4, 0x62, 0x89, 0x22,
+        0x96, 0x1a, 0x04, 0xad, 0x86, 0x5c, 0xe0, 0xe2,
+        0x66, 0x15, 0x6f, 0x26, 0xaa, 0x42, 0x2b, 0x5a,
+        0x92, 0xf8, 0xeb, 0x31, 0x93, 0x85, 0xcd, 0xc8,
+        0xe9, 0xad, 0x53, 0x83, 0x9f, 0x2e, 0x6b, 0x41,
+        0xd1, 0xaa, 0xd3, 0x8a, 0x65, 0x5e, 0x64, 0xe9,
+        0x3b, 0xd1, 0x46, 0x8a, 0x76, 0x8d, 0x16, 0x8a,
+        0xb4, 0xab, 0xd5, 0x12, 0xa6, 0x5b, 0xa1, 0x85,
+        0x3e, 0xcb, 0x15, 0x77, 0xc1, 0x7f, 0x1b, 0x85,
+        0xc5, 0xb2, 0x15, 0x7f, 0xaa, 0xd1, 0x4a, 0xb2,
+        0x76, 0xc5, 0x26, 0xc2, 0x75, 0xeb, 0xb4, 0x93,
+        0x6f, 0xb9, 0xee, 0x2e, 0xe3, 0x68, 0x25, 0x1a,
+        0xb7, 0x4e, 0x33, 0xed, 0xb8, 0xf5, 0x6a, 0x49,
+        0xa8, 0x5c, 0xa5, 0x85, 0x92, 0xaa, 0x55, 0xe5,
+        0x40, 0xac, 0x43, 0xf9, 0x10, 0x0e, 0xe5, 0x30,
+        0x28, 0x02, 0xe7, 0x4c, 0xc6, 0xdf, 0xd4, 0xb9,
+        0xdc, 0xca, 0x01, 0x59, 0x69, 0x94, 0x22, 0x7b,
+        0xc9, 0x92, 0x23, 0x59, 0x9d, 0x6f, 0x78, 0x62,
+        0x57, 0x61, 0x8b, 0xcd, 0xca, 0x8c, 0xcf, 0x08,
+        0xfd, 0x06, 0xd1, 0x96, 0xfe, 0x25, 0x93, 0x23,
+        0x0d, 0x8f, 0x7e, 0xad, 0x60, 0x30, 0xee, 0x28,
+        0x5e, 0xe6, 0x5b, 0x8c, 0xcf, 0xc1, 0xa1, 0x8e,
+        0xb5, 0x11, 0x1e, 0x65, 0xfe, 0xd5, 0x82, 0x08,
+        0xf1, 0x30, 0x2c, 0xc7, 0x5f, 0x6a, 0x91, 0xc0,
+        0x02, 0x5f, 0xf3, 0x34, 0x07, 0x81, 0x12, 0xeb,
+        0xa2, 0xbe, 0x5d, 0x16, 0xd5, 0xd2, 0xb3, 0xa2,
+        0x38, 0xac, 0x92, 0x6a, 0x8b, 0x71, 0xb5, 0xff,
+        0x54, 0x99, 0x7d, 0x2d, 0xe6, 0xd5, 0x84, 0x85,
+        0x05, 0xa7, 0x4a, 0x37, 0x2d, 0xb8, 0x38, 0xcc,
+        0x08, 0xeb, 0xd9, 0x1f, 0x6a, 0x89, 0xc3, 0xae,
+        0xe0, 0x57, 0x98, 0x55, 0x13, 0xa9, 0x94, 0xc1,
+        0x36, 0xb0, 0x9c, 0xcb, 0x31, 0x65, 0xb6, 0x63,
+        0x61, 0x4a, 0x1f, 0x6a, 0xe7, 0xcf, 0xae, 0xe0,
+        0x57, 0xd8, 0x52, 0x0b, 0x41, 0x95, 0x21, 0x37,
+        0xf0, 0x95, 0xcb, 0x91, 0xb5, 0x57, 0xda, 0xfd,
+        0xd4, 0x86, 0xb0, 0xb5, 0xee, 0x65, 0xfe, 0xd3,
+        0xb4, 0xfc, 0x55, 0xe0, 0xcd, 0x4c, 0x04, 0x9b,
+        0x0e, 0x40, 0x44, 0x4d, 0xe4, 0x85, 0x00, 0x19,
+        0xfe, 0x50, 0x0c, 0x23, 0xfb, 0x08, 0xa0, 0x52,
+        0xc0, 0x12, 0x91, 0x2d, 0x6b, 0x2b, 0xbc, 0x3c,
+        0xd9, 0xcc, 0xde, 0xf1, 0xe5, 0x00, 0xd6, 0x23,
+        0xf1, 0x4a, 0xd6, 0x31, 0x52, 0xb2, 0x14, 0xe2,
+        0x58, 0x8e, 0x1c, 0x93, 0x95, 0x48, 0x6a, 0x92,
+        0x78, 0x61, 0x81, 0x96, 0x9f, 0xfe, 0xd0, 0xeb,
+        0x49, 0xd9, 0x5a, 0xf5, 0xbf, 0xda, 0xc4, 0x45,
+        0xb4, 0x8e, 0x2f, 0x24, 0xcc, 0xe9, 0x85, 0x37,
+        0xec, 0x1f, 0xa3, 0x75, 0x13, 0xe4, 0x3a, 0xec,
+        0x79, 0x19, 0x84, 0x5e, 0x54, 0x60, 0x63, 0xb4,
+        0xb6, 0x81, 0xf8, 0x2c, 0x32, 0xbc, 0xb6, 0xca,
+        0x13, 0x11, 0xbc, 0x53, 0x30, 0xa0, 0xc0, 0x60,
+        0x8e, 0xdc, 0xd0, 0xe0, 0x34, 0x8b, 0xb2, 0x19,
+        0xc8, 0xa5, 0x2c, 0x30, 0x6a, 0xc3, 0x20, 0xf7,
+        0x75, 0x80, 0x5d, 0xa9, 0x0b, 0xa4, 0xb9, 0xd7,
+        0x29, 0x4b, 0xa9, 0x8a, 0x85, 0x1a, 0x60, 0x69,
+        0x96, 0x80, 0xd8, 0xb9, 0x36, 0x9a, 0xb3, 0x03,
+        0xfe, 0x44, 0xd7, 0x66, 0x68, 0xae, 0x48, 0x6c,
+        0x43, 0x63, 0xbe, 0xeb, 0x02, 0x7b, 0xf4, 0x42,
+        0x4f, 0xe0, 0x81, 0xd7, 0x91, 0xcc, 0xec, 0x91,
+        0x43, 0x84, 0x2c, 0xdb, 0x97, 0x64, 0x65, 0x05,
+        0xef, 0x77, 0x0f, 0x29, 0xa2, 0xd4, 0x09, 0x4c,
+        0xce, 0x1b, 0x1c, 0x13, 0x9e, 0x16, 0xb8, 0x70,
+        0x8c, 0xaf, 0x87, 0x38, 0xd1, 0xdf, 0x80, 0x97,
+        0x27, 0xe6, 0x73, 0x58, 0xc8, 0xe8, 0x4c, 0xc0,
+        0x22, 0x10, 0xcc, 0x1c, 0x27, 0xdc, 0xae, 0x52,
+        0x06, 0xf9, 0x63, 0x0a, 0xd8, 0x6f, 0x70, 0xc8,
+        0xc1, 0xac, 0x60, 0xc2, 0x21, 0x18, 0x64, 0xf0,
+        0xa5, 0x39, 0xec, 0x11, 0xa0, 0xe7, 0xde, 0x59,
+        0x24, 0xb6, 0xeb, 0x34, 0x2b, 0xe8, 0xe6, 0x29,
+        0x13, 0xf4, 0x15, 0x1b, 0x94, 0x21, 0x6e, 0x97,
+        0x69, 0xac, 0xb1, 0x9b, 0x06, 0x68, 0xf2, 0x4d,
+        0xd9, 0x40, 0x4d, 0xe0, 0x08, 0x2f, 0x1c, 0x83,
+        0xec, 0x07, 0x88, 0x12, 0x8d, 0xcd, 0x38, 0xed,
+        0x59, 0x10, 0x83, 0x9e, 0x04, 0x94, 0xe9, 0x80,
+        0xe4, 0x0b, 0x88, 0x2c, 0xfd, 0x15, 0x6a, 0x8b,
+        0xd0, 0x2c, 0x7f, 0xd9, 0xd2, 0xe1, 0xac, 0x9f,
+        0xb6, 0x78, 0xdc, 0xfc, 0x32, 0x61, 0xdd, 0x32,
+        0x3a, 0xfd, 0x2d, 0x69, 0x88, 0x8d, 0x5a, 0x8d,
+        0x85, 0xc8, 0xef, 0x0f, 0xf4, 0xaf, 0xed, 0x96,
+        0x9b, 0x12, 0xb6, 0xce, 0x88, 0x2a, 0x04, 0x72,
+        0x09, 0xa8, 0xda, 0xa9, 0xb9, 0x12, 0x89, 0x5b,
+        0x1d, 0xf4, 0xcf, 0x2f, 0xae, 0x3f, 0x75, 0xad,
+        0xaa, 0x5f, 0x2b, 0xfd, 0xdf, 0x14, 0x06, 0x36,
+        0x9c, 0xad, 0xbd, 0x2e, 0xd6, 0xea, 0xd0, 0x45,
+        0x41, 0x94, 0xe3, 0x15, 0x41, 0xc0, 0x57, 0xb2,
+        0x9b, 0x15, 0x8b, 0x05, 0x0a, 0x59, 0x79, 0x35,
+        0x80, 0x17, 0x02, 0x39, 0xde, 0x67, 0x04, 0xde,
+        0x3c, 0xd8, 0x9c, 0xf7, 0x82, 0xa4, 0x88, 0x80,
+        0xbc, 0x03, 0xbc, 0xbc, 0xc7, 0x2d, 0xa4, 0xa0,
+        0x99, 0x0d, 0xdb, 0x97, 0xfc, 0x90, 0xa0, 0x11,
+        0xfc, 0x2c, 0x00, 0x5c, 0xd4, 0x1d, 0x0d, 0x57,
+        0x7a, 0x98, 0xd3, 0x9d, 0x90, 0xbe, 0xc5, 0xc1,
+        0x9b, 0x3b, 0xbc, 0x8f, 0xce, 0x35, 0xbc, 0xd4,
+        0x7b, 0x27, 0xc4, 0x9a, 0x0a, 0x09, 0x12, 0x0a,
+        0x4d, 0xe9, 0x66, 0xb1, 0x84, 0x8d, 0x3f, 0x5a,
+        0x9f, 0xfb, 0x7c, 0xdf, 0xb3, 0x4d, 0xe9, 0xd2,
+        0x28, 0x4a, 0xce, 0x44, 0x96, 0x23, 0x4f, 0xc8,
+        0x04, 0x5d, 0x76, 0xf4, 0xcb, 0x87, 0x8d, 0x46,
+        0x5b, 0x8a, 0x3e, 0xc0, 0xd7, 0x81, 0xa0, 0xbf,
+        0x7a, 0xf5, 0x8f, 0xd7, 0x5f, 0xbe, 0x9a, 0xbc,
+        0x79, 0xfd, 0xcf, 0x57, 0xdf, 0x4e, 0x7e, 0x78,
+        0xf9, 0xe3, 0xeb, 0xef, 0xe1, 0x63, 0xc3, 0x54,
+        0x6b, 0xdb, 0x22, 0xf2, 0x6c, 0x3e, 0x36, 0x0e,
+        0x3b, 0x72, 0xea, 0xfb, 0x80, 0x8f, 0xfa, 0x15,
+        0xcf, 0x40, 0xbb, 0x33, 0xb6, 0xc3, 0xb5, 0x4a,
+        0xb6, 0xb7, 0xaf, 0x9f, 0xdf, 0x95, 0x7e, 0x7d,
+        0xeb, 0x6a, 0xf2, 0x5d, 0xea, 0xb9, 0x1f, 0x47,
+        0x3b, 0xfd, 0xb8, 0x1a, 0xe5, 0x47, 0x52, 0x02,
+        0x6d, 0x05, 0xb0, 0x4d, 0xff, 0xbb, 0x8a, 0x22,
+        0xd7, 0xaa, 0xc7, 0x5d, 0x59, 0x1b, 0x6b, 0x51,
+        0xc6, 0x76, 0x57, 0xac, 0xda, 0xf5, 0xaa, 0xab,
+        0xaa, 0x46, 0x3b, 0x68, 0x46, 0xd7, 0xd7, 0x66,
+        0x76, 0x50, 0x66, 0x3e, 0x48, 0x01, 0xd9, 0x49,
+        0xff, 0xf8, 0x00, 0x6d, 0xa1, 0x2c, 0xe4, 0x13,
+        0xcd, 0xc1, 0xb1, 0xca, 0xe7, 0x21, 0xc3, 0x54,
+        0x07, 0x67, 0x2c, 0x92, 0x05, 0x21, 0xcd, 0xbf,
+        0x28, 0xae, 0xae, 0x58, 0x7e, 0xcb, 0x31, 0x22,
+        0xc1, 0xbe, 0xb7, 0xa1, 0xea, 0x3a, 0x20, 0x3c,
+        0xc9, 0x6a, 0xbd, 0x55, 0x70, 0xde, 0x91, 0xaa,
+        0x79, 0xe9, 0x6c, 0xb0, 0x1a, 0x6a, 0x8d, 0x09,
+        0x5a, 0xe4, 0xab, 0x34, 0x2d, 0x96, 0x78, 0x47,
+        0xdf, 0x19, 0xe2, 0xbd, 0x74, 0x19, 0xa8, 0x5f,
+        0x46, 0xde, 0x51, 0x55, 0x18, 0x9e, 0x54, 0x6f,
+        0x11, 0x9a, 0xbd, 0x36, 0x7f, 0x03, 0x4d, 0x62,
+        0x38, 0xf2, 0xbe, 0xc0, 0x7f, 0xbc, 0xe7, 0x76,
+        0x4f, 0x5a, 0x54, 0xa8, 0xf4, 0xa6, 0x4b, 0x86,
+        0xb6, 0xdf, 0x51, 0x05, 0x05, 0xb9, 0x8f, 0x1a,
+        0xcf, 0x50, 0xe5, 0x83, 0x54, 0x67, 0xce, 0x37,
+        0xa3, 0x3f, 0x30, 0x17, 0x06, 0xf0, 0xbb, 0xd6,
+        0x2c, 0x1d, 0x02, 0x3e, 0xf0, 0xca, 0x8a, 0xa7,
+        0x51, 0xe6, 0x6f, 0xe0, 0x1a, 0xe1, 0xae, 0xef,
+        0xb4, 0x2f, 0xbd, 0xa3, 0xb6, 0xb0, 0x6c, 0x96,
+        0x26, 0xb6, 0x02, 0xb6, 0x7b, 0x51, 0x6f, 0x15,
+        0xe4, 0xb2, 0x06, 0xcb, 0xec, 0x58, 0x57, 0x28,
+        0xdb, 0x64, 0xb9, 0xb9, 0x2a, 0xab, 0x3b, 0xf0,
+        0x14, 0xef, 0x37, 0x75, 0xee, 0xe2, 0xc2, 0xe0,
+        0x8a, 0x22, 0xcb, 0x25, 0xd7, 0x42, 0xaa, 0x5d,
+        0xc3, 0xcd, 0x4e, 0x45, 0x8a, 0x28, 0x17, 0x90,
+        0xf4, 0x9a, 0xf3, 0x1d, 0xd6, 0x6e, 0x77, 0xe0,
+        0xb2, 0xa7, 0x13, 0x72, 0xce, 0x7a, 0xa5, 0x94,
+        0x5a, 0xef, 0xb3, 0xe1, 0x67, 0x68, 0x20, 0x40,
+        0xd9, 0xf6, 0x9d, 0x00, 0xed, 0x28, 0xf6, 0x42,
+        0x06, 0xac, 0x6e, 0xdc, 0x50, 0x2e, 0x0e, 0xc2,
+        0x5f, 0x37, 0x79, 0x61, 0x57, 0x22, 0x51, 0xba,
+        0x48, 0x4f, 0x1e, 0x90, 0x20, 0x0e, 0x32, 0xb7,
+        0x58, 0xad, 0xa3, 0x2c, 0x82, 0x51, 0x80, 0x48,
+        0x3c, 0x5b, 0xa6, 0xb9, 0x48, 0x94, 0xab, 0xa5,
+        0x72, 0xbf, 0x44, 0x67, 0xaf, 0x22, 0x9a, 0x83,
+        0x4e, 0x4c, 0x9e, 0x60, 0x29, 0x08, 0xd0, 0x71,
+        0xb0, 0x5e, 0x23, 0x8a, 0x0c, 0x34, 0x47, 0x60,
+        0xa8, 0x23, 0x17, 0x17, 0x6b, 0x84, 0xe4, 0x2d,
+        0x45, 0x50, 0xa0, 0x0a, 0x3e, 0x03, 0xb6, 0x90,
+        0x7b, 0x1d, 0x72, 0xcb, 0xc5, 0xea, 0xb3, 0x18,
+        0xb0, 0x11, 0x19, 0x68, 0xc1, 0x79, 0xba, 0xc9,
+        0x40, 0x15, 0x7c, 0xc0, 0xfe, 0x39, 0x36, 0x79,
+        0xfc, 0xeb, 0xd5, 0x0f, 0xdf, 0x6b, 0xa9, 0x9b,
+        0xdc, 0x11, 0xd1, 0x67, 0xf4, 0x71, 0x7f, 0xc8,
+        0x13, 0xf0, 0x4d, 0xb0, 0xc9, 0xf3, 0x28, 0x48,
+        0xd4, 0x78, 0x66, 0x29, 0xe8, 0xce, 0xd1, 0x2c,
+        0x02, 0x95, 0xe0, 0xb9, 0x37, 0x82, 0xaa, 0xf9,
+        0x6f, 0x59, 0xd1, 0x19, 0xc3, 0xf6, 0x79, 0xf3,
+        0xda, 0xb8, 0xa3, 0x7c, 0xf3, 0xf2, 0xa7, 0xd3,
+        0xd3, 0xc9, 0x97, 0xdf, 0xbf, 0xfa, 0x1a, 0xd8,
+        0xd2, 0xe1, 0xb3, 0xa7, 0xcf, 0x8e, 0xc6, 0xe3,
+        0xa7, 0xc3, 0xa3, 0xe1, 0xe8, 0xe8, 0x70, 0xfc,
+        0xe4, 0x8a, 0x26, 0x66, 0xb9, 0x75, 0xb0, 0x06,
+        0xff, 0x5a, 0x6b, 0xec, 0xe2, 0x22, 0xdf, 0xda,
+        0x4e, 0x35, 0xb6, 0x43, 0x7b, 0xcb, 0xd0, 0xde,
+        0x2f, 0xef, 0x8c, 0xdd, 0x2c, 0xcd, 0x4d, 0x12,
+        0xca, 0xad, 0xd9, 0x9d, 0x6f, 0xc1, 0xc8, 0xb6,
+        0x49, 0x68, 0x27, 0x85, 0x93, 0x6b, 0x59, 0xdb,
+        0x48, 0x41, 0x7d, 0x28, 0x9b, 0x3e, 0x04, 0xa2,
+        0x58, 0xa1, 0xb5, 0x27, 0x81, 0x31, 0x24, 0x0b,
+        0xd2, 0x3e, 0xb3, 0x74, 0xe5, 0xfd, 0xd2, 0x1b,
+        0xf9, 0x5e, 0x8f, 0x1c, 0x45, 0x53, 0xef, 0x17,
+        0xf8, 0x7d, 0xf4, 0xb6, 0xef, 0x79, 0x3f, 0x8b,
+        0x87, 0x71, 0xec, 0x6d, 0xe4, 0x14, 0xa0, 0xd5,
+        0xad, 0xc0, 0xf2, 0x75, 0x96, 0x86, 0x9b, 0x19,
+        0x8f, 0x0c, 0x08, 0xbe, 0x88, 0x66, 0xec, 0x0b,
+        0x17, 0x00, 0x81, 0x6d, 0x50, 0x91, 0x84, 0x1e,
+        0x96, 0x00, 0x37, 0x58, 0x29, 0x1b, 0x14, 0x59,
+        0x6b, 0xbc, 0x39, 0x90, 0x3e, 0x6c, 0x3e, 0x05,
+        0x6c, 0x2b, 0x1e, 0xa2, 0xa7, 0x62, 0x18, 0x52,
+        0xad, 0xb4, 0x65, 0xbb, 0x6a, 0x54, 0x82, 0x38,
+        0x4f, 0xc9, 0x3f, 0x10, 0x31, 0x09, 0xb4, 0x96,
+        0x1b, 0x78, 0x92, 0x2f, 0xc0, 0xf1, 0x96, 0xf2,
+        0xdc, 0x22, 0x30, 0xc0, 0x60, 0xb1, 0x42, 0x7d,
+        0x38, 0x5f, 0x06, 0x68, 0x43, 0x9c, 0xc1, 0xd6,
+        0x08, 0x05, 0x6c, 0xb2, 0x15, 0xd2, 0x3d, 0xd6,
+        0xd0, 0x5a, 0x7a, 0x3a, 0x57, 0xb0, 0x44, 0x30,
+        0x5b, 0x9a, 0x96, 0x34, 0x39, 0x95, 0x11, 0xf4,
+        0x55, 0xe5, 0xff, 0x12, 0x73, 0xf4, 0x6a, 0x84,
+        0x85, 0x0c, 0x53, 0xe8, 0x9a, 0x4c, 0x5e, 0xe4,
+        0xec, 0x88, 0xe6, 0x4a, 0xb2, 0x23, 0xa0, 0x97,
+        0xfd, 0xda, 0xcb, 0x37, 0x6a, 0x23, 0xa2, 0xc1,
+        0xcd, 0xa0, 0xa8, 0xe0, 0xc8, 0x61, 0xcf, 0x81,
+        0xd3, 0xe4, 0x8e, 0x71, 0x0e, 0xe0, 0xbc, 0x17,
+        0x59, 0xea, 0xc9, 0x11, 0xd9, 0x5e, 0x9a, 0x38,
+        0xc9, 0x7d, 0xb3, 0xc8, 0x68, 0x1f, 0xcb, 0x09,
+        0x81, 0x2d, 0xc8, 0x1d, 0xa4, 0xf8, 0x27, 0xe9,
+        0xd6, 0x3b, 0x85, 0xbe, 0x67, 0x4b, 0xea, 0xd0,
+        0xcc, 0x3b, 0xed, 0xa9, 0x03, 0x9b, 0xe3, 0xc2,
+        0x5f, 0x16, 0x1f, 0x38, 0x00, 0x82, 0x5d, 0x77,
+        0x7a, 0xc3, 0xfe, 0x31, 0xfc, 0x7a, 0xd8, 0x1f,
+        0xfe, 0x1b, 0x79, 0xc6, 0xe9, 0xbf, 0xc7, 0x5d,
+        0xef, 0xc5, 0x0b, 0x62, 0x42, 0x0a, 0xd4, 0xcf,
+        0xcb, 0x08, 0x2d, 0x75, 0x69, 0x8c, 0xd6, 0x8d,
+        0x22, 0x7d, 0xae, 0xbe, 0x9f, 0xa2, 0xb4, 0x84,
+        0xcc, 0xa6, 0x87, 0x14, 0x79, 0x00, 0xe7, 0xd3,
+        0xa2, 0x43, 0xcc, 0x0b, 0x64, 0x9a, 0x4b, 0xbb,
+        0xef, 0x76, 0xd1, 0xab, 0xef, 0x50, 0xfa, 0x5a,
+        0xf3, 0x86, 0x6b, 0x01, 0x28, 0xe1, 0x0d, 0x1c,
+        0x78, 0x03, 0x07, 0x1e, 0x83, 0x33, 0x5b, 0xe2,
+        0x0d, 0x52, 0x10, 0x51, 0xaf, 0x3c, 0x4e, 0x60,
+        0x3b, 0x90, 0xfb, 0x0f, 0xce, 0xad, 0xc5, 0x3c,
+        0xce, 0xac, 0x1d, 0x77, 0x8a, 0x18, 0x97, 0x36,
+        0xa2, 0x81, 0x78, 0x4a, 0x8b, 0x3d, 0xbd, 0x50,
+        0x9c, 0x41, 0x19, 0x64, 0xd0, 0x3b, 0xb7, 0xc7,
+        0xc6, 0x4d, 0xa6, 0x07, 0x3c, 0x2a, 0xd2, 0xcc,
+        0xde, 0x45, 0xf0, 0x61, 0x13, 0xc4, 0xda, 0x36,
+        0x8e, 0x5b, 0x47, 0xd9, 0xf2, 0xea, 0x45, 0x70,
+        0x63, 0xce, 0x92, 0x9d, 0xd5, 0x58, 0x88, 0xef,
+        0xc4, 0xd4, 0x7e, 0x24, 0x7d, 0x7a, 0x48, 0xaa,
+        0xaa, 0x5a, 0xd9, 0x41, 0x6c, 0x95, 0x58, 0xb9,
+        0xa6, 0xc4, 0x46, 0xa1, 0x8e, 0x8e, 0xf8, 0x4b,
+        0xe5, 0xb2, 0x1b, 0x93, 0xac, 0xea, 0xab, 0x59,
+        0x42, 0x48, 0x9b, 0xb0, 0x71, 0xcb, 0x67, 0x6d,
+        0xbb, 0x26, 0x6f, 0x1d, 0xb3, 0x3b, 0x1e, 0x96,
+        0x6a, 0x2d, 0xff, 0xd7, 0xe5, 0xaf, 0x22, 0x2f,
+        0xa2, 0x55, 0x40, 0x2b, 0x41, 0xc6, 0xff, 0xa0,
+        0x32, 0x2e, 0x74, 0x71, 0x46, 0xb1, 0xe8, 0xf8,
+        0xfc, 0xd8, 0xda, 0x8e, 0xe8, 0xeb, 0x65, 0xd8,
+        0x83, 0xfe, 0x6f, 0x98, 0x16, 0x1d, 0x3d, 0x4f,
+        0xbe, 0x99, 0xb2, 0xae, 0xad, 0xd8, 0x9d, 0x81,
+        0x10, 0xf4, 0x62, 0x67, 0x26, 0x14, 0x36, 0xe8,
+        0x39, 0x44, 0x73, 0x00, 0x8a, 0xfc, 0xb6, 0xcc,
+        0x7f, 0xba, 0x77, 0xe8, 0x72, 0x4a, 0x7e, 0xf4,
+        0x27, 0x0d, 0x92, 0x6a, 0xd5, 0x89, 0xee, 0xba,
+        0x0a, 0x0e, 0xcd, 0x11, 0xf5, 0x55, 0xe3, 0x9e,
+        0xd9, 0x3f, 0x87, 0x66, 0x01, 0xff, 0x66, 0xf9,
+        0x4b, 0xf6, 0x2f, 0xa4, 0x98, 0xd8, 0x93, 0x85,
+        0x17, 0x8e, 0x1b, 0x63, 0x8d, 0x2f, 0x60, 0x5d,
+        0x11, 0xeb, 0x82, 0x70, 0x8c, 0xaf, 0x5b, 0x84,
+        0xf8, 0x1d, 0x07, 0x2a, 0x1d, 0xd1, 0xeb, 0x9d,
+        0xde, 0xa8, 0x59, 0xb7, 0x9f, 0x95, 0x7d, 0xe4,
+        0x4a, 0xb5, 0x0d, 0x3e, 0x3e, 0x0b, 0x40, 0x20,
+        0x43, 0x22, 0xa3, 0x91, 0xe4, 0x55, 0x5a, 0xd9,
+        0x9b, 0xf1, 0x46, 0x1e, 0xee, 0xa4, 0xd2, 0x56,
+        0xbe, 0x82, 0x50, 0xb1, 0x4c, 0xb3, 0x86, 0x42,
+        0xcd, 0x48, 0xaa, 0xc0, 0xe2, 0x60, 0x26, 0xc2,
+        0x93, 0x4b, 0x35, 0xad, 0x76, 0x17, 0xba, 0x5d,
+        0x9c, 0xe7, 0xd4, 0xb2, 0xc9, 0x3d, 0xa9, 0x7b,
+        0x2e, 0x7f, 0x4f, 0xd2, 0xe2, 0xa7, 0x9c, 0x50,
+        0xaa, 0xf5, 0xff, 0xb4, 0x6e, 0xdc, 0xde, 0x90,
+        0x84, 0x54, 0x47, 0xc4, 0x66, 0x32, 0x9c, 0xcb,
+        0x29, 0x9b, 0x75, 0x19, 0x54, 0x65, 0x65, 0x2d,
+        0x99, 0xbd, 0x28, 0xf5, 0xa0, 0xee, 0x62, 0x9c,
+        0xd6, 0x69, 0x1c, 0x93, 0x8f, 0xff, 0x64, 0x2d,
+        0x32, 0x7c, 0xab, 0x82, 0xd2, 0xd3, 0x84, 0xef,
+        0x4b, 0x80, 0x10, 0x62, 0xa0, 0x98, 0x8e, 0x65,
+        0x7b, 0x39, 0x86, 0x93, 0x89, 0x99, 0x57, 0xa7,
+        0x65, 0x92, 0x80, 0x87, 0x37, 0x62, 0xd5, 0x75,
+        0x4d, 0x39, 0x24, 0x53, 0x64, 0xe2, 0x0c, 0x00,
+        0xe4, 0xa4, 0x03, 0x22, 0xcb, 0x0c, 0x41, 0x12,
+        0x0c, 0xb2, 0xde, 0x3c, 0x12, 0x71, 0xe8, 0x4d,
+        0xd3, 0x73, 0x96, 0xba, 0xe9, 0x6e, 0x53, 0x84,
+        0x03, 0xac, 0x85, 0xc2, 0x01, 0xca, 0x8a, 0x51,
+        0x2c, 0x72, 0x0d, 0xef, 0xc8, 0x08, 0xef, 0xbb,
+        0x59, 0x3f, 0x0c, 0xe7, 0xab, 0xbf, 0xfd, 0x0a,
+        0x2c, 0x81, 0xe1, 0x92, 0x5b, 0x2e, 0xf8, 0xbb,
+        0x65, 0x2a, 0x0d, 0xdf, 0x21, 0x5a, 0x61, 0xc6,
+        0x43, 0xbf, 0x1a, 0xde, 0x23, 0xc9, 0xc5, 0x2e,
+        0x63, 0xd6, 0xf3, 0xc1, 0x04, 0x67, 0x9b, 0x06,
+        0xe3, 0xf5, 0x12, 0xef, 0x8e, 0x60, 0x0d, 0x8d,
+        0xa4, 0xf3, 0x03, 0xf5, 0xaa, 0xd1, 0xf7, 0x81,
+        0x40, 0x60, 0xc8, 0x71, 0x30, 0x15, 0x71, 0x1b,
+        0xdf, 0x97, 0x13, 0xa8, 0x67, 0x11, 0xa6, 0x80,
+        0xc0, 0x1b, 0xc0, 0xff, 0xc5, 0x8f, 0x50, 0x93,
+        0xd4, 0x06, 0x4e, 0x70, 0xf1, 0x5a, 0x2e, 0x5f,
+        0xa6, 0x5b, 0x40, 0x5f, 0x3b, 0x14, 0xe8, 0xd9,
+        0xf9, 0x4f, 0x96, 0x81, 0x9c, 0xab, 0xd7, 0x3a,
+        0xee, 0x62, 0xfa, 0x66, 0x66, 0x66, 0x10, 0xb0,
+        0xee, 0x19, 0x19, 0xb2, 0x9a, 0xdc, 0x0a, 0x68,
+        0xa5, 0xe5, 0x01, 0x95, 0x01, 0x9e, 0x05, 0x6a,
+        0x6c, 0x70, 0x58, 0xcc, 0x41, 0xe9, 0x41, 0xe1,
+        0x2e, 0xdd, 0x14, 0xf5, 0x48, 0x1c, 0xbc, 0xf0,
+        0xfa, 0x23, 0xd5, 0xcf, 0xef, 0x7f, 0x5e, 0xd6,
+        0x56, 0x2e, 0x50, 0x2a, 0x7d, 0xa3, 0x00, 0x58,
+        0xff, 0x5d, 0xcb, 0xde, 0x7b, 0x4e, 0xf9, 0x01,
+        0x9c, 0x92, 0x2f, 0xb6, 0x6f, 0x9d, 0x57, 0x56,
+        0x66, 0x66, 0xcd, 0x86, 0x88, 0x89, 0x54, 0xd0,
+        0x50, 0x7c, 0x1a, 0x9f, 0xb0, 0xb2, 0x18, 0xba,
+        0x96, 0x8e, 0x3c, 0x46, 0xd1, 0x95, 0x95, 0xf3,
+        0x55, 0xf0, 0x4e, 0x78, 0x19, 0x3e, 0xc1, 0x44,
+        0x1b, 0x1f, 0x1a, 0xfc, 0x7b, 0x64, 0xf1, 0xf7,
+        0xf4, 0xb5, 0xd6, 0x55, 0x19, 0x72, 0x09, 0x8f,
+        0x3b, 0xe2, 0xd0, 0x5c, 0xa6, 0xcd, 0x5a, 0xc1,
+        0x34, 0xef, 0x68, 0x34, 0xfb, 0x17, 0x5d, 0x9a,
+        0x88, 0x9f, 0xd1, 0xca, 0x91, 0x3c, 0x2c, 0xa4,
+        0x7f, 0x8e, 0xf1, 0x42, 0xc8, 0xc9, 0xec, 0x32,
+        0x4d, 0x41, 0x81, 0xd0, 0x5a, 0x74, 0xad, 0xd5,
+        0x0b, 0x6d, 0x43, 0xe2, 0x37, 0xd0, 0x76, 0x71,
+        0x75, 0x41, 0xf4, 0x83, 0xca, 0x38, 0x0d, 0xd2,
+        0xf6, 0x23, 0x15, 0xef, 0x8a, 0xe6, 0x6d, 0xcf,
+        0x97, 0x3b, 0x3b, 0x27, 0x6e, 0x5d, 0x39, 0x87,
+        0x2f, 0xae, 0xe6, 0x4e, 0x72, 0xd9, 0x94, 0x5a,
+        0x72, 0xb3, 0x16, 0x7e, 0x91, 0x70, 0xc9, 0x0d,
+        0x46, 0xe1, 0x71, 0x73, 0x4c, 0xe7, 0xc6, 0x78,
+        0xce, 0x07, 0x9c, 0x95, 0x8e, 0x04, 0x7e, 0xf7,
+        0x27, 0xe5, 0xec, 0xa3, 0x1e, 0x91, 0x33, 0x7d,
+        0x36, 0x8e, 0x9d, 0x0e, 0xdc, 0xcb, 0x4e, 0x5e,
+        0xfe, 0xf2, 0x95, 0x67, 0x69, 0x5d, 0xba, 0xbb,
+        0x5c, 0x93, 0x1a, 0x2d, 0x99, 0x54, 0xde, 0x2a,
+        0x78, 0x1b, 0x48, 0xe9, 0x7a, 0x78, 0x74, 0x4c,
+        0x7a, 0x77, 0x2d, 0x52, 0x83, 0x5a, 0x42, 0x35,
+        0xa0, 0xf4, 0x66, 0xd7, 0xfb, 0xbe, 0xa9, 0x7b,
+        0x5b, 0xf1, 0x97, 0x9b, 0x06, 0xf7, 0x11, 0x19,
+        0x23, 0x99, 0x57, 0x34, 0x5c, 0x61, 0x3a, 0xe3,
+        0x6f, 0xb8, 0x97, 0xed, 0xb9, 0xbe, 0xba, 0xb4,
+        0xd2, 0xbd, 0x72, 0x37, 0x3b, 0x5c, 0x76, 0xca,
+        0x0b, 0xf8, 0xdf, 0x3f, 0xde, 0x4b, 0xda, 0x3a,
+        0xbf, 0xa2, 0x9d, 0x9f, 0xcd, 0x5e, 0x07, 0xf3,
+        0x4f, 0xf1, 0xa5, 0xd3, 0x7d, 0x7b, 0xa8, 0x53,
+        0x6f, 0x72, 0xbb, 0x87, 0xaf, 0x27, 0xee, 0xfc,
+        0xe9, 0xc0, 0x75, 0xb6, 0xc2, 0xc7, 0xf2, 0xcf,
+        0xbb, 0x71, 0xbf, 0xb6, 0xbb, 0xf6, 0xa9, 0xba,
+        0x8e, 0x03, 0x53, 0x9b, 0xd1, 0xeb, 0x26, 0x1f,
+        0x83, 0x5e, 0x8d, 0x2b, 0xd5, 0x1b, 0x49, 0xeb,
+        0xcd, 0x84, 0x4d, 0xab, 0xb9, 0x29, 0xe2, 0x28,
+        0x69, 0x7d, 0x27, 0xe7, 0x54, 0x69, 0x61, 0x68,
+        0x4e, 0xbd, 0x5a, 0xc6, 0x56, 0xaa, 0xd1, 0x42,
+        0x8a, 0x95, 0x9a, 0x7f, 0x4c, 0x46, 0xe7, 0xce,
+        0x3e, 0xb1, 0x1b, 0xfb, 0x4b, 0x2d, 0xe3, 0x73,
+        0x6a, 0xf8, 0xd5, 0xf5, 0x69, 0x62, 0x84, 0x15,
+        0xc8, 0x4d, 0x93, 0xfc, 0x49, 0x33, 0x46, 0x6d,
+        0x96, 0x87, 0x9a, 0x9d, 0x92, 0x3e, 0x38, 0x28,
+        0xe9, 0x77, 0x8f, 0x58, 0xb6, 0x1e, 0x78, 0x7c,
+        0xcf, 0xa9, 0x37, 0x50, 0x33, 0x73, 0x75, 0xd7,
+        0xeb, 0x23, 0x50, 0xf8, 0xcd, 0x91, 0xe8, 0x6e,
+        0x57, 0x09, 0x0d, 0x1c, 0xb4, 0x42, 0xb6, 0x1f,
+        0x42, 0x67, 0x37, 0xc8, 0xa1, 0x8d, 0xe0, 0x6c,
+        0xcb, 0xfc, 0x48, 0x0d, 0x3d, 0xc3, 0x7e, 0xd3,
+        0x0c, 0x54, 0xf4, 0x0b, 0x47, 0x5e, 0x56, 0x9a,
+        0x1b, 0x5f, 0xe3, 0x94, 0x3d, 0x19, 0x49, 0x19,
+        0x42, 0xa0, 0xf5, 0x97, 0x1f, 0xee, 0x80, 0x0f,
+        0xbc, 0x0e, 0x43, 0xd3, 0x07, 0xc3, 0x47, 0xb8,
+        0x27, 0xdb, 0x07, 0x6c, 0x69, 0x0b, 0xaf, 0x71,
+        0xa5, 0xf3, 0xf1, 0x93, 0x3d, 0x5a, 0xee, 0x3d,
+        0xab, 0xde, 0x07, 0xbe, 0xb1, 0xb0, 0xb8, 0xa9,
+        0x83, 0xeb, 0xde, 0x47, 0xcf, 0xb9, 0xb1, 0x20,
+        0x39, 0xd7, 0xd9, 0xc5, 0x77, 0xae, 0xb3, 0x5c,
+        0xfb, 0x24, 0xdb, 0xc7, 0xfb, 0xb9, 0xdd, 0x78,
+        0x3f, 0xe8, 0x29, 0x1c, 0x25, 0xa1, 0xf5, 0x76,
+        0x30, 0x55, 0x07, 0x39, 0x5f, 0x2f, 0xd0, 0x19,
+        0x6e, 0xa2, 0x73, 0xa2, 0x87, 0xd8, 0x1d, 0x89,
+        0x18, 0x57, 0x0f, 0x48, 0x54, 0x12, 0x38, 0xf6,
+        0xa1, 0xe0, 0x3e, 0x5a, 0x28, 0xb8, 0xbd, 0x14,
+        0xb1, 0x97, 0x22, 0xf6, 0xe1, 0xf3, 0xee, 0x46,
+        0x00, 0xd8, 0x1f, 0xf6, 0xfb, 0xc3, 0xfe, 0xe6,
+        0x83, 0xfb, 0xdd, 0xed, 0x19, 0x7a, 0x08, 0x9f,
+        0xc9, 0xc5, 0xa1, 0x14, 0x13, 0x56, 0xb1, 0x7f,
+        0x5d, 0x4e, 0x67, 0x51, 0x2d, 0xbd, 0x52, 0xf1,
+        0xe5, 0xcf, 0xb9, 0x9c, 0xaf, 0x68, 0xae, 0x4d,
+        0x00, 0x52, 0x10, 0x4f, 0x44, 0xc9, 0x62, 0x7c,
+        0x04, 0x1b, 0x4c, 0x5d, 0xa8, 0x35, 0xbd, 0x9b,
+        0x0f, 0xea, 0xf7, 0x4e, 0x40, 0x25, 0x2d, 0x71,
+        0xe9, 0xa0, 0xb4, 0x3e, 0x2e, 0x1d, 0x15, 0xb4,
+        0x3d, 0xb8, 0x97, 0x15, 0x5a, 0x6d, 0x64, 0xcb,
+        0x96, 0xb7, 0x84, 0xcb, 0x9a, 0xb7, 0x84, 0x36,
+        0x6a, 0xcb, 0xd2, 0x53, 0x42, 0xab, 0xf1, 0xb2,
+        0xd6, 0xdf, 0xdd, 0x41, 0x6f, 0x59, 0xf6, 0x00,
+        0xbf, 0xdf, 0xb7, 0x85, 0x3b, 0x9f, 0xfe, 0xb4,
+        0xd0, 0x14, 0xbc, 0x0b, 0x7e, 0xa9, 0x0f, 0xde,
+        0x05, 0x05, 0xbe, 0x5e, 0xf8, 0xc6, 0xe0, 0x5d,
+        0xb2, 0x79, 0x69, 0x1d, 0x5b, 0x7a, 0x5e, 0x5a,
+        0x5e, 0xf7, 0xcd, 0x8f, 0xdb, 0x96, 0xfa, 0x71,
+        0xdb, 0xb2, 0xee, 0x71, 0x5b, 0x65, 0x11, 0x09,
+        0x87, 0xe5, 0xee, 0x6f, 0xdb, 0xee, 0xe4, 0x1e,
+        0x52, 0xb1, 0xb3, 0x43, 0x8f, 0x77, 0x24, 0x79,
+        0xe1, 0xe8, 0xcd, 0x09, 0x6a, 0xc4, 0x7b, 0xc9,
+        0xc5, 0xe4, 0x2c, 0xe2, 0xc3, 0x6c, 0xd2, 0x19,
+        0xf0, 0x6f, 0xe5, 0xb4, 0xa6, 0x86, 0xa7, 0x0b,
+        0xf9, 0x8b, 0xfb, 0xba, 0x5a, 0xc5, 0x18, 0x67,
+        0xe0, 0x18, 0x01, 0x64, 0x7c, 0x45, 0xa7, 0xae,
+        0x82, 0x9c, 0x3d, 0x86, 0xde, 0x17, 0xaa, 0xc7,
+        0xe7, 0x1e, 0x53, 0xc0, 0xa8, 0x6b, 0x7b, 0xbc,
+        0xa0, 0xbe, 0x74, 0x06, 0x1b, 0x0c, 0x5f, 0x5b,
+        0x92, 0x72, 0xd5, 0xc1, 0xb0, 0xfd, 0x61, 0x90,
+        0xbd, 0x1b, 0x4c, 0x33, 0x6a, 0x17, 0xf1, 0x9b,
+        0xa0, 0x7c, 0x93, 0xcd, 0x03, 0x28, 0xa7, 0x29,
+        0xf9, 0xa2, 0x5b, 0x7e, 0x09, 0x7e, 0x26, 0x93,
+        0x92, 0x98, 0xd4, 0x17, 0xc3, 0xfe, 0x78, 0x34,
+        0x76, 0xb3, 0x58, 0x0c, 0xfb, 0x4f, 0x46, 0xc7,
+        0x63, 0xfd, 0x69, 0x4a, 0x9f, 0x86, 0x4f, 0xc6,
+        0x63, 0x2d, 0x1b, 0x36, 0xf8, 0xb8, 0x94, 0x3d,
+        0xd4, 0x30, 0xd0, 0x7f, 0x18, 0x4a, 0x97, 0x33,
+        0x2f, 0x58, 0x4d, 0xf1, 0x81, 0x89, 0x27, 0xd9,
+        0xeb, 0x02, 0xdd, 0xae, 0x92, 0xd4, 0xf8, 0x59,
+        0x71, 0xea, 0x81, 0x22, 0x2d, 0xe8, 0xc5, 0xea,
+        0x34, 0x06, 0xb2, 0x30, 0x07, 0x93, 0x6c, 0x1c,
+        0xcb, 0x55, 0x51, 0x1d, 0x1f, 0x52, 0xa7, 0xfa,
+        0xbf, 0xe6, 0xa0, 0x64, 0x0c, 0xd1, 0x5f, 0xcd,
+        0x6a, 0x68, 0xd0, 0xfa, 0x52, 0x85, 0xc4, 0x87,
+        0x8a, 0x79, 0x07, 0x26, 0xae, 0x08, 0xba, 0xbe,
+        0xb7, 0xa5, 0x0c, 0x04, 0xf4, 0x97, 0x9a, 0xcf,
+        0x80, 0xd2, 0xd3, 0xa8, 0x04, 0x04, 0x6a, 0x76,
+        0x25, 0x5d, 0x05, 0xa4, 0xee, 0xce, 0xe7, 0x1b,
+        0x20, 0x23, 0xc6, 0x2c, 0x0b, 0x2e, 0x1c, 0x9d,
+        0x36, 0x43, 0x6f, 0xac, 0x34, 0x21, 0x1a, 0x64,
+        0xff, 0x44, 0x7c, 0x65, 0x22, 0x9b, 0xe3, 0xeb,
+        0xd7, 0xc3, 0xa7, 0x47, 0x38, 0x69, 0xe6, 0x4c,
+        0xea, 0x36, 0x4c, 0x23, 0x3d, 0xf7, 0xb5, 0x01,
+        0xca, 0x87, 0x78, 0x76, 0xec, 0x1d, 0x7c, 0x14,
+        0x29, 0xac, 0xcc, 0x3b, 0x2a, 0x9d, 0x01, 0xc1,
+        0x1e, 0xe0, 0x3b, 0x42, 0x7a, 0x2e, 0x96, 0x7b,
+        0x49, 0x90, 0x65, 0x28, 0x1d, 0xeb, 0x47, 0x75,
+        0xf8, 0x7c, 0x86, 0x33, 0x0b, 0xf0, 0x38, 0xf4,
+        0xe9, 0xa7, 0x1f, 0x29, 0xc2, 0x50, 0xb9, 0x16,
+        0x96, 0x8b, 0x4c, 0x92, 0x1d, 0x34, 0x70, 0x28,
+        0x8e, 0xbd, 0x1b, 0xdd, 0x71, 0xa3, 0x70, 0xd0,
+        0x61, 0x25, 0xbd, 0x7c, 0xb6, 0x76, 0x29, 0x51,
+        0x85, 0x2a, 0xb5, 0x28, 0xf4, 0x51, 0x5d, 0x55,
+        0x9c, 0x12, 0xdf, 0x06, 0x5e, 0xa2, 0xb3, 0x05,
+        0xfa, 0xed, 0x20, 0x85, 0x05, 0x71, 0x0a, 0xe3,
+        0x7c, 0xef, 0x05, 0xe7, 0x11, 0xa7, 0x39, 0x40,
+        0x07, 0x31, 0x89, 0x67, 0xae, 0xfd, 0xad, 0xe4,
+        0xa6, 0xbd, 0xf0, 0xfe, 0x8a, 0x0e, 0x66, 0x43,
+        0xdb, 0xdf, 0xca, 0x1e, 0xc0, 0x81, 0x5a, 0xb9,
+        0x4e, 0x01, 0x68, 0x11, 0x8b, 0xa0, 0xd7, 0x5e,
+        0xdb, 0xce, 0x52, 0xbd, 0xdd, 0x1b, 0x1d, 0x0f,
+        0x95, 0x77, 0x97, 0x4f, 0xc3, 0x85, 0x1d, 0x84,
+        0x7f, 0x3e, 0x7b, 0xea, 0x7b, 0x8d, 0x03, 0x37,
+        0xb4, 0x6a, 0xc2, 0x31, 0xbd, 0xcc, 0x31, 0xa5,
+        0x11, 0xda, 0x51, 0x82, 0x58, 0x92, 0xb0, 0x8e,
+        0x2d, 0xa6, 0xe6, 0xf9, 0x91, 0xbb, 0x91, 0x3c,
+        0xc9, 0x2e, 0x5d, 0x3a, 0xb4, 0x06, 0xc0, 0x59,
+        0x91, 0xac, 0xba, 0x35, 0x8b, 0x3e, 0x4d, 0x37,
+        0x98, 0x0d, 0x84, 0x1f, 0x95, 0xf3, 0x03, 0xd0,
+        0xe5, 0x86, 0x28, 0x29, 0xd6, 0xa7, 0x06, 0xb4,
+        0x50, 0x6f, 0x3f, 0x2d, 0x4a, 0xa2, 0x21, 0x85,
+        0x26, 0xf8, 0x1a, 0x66, 0xe8, 0x89, 0x05, 0xbe,
+        0x3e, 0x85, 0x73, 0xd5, 0xeb, 0xa4, 0x6b, 0x7a,
+        0x0d, 0x08, 0x53, 0xc6, 0xa3, 0x91, 0xce, 0x92,
+        0x65, 0x6c, 0x24, 0x47, 0xe9, 0xd3, 0x8e, 0xe5,
+        0xd9, 0x36, 0x1c, 0xca, 0x59, 0x0c, 0x47, 0xba,
+        0xeb, 0x67, 0x6a, 0xba, 0x69, 0xf6, 0x0f, 0x4b,
+        0xb3, 0x2d, 0xeb, 0x38, 0x73, 0xad, 0x7a, 0x5a,
+        0x94, 0x7b, 0x5a, 0xb4, 0xf7, 0xb4, 0xd8, 0xa1,
+        0xa7, 0x45, 0x6d, 0x4f, 0xd3, 0x72, 0x4f, 0xd3,
+        0xf6, 0x9e, 0xa6, 0x3b, 0xf4, 0x34, 0xd5, 0x3d,
+        0x61, 0xdc, 0x88, 0x7a, 0x51, 0xb3, 0x45, 0x00,
+        0xb9, 0x6d, 0x81, 0xf1, 0x86, 0x64, 0xbe, 0x5b,
+        0x77, 0xc7, 0xd9, 0x55, 0x0d, 0xd5, 0x52, 0xdb,
+        0xee, 0x12, 0x58, 0xab, 0x00, 0x76, 0x35, 0x31,
+        0xea, 0x43, 0xfd, 0x76, 0x6a, 0x95, 0x2b, 0x9b,
+        0x4c, 0xf6, 0x76, 0xcd, 0xab, 0xd9, 0x35, 0xcb,
+        0xb5, 0xa4, 0xa8, 0xac, 0xbd, 0xa9, 0xef, 0xb5,
+        0x36, 0x7a, 0x95, 0x5b, 0x20, 0x64, 0x27, 0x4a,
+        0x5a, 0xab, 0xfa, 0x7c, 0x5b, 0x3c, 0x6c, 0xaf,
+        0xd9, 0x5e, 0x9f, 0xcb, 0xed, 0x75, 0xc7, 0xca,
+        0x53, 0xef, 0x4b, 0x74, 0x37, 0xcb, 0x2b, 0x3d,
+        0x5c, 0x08, 0xeb, 0x05, 0x91, 0x5d, 0x73, 0x7b,
+        0xdb, 0x3a, 0x9e, 0xa9, 0xf1, 0x1e, 0xed, 0x65,
+        0xf5, 0x7a, 0xdc, 0x55, 0x54, 0xc1, 0xf7, 0xb6,
+        0xf9, 0xdd, 0x98, 0x25, 0x55, 0xbf, 0x18, 0xbd,
+        0x02, 0x45, 0x81, 0xff, 0xf8, 0x0f, 0x4f, 0x4b,
+        0xae, 0x2f, 0x48, 0x72, 0xb5, 0x3e, 0xbd, 0xa7,
+        0x5a, 0xac, 0x55, 0x68, 0x69, 0xf6, 0x0b, 0x19,
+        0x3f, 0x01, 0xe3, 0x83, 0xe8, 0x47, 0x2d, 0x45,
+        0x6a, 0xa2, 0xe4, 0x3e, 0xe7, 0x07, 0xc9, 0xf6,
         0x6c, 0x02, 0x3a, 0x24, 0x98, 0x38, 0xbc, 0x8d,
-        0x5f, 0xd2, 0x18, 0x18, 0x28, 0x57, 0x7f, 0xea,
-        0xeb, 0x82, 0x87, 0x70, 0x59, 0xe0, 0x38, 0x1c,
-        0x68, 0xf5, 0xb6, 0x49, 0x3d, 0xbe, 0xa6, 0x8e,
-        0xb8, 0xdf, 0xa4, 0x23, 0xde, 0x48, 0xe3, 0xe2,
-        0xd7, 0x71, 0xd7, 0x51, 0xb2, 0x1e, 0xa2, 0xca,
-        0x64, 0x66, 0xbb, 0x97, 0xce, 0x2d, 0x41, 0xbb,
-        0x5e, 0xbc, 0xe6, 0xce, 0x28, 0x6e, 0xeb, 0x80,
-        0x46, 0x2a, 0x7f, 0xdd, 0x6f, 0x57, 0x09, 0xda,
-        0xaa, 0x7c, 0xa8, 0xf2, 0x97, 0xfe, 0x39, 0xbd,
-        0x41, 0x5c, 0x39, 0xe0, 0x4b, 0x50, 0x2d, 0x1e,
-        0xb6, 0xe4, 0xbf, 0xbb, 0xc2, 0xba, 0x87, 0x2b,
-        0x2c, 0x99, 0xca, 0xf5, 0x42, 0x66, 0x54, 0x6d,
-        0xbc, 0xc5, 0xaa, 0xbd, 0xf5, 0x52, 0x8d, 0xf7,
-        0xdc, 0x1d, 0xb2, 0x0b, 0xe2, 0xf2, 0x11, 0x41,
-        0x5c, 0x6e, 0x1a, 0xa4, 0xa5, 0x30, 0xad, 0xb5,
-        0x91, 0x5a, 0x6e, 0x3d, 0xaa, 0x4a, 0xdd, 0x0b,
-        0xb7, 0x2d, 0x43, 0x12, 0x48, 0x44, 0x6b, 0x9d,
-        0x63, 0x3e, 0xfa, 0x95, 0x9f, 0xe3, 0x08, 0xe9,
-        0xf4, 0x07, 0x3b, 0xea, 0x68, 0xf8, 0x7c, 0x64,
-        0x5c, 0x1f, 0xf1, 0xc1, 0xfc, 0xe8, 0xb0, 0x29,
-        0x0f, 0x69, 0x21, 0x09, 0x3d, 0x33, 0xac, 0x86,
-        0x55, 0xad, 0x1a, 0x4f, 0x81, 0x8a, 0xa7, 0xe1,
-        0x12, 0x8f, 0xf8, 0x24, 0x2e, 0xd3, 0x00, 0x3e,
-        0x9c, 0xaf, 0x38, 0xe8, 0xbc, 0x0b, 0x2e, 0x90,
-        0x69, 0xa8, 0x41, 0xde, 0x7b, 0x19, 0x05, 0xe7,
-        0xe4, 0x53, 0xd6, 0x92, 0x89, 0x2f, 0x28, 0x27,
-        0xae, 0x64, 0xd8, 0xa1, 0x97, 0xa9, 0x79, 0x43,
-        0xdb, 0x7f, 0x82, 0x91, 0xe2, 0x73, 0x95, 0x89,
-        0x5b, 0x04, 0xaa, 0x29, 0x9b, 0xcd, 0xe9, 0x61,
-        0x3c, 0xc6, 0xd9, 0xcb, 0x0c, 0x9b, 0x90, 0xe1,
-        0xde, 0x2b, 0x48, 0x8a, 0x19, 0x26, 0xa7, 0xfe,
+        0x5f, 0xd2, 0x18, 0x18, 0x28, 0x57, 0x7f, 0xec,
+        0xeb, 0x82, 0xfb, 0x70, 0x59, 0xe0, 0x38, 0x1c,
+        0x68, 0xf5, 0xb6, 0x4d, 0x3d, 0xbe, 0xa2, 0x8e,
+        0x78, 0xd8, 0xa6, 0x23, 0x5e, 0x4b, 0xe3, 0xe2,
+        0xd7, 0x71, 0x57, 0x51, 0xb2, 0xee, 0xa3, 0xca,
+        0x64, 0x66, 0xbb, 0x9f, 0x2d, 0x2c, 0x41, 0xbb,
+        0x59, 0xbc, 0xe6, 0xce, 0x28, 0x6e, 0xeb, 0x90,
+        0x46, 0x2a, 0x7f, 0x3d, 0xec, 0xd6, 0x09, 0xda,
+        0xaa, 0x7c, 0xa4, 0xf2, 0x97, 0xfe, 0x39, 0xbd,
+        0x41, 0x5c, 0x39, 0xe0, 0x8f, 0xa0, 0x5a, 0xdc,
+        0x6f, 0xc9, 0x7f, 0x7f, 0x85, 0x75, 0x07, 0x57,
+        0x58, 0x32, 0x95, 0xeb, 0xb9, 0xcc, 0xa8, 0xda,
+        0x7a, 0x8b, 0xd5, 0x78, 0xeb, 0xa5, 0x1a, 0x1f,
+        0xb8, 0x3b, 0x64, 0x1f, 0xc4, 0xe5, 0x03, 0x82,
+        0xb8, 0x5c, 0x37, 0x48, 0x4b, 0x69, 0x5a, 0x1b,
+        0x23, 0xb5, 0xdc, 0x78, 0x54, 0x95, 0xa6, 0x17,
+        0x6e, 0x3b, 0x86, 0x24, 0x90, 0x88, 0x36, 0x3a,
+        0xc7, 0x7c, 0xf0, 0x2b, 0x3f, 0xc7, 0x11, 0xd2,
+        0xe9, 0x0f, 0x76, 0xd4, 0xd3, 0xd1, 0xb3, 0xb1,
+        0x71, 0x7d, 0xc4, 0x07, 0xf3, 0xe3, 0xe3, 0xb6,
+        0x3c, 0xa4, 0xa5, 0x24, 0xf4, 0xcc, 0xb0, 0x5a,
+        0x56, 0xb5, 0x6e, 0x3c, 0x25, 0x2a, 0x0e, 0xa3,
+        0x15, 0x1e, 0xf1, 0x69, 0x52, 0xa5, 0x01, 0x7c,
+        0x38, 0x5f, 0x73, 0xd0, 0x05, 0xe7, 0x5c, 0x20,
+        0xd3, 0x50, 0x83, 0xbc, 0xf7, 0x2a, 0x16, 0x67,
+        0xe4, 0x53, 0xd6, 0x91, 0x89, 0x2f, 0x28, 0x27,
+        0xae, 0x64, 0xd8, 0x51, 0x90, 0xab, 0x79, 0x43,
+        0xdb, 0x7f, 0x8a, 0x91, 0xe2, 0x0b, 0x95, 0x89,
+        0xdb, 0x13, 0xaa, 0x29, 0x9b, 0xcd, 0xe9, 0x61,
+        0x3c, 0xc6, 0xd9, 0xcb, 0x0d, 0x9b, 0x90, 0xe1,
+        0xde, 0x6b, 0x48, 0x8a, 0x19, 0x26, 0xa7, 0xfe,
         0xc6, 0x20, 0x6d, 0x76, 0x06, 0x58, 0x0a, 0x0b,
-        0x9c, 0xc2, 0x9c, 0xd2, 0x2f, 0x73, 0x2b, 0x93,
-        0x2c, 0x7d, 0xf0, 0xf5, 0x07, 0xf9, 0x2f, 0x2e,
-        0xc2, 0x01, 0x02, 0xf9, 0xa3, 0x36, 0x5f, 0x61,
-        0xb0, 0xca, 0xc2, 0x88, 0x96, 0x9c, 0xc3, 0x68,
-        0x3a, 0x93, 0xa7, 0x06, 0xf8, 0xfb, 0x1a, 0x13,
-        0xfc, 0x4e, 0x65, 0xf6, 0x64, 0x1d, 0xd6, 0xee,
-        0x49, 0xd7, 0xfc, 0xef, 0x89, 0xfa, 0xf8, 0xff,
-        0xe0, 0x1f, 0xfd, 0x63, 0x3e, 0x7a, 0xf0, 0xe3,
-        0xc3, 0xcf, 0xc4, 0xfe, 0x58, 0x51, 0xf3, 0x3a,
-        0x30, 0xa7, 0xf0, 0x13, 0xc0, 0xcf, 0xec, 0x16,
-        0x61, 0xce, 0xe1, 0x67, 0x01, 0x3f, 0xe1, 0xb5,
-        0x60, 0xda, 0x4e, 0x84, 0xac, 0x2e, 0x58, 0xe4,
-        0x33, 0xe6, 0x0c, 0xbd, 0xa4, 0x11, 0x75, 0xe5,
-        0x7c, 0xa3, 0xd6, 0xa7, 0x7f, 0xbf, 0x64, 0xf1,
-        0xdb, 0x91, 0xe2, 0xfd, 0x46, 0x30, 0x83, 0x2b,
-        0x5a, 0x4f, 0x1a, 0x5b, 0x6f, 0x8b, 0xc3, 0x74,
-        0xeb, 0xa1, 0x0c, 0x2a, 0x5a, 0x07, 0x95, 0xad,
-        0xcb, 0xf5, 0x66, 0xdb, 0xe2, 0x5a, 0xd5, 0xc9,
-        0x7c, 0x6b, 0x14, 0x9b, 0x06, 0xba, 0xb8, 0x6a,
-        0xb2, 0x9b, 0x1a, 0x87, 0xdb, 0xe2, 0x5f, 0x06,
-        0xa2, 0x88, 0x89, 0x6e, 0x09, 0x31, 0x6a, 0x66,
-        0x78, 0x1e, 0xca, 0x10, 0xa9, 0x17, 0x74, 0xc9,
-        0x72, 0x29, 0xb2, 0x28, 0x59, 0x05, 0x14, 0xa9,
-        0xf0, 0x08, 0x35, 0x1e, 0xdc, 0x80, 0x14, 0x81,
-        0x4e, 0xdf, 0xb9, 0x50, 0x5b, 0xf3, 0x1d, 0xf8,
-        0xf1, 0x7b, 0x4f, 0xb2, 0x9b, 0x3e, 0x7d, 0x6e,
-        0x8b, 0xd0, 0x6c, 0x59, 0x8c, 0x50, 0xb1, 0x5e,
-        0xce, 0xa0, 0x0d, 0x87, 0xf9, 0xb4, 0x32, 0xa0,
-        0xf7, 0x45, 0x4b, 0xe6, 0x94, 0xc6, 0x04, 0xe2,
+        0x9c, 0xc1, 0x9c, 0xd2, 0x2f, 0x0b, 0x2b, 0x93,
+        0x2c, 0x7d, 0x98, 0xea, 0x0f, 0xf2, 0x5f, 0x5c,
+        0x84, 0x23, 0x04, 0xf2, 0x7b, 0x63, 0xbe, 0x42,
+        0xb1, 0xce, 0xa3, 0x98, 0x96, 0x9c, 0xc3, 0x68,
+        0x3a, 0x93, 0xa7, 0x06, 0xf8, 0xdb, 0x06, 0x13,
+        0xfc, 0x86, 0x32, 0x7b, 0xb2, 0x0e, 0x6b, 0xf7,
+        0xa8, 0x67, 0xfe, 0xf7, 0x48, 0x7d, 0xfc, 0x7f,
+        0xf0, 0x8f, 0xfe, 0x31, 0x1f, 0x03, 0xf8, 0x99,
+        0xc2, 0xcf, 0xcc, 0xfe, 0x58, 0x53, 0xf3, 0x2a,
+        0x30, 0x43, 0xf8, 0x11, 0xf0, 0x33, 0xbf, 0x41,
+        0x98, 0x0b, 0xf8, 0x59, 0xc2, 0x4f, 0x74, 0x25,
+        0x98, 0xb6, 0x13, 0x21, 0xab, 0x0b, 0x16, 0xf9,
+        0x4c, 0x38, 0x43, 0x2f, 0x69, 0x44, 0x3d, 0x39,
+        0xdf, 0xa8, 0xf5, 0xe9, 0xdf, 0x2f, 0x58, 0xfc,
+        0x76, 0xa4, 0xf8, 0x69, 0x2b, 0x98, 0xe1, 0x25,
+        0xad, 0x67, 0xad, 0xad, 0x77, 0xc5, 0x21, 0xdc,
+        0x79, 0x28, 0xc3, 0x9a, 0xd6, 0xa2, 0xb6, 0x75,
+        0xb5, 0xde, 0x7c, 0x57, 0x5c, 0xeb, 0x3a, 0x59,
+        0xec, 0x8c, 0x62, 0xdb, 0x40, 0x97, 0x97, 0x4d,
+        0x76, 0x5b, 0xe3, 0x68, 0x57, 0xfc, 0xab, 0x40,
+        0x14, 0x31, 0xd1, 0x2d, 0x21, 0x46, 0xcd, 0x8c,
+        0xce, 0x22, 0x19, 0x22, 0xf5, 0x9c, 0x2e, 0x59,
+        0x2e, 0xbc, 0x3c, 0x4e, 0xd7, 0x82, 0x22, 0x15,
+        0x3e, 0x45, 0x8d, 0x07, 0x37, 0x20, 0x45, 0xa0,
+        0xd3, 0x77, 0x2e, 0xd4, 0xd6, 0x7c, 0x07, 0x7e,
+        0xfc, 0x2e, 0x90, 0xec, 0x66, 0x40, 0x9f, 0xbb,
+        0x5e, 0x64, 0xb6, 0x2c, 0x46, 0xa8, 0xd8, 0xac,
+        0xe6, 0xd0, 0x86, 0xc3, 0x7c, 0x5a, 0x19, 0xd0,
+        0x07, 0x5e, 0x47, 0xe6, 0x94, 0xc6, 0x04, 0xe2,
         0xa8, 0x97, 0x42, 0x87, 0x32, 0xbe, 0x2f, 0x56,
-        0xc4, 0x50, 0x23, 0x6d, 0xd3, 0x2d, 0x46, 0xba,
-        0xc4, 0x98, 0xc0, 0xbf, 0xaf, 0x43, 0xe0, 0x72,
-        0x01, 0xc5, 0xd8, 0x3c, 0x26, 0x24, 0x0f, 0x06,
-        0x83, 0x67, 0x87, 0x83, 0xe1, 0xd3, 0xde, 0xd3,
-        0xa3, 0xc3, 0xc3, 0x67, 0x47, 0x87, 0x08, 0xf9,
-        0x70, 0x38, 0x92, 0x0a, 0x1b, 0x89, 0x40, 0xc8,
-        0x6c, 0xdb, 0x05, 0x60, 0x18, 0x8e, 0xd4, 0xc7,
-        0x14, 0x39, 0x18, 0x06, 0x72, 0x4a, 0xd0, 0x64,
-        0xfd, 0xe1, 0x73, 0x38, 0x42, 0x9e, 0x0e, 0x9f,
-        0x3f, 0x07, 0x60, 0xa3, 0x67, 0xa4, 0x51, 0x11,
-        0x00, 0x13, 0xc1, 0x53, 0x07, 0xf9, 0xe4, 0xa8,
-        0x24, 0x74, 0xdf, 0x1b, 0x5c, 0x78, 0xf3, 0x79,
-        0x90, 0xe2, 0x95, 0x2c, 0x0e, 0x72, 0x11, 0x46,
-        0x91, 0xba, 0x66, 0xca, 0x17, 0x98, 0xf3, 0xa3,
-        0x03, 0xdd, 0x4d, 0x3c, 0xbc, 0xe2, 0x4a, 0x30,
-        0x53, 0xfc, 0x26, 0x74, 0x02, 0xbb, 0x62, 0x70,
-        0x04, 0x2f, 0xc5, 0xa0, 0xa3, 0x71, 0x82, 0x81,
-        0x4e, 0x3c, 0x1f, 0x26, 0x04, 0x96, 0x1b, 0x04,
-        0x6e, 0x0a, 0x63, 0x99, 0xf5, 0xb0, 0xbf, 0x69,
-        0x42, 0xa1, 0x91, 0x29, 0xd0, 0xa8, 0x0e, 0x2e,
-        0x49, 0xc1, 0x92, 0x7d, 0x8c, 0x6c, 0xba, 0xd4,
-        0x10, 0x9d, 0x70, 0x97, 0x72, 0x5c, 0x2d, 0x1e,
+        0xc4, 0x50, 0x23, 0x5d, 0xd3, 0x2d, 0x46, 0xba,
+        0xc4, 0x98, 0xc0, 0xbf, 0x6d, 0x22, 0xe0, 0x72,
+        0x82, 0x62, 0x6c, 0x3e, 0x27, 0x24, 0x8f, 0x86,
+        0xc3, 0x27, 0xc7, 0xc3, 0xd1, 0xe3, 0xfe, 0xe3,
+        0xa7, 0xc7, 0xc7, 0x4f, 0x9e, 0x1e, 0x23, 0xe4,
+        0xe3, 0xd1, 0x58, 0x2a, 0x6c, 0x24, 0x02, 0x21,
+        0xb3, 0xed, 0x96, 0x80, 0x61, 0x38, 0xd2, 0x29,
+        0xa6, 0xc8, 0xc1, 0x30, 0x90, 0x21, 0x41, 0x93,
+        0xf5, 0x47, 0xcf, 0xe0, 0x08, 0x79, 0x3c, 0x7a,
+        0xf6, 0x0c, 0x80, 0x8d, 0x9f, 0x90, 0x46, 0x45,
+        0x00, 0x4c, 0x04, 0x4f, 0x1d, 0xe4, 0x93, 0xa3,
+        0x92, 0xd0, 0x7d, 0xaf, 0x38, 0x0f, 0x16, 0x0b,
+        0x91, 0xe1, 0x95, 0x2c, 0x0e, 0x72, 0x19, 0xc5,
+        0xb1, 0xba, 0x66, 0x2a, 0x96, 0x98, 0xf3, 0xc3,
+        0x87, 0xee, 0x66, 0x01, 0x5e, 0x71, 0xa5, 0x98,
+        0x29, 0x7e, 0x1b, 0x39, 0x81, 0x5d, 0x31, 0x38,
+        0x42, 0x90, 0x61, 0xd0, 0xd1, 0x24, 0xc5, 0x40,
+        0x27, 0xc1, 0x14, 0x26, 0x04, 0x96, 0x1b, 0x04,
+        0x6e, 0x0a, 0x63, 0x99, 0xf7, 0xb1, 0xbf, 0x30,
+        0xa5, 0xd0, 0xc8, 0x14, 0x68, 0x54, 0x07, 0x97,
+        0xa4, 0x60, 0xc9, 0x53, 0x8c, 0x6c, 0xba, 0xd2,
+        0x10, 0x9d, 0x70, 0x97, 0x72, 0x5c, 0x1d, 0x1e,
         0x07, 0x0d, 0x48, 0x9e, 0x40, 0xe4, 0x2a, 0xdc,
-        0x96, 0xab, 0x4a, 0x77, 0xc6, 0x30, 0x2b, 0x5e,
-        0xea, 0x87, 0x79, 0x8a, 0xd7, 0x5f, 0x74, 0x9e,
-        0x28, 0x90, 0xff, 0x2d, 0xa9, 0x06, 0x47, 0xe0,
-        0x9d, 0x82, 0xc6, 0x29, 0x27, 0x12, 0x96, 0xf3,
-        0x7d, 0x86, 0x9e, 0xd2, 0xea, 0x72, 0x2c, 0xb8,
-        0xc0, 0x24, 0xec, 0x74, 0xd8, 0xfa, 0x01, 0xe0,
-        0xdf, 0x13, 0x59, 0x10, 0x08, 0x05, 0x26, 0x0e,
-        0x27, 0xef, 0xc3, 0x69, 0xb4, 0x9e, 0x7b, 0xd9,
-        0xe2, 0x31, 0xf4, 0xb7, 0x09, 0x10, 0x6f, 0xe1,
-        0xa7, 0x81, 0xf7, 0x7e, 0x9a, 0x6c, 0x38, 0x87,
-        0x3d, 0x65, 0xab, 0x0f, 0xe3, 0x59, 0xa2, 0x49,
-        0x36, 0xcf, 0x57, 0xd9, 0x71, 0xbf, 0x3f, 0x0f,
-        0xf3, 0xc5, 0xda, 0xef, 0x4d, 0x92, 0x65, 0x7f,
-        0xe9, 0xad, 0xfc, 0xe4, 0x42, 0xfe, 0xd3, 0x9d,
-        0x47, 0xdd, 0x7f, 0x03, 0x05, 0xae, 0xa3, 0xa8,
-        0x7f, 0x38, 0x3a, 0x7a, 0xfa, 0xf5, 0x34, 0xcc,
-        0x26, 0x6b, 0x42, 0x62, 0x9c, 0x0e, 0x0f, 0x8e,
-        0x0e, 0x86, 0xcf, 0x0f, 0x0f, 0x9f, 0x3a, 0xf1,
-        0x20, 0xe4, 0x72, 0x29, 0x01, 0x84, 0xa6, 0xe6,
-        0x6f, 0x24, 0x44, 0x60, 0x54, 0xf9, 0x03, 0x71,
-        0x6c, 0x3e, 0x1e, 0xf4, 0x0e, 0xe9, 0xe3, 0xfe,
-        0x21, 0x7c, 0x85, 0x7f, 0x6c, 0xa5, 0x61, 0x0a,
-        0x67, 0xd5, 0xb9, 0x8a, 0x09, 0xac, 0xad, 0x09,
-        0xad, 0x09, 0xec, 0xc8, 0x99, 0xfc, 0x09, 0xdb,
-        0x30, 0xe7, 0x2d, 0x0f, 0xcf, 0x4d, 0xf9, 0x33,
-        0xb7, 0x02, 0xf3, 0xb4, 0xe6, 0xf0, 0x61, 0x21,
-        0x7f, 0x4c, 0x55, 0x5f, 0xfe, 0x4c, 0x64, 0xc0,
-        0x79, 0x20, 0x6b, 0x5e, 0x48, 0x34, 0x3b, 0xd4,
-        0x2c, 0xa5, 0x33, 0xa8, 0x27, 0x92, 0x90, 0x47,
-        0x86, 0x82, 0xab, 0xd5, 0x00, 0x36, 0x39, 0x90,
-        0xdc, 0x65, 0xac, 0x21, 0x38, 0x2a, 0x90, 0x8c,
-        0x8d, 0x54, 0x75, 0xd8, 0x29, 0x14, 0x5e, 0x56,
-        0x17, 0x0e, 0xed, 0xe0, 0xfa, 0x6c, 0x8c, 0x19,
-        0xdc, 0x47, 0x78, 0xc8, 0x07, 0x29, 0xad, 0x56,
-        0x0b, 0xab, 0x57, 0x29, 0x12, 0x95, 0x48, 0x15,
-        0x64, 0xce, 0x08, 0x30, 0x40, 0x6f, 0x89, 0x92,
-        0x30, 0x2a, 0x1d, 0x45, 0x0a, 0x09, 0xe6, 0x91,
-        0x15, 0x25, 0x9b, 0xd2, 0x67, 0xed, 0x5c, 0x51,
-        0x2a, 0xf1, 0x26, 0x18, 0xa8, 0x07, 0x17, 0x4c,
-        0x06, 0x4f, 0x7d, 0xfd, 0x4a, 0xec, 0xf7, 0x86,
-        0x07, 0xc3, 0xc3, 0xe7, 0xa3, 0xa7, 0x87, 0xfb,
-        0x87, 0x47, 0xcf, 0x9f, 0x3d, 0xdf, 0xaf, 0x0f,
-        0xb6, 0x45, 0x07, 0x44, 0x83, 0x0e, 0x53, 0xb5,
-        0x83, 0x5a, 0x7c, 0x20, 0xf4, 0xd2, 0x39, 0xc7,
-        0xd2, 0x6e, 0x97, 0x82, 0x69, 0xff, 0xe6, 0x9c,
-        0x59, 0x74, 0x56, 0x21, 0xe3, 0xf3, 0x5c, 0x76,
-        0xe7, 0x64, 0x33, 0x9b, 0xc0, 0xb2, 0xc5, 0xea,
-        0xe4, 0x21, 0xf8, 0xc8, 0x74, 0x56, 0xab, 0x34,
-        0xb9, 0xc0, 0xd8, 0xab, 0x18, 0x77, 0x27, 0xa7,
-        0x38, 0x48, 0x56, 0xce, 0x26, 0x18, 0x3b, 0x26,
-        0x5b, 0x63, 0x4e, 0x14, 0xa4, 0x13, 0x8f, 0x98,
-        0x28, 0x47, 0xf7, 0xa2, 0x28, 0xbc, 0x61, 0x06,
-        0x5f, 0xe8, 0xe5, 0x15, 0xb1, 0xb6, 0xaf, 0x0f,
-        0x8e, 0x06, 0xcf, 0xa8, 0xf6, 0x34, 0xc8, 0xbd,
-        0x30, 0xca, 0xec, 0x90, 0x31, 0x88, 0xd9, 0xf7,
-        0x2a, 0xaa, 0x15, 0x3a, 0xeb, 0xa0, 0x93, 0x87,
-        0x17, 0x67, 0xad, 0x96, 0x59, 0xc4, 0xb7, 0x83,
-        0x77, 0x6c, 0xb8, 0x53, 0x7f, 0x0f, 0xdf, 0xe1,
-        0x76, 0x96, 0x26, 0x50, 0xa9, 0x8e, 0xb6, 0xd9,
-        0xde, 0x69, 0x55, 0x91, 0xc4, 0xc6, 0x13, 0x43,
-        0xc1, 0xb9, 0xad, 0x33, 0xc1, 0x9e, 0x1f, 0x9b,
-        0xa7, 0x7f, 0xe8, 0xca, 0x69, 0x82, 0x39, 0x19,
-        0x02, 0x7f, 0xb0, 0x71, 0xa5, 0x06, 0x40, 0xb5,
-        0xb9, 0x17, 0xb7, 0xb0, 0x0c, 0x43, 0x3d, 0xf3,
-        0x7b, 0x16, 0x5a, 0x23, 0xe4, 0x41, 0xd6, 0x78,
-        0xdc, 0xc7, 0x2c, 0x14, 0xb8, 0x09, 0x1a, 0x2b,
-        0xce, 0xc1, 0x16, 0x56, 0xb4, 0xdd, 0x23, 0x34,
-        0xc9, 0x32, 0x30, 0xb8, 0x0c, 0x97, 0xb7, 0x81,
-        0x93, 0x02, 0x49, 0xa9, 0x07, 0x6b, 0xaa, 0x82,
-        0xbe, 0x85, 0x18, 0x52, 0x5e, 0x8f, 0x6e, 0x29,
-        0x1f, 0x88, 0x09, 0x57, 0x7b, 0xaa, 0x88, 0x5d,
-        0xa9, 0xed, 0x72, 0x1e, 0xa6, 0x53, 0x04, 0xac,
-        0xa2, 0x83, 0xd1, 0xe1, 0x08, 0x6b, 0x07, 0x42,
-        0x06, 0xb4, 0x81, 0x15, 0x97, 0xb1, 0xb3, 0xe6,
-        0x51, 0xe2, 0x7b, 0x91, 0x74, 0xe4, 0x48, 0x7c,
-        0x5c, 0xda, 0x8e, 0x3c, 0xd0, 0x00, 0x42, 0x06,
-        0x20, 0xfa, 0x23, 0xc7, 0xdb, 0x03, 0xc9, 0xe6,
-        0x43, 0xb8, 0x5c, 0xe7, 0x0b, 0x13, 0x2e, 0x5a,
-        0xe7, 0xa8, 0xd3, 0x1d, 0x14, 0xa8, 0x67, 0x30,
-        0x0d, 0xe6, 0x98, 0xd0, 0x0e, 0xce, 0xc3, 0x55,
-        0x12, 0xab, 0x50, 0xeb, 0x31, 0x10, 0xcf, 0xa2,
-        0x4f, 0xb9, 0xbf, 0x92, 0x95, 0xa2, 0x4d, 0x95,
-        0xb8, 0x4f, 0xa5, 0x4e, 0xc8, 0xf2, 0x4b, 0x20,
-        0x69, 0x9c, 0x55, 0xdb, 0x85, 0x09, 0x4b, 0x92,
-        0x34, 0x9c, 0x93, 0x83, 0x8d, 0x0c, 0xac, 0xbe,
-        0xf1, 0x32, 0xb1, 0x49, 0xc3, 0x1c, 0x26, 0x46,
-        0xf6, 0x1f, 0xac, 0x72, 0xd1, 0xea, 0x82, 0x04,
-        0x42, 0xee, 0x76, 0x88, 0xe1, 0x77, 0xca, 0xa0,
-        0x0c, 0xf4, 0xf4, 0x1c, 0x76, 0x96, 0x27, 0xbd,
-        0xc3, 0xd4, 0x88, 0x7a, 0xf6, 0x52, 0xf2, 0x47,
-        0x6b, 0x82, 0x2f, 0x81, 0xf4, 0x5e, 0xbf, 0x72,
-        0xf6, 0xa1, 0x4e, 0x2c, 0x28, 0xa9, 0x06, 0x0e,
-        0xfd, 0x24, 0x0e, 0x28, 0xe5, 0x0a, 0x3a, 0xbf,
-        0xa9, 0x2d, 0xa8, 0x97, 0x0b, 0xc4, 0x30, 0xca,
-        0xb6, 0xe6, 0x81, 0xe0, 0xc5, 0xae, 0x6b, 0x7c,
-        0x01, 0xb3, 0x0c, 0x23, 0x0f, 0xdd, 0x6a, 0x6c,
-        0x37, 0x30, 0x0b, 0x96, 0xfb, 0xde, 0x4a, 0xcc,
-        0xd6, 0x31, 0x8f, 0xa2, 0x34, 0x49, 0xc7, 0xd7,
-        0x94, 0x14, 0x7c, 0x58, 0x7f, 0xf8, 0x82, 0x49,
-        0x1f, 0xfa, 0x59, 0x3a, 0xe9, 0x13, 0xa4, 0x2e,
-        0x42, 0xea, 0x1b, 0xf9, 0xa5, 0x4f, 0xbc, 0x8f,
-        0x96, 0x38, 0xeb, 0x1b, 0x4c, 0x82, 0xde, 0xbf,
-        0xb3, 0xaf, 0x7f, 0x1c, 0x0d, 0x9f, 0x75, 0x7f,
-        0x1c, 0x8d, 0x8e, 0x8a, 0xce, 0x45, 0xc8, 0x53,
-        0x61, 0x55, 0x0c, 0xa1, 0x4a, 0x67, 0xb6, 0x09,
-        0x48, 0x38, 0x98, 0x0b, 0x04, 0x45, 0x9b, 0x64,
-        0xe5, 0x81, 0x92, 0x6b, 0x0b, 0x89, 0xf6, 0x02,
-        0x48, 0x03, 0xed, 0xb0, 0x77, 0xf4, 0xec, 0x10,
-        0xd6, 0xcb, 0x8e, 0xd0, 0x3c, 0xec, 0x3d, 0x3b,
-        0xb4, 0xb7, 0x1d, 0x1c, 0xfe, 0xff, 0x90, 0x2e,
-        0x91, 0x1c, 0x29, 0x10, 0x97, 0xa9, 0xc0, 0x7d,
-        0xa6, 0x67, 0x72, 0x5f, 0x1b, 0x40, 0x5f, 0x71,
-        0xf5, 0x6f, 0x90, 0xe7, 0x82, 0x4c, 0xc1, 0xf7,
-        0xae, 0xb4, 0x90, 0x8a, 0xe9, 0x92, 0x7c, 0xae,
-        0x8b, 0x54, 0x37, 0xaa, 0x14, 0xb9, 0x93, 0xee,
-        0xfa, 0x98, 0x5b, 0xda, 0x39, 0x0f, 0x02, 0xc1,
-        0xe7, 0x87, 0x74, 0xea, 0x80, 0x2d, 0xa8, 0x56,
-        0xdd, 0xf5, 0xb5, 0xca, 0xf0, 0x64, 0x91, 0x1b,
-        0x80, 0xe9, 0x08, 0xb6, 0xa0, 0xa2, 0x2b, 0xa4,
-        0xee, 0x66, 0x00, 0xd8, 0xbc, 0x38, 0xfd, 0x79,
-        0xa1, 0x73, 0xd8, 0xb7, 0x24, 0x94, 0x43, 0x2f,
-        0x93, 0x05, 0xf9, 0x17, 0x06, 0x94, 0xfb, 0x03,
-        0x28, 0xa8, 0xb2, 0x2f, 0xa8, 0xcf, 0x15, 0x40,
-        0xa2, 0x75, 0x76, 0x05, 0xc3, 0x64, 0x1e, 0x6e,
-        0xcd, 0xab, 0xc3, 0x84, 0x35, 0xff, 0xa5, 0x70,
-        0x7c, 0x16, 0x2a, 0xb8, 0x77, 0xed, 0x01, 0xd1,
-        0xa9, 0x45, 0x82, 0x17, 0x8c, 0xa7, 0x40, 0x2a,
-        0xc5, 0x11, 0xa9, 0xe2, 0x10, 0x90, 0xfa, 0x4f,
-        0x5e, 0xb8, 0x69, 0x42, 0x61, 0xd4, 0x30, 0x1c,
-        0x1f, 0xdf, 0x12, 0x61, 0x8c, 0x79, 0xce, 0xd4,
-        0xc9, 0x13, 0x8b, 0x7d, 0x30, 0xdd, 0x59, 0x5a,
-        0x4f, 0x14, 0x94, 0xa9, 0xf2, 0x6f, 0x04, 0x4f,
-        0xb2, 0xca, 0x80, 0x82, 0x42, 0x02, 0x34, 0x09,
-        0x81, 0x68, 0x15, 0xcf, 0x9b, 0x6c, 0x05, 0xba,
-        0x49, 0x2c, 0xe7, 0x83, 0xfd, 0x33, 0x68, 0x5c,
-        0xda, 0x91, 0x56, 0x1e, 0x55, 0xfc, 0x95, 0x2d,
-        0x94, 0x72, 0xe4, 0x7b, 0x52, 0xbe, 0xb4, 0xa9,
-        0x78, 0x54, 0x7b, 0x9b, 0xc8, 0x73, 0xc4, 0x61,
-        0xcd, 0xd0, 0xfe, 0xde, 0x92, 0xe7, 0xca, 0x13,
-        0xc5, 0x95, 0x90, 0x30, 0x81, 0xbd, 0xb3, 0xd0,
-        0xe9, 0x4a, 0x09, 0x1a, 0x37, 0x02, 0xa2, 0x51,
-        0x63, 0x1b, 0x3d, 0x0b, 0x40, 0x1d, 0x5b, 0xe6,
-        0xe9, 0x70, 0x45, 0xc4, 0x16, 0x08, 0xc9, 0x59,
-        0xd3, 0xad, 0xb1, 0x2e, 0x08, 0xac, 0xce, 0xac,
-        0xe8, 0x03, 0xdc, 0xc2, 0xa7, 0xe7, 0xe1, 0x31,
-        0x6e, 0x7d, 0xb8, 0x15, 0x91, 0xf8, 0xd1, 0x23,
-        0xc9, 0x39, 0x4d, 0x46, 0x8d, 0x73, 0x3c, 0x18,
-        0xe8, 0x38, 0xe3, 0x13, 0x2c, 0x96, 0xe9, 0x2b,
-        0x30, 0xe6, 0x9e, 0xa4, 0x6d, 0x72, 0xcc, 0xce,
-        0xe1, 0x80, 0x80, 0x33, 0xfb, 0x9c, 0x62, 0x6b,
-        0x52, 0xf2, 0x0c, 0x90, 0xa6, 0x96, 0x40, 0x02,
-        0x41, 0xea, 0xbc, 0x84, 0xf5, 0x48, 0xd2, 0x53,
-        0x49, 0x33, 0x7b, 0x5a, 0x2c, 0x7c, 0xf1, 0xd3,
-        0x9b, 0x57, 0x2f, 0x7e, 0x7c, 0xf5, 0xe2, 0xec,
-        0xd5, 0x4f, 0x3f, 0x34, 0x25, 0xa4, 0x84, 0xc9,
-        0x23, 0x2c, 0x39, 0x51, 0xc1, 0x10, 0xf4, 0x6a,
-        0xf8, 0x46, 0x19, 0x2d, 0x9e, 0x62, 0xae, 0x09,
+        0x95, 0xab, 0x4a, 0x77, 0xc6, 0x30, 0x2b, 0x41,
+        0x36, 0x8d, 0x8a, 0x0c, 0xaf, 0xbf, 0xe8, 0x3c,
+        0x51, 0x20, 0xff, 0x5b, 0x52, 0x0d, 0x8e, 0x20,
+        0x78, 0x01, 0x1a, 0xa7, 0x9c, 0x48, 0x58, 0xce,
+        0x77, 0x39, 0x7a, 0x4a, 0xab, 0xcb, 0x31, 0x71,
+        0x8e, 0x49, 0xd8, 0xe9, 0xb0, 0x9d, 0x0a, 0xc0,
+        0xbf, 0xef, 0xe5, 0x42, 0x78, 0x0a, 0x4c, 0x12,
+        0xcd, 0xde, 0x45, 0x61, 0xbc, 0x59, 0x04, 0xf9,
+        0xf2, 0x21, 0xf4, 0xb7, 0x15, 0x88, 0xb7, 0x37,
+        0xcd, 0x44, 0xf0, 0x2e, 0x4c, 0xb7, 0x9c, 0xc3,
+        0x9e, 0xb2, 0xd5, 0x47, 0xc9, 0x3c, 0xd5, 0x24,
+        0x5b, 0x14, 0xeb, 0xfc, 0xf9, 0x60, 0xb0, 0x88,
+        0x8a, 0xe5, 0x66, 0xda, 0x9f, 0xa5, 0xab, 0xc1,
+        0x2a, 0x58, 0x4f, 0xd3, 0x73, 0xf9, 0x4f, 0x6f,
+        0x11, 0xf7, 0x7e, 0x05, 0x0a, 0xdc, 0xc4, 0xf1,
+        0xe0, 0x78, 0xfc, 0xf4, 0xf1, 0xe7, 0x61, 0x94,
+        0xcf, 0x36, 0x84, 0xc4, 0x24, 0x1b, 0x1d, 0x3d,
+        0x3d, 0x1a, 0x3d, 0x3b, 0x3e, 0x7e, 0xec, 0xc4,
+        0x83, 0x90, 0xcb, 0xa5, 0x04, 0x10, 0x9a, 0x9a,
+        0xbf, 0x91, 0x10, 0x81, 0x51, 0xe5, 0x8f, 0xbc,
+        0xe7, 0xe6, 0xe3, 0x51, 0xff, 0x98, 0x3e, 0x1e,
+        0x1e, 0xc3, 0x57, 0xf8, 0xc7, 0x56, 0x1a, 0x42,
+        0x38, 0xab, 0xce, 0x54, 0x4c, 0x60, 0x6d, 0x4d,
+        0xe8, 0xcc, 0x60, 0x47, 0xce, 0xe5, 0x4f, 0xd4,
+        0x85, 0x39, 0xef, 0x04, 0x78, 0x6e, 0xca, 0x9f,
+        0x85, 0x15, 0x98, 0xa7, 0xb3, 0x80, 0x0f, 0x4b,
+        0xf9, 0x63, 0xaa, 0x4e, 0xe5, 0xcf, 0x4c, 0x06,
+        0x9c, 0x07, 0xb2, 0xe6, 0x85, 0x44, 0xb3, 0x43,
+        0xc3, 0x52, 0x3a, 0x83, 0x7a, 0x24, 0x09, 0x79,
+        0x6c, 0x28, 0xb8, 0x5e, 0x0d, 0x60, 0x93, 0x03,
+        0xc9, 0x5d, 0xc6, 0x1a, 0x82, 0xa3, 0x02, 0xc9,
+        0xd8, 0x48, 0x55, 0xc7, 0x7e, 0xa9, 0xf0, 0xa2,
+        0xbe, 0x70, 0x64, 0x07, 0xd7, 0x67, 0x63, 0xcc,
+        0xf0, 0x2e, 0xc2, 0x43, 0xde, 0x4b, 0x69, 0xb5,
+        0x5e, 0x58, 0xbd, 0x4c, 0x91, 0xa8, 0x45, 0xaa,
+        0x24, 0x73, 0xc6, 0x80, 0x01, 0x7a, 0x4b, 0x54,
+        0x84, 0x51, 0xe9, 0x28, 0x52, 0x4a, 0x30, 0x8f,
+        0xac, 0x28, 0xdd, 0x56, 0x3e, 0x6b, 0xe7, 0x8a,
+        0x4a, 0x49, 0x30, 0xc3, 0x40, 0x3d, 0xb8, 0x60,
+        0x32, 0x78, 0xea, 0x9b, 0xd7, 0xde, 0x61, 0x7f,
+        0x74, 0x34, 0x3a, 0x7e, 0x36, 0x7e, 0x7c, 0x7c,
+        0x78, 0xfc, 0xf4, 0xd9, 0x93, 0x67, 0x87, 0xcd,
+        0xc1, 0xb6, 0xe8, 0x80, 0x68, 0xd1, 0x61, 0xea,
+        0x76, 0x50, 0x87, 0x0f, 0x84, 0x7e, 0xb6, 0xe0,
+        0x58, 0xda, 0xdd, 0x4a, 0x30, 0xed, 0x9f, 0x9d,
+        0x33, 0x8b, 0xce, 0x2a, 0x64, 0x7c, 0x81, 0xcb,
+        0xee, 0x9c, 0x6c, 0x66, 0x33, 0x58, 0xb6, 0x44,
+        0x9d, 0x3c, 0x04, 0x1f, 0x99, 0xce, 0x7a, 0x9d,
+        0xa5, 0xe7, 0x18, 0x7b, 0x15, 0xe3, 0xee, 0x14,
+        0x14, 0x07, 0xc9, 0xca, 0xd9, 0x04, 0x63, 0xc7,
+        0x64, 0x6b, 0xcc, 0x89, 0x44, 0x36, 0x0b, 0x88,
+        0x89, 0x72, 0x74, 0x2f, 0x8a, 0xc2, 0x1b, 0xe5,
+        0xf0, 0x85, 0x5e, 0x5e, 0x11, 0x6b, 0xfb, 0xfc,
+        0xe8, 0xe9, 0xf0, 0x09, 0xd5, 0x0e, 0x45, 0x11,
+        0x44, 0x71, 0x6e, 0x87, 0x8c, 0x41, 0xcc, 0xbe,
+        0x56, 0x51, 0xad, 0xd0, 0x59, 0x07, 0x9d, 0x3c,
+        0x82, 0x24, 0xef, 0x74, 0xcc, 0x22, 0xfe, 0x32,
+        0x7c, 0xcb, 0x86, 0x3b, 0xf5, 0xf7, 0xe8, 0x2d,
+        0x6e, 0x67, 0x69, 0x02, 0x95, 0xea, 0x68, 0x97,
+        0xed, 0x9d, 0x56, 0x15, 0x49, 0x6c, 0x3c, 0x31,
+        0x14, 0x9c, 0xdb, 0x3a, 0x13, 0xec, 0xf9, 0xb1,
+        0x79, 0xfa, 0xfb, 0x9e, 0x9c, 0x26, 0x98, 0x93,
+        0x11, 0xf0, 0x07, 0x1b, 0x57, 0x6a, 0x00, 0x54,
+        0x5b, 0x04, 0x49, 0x07, 0xcb, 0x30, 0xd4, 0x33,
+        0xbf, 0x67, 0xa1, 0x35, 0x42, 0x1e, 0x64, 0x8d,
+        0xc7, 0x7d, 0xcc, 0x42, 0x81, 0x9b, 0xa0, 0xb1,
+        0xe2, 0x1c, 0x6c, 0x61, 0x45, 0xdb, 0x3d, 0x42,
+        0x93, 0x2c, 0x03, 0x83, 0xcb, 0x70, 0x79, 0x17,
+        0x38, 0x29, 0x90, 0x94, 0x7a, 0xb0, 0xa6, 0x2a,
+        0xe8, 0x5b, 0x88, 0x11, 0xe5, 0xf5, 0xe8, 0x55,
+        0xf2, 0x81, 0x98, 0x70, 0xb5, 0x2f, 0x14, 0xb1,
+        0x2b, 0xb5, 0x5d, 0xce, 0x43, 0x18, 0x22, 0x60,
+        0x15, 0x1d, 0x8c, 0x0e, 0x47, 0x58, 0x3b, 0x10,
+        0x32, 0xa0, 0x0d, 0xac, 0xb8, 0x8c, 0x9d, 0xb5,
+        0x88, 0xd3, 0x69, 0x10, 0x4b, 0x47, 0x8e, 0x74,
+        0x8a, 0x4b, 0xeb, 0xcb, 0x03, 0x0d, 0x20, 0xe4,
+        0x00, 0x62, 0x30, 0x76, 0xbc, 0x3d, 0x90, 0x6c,
+        0xde, 0x47, 0xab, 0x4d, 0xb1, 0x34, 0xe1, 0xa2,
+        0x75, 0x8e, 0x3a, 0xdd, 0x41, 0x89, 0x7a, 0x86,
+        0xa1, 0x58, 0x60, 0x42, 0x3b, 0x38, 0x0f, 0xd7,
+        0x69, 0xa2, 0x42, 0xad, 0x27, 0x40, 0x3c, 0xcb,
+        0x01, 0xe5, 0xfe, 0x4a, 0xd7, 0x8a, 0x36, 0x55,
+        0xe2, 0x3e, 0x95, 0x3a, 0x21, 0x2f, 0x2e, 0x80,
+        0xa4, 0x71, 0x56, 0x6d, 0x17, 0x26, 0x2c, 0x49,
+        0xb3, 0x68, 0x41, 0x0e, 0x36, 0x32, 0xb0, 0xfa,
+        0x36, 0xc8, 0xbd, 0x6d, 0x16, 0x15, 0x30, 0x31,
+        0xb2, 0x7f, 0xb1, 0x2e, 0xbc, 0x4e, 0x0f, 0x24,
+        0x10, 0x72, 0xb7, 0x43, 0x0c, 0xbf, 0x52, 0x06,
+        0x65, 0xa0, 0xa7, 0x67, 0xb0, 0xb3, 0x02, 0xe9,
+        0x1d, 0xa6, 0x46, 0xd4, 0xb7, 0x97, 0x92, 0x3f,
+        0x5a, 0x13, 0x7c, 0x01, 0xa4, 0xf7, 0xe6, 0xb5,
+        0xb3, 0x0f, 0x75, 0x62, 0x41, 0x49, 0x35, 0x70,
+        0xe8, 0xa7, 0x89, 0xa0, 0x94, 0x2b, 0xe8, 0xfc,
+        0xa6, 0xb6, 0xa0, 0x5e, 0x2e, 0x10, 0xc3, 0x28,
+        0xdb, 0x5a, 0x00, 0x82, 0x17, 0xbb, 0xae, 0xf1,
+        0x05, 0xcc, 0x2a, 0x8a, 0x03, 0x74, 0xab, 0xb1,
+        0xdd, 0xc0, 0x2c, 0x58, 0xee, 0x7b, 0x2b, 0x6f,
+        0xbe, 0x49, 0x78, 0x14, 0x95, 0x49, 0x7a, 0x7e,
+        0x45, 0x49, 0x61, 0x0a, 0xeb, 0x0f, 0x5f, 0x30,
+        0xe9, 0xc3, 0x20, 0xcf, 0x66, 0x03, 0x82, 0xd4,
+        0x43, 0x48, 0x03, 0x23, 0xbf, 0x0c, 0x88, 0xf7,
+        0xd1, 0x12, 0xe7, 0x03, 0x83, 0x89, 0xe8, 0xff,
+        0x9a, 0x7f, 0xfe, 0xed, 0x78, 0xf4, 0xa4, 0xf7,
+        0xed, 0x78, 0xfc, 0xb4, 0xec, 0x5c, 0x84, 0x3c,
+        0x15, 0x56, 0xc5, 0x10, 0xaa, 0x74, 0x66, 0x9b,
+        0x81, 0x84, 0x83, 0xb9, 0x40, 0x50, 0xb4, 0x49,
+        0xd7, 0x01, 0x28, 0xb9, 0xb6, 0x90, 0x68, 0x2f,
+        0x80, 0x34, 0xd0, 0x8e, 0xfa, 0x4f, 0x9f, 0x1c,
+        0xc3, 0x7a, 0xd9, 0x11, 0x9a, 0x47, 0xfd, 0x27,
+        0xc7, 0xf6, 0xb6, 0x83, 0xc3, 0xff, 0x1f, 0xd2,
+        0x25, 0x92, 0x23, 0x05, 0xe2, 0x32, 0x95, 0xb8,
+        0x4f, 0x78, 0x2a, 0xf7, 0xb5, 0x01, 0xf4, 0x57,
+        0xae, 0xfe, 0x05, 0xf2, 0x5c, 0x90, 0x29, 0xf8,
+        0xde, 0x95, 0x16, 0x52, 0x31, 0x5d, 0x92, 0xcf,
+        0x75, 0x91, 0xea, 0x46, 0x95, 0x22, 0x77, 0xd2,
+        0x5d, 0x3f, 0xe7, 0x96, 0x76, 0xce, 0x03, 0xe1,
+        0xf1, 0xf9, 0x21, 0x9d, 0x3a, 0x60, 0x0b, 0xaa,
+        0x55, 0x77, 0x7d, 0xad, 0x72, 0x3c, 0x59, 0xe4,
+        0x06, 0x60, 0x3a, 0x82, 0x2d, 0xa8, 0xe8, 0x0a,
+        0xa9, 0xbb, 0x1d, 0x00, 0x36, 0x2f, 0x4f, 0x7f,
+        0x51, 0xea, 0x1c, 0xf6, 0x2d, 0x09, 0xe5, 0xd0,
+        0xcb, 0x6c, 0x49, 0xfe, 0x85, 0x82, 0x72, 0x7f,
+        0x00, 0x05, 0xd5, 0xf6, 0x05, 0xf5, 0xb9, 0x02,
+        0x48, 0xb4, 0xce, 0xae, 0x60, 0x98, 0xcc, 0xc3,
+        0xad, 0x79, 0x75, 0x98, 0xb0, 0xe6, 0xbf, 0x14,
+        0x8e, 0xcf, 0x42, 0x05, 0xf7, 0xae, 0x3d, 0x20,
+        0x3a, 0xb5, 0x48, 0xf0, 0x82, 0xf1, 0x94, 0x48,
+        0xa5, 0x3c, 0x22, 0x55, 0x1c, 0x01, 0x52, 0xff,
+        0xc9, 0x0b, 0x17, 0xa6, 0x14, 0x46, 0x0d, 0xc3,
+        0xf1, 0xf1, 0x2d, 0x11, 0xc6, 0x98, 0xe7, 0x4c,
+        0x9d, 0x3c, 0xb1, 0xd8, 0x07, 0xd3, 0x9d, 0xa5,
+        0xf5, 0xc4, 0xa2, 0x4a, 0x95, 0x7f, 0x23, 0x78,
+        0x92, 0x55, 0x0a, 0x0a, 0x0a, 0x09, 0xd0, 0x24,
+        0x04, 0xa2, 0x55, 0x3c, 0x6f, 0xf2, 0x35, 0xe8,
+        0x26, 0x89, 0x9c, 0x0f, 0xf6, 0xcf, 0xa0, 0x71,
+        0x69, 0x47, 0x5a, 0x79, 0x54, 0xf1, 0x57, 0xb6,
+        0x50, 0xca, 0x91, 0x1f, 0x48, 0xf9, 0xd2, 0xa6,
+        0xe2, 0x71, 0xe3, 0x6d, 0x22, 0xcf, 0x11, 0x87,
+        0x35, 0x43, 0xfb, 0x7b, 0x47, 0x9e, 0x2b, 0x8f,
+        0x14, 0x57, 0x42, 0xc2, 0x04, 0xf6, 0xce, 0x42,
+        0xa7, 0x2b, 0x25, 0x68, 0xdc, 0x08, 0x88, 0x46,
+        0x8d, 0x6d, 0xf4, 0x2c, 0x00, 0xf9, 0xb6, 0xcc,
+        0xe3, 0x73, 0x45, 0xc4, 0x16, 0x08, 0xc9, 0x59,
+        0xd3, 0x9d, 0xb1, 0x2e, 0x09, 0xac, 0xce, 0xac,
+        0xe8, 0x03, 0xdc, 0xc2, 0xa7, 0x1f, 0xe0, 0x31,
+        0x6e, 0x7d, 0xb8, 0x11, 0x91, 0xf8, 0xc1, 0x03,
+        0xc9, 0x39, 0x4d, 0x46, 0x8d, 0x33, 0x3c, 0x18,
+        0xe8, 0x38, 0xe3, 0x13, 0x2c, 0x91, 0xe9, 0x2b,
+        0x30, 0xe6, 0x9e, 0xa4, 0x6d, 0x72, 0xcc, 0x2e,
+        0xe0, 0x80, 0x80, 0x33, 0xfb, 0x8c, 0x62, 0x6b,
+        0x52, 0xf2, 0x0c, 0x90, 0xa6, 0x56, 0x40, 0x02,
+        0x22, 0x73, 0x5e, 0xc2, 0x06, 0x24, 0xe9, 0xa9,
+        0xa4, 0x99, 0x7d, 0x2d, 0x16, 0xbe, 0xfc, 0xee,
+        0xc7, 0xd7, 0x2f, 0xbf, 0x7d, 0xfd, 0xf2, 0xf4,
+        0xf5, 0x77, 0xdf, 0xb4, 0x25, 0xa4, 0x84, 0xc9,
+        0x23, 0x2c, 0x39, 0x51, 0xc1, 0x08, 0xf4, 0x6a,
+        0xf8, 0x46, 0x19, 0x2d, 0x1e, 0x63, 0xae, 0x09,
         0x89, 0x3f, 0xf0, 0x14, 0x4a, 0xe2, 0x09, 0xfd,
-        0x27, 0x1b, 0xc0, 0x65, 0x19, 0xe6, 0xe4, 0xd2,
-        0xbb, 0x64, 0x0d, 0x19, 0x65, 0x05, 0xb9, 0xc5,
-        0x97, 0x09, 0xfa, 0x68, 0xf6, 0x4c, 0xa4, 0xcb,
-        0xa9, 0xf6, 0x6a, 0x0e, 0x29, 0xeb, 0x0f, 0x8a,
-        0x68, 0xb4, 0xb7, 0x60, 0x40, 0xfe, 0x25, 0x30,
-        0x80, 0x56, 0x77, 0x38, 0x3a, 0xea, 0xf5, 0xa0,
-        0xeb, 0x76, 0x8f, 0x92, 0xbf, 0xd0, 0x09, 0x96,
-        0x06, 0xf3, 0x35, 0x9e, 0x40, 0xdc, 0x36, 0xc3,
-        0x74, 0x21, 0x30, 0x5a, 0x19, 0x49, 0xef, 0xe9,
-        0x3e, 0x28, 0xed, 0xeb, 0x5c, 0x62, 0x87, 0x2a,
-        0x72, 0x2a, 0x05, 0xad, 0xbf, 0x22, 0x59, 0xc2,
-        0xf9, 0xf4, 0x57, 0xdd, 0x90, 0x79, 0xbf, 0x77,
-        0x8e, 0x7a, 0xb4, 0x1f, 0xa2, 0x1a, 0xa6, 0xa0,
-        0xb4, 0x80, 0xf5, 0x30, 0x58, 0x74, 0x54, 0x0f,
-        0x63, 0x9d, 0xe0, 0x08, 0x93, 0x10, 0xb5, 0x69,
-        0x1d, 0xd4, 0x6c, 0x32, 0x4e, 0x34, 0x23, 0xee,
-        0x27, 0xcc, 0x76, 0x76, 0x78, 0xf4, 0x6c, 0x7f,
-        0x30, 0x7c, 0xfa, 0xa8, 0xec, 0x2a, 0x85, 0x77,
-        0x54, 0x8c, 0x47, 0x85, 0x1f, 0x95, 0xcc, 0x53,
-        0x78, 0xc5, 0x85, 0x4c, 0x39, 0xfb, 0x14, 0x85,
-        0xdf, 0x2c, 0x28, 0x17, 0x40, 0x8c, 0xe5, 0x57,
-        0xb2, 0x05, 0x75, 0x45, 0x21, 0x52, 0xf8, 0x4c,
-        0x11, 0x06, 0x47, 0x65, 0x2f, 0xac, 0xb9, 0xb7,
-        0x5c, 0x7a, 0x2a, 0x90, 0x66, 0x55, 0x76, 0x09,
-        0xbc, 0x98, 0x8a, 0x83, 0x2c, 0x99, 0x79, 0xe9,
-        0x67, 0x1a, 0x75, 0x8f, 0xa2, 0xd1, 0x56, 0xfb,
-        0x90, 0x51, 0x86, 0xfb, 0x5a, 0x1f, 0x32, 0xca,
-        0xbf, 0x78, 0xe7, 0xe9, 0x48, 0x1f, 0xca, 0x13,
-        0xe4, 0x6a, 0x2c, 0xe7, 0xde, 0x8a, 0xb3, 0x35,
-        0x56, 0xa2, 0xa9, 0x4a, 0x1b, 0xf3, 0xad, 0xa9,
-        0x4a, 0x57, 0x65, 0x5c, 0xb3, 0xeb, 0x35, 0xcf,
-        0xdc, 0x6c, 0x96, 0x05, 0x35, 0xde, 0x77, 0x5c,
-        0xd6, 0x30, 0x6f, 0x54, 0xde, 0x3c, 0x35, 0xba,
-        0x4a, 0x23, 0x16, 0x0d, 0xd3, 0x72, 0xf5, 0x9c,
-        0x6c, 0x35, 0x21, 0xc5, 0xd9, 0xf8, 0x6c, 0xc2,
-        0x35, 0xea, 0xf8, 0xcf, 0x2a, 0x97, 0x69, 0xd9,
-        0xd5, 0x90, 0x13, 0x59, 0xca, 0x1d, 0x58, 0xeb,
-        0x6a, 0xd8, 0x9c, 0x0a, 0xf5, 0x21, 0x3c, 0x8f,
-        0x6f, 0xc0, 0x45, 0x6f, 0x9d, 0x72, 0x0a, 0x35,
-        0x55, 0x54, 0x89, 0x9b, 0x2a, 0xec, 0x38, 0x1b,
-        0xac, 0x21, 0x21, 0x9b, 0x0d, 0xad, 0x62, 0x17,
-        0x35, 0x4d, 0x17, 0xef, 0xa4, 0xe2, 0x80, 0xe9,
-        0x6b, 0xf5, 0xbc, 0x51, 0x51, 0xc7, 0xda, 0x68,
-        0xb5, 0xb3, 0xa6, 0x81, 0x94, 0x36, 0x54, 0x53,
-        0x0e, 0xbd, 0x9a, 0x09, 0xab, 0x9f, 0x2d, 0x3d,
-        0x55, 0x57, 0xcf, 0x93, 0x99, 0xa4, 0xe2, 0xce,
-        0xd2, 0xc6, 0x30, 0xcf, 0x09, 0xbd, 0x2d, 0xf3,
-        0xbd, 0xa2, 0x88, 0x0b, 0xb2, 0xcb, 0xc0, 0x31,
-        0xb8, 0x18, 0xff, 0x65, 0xe9, 0xab, 0x22, 0xab,
-        0x7f, 0xe8, 0x50, 0x64, 0x76, 0x16, 0x8b, 0x2d,
-        0xaf, 0x3e, 0x79, 0x86, 0xa2, 0xb0, 0xae, 0xb2,
-        0x45, 0x71, 0x7d, 0xbe, 0xb5, 0x45, 0xb9, 0x54,
-        0x7e, 0xc1, 0x38, 0xe7, 0x4f, 0x0f, 0x74, 0x4e,
-        0xbb, 0xb2, 0x4b, 0xa7, 0x2d, 0x71, 0x50, 0x3a,
-        0x5a, 0xa5, 0x64, 0x5c, 0xa0, 0x94, 0x36, 0x44,
-        0x57, 0xbb, 0x90, 0x0c, 0x26, 0x98, 0xed, 0x1c,
-        0x34, 0x9f, 0x89, 0xb7, 0x02, 0xc9, 0xb9, 0x7c,
-        0xef, 0x71, 0xa9, 0xab, 0xa3, 0x18, 0x27, 0xc5,
-        0x37, 0xca, 0xf5, 0x86, 0x82, 0x18, 0x3f, 0xfc,
-        0xe9, 0x4a, 0x70, 0xea, 0x3b, 0xde, 0x11, 0x38,
-        0x53, 0x4b, 0x78, 0x59, 0xce, 0xb6, 0x16, 0x6a,
-        0x1f, 0x36, 0x26, 0xee, 0xba, 0x2c, 0x57, 0xd2,
-        0x89, 0x65, 0x6f, 0xc8, 0xa4, 0x8e, 0x83, 0x2c,
-        0x90, 0xcc, 0x0c, 0x19, 0xc5, 0xa7, 0x46, 0x81,
-        0xcd, 0x0f, 0xd0, 0x56, 0x18, 0x85, 0x2c, 0x48,
-        0x22, 0x92, 0xff, 0xe7, 0x8c, 0xb0, 0x8a, 0xf9,
-        0x3d, 0x23, 0xa5, 0x18, 0x44, 0x15, 0x39, 0xd3,
-        0xb9, 0xe0, 0x96, 0x20, 0x7a, 0x93, 0x9d, 0x66,
-        0x69, 0x12, 0x0b, 0x4a, 0x43, 0x0d, 0x5a, 0x84,
-        0x40, 0xad, 0x48, 0x71, 0x2f, 0x93, 0x42, 0x18,
-        0x2e, 0x01, 0x36, 0x6e, 0x67, 0x6e, 0x6d, 0x6d,
-        0x23, 0xfd, 0x6b, 0x9f, 0x57, 0xc0, 0xba, 0x3c,
-        0xf4, 0xa2, 0x99, 0xaa, 0x55, 0xaa, 0xa2, 0x69,
-        0x1e, 0x0d, 0x67, 0xf8, 0x74, 0x5d, 0x12, 0xbe,
-        0x63, 0x40, 0xe3, 0x1a, 0xba, 0x87, 0x27, 0xa2,
-        0xa5, 0x7f, 0x57, 0xd6, 0x37, 0x47, 0xaa, 0x3f,
-        0x2e, 0xdd, 0x41, 0x82, 0xfa, 0x50, 0x02, 0x62,
-        0xf0, 0xda, 0xab, 0x00, 0x38, 0x22, 0x73, 0xde,
-        0x90, 0xc9, 0xac, 0x65, 0x8d, 0x41, 0x59, 0x09,
-        0x39, 0x8f, 0xaf, 0xdd, 0x6f, 0xbb, 0x98, 0xdf,
-        0xad, 0x32, 0xa8, 0x3d, 0x5d, 0x19, 0xa1, 0x7e,
-        0x62, 0xbf, 0x69, 0x84, 0x9a, 0x31, 0x8a, 0xdc,
-        0xfe, 0xa5, 0xd1, 0x7e, 0xcc, 0xc6, 0x06, 0x80,
-        0x64, 0x72, 0x08, 0x33, 0xba, 0xbf, 0x0b, 0x2e,
-        0x7a, 0x65, 0x7a, 0x92, 0xd1, 0x7c, 0xe4, 0x40,
-        0xf7, 0x9c, 0x28, 0xf8, 0x85, 0x24, 0x6f, 0xe6,
-        0x29, 0x26, 0x29, 0xd0, 0xbc, 0x02, 0x1b, 0xc4,
-        0x60, 0x9a, 0x7a, 0x1b, 0xb6, 0x79, 0x45, 0x9c,
-        0xf2, 0xd0, 0xe3, 0x67, 0xae, 0x92, 0x28, 0xd0,
-        0x8e, 0x2d, 0x6d, 0x1f, 0x9c, 0x85, 0x8e, 0xaa,
-        0xf5, 0x6c, 0x63, 0x77, 0xa2, 0x2f, 0xf7, 0xc8,
-        0x7a, 0xc4, 0xc0, 0xec, 0x24, 0x96, 0x72, 0x53,
-        0xe4, 0xc9, 0xc6, 0x4b, 0xa7, 0x99, 0xad, 0x0d,
-        0x91, 0xe6, 0x02, 0xfb, 0x2f, 0x07, 0xcc, 0xac,
-        0x7b, 0x46, 0x42, 0x8c, 0x73, 0x3f, 0x2a, 0xf4,
-        0x78, 0x8f, 0x02, 0x27, 0x52, 0xd0, 0x5a, 0x2e,
-        0x6f, 0x81, 0x1d, 0x08, 0xdd, 0x0d, 0xdb, 0x32,
-        0x6f, 0x1d, 0xf4, 0x11, 0xea, 0x37, 0x78, 0x6a,
-        0x56, 0x24, 0x4e, 0x12, 0x00, 0x2a, 0x5d, 0x31,
-        0xed, 0x76, 0xe3, 0x56, 0xdb, 0xab, 0xe0, 0x87,
-        0x6b, 0x6d, 0xb6, 0xb2, 0x7a, 0x3c, 0xa9, 0xa8,
-        0x98, 0x1b, 0x5f, 0x2c, 0x3f, 0x6b, 0xad, 0xdb,
-        0x27, 0xe5, 0x15, 0xe3, 0x89, 0x47, 0xbf, 0x39,
-        0xb9, 0x04, 0x15, 0x8b, 0x86, 0x37, 0xcc, 0xca,
-        0x03, 0x18, 0x0d, 0x58, 0x39, 0x25, 0xb1, 0xea,
-        0xae, 0x3b, 0x02, 0xfe, 0x9f, 0x3b, 0x8e, 0x75,
-        0x3a, 0x99, 0x87, 0xc5, 0x8f, 0x8b, 0xf7, 0x3e,
-        0x44, 0x24, 0x7d, 0xa5, 0x2c, 0x19, 0x27, 0xe9,
-        0x72, 0x32, 0xa0, 0x8a, 0xc6, 0x7c, 0x69, 0xaf,
-        0xb0, 0x2e, 0x42, 0x91, 0x3b, 0xa5, 0x84, 0x85,
-        0x21, 0x3b, 0x6d, 0x0f, 0x13, 0xf8, 0x92, 0x7a,
-        0xb9, 0x96, 0x9a, 0xbe, 0x95, 0x42, 0x81, 0x4c,
-        0xca, 0x98, 0x14, 0x34, 0xcc, 0x16, 0xa8, 0xf3,
-        0xa7, 0x18, 0xbf, 0x3e, 0xc0, 0xa4, 0x1e, 0x0e,
-        0xa1, 0xd4, 0x06, 0xc9, 0x1f, 0xa3, 0x9d, 0x0d,
-        0x76, 0x80, 0x9d, 0x96, 0xc1, 0x44, 0xb8, 0xb2,
-        0xa2, 0x5f, 0xd6, 0x36, 0xae, 0x6e, 0x59, 0x1a,
-        0x54, 0x55, 0x40, 0xbb, 0xbd, 0x4a, 0x6d, 0x53,
-        0x5f, 0xaf, 0x59, 0x5a, 0x23, 0x00, 0xde, 0x02,
-        0xef, 0xfe, 0x55, 0xf8, 0xe9, 0x93, 0x92, 0x15,
-        0x55, 0x75, 0xa3, 0xcb, 0x1c, 0xa0, 0xc3, 0x6c,
-        0xf3, 0xd3, 0x86, 0xd9, 0x26, 0xa1, 0xf6, 0xce,
-        0xb5, 0xc1, 0xbb, 0x8a, 0x27, 0x5b, 0xd4, 0xff,
-        0x6b, 0xac, 0x05, 0x95, 0x66, 0x81, 0x7b, 0x0f,
-        0x08, 0xae, 0xf5, 0x87, 0xed, 0x75, 0x81, 0x5b,
-        0x0c, 0xfe, 0x53, 0x3a, 0x54, 0xac, 0x44, 0xb9,
-        0xe6, 0x1e, 0xd3, 0x64, 0xc7, 0xa5, 0xd3, 0x85,
-        0x32, 0xf6, 0xe0, 0x1e, 0xe9, 0x35, 0x04, 0xa5,
-        0xe3, 0xd9, 0x6e, 0x93, 0xbb, 0x2f, 0x2f, 0x48,
-        0x2f, 0xab, 0x3b, 0xc9, 0x3c, 0xba, 0x80, 0x61,
-        0x7b, 0x1f, 0xa7, 0xea, 0xe0, 0x8b, 0xc3, 0x1e,
-        0xa7, 0xf2, 0x40, 0x67, 0x9c, 0x90, 0x58, 0x3c,
-        0x1d, 0x29, 0x33, 0xf9, 0xa2, 0x3a, 0xb6, 0x2f,
-        0x72, 0x14, 0x62, 0x68, 0xe8, 0xa2, 0x14, 0xc5,
-        0xb1, 0x62, 0xce, 0x54, 0xd2, 0xd2, 0x48, 0xe4,
-        0x6d, 0x64, 0x4f, 0x36, 0x20, 0x95, 0x13, 0x04,
-        0x20, 0x99, 0x6a, 0x99, 0x1d, 0x0f, 0x02, 0x97,
-        0x01, 0xb7, 0x69, 0x8b, 0x16, 0xe6, 0x49, 0xad,
-        0xf1, 0x91, 0x47, 0xeb, 0xd0, 0x53, 0x39, 0x06,
-        0x1f, 0x5b, 0x7b, 0x97, 0x40, 0x60, 0x34, 0x65,
-        0x5d, 0x1b, 0x37, 0xf8, 0x8b, 0xfa, 0xc2, 0xc7,
-        0x14, 0x1a, 0x13, 0xf8, 0x48, 0x1c, 0x10, 0xba,
-        0xa4, 0xc2, 0x72, 0xd4, 0x83, 0x9a, 0xd8, 0xf0,
-        0x77, 0x13, 0x0b, 0x78, 0x67, 0x59, 0xbd, 0x15,
-        0xcb, 0x6a, 0xf1, 0x6e, 0x53, 0x6f, 0x3c, 0x9f,
-        0x53, 0x4d, 0xcb, 0x74, 0xd9, 0xa1, 0xf6, 0x75,
-        0xf2, 0xd7, 0xb3, 0x19, 0x9c, 0x21, 0xfa, 0xae,
-        0x06, 0x46, 0x8f, 0x8e, 0x65, 0x34, 0x45, 0x08,
-        0x8d, 0x02, 0x39, 0x28, 0x28, 0x1c, 0xd0, 0x82,
-        0x3e, 0x65, 0x01, 0x65, 0xb8, 0xce, 0x7a, 0xe2,
-        0xd7, 0x4c, 0x5e, 0x52, 0x6b, 0xe7, 0x5d, 0x99,
-        0xe7, 0xd8, 0x41, 0xc0, 0x18, 0xdc, 0x7f, 0x7c,
-        0xf5, 0xd3, 0xcb, 0xf1, 0x77, 0xaf, 0xce, 0xde,
-        0xbc, 0xf8, 0x09, 0xe8, 0xfc, 0xec, 0xdb, 0x17,
-        0x3f, 0xbe, 0xd4, 0xc6, 0xf5, 0xcf, 0xe0, 0x0a,
-        0xe0, 0x8b, 0xb2, 0x5d, 0x5b, 0x86, 0xe9, 0xe6,
-        0xf3, 0x6b, 0x67, 0x18, 0xbe, 0x7d, 0xc3, 0xf0,
-        0xc3, 0x30, 0xc2, 0x3e, 0x44, 0xf3, 0xf4, 0x03,
-        0x36, 0x0c, 0xef, 0x0c, 0xb3, 0x0f, 0xd2, 0xea,
-        0xf9, 0x19, 0x58, 0x8a, 0xbf, 0x38, 0xc3, 0xac,
-        0xdd, 0xe2, 0xa6, 0xd6, 0xd9, 0x0a, 0x61, 0x60,
-        0x67, 0xad, 0xdd, 0x59, 0x6b, 0x77, 0xd6, 0xda,
-        0x9d, 0xb5, 0x76, 0x67, 0xad, 0xdd, 0x59, 0x6b,
-        0xff, 0x04, 0xd6, 0x5a, 0xfb, 0xe4, 0xf4, 0x6c,
-        0x85, 0x6c, 0x4b, 0x63, 0xee, 0xed, 0x46, 0xf9,
-        0x7a, 0x48, 0xd1, 0x34, 0x50, 0xcd, 0xbf, 0x5e,
-        0x38, 0x8d, 0x4f, 0xa1, 0xfd, 0x7e, 0x46, 0xf6,
-        0xec, 0x6d, 0x43, 0x6e, 0xec, 0x6c, 0xc7, 0x3b,
-        0xdb, 0xf1, 0x47, 0xda, 0x8e, 0xb9, 0x83, 0x0b,
-        0x0a, 0x48, 0xc5, 0x61, 0x48, 0x0c, 0x9f, 0xeb,
-        0x97, 0xd8, 0x14, 0xbe, 0xf6, 0x2d, 0x3a, 0x52,
-        0x5f, 0x58, 0x21, 0x4c, 0x1a, 0xda, 0xfa, 0xa6,
-        0xad, 0x9a, 0x32, 0xb5, 0xd2, 0x3d, 0x92, 0xf7,
-        0x8d, 0x59, 0x38, 0x9c, 0x92, 0xbc, 0xa0, 0xe8,
-        0x08, 0x81, 0x76, 0x50, 0xda, 0x90, 0xe5, 0x1c,
-        0x88, 0x15, 0x0d, 0x8c, 0x00, 0x50, 0x7d, 0xa4,
-        0x50, 0x55, 0xf4, 0xd1, 0x7a, 0x3c, 0x4b, 0xf3,
-        0x55, 0x10, 0xf5, 0x94, 0xec, 0xc6, 0x52, 0xbc,
-        0x0a, 0x57, 0x3c, 0x20, 0xf9, 0x10, 0xe5, 0x4f,
-        0x26, 0x5d, 0xc6, 0x5c, 0x45, 0x9e, 0x59, 0x45,
-        0xeb, 0x4c, 0xa5, 0xa4, 0x17, 0xf8, 0x2e, 0xb2,
-        0x6d, 0xbd, 0xe1, 0x0a, 0xe2, 0x6c, 0x2d, 0x5f,
-        0x39, 0x27, 0xf1, 0xe3, 0x5c, 0xb2, 0x3f, 0xea,
-        0x46, 0xbd, 0x1f, 0x9b, 0x06, 0x18, 0xac, 0x96,
-        0x5e, 0x14, 0x64, 0x97, 0x4b, 0x3f, 0x89, 0xd4,
-        0x9b, 0xb1, 0x6c, 0x05, 0x42, 0x3f, 0xea, 0x01,
-        0x41, 0x90, 0x6b, 0x01, 0x0f, 0x25, 0x1f, 0x7c,
-        0x1f, 0x3b, 0x9d, 0xb2, 0xb2, 0x91, 0x2d, 0xc2,
-        0x59, 0xae, 0x43, 0xc6, 0xd2, 0x7b, 0x15, 0x85,
-        0x3d, 0x4a, 0x68, 0x50, 0xc9, 0x1d, 0xc5, 0x90,
-        0x14, 0x0a, 0xf7, 0x39, 0x4b, 0x32, 0xb3, 0x29,
-        0x5e, 0x3e, 0x96, 0xe3, 0x90, 0x0c, 0xf8, 0x6e,
-        0xc7, 0x3e, 0xec, 0x2f, 0xc7, 0x32, 0x8f, 0x3c,
-        0x4a, 0xe4, 0xd6, 0x12, 0x29, 0x47, 0x75, 0x43,
-        0x5d, 0x92, 0x9a, 0x5a, 0x25, 0x2a, 0xc1, 0x57,
-        0x3c, 0x26, 0x54, 0x46, 0xbb, 0x8a, 0x90, 0xdc,
-        0x04, 0x45, 0x97, 0x44, 0x43, 0x1f, 0xd1, 0xa7,
-        0x7f, 0x75, 0x9f, 0xbe, 0xee, 0x53, 0x69, 0xac,
-        0x4c, 0xf4, 0x1f, 0x11, 0x08, 0x88, 0x8e, 0xfa,
-        0x0b, 0x8c, 0x31, 0x04, 0x93, 0xd6, 0x2e, 0x42,
-        0xf7, 0x3f, 0x32, 0x6c, 0x8f, 0x84, 0xee, 0x23,
-        0x74, 0xbf, 0xed, 0x48, 0xa1, 0xf6, 0x8b, 0x83,
-        0xea, 0xe0, 0x3d, 0x63, 0x8c, 0xd2, 0x5d, 0x53,
-        0x84, 0x31, 0x71, 0xf9, 0xd4, 0xbe, 0xe2, 0x06,
-        0xe9, 0x2e, 0x72, 0x3b, 0xed, 0xee, 0x8f, 0x76,
-        0xf7, 0x47, 0xbb, 0xfb, 0xa3, 0xc6, 0xfb, 0x23,
-        0xc9, 0x12, 0x6a, 0x83, 0xf0, 0xc2, 0xb6, 0x1e,
-        0x5f, 0xd6, 0x8b, 0xf6, 0xf5, 0x31, 0x7a, 0xa9,
-        0x9d, 0x7f, 0x97, 0xf7, 0x55, 0xf2, 0x33, 0xf6,
-        0xe4, 0x55, 0x7e, 0xf5, 0x6f, 0x28, 0xc2, 0xef,
-        0x9e, 0x5d, 0xec, 0x9e, 0x5d, 0xec, 0x9e, 0x5d,
-        0x5c, 0xff, 0x76, 0x4d, 0x2d, 0x5e, 0xc5, 0x2d,
-        0xc4, 0x75, 0xaf, 0xde, 0xaa, 0x91, 0xa4, 0xc3,
-        0xbc, 0x01, 0x53, 0x53, 0x5e, 0x3f, 0x65, 0xa6,
-        0x4e, 0x25, 0xb5, 0xd9, 0xc5, 0x0d, 0xb3, 0xea,
-        0x56, 0xdb, 0x3d, 0x24, 0xd9, 0x3d, 0x24, 0xf9,
-        0xb3, 0x3d, 0x24, 0xb9, 0xdb, 0x1b, 0xca, 0x06,
+        0xa7, 0x5b, 0xc0, 0x65, 0x15, 0x15, 0xe4, 0xd2,
+        0xbb, 0x62, 0x0d, 0x19, 0x65, 0x05, 0xb9, 0xc5,
+        0x57, 0x29, 0xfa, 0x68, 0xf6, 0x4d, 0xa4, 0xcb,
+        0x50, 0x7b, 0x35, 0x47, 0x94, 0xf5, 0x07, 0x45,
+        0x34, 0xda, 0x5b, 0x30, 0xa0, 0xe9, 0x05, 0x30,
+        0x80, 0x4e, 0x6f, 0x34, 0x7e, 0xda, 0xef, 0x43,
+        0xd7, 0xdd, 0x3e, 0x25, 0x7f, 0xa1, 0x13, 0x2c,
+        0x13, 0x8b, 0x0d, 0x9e, 0x40, 0xdc, 0x36, 0xc7,
+        0x74, 0x21, 0x30, 0x5a, 0x19, 0x49, 0xef, 0xf1,
+        0x21, 0x28, 0xed, 0x9b, 0x42, 0x62, 0x87, 0x2a,
+        0x72, 0x26, 0x05, 0xad, 0xcf, 0x90, 0x2c, 0xe1,
+        0x7c, 0xfa, 0x4c, 0x37, 0x64, 0xde, 0x1f, 0x9c,
+        0xa1, 0x1e, 0x3d, 0x8d, 0x50, 0x0d, 0x53, 0x50,
+        0x3a, 0xc0, 0x7a, 0x18, 0x2c, 0x3a, 0xaa, 0x47,
+        0x89, 0x4e, 0x70, 0x84, 0x49, 0x88, 0xba, 0xb4,
+        0x0e, 0x6a, 0x36, 0x19, 0x27, 0x9a, 0x11, 0xf7,
+        0x13, 0x66, 0x3b, 0x3b, 0x7e, 0xfa, 0xe4, 0x70,
+        0x38, 0x7a, 0xfc, 0xa0, 0xea, 0x2a, 0x85, 0x77,
+        0x54, 0x8c, 0x47, 0x8d, 0x1f, 0x95, 0xcc, 0x53,
+        0x78, 0xc9, 0x85, 0x4c, 0x35, 0xfb, 0x14, 0x85,
+        0xdf, 0x2c, 0x29, 0x17, 0x40, 0x8c, 0xd5, 0x57,
+        0xb2, 0x25, 0x75, 0x45, 0x21, 0x52, 0xfa, 0x4c,
+        0x11, 0x06, 0xc7, 0x55, 0x2f, 0xac, 0x45, 0xb0,
+        0x5a, 0x05, 0x2a, 0x90, 0x66, 0x5d, 0x76, 0x09,
+        0xbc, 0x98, 0x4a, 0x44, 0x9e, 0xce, 0x83, 0xec,
+        0x13, 0x8d, 0xba, 0x47, 0xd1, 0x68, 0xeb, 0x7d,
+        0xc8, 0x28, 0xc3, 0x7d, 0xa3, 0x0f, 0x19, 0xe5,
+        0x5f, 0xbc, 0xf5, 0x74, 0xa4, 0xf7, 0xe5, 0x09,
+        0x72, 0x3d, 0x96, 0x8b, 0x60, 0xcd, 0xd9, 0x1a,
+        0x6b, 0xd1, 0x54, 0xa5, 0xad, 0xf9, 0xd6, 0x54,
+        0xa5, 0xcb, 0x32, 0xae, 0xd9, 0xf5, 0xda, 0x67,
+        0x6e, 0x3e, 0xcf, 0x45, 0x83, 0xf7, 0x1d, 0x97,
+        0xb5, 0xcc, 0x1b, 0x95, 0xb7, 0x4f, 0x8d, 0xae,
+        0xd2, 0x8a, 0x45, 0xcb, 0xb4, 0x5c, 0x3e, 0x27,
+        0x3b, 0x4d, 0x48, 0x79, 0x36, 0x3e, 0x99, 0x70,
+        0x8d, 0x3a, 0xfe, 0xb3, 0xca, 0x65, 0x5a, 0x75,
+        0x35, 0xe4, 0x44, 0x96, 0x72, 0x07, 0x36, 0xba,
+        0x1a, 0xb6, 0xa7, 0x42, 0xbd, 0x0f, 0xcf, 0xe3,
+        0x5b, 0x70, 0xd1, 0x5b, 0xa7, 0x9a, 0x42, 0x4d,
+        0x15, 0xd5, 0xe2, 0xa6, 0x0a, 0x7d, 0x67, 0x83,
+        0xb5, 0x24, 0x64, 0xb3, 0xa1, 0xd5, 0xec, 0xa2,
+        0xb6, 0xe9, 0xe2, 0x9d, 0x54, 0x1e, 0x30, 0x7d,
+        0xad, 0x9f, 0x37, 0x2a, 0xf2, 0xad, 0x8d, 0xd6,
+        0x38, 0x6b, 0x1a, 0x48, 0x65, 0x43, 0xb5, 0xe5,
+        0xd0, 0x6b, 0x98, 0xb0, 0xe6, 0xd9, 0xd2, 0x53,
+        0x75, 0xf9, 0x3c, 0x99, 0x49, 0x2a, 0xef, 0x2c,
+        0x6d, 0x0c, 0x0b, 0x9c, 0xd0, 0xdb, 0x32, 0xdf,
+        0x2b, 0x8a, 0xb8, 0x20, 0xbb, 0x0c, 0x1d, 0x83,
+        0x8b, 0xf1, 0x5f, 0x96, 0xbe, 0x2a, 0xb2, 0xfa,
+        0x7b, 0x9f, 0x22, 0xb3, 0xb3, 0x58, 0x6c, 0x79,
+        0xf5, 0xc9, 0x33, 0x14, 0x85, 0x75, 0x95, 0x2d,
+        0x8a, 0xeb, 0xf3, 0xad, 0x2d, 0xca, 0xa5, 0xf2,
+        0x0b, 0xc6, 0x39, 0x7f, 0x7c, 0xa4, 0x73, 0xda,
+        0x55, 0x5d, 0x3a, 0x6d, 0x89, 0x83, 0xd2, 0xd1,
+        0x2a, 0x25, 0xe3, 0x1c, 0xa5, 0xb4, 0x11, 0xba,
+        0xda, 0x45, 0x64, 0x30, 0xc1, 0x6c, 0xe7, 0xa0,
+        0xf9, 0xcc, 0x82, 0x35, 0x48, 0xce, 0xd5, 0x7b,
+        0x8f, 0x0b, 0x5d, 0x1d, 0xc5, 0x38, 0x29, 0xbe,
+        0x51, 0xae, 0x37, 0x14, 0xc4, 0xf8, 0xe1, 0x4f,
+        0x4f, 0x82, 0x53, 0xdf, 0xf1, 0x8e, 0xc0, 0x99,
+        0x5a, 0xc2, 0xcb, 0x72, 0xb6, 0xb5, 0x50, 0x7b,
+        0xbf, 0x35, 0x71, 0xd7, 0x65, 0xb9, 0x92, 0x4e,
+        0x2c, 0x7b, 0x43, 0x2e, 0x75, 0x1c, 0x64, 0x81,
+        0x64, 0x66, 0xc8, 0x29, 0x3e, 0x35, 0x0a, 0x6c,
+        0x53, 0x81, 0xb6, 0xc2, 0x38, 0x62, 0x41, 0x12,
+        0x91, 0xfc, 0x9f, 0x53, 0xc2, 0x2a, 0xe1, 0xf7,
+        0x8c, 0x94, 0x62, 0x10, 0x55, 0xe4, 0x5c, 0xe7,
+        0x82, 0x5b, 0x81, 0xe8, 0x4d, 0x76, 0x9a, 0x95,
+        0x49, 0x2c, 0x28, 0x0d, 0x35, 0x68, 0x11, 0x02,
+        0xb5, 0x22, 0xc3, 0xbd, 0x4c, 0x0a, 0x61, 0xb4,
+        0x02, 0xd8, 0xb8, 0x9d, 0xb9, 0xb5, 0xb5, 0x8d,
+        0xf4, 0xaf, 0x03, 0x5e, 0x01, 0xeb, 0xf2, 0x30,
+        0x88, 0xe7, 0xaa, 0x56, 0xa5, 0x8a, 0xa6, 0x79,
+        0x34, 0x9c, 0xe1, 0xd3, 0x75, 0x49, 0xf8, 0x8e,
+        0x01, 0x8d, 0x6b, 0xe8, 0x1e, 0x1e, 0x79, 0x1d,
+        0xfd, 0xbb, 0xb2, 0xbe, 0x39, 0x52, 0xfd, 0xf3,
+        0xca, 0x1d, 0x24, 0xa8, 0x0f, 0x15, 0x20, 0x06,
+        0xaf, 0x83, 0x1a, 0x80, 0x63, 0x32, 0xe7, 0x8d,
+        0x98, 0xcc, 0x3a, 0xd6, 0x18, 0x94, 0x95, 0x90,
+        0xf3, 0xf8, 0xda, 0xfd, 0x76, 0xcb, 0xf9, 0xdd,
+        0x6a, 0x83, 0xda, 0xd3, 0x95, 0x11, 0xea, 0x27,
+        0xf6, 0x9b, 0x46, 0xa8, 0x99, 0xa0, 0xc8, 0x3d,
+        0xbd, 0x30, 0xda, 0x8f, 0xd9, 0xd8, 0x00, 0x90,
+        0x4c, 0x0e, 0x51, 0x4e, 0xf7, 0x77, 0xe2, 0xbc,
+        0x5f, 0xa5, 0x27, 0x19, 0xcd, 0x47, 0x0e, 0xf4,
+        0xc0, 0x89, 0x82, 0x5f, 0x4a, 0xf2, 0x66, 0x9e,
+        0x62, 0x92, 0x02, 0xcd, 0x2b, 0xb0, 0x45, 0x0c,
+        0xc2, 0x2c, 0xd8, 0xb2, 0xcd, 0x2b, 0xe6, 0x94,
+        0x87, 0x01, 0x3f, 0x73, 0x95, 0x44, 0x81, 0x76,
+        0x6c, 0x69, 0xfb, 0xe0, 0x2c, 0x74, 0x54, 0xad,
+        0x6f, 0x1b, 0xbb, 0x53, 0x7d, 0xb9, 0x47, 0xd6,
+        0x23, 0x06, 0x66, 0x27, 0xb1, 0x94, 0x9b, 0xa2,
+        0x48, 0xb7, 0x41, 0x16, 0xe6, 0xb6, 0x36, 0x44,
+        0x9a, 0x0b, 0xec, 0xbf, 0x02, 0x30, 0xb3, 0xee,
+        0x19, 0x09, 0x31, 0xce, 0xfd, 0xa8, 0xd0, 0xe3,
+        0x3d, 0x0a, 0x9c, 0x48, 0x41, 0xeb, 0xb8, 0xbc,
+        0x05, 0x76, 0x20, 0x74, 0x37, 0xea, 0xca, 0xbc,
+        0x75, 0xd0, 0x47, 0xa4, 0xdf, 0xe0, 0xa9, 0x59,
+        0x91, 0x38, 0x49, 0x00, 0xa8, 0x74, 0x25, 0xb4,
+        0xdb, 0x8d, 0x5b, 0x6d, 0xbf, 0x86, 0x1f, 0x6e,
+        0xb4, 0xd9, 0xca, 0xea, 0xf1, 0xa4, 0xa6, 0x62,
+        0x61, 0x7c, 0xb1, 0xa6, 0x79, 0x67, 0xd3, 0x3d,
+        0xa9, 0xae, 0x18, 0x4f, 0x3c, 0xfa, 0xcd, 0xc9,
+        0x25, 0xa8, 0x59, 0x34, 0xbc, 0x61, 0x56, 0x1e,
+        0xc0, 0x68, 0xc0, 0x2a, 0x28, 0x89, 0x55, 0x6f,
+        0xe3, 0x7b, 0xf0, 0xff, 0xc2, 0x71, 0xac, 0xd3,
+        0xc9, 0x3c, 0x2c, 0x7e, 0x5c, 0xbe, 0xf7, 0x21,
+        0x22, 0x19, 0x28, 0x65, 0xc9, 0x38, 0x49, 0x57,
+        0x93, 0x01, 0xd5, 0x34, 0xe6, 0x4b, 0x7b, 0x85,
+        0x75, 0x19, 0x8a, 0xdc, 0x29, 0x15, 0x2c, 0x0c,
+        0xd9, 0x69, 0x7b, 0x98, 0x87, 0x2f, 0xa9, 0x57,
+        0x1b, 0xa9, 0xe9, 0x5b, 0x29, 0x14, 0xc8, 0xa4,
+        0x8c, 0x49, 0x41, 0xa3, 0x7c, 0x89, 0x3a, 0x7f,
+        0x86, 0xf1, 0xeb, 0x05, 0x26, 0xf5, 0x70, 0x08,
+        0xa5, 0x31, 0x48, 0xfe, 0x04, 0xed, 0x6c, 0xb0,
+        0x03, 0xec, 0xb4, 0x0c, 0x26, 0xc2, 0x95, 0x15,
+        0xfd, 0xb2, 0xb1, 0x71, 0x7d, 0xcb, 0xca, 0xa0,
+        0xea, 0x02, 0xda, 0x1d, 0xd4, 0x6a, 0x9b, 0xfa,
+        0x7a, 0xcd, 0xd2, 0x1a, 0x01, 0xf0, 0x0e, 0x78,
+        0x0f, 0x2e, 0xc3, 0x4f, 0x9f, 0x94, 0xac, 0xa8,
+        0xaa, 0x1b, 0x5d, 0xe6, 0x00, 0x3e, 0xb3, 0xcd,
+        0x8f, 0x1b, 0x66, 0x9b, 0x84, 0xda, 0x5b, 0xd7,
+        0x06, 0x6f, 0x2b, 0x9e, 0x6c, 0x59, 0xff, 0x6f,
+        0xb0, 0x16, 0xd4, 0x9a, 0x05, 0xee, 0x3c, 0x20,
+        0xb8, 0xd6, 0x1f, 0x76, 0xd7, 0x05, 0x6e, 0x30,
+        0xf8, 0x4f, 0xe5, 0x50, 0xb1, 0x12, 0xe5, 0x9a,
+        0x7b, 0x4c, 0x93, 0x1d, 0x97, 0x4e, 0x17, 0xca,
+        0xd8, 0x83, 0x7b, 0xa4, 0xdf, 0x12, 0x94, 0x8e,
+        0x67, 0xbb, 0x4b, 0xee, 0xbe, 0xbc, 0x20, 0xfd,
+        0xbc, 0xe9, 0x24, 0x0b, 0xe8, 0x02, 0x86, 0xed,
+        0x7d, 0x9c, 0xaa, 0x83, 0x2f, 0x0e, 0xfb, 0x9c,
+        0xca, 0x03, 0x9d, 0x71, 0x22, 0x62, 0xf1, 0x74,
+        0xa4, 0xcc, 0xe5, 0x8b, 0xea, 0xc4, 0xbe, 0xc8,
+        0x51, 0x88, 0xa1, 0xa1, 0x8b, 0x52, 0x14, 0x27,
+        0x8a, 0x39, 0x53, 0x49, 0x47, 0x23, 0x51, 0x74,
+        0x91, 0x3d, 0xd9, 0x80, 0x54, 0x4e, 0x10, 0x80,
+        0x64, 0xaa, 0xe5, 0x76, 0x3c, 0x08, 0x5c, 0x06,
+        0xdc, 0xa6, 0x1d, 0x5a, 0x98, 0x47, 0x8d, 0xc6,
+        0x47, 0x1e, 0xad, 0x43, 0x4f, 0xd5, 0x18, 0x7c,
+        0x6c, 0xed, 0x5d, 0x01, 0x81, 0xd1, 0x94, 0xf5,
+        0x6c, 0xdc, 0xe0, 0x2f, 0xea, 0x0b, 0x1f, 0x53,
+        0x68, 0x4c, 0xe0, 0x23, 0x71, 0x40, 0xe8, 0x92,
+        0x0a, 0xab, 0x51, 0x0f, 0x1a, 0x62, 0xc3, 0xdf,
+        0x4e, 0x2c, 0xe0, 0xbd, 0x65, 0xf5, 0x46, 0x2c,
+        0xab, 0xe5, 0xbb, 0x4d, 0xbd, 0xf1, 0xa6, 0x9c,
+        0x6a, 0x5a, 0xa6, 0xcb, 0x8e, 0xb4, 0xaf, 0xd3,
+        0x74, 0x33, 0x9f, 0xc3, 0x19, 0xa2, 0xef, 0x6a,
+        0x60, 0xf4, 0xe8, 0x58, 0x46, 0x53, 0x84, 0xd0,
+        0x28, 0x90, 0x83, 0x82, 0xc2, 0x01, 0x2d, 0xe8,
+        0x53, 0x2e, 0x28, 0xc3, 0x75, 0xde, 0xf7, 0x7e,
+        0xca, 0xe5, 0x25, 0xb5, 0x76, 0xde, 0x95, 0x79,
+        0x8e, 0x1d, 0x04, 0x8c, 0xc1, 0xfd, 0xdb, 0xd7,
+        0xdf, 0xbd, 0x9a, 0x7c, 0xf5, 0xfa, 0xf4, 0xc7,
+        0x97, 0xdf, 0x01, 0x9d, 0x9f, 0x7e, 0xf9, 0xf2,
+        0xdb, 0x57, 0xda, 0xb8, 0xfe, 0x09, 0x5c, 0x01,
+        0xfc, 0xa1, 0x6c, 0xd7, 0x96, 0x61, 0xba, 0xfd,
+        0xfc, 0xda, 0x1b, 0x86, 0x6f, 0xde, 0x30, 0x7c,
+        0x3f, 0x8c, 0xb0, 0xf7, 0xd1, 0x3c, 0x7d, 0x8f,
+        0x0d, 0xc3, 0x7b, 0xc3, 0xec, 0xbd, 0xb4, 0x7a,
+        0x7e, 0x02, 0x96, 0xe2, 0x3f, 0x9c, 0x61, 0xd6,
+        0x6e, 0x71, 0x5d, 0xeb, 0x6c, 0x8d, 0x30, 0xb0,
+        0xb7, 0xd6, 0xee, 0xad, 0xb5, 0x7b, 0x6b, 0xed,
+        0xde, 0x5a, 0xbb, 0xb7, 0xd6, 0xee, 0xad, 0xb5,
+        0x7f, 0x02, 0x6b, 0xad, 0x7d, 0x72, 0x06, 0xb6,
+        0x42, 0xb6, 0xa3, 0x31, 0xf7, 0x66, 0xa3, 0x7c,
+        0xdd, 0xa7, 0x68, 0x1a, 0xa8, 0xe6, 0x5f, 0x2d,
+        0x9c, 0xc6, 0xc7, 0xd0, 0x7e, 0x3f, 0x21, 0x7b,
+        0xf6, 0xae, 0x21, 0x37, 0xf6, 0xb6, 0xe3, 0xbd,
+        0xed, 0xf8, 0x03, 0x6d, 0xc7, 0xdc, 0xc1, 0x39,
+        0x05, 0xa4, 0xe2, 0x30, 0x24, 0x86, 0xcf, 0x0d,
+        0x2a, 0x6c, 0x0a, 0x5f, 0xfb, 0x96, 0x1d, 0xa9,
+        0xcf, 0xad, 0x10, 0x26, 0x2d, 0x6d, 0xa7, 0xa6,
+        0xad, 0x9a, 0x32, 0xb5, 0xd2, 0x7d, 0x92, 0xf7,
+        0x8d, 0x59, 0x38, 0x0a, 0x49, 0x5e, 0x50, 0x74,
+        0x84, 0x40, 0x7d, 0x94, 0x36, 0x64, 0x39, 0x07,
+        0x62, 0x45, 0x03, 0x23, 0x00, 0x54, 0x1f, 0x29,
+        0x54, 0x15, 0x7d, 0xb4, 0x1e, 0xcf, 0xd2, 0x7c,
+        0x95, 0x44, 0x3d, 0x25, 0xbb, 0xb1, 0x14, 0xaf,
+        0xc2, 0x15, 0x0f, 0x49, 0x3e, 0x44, 0xf9, 0x93,
+        0x49, 0x97, 0x31, 0x57, 0x91, 0x67, 0xd6, 0xf1,
+        0x26, 0x57, 0x29, 0xe9, 0x3d, 0x7c, 0x17, 0xd9,
+        0xb5, 0xde, 0x70, 0x89, 0x24, 0xdf, 0xc8, 0x57,
+        0xce, 0x69, 0xf2, 0xb0, 0x90, 0xec, 0x8f, 0xba,
+        0x51, 0xef, 0xc7, 0x42, 0x81, 0xc1, 0x6a, 0xe9,
+        0x45, 0x41, 0x7e, 0xb1, 0x9a, 0xa6, 0xb1, 0x7a,
+        0x33, 0x96, 0xaf, 0x41, 0xe8, 0x47, 0x3d, 0x40,
+        0x88, 0x42, 0x0b, 0x78, 0x28, 0xf9, 0xe0, 0xfb,
+        0xd8, 0x30, 0x64, 0x65, 0x23, 0x5f, 0x46, 0xf3,
+        0x42, 0x87, 0x8c, 0xa5, 0xf7, 0x2a, 0x0a, 0x7b,
+        0x94, 0xd0, 0xa0, 0x92, 0x3b, 0x8a, 0x11, 0x29,
+        0x14, 0xee, 0x73, 0x96, 0x74, 0x6e, 0x53, 0xbc,
+        0x7c, 0x2c, 0xc7, 0x21, 0x19, 0xf0, 0xdd, 0x8e,
+        0x7d, 0xd8, 0x5f, 0x4c, 0x64, 0x1e, 0x79, 0x94,
+        0xc8, 0xad, 0x25, 0x52, 0x8e, 0xea, 0x86, 0xba,
+        0x24, 0x35, 0x75, 0x2a, 0x54, 0x82, 0xaf, 0x78,
+        0x4c, 0xa8, 0x8c, 0x6e, 0x1d, 0x21, 0xb9, 0x09,
+        0x8a, 0x2e, 0x88, 0x86, 0x3e, 0xa0, 0xcf, 0xe9,
+        0xe5, 0x7d, 0x4e, 0x75, 0x9f, 0x4a, 0x63, 0x65,
+        0xa2, 0xff, 0x80, 0x40, 0x40, 0x74, 0xd4, 0x9f,
+        0x63, 0x8c, 0x21, 0x98, 0xb4, 0x6e, 0x19, 0xfa,
+        0xf4, 0x03, 0xc3, 0xf6, 0x48, 0xe8, 0x53, 0x84,
+        0x3e, 0xed, 0x3a, 0x52, 0xa8, 0xfd, 0xe2, 0xa0,
+        0x3e, 0x78, 0xcf, 0x04, 0xa3, 0x74, 0x37, 0x14,
+        0x61, 0x4c, 0x5c, 0x3e, 0xb5, 0x2f, 0xb9, 0x41,
+        0xba, 0x8d, 0xdc, 0x4e, 0xfb, 0xfb, 0xa3, 0xfd,
+        0xfd, 0xd1, 0xfe, 0xfe, 0xa8, 0xf5, 0xfe, 0x48,
+        0xb2, 0x84, 0xc6, 0x20, 0xbc, 0xb0, 0xad, 0x27,
+        0x17, 0xcd, 0xa2, 0x7d, 0x73, 0x8c, 0x5e, 0x6a,
+        0x37, 0xbd, 0xcd, 0xfb, 0x2a, 0xf9, 0x19, 0x7b,
+        0x0a, 0x6a, 0xbf, 0x4e, 0xaf, 0x29, 0xc2, 0xef,
+        0x9f, 0x5d, 0xec, 0x9f, 0x5d, 0xec, 0x9f, 0x5d,
+        0x5c, 0xfd, 0x76, 0x4d, 0x2d, 0x5e, 0xcd, 0x2d,
+        0xc4, 0x55, 0xaf, 0xde, 0xea, 0x91, 0xa4, 0xc3,
+        0xbc, 0x05, 0x53, 0x53, 0xde, 0x3c, 0x65, 0xa6,
+        0x4e, 0x2d, 0xb5, 0xd9, 0xc5, 0x2d, 0xb3, 0xea,
+        0x56, 0xdb, 0x3f, 0x24, 0xd9, 0x3f, 0x24, 0xf9,
+        0xb3, 0x3d, 0x24, 0xb9, 0xdd, 0x1b, 0xca, 0x16,
         0x14, 0x2c, 0x26, 0x20, 0x95, 0x3a, 0xf9, 0x67,
-        0x25, 0x32, 0xa6, 0xb8, 0x53, 0x60, 0x10, 0x75,
-        0x13, 0xe3, 0x02, 0xac, 0xde, 0xe9, 0xbb, 0xfb,
-        0xd3, 0xdd, 0xfd, 0xe9, 0xee, 0xfe, 0xf4, 0xb3,
-        0xb8, 0x3f, 0xdd, 0x5d, 0x9f, 0xee, 0xae, 0x4f,
-        0x77, 0xd7, 0xa7, 0x7f, 0xae, 0xeb, 0x53, 0x32,
-        0x09, 0xa8, 0xeb, 0x51, 0xfb, 0x1c, 0xdd, 0x2b,
-        0x59, 0x3c, 0x28, 0x1a, 0xa0, 0x2d, 0x24, 0x58,
-        0xd4, 0x55, 0xaa, 0x7b, 0x49, 0xc1, 0xca, 0xa4,
-        0x49, 0x44, 0x0f, 0x84, 0x4c, 0x0d, 0x5b, 0xf5,
-        0xe6, 0x5f, 0xa3, 0x37, 0xdf, 0xe9, 0xcd, 0x6f,
-        0x5f, 0xe3, 0x25, 0xcf, 0x35, 0xa2, 0x79, 0x67,
-        0xd3, 0x19, 0xad, 0x43, 0x5d, 0xda, 0x82, 0x07,
-        0x69, 0x99, 0xd9, 0xbd, 0x46, 0xda, 0x46, 0x97,
-        0xbf, 0x4f, 0x6d, 0xfc, 0x5e, 0x14, 0xe9, 0x2f,
-        0xf0, 0x61, 0x54, 0x3d, 0xb4, 0x2b, 0x1d, 0x43,
-        0xeb, 0x34, 0xa6, 0x2b, 0x15, 0xa6, 0x1b, 0xa8,
-        0x3a, 0xbb, 0xeb, 0xf7, 0x2f, 0xe7, 0xfa, 0x1d,
-        0x38, 0x3e, 0xd6, 0x1b, 0x7b, 0x75, 0x81, 0x4c,
-        0x89, 0x6b, 0xb7, 0x7b, 0xde, 0x49, 0x45, 0x23,
-        0xbf, 0xa9, 0x91, 0x5f, 0xdd, 0x48, 0x5e, 0x1d,
-        0xea, 0x7e, 0x3b, 0x06, 0x9a, 0x49, 0xe4, 0x81,
-        0xad, 0xe4, 0x0d, 0xe0, 0xa9, 0xc8, 0x96, 0x09,
-        0x48, 0x9e, 0x59, 0x1e, 0xac, 0x28, 0x21, 0x52,
-        0xd7, 0x3a, 0xa7, 0x0a, 0xc7, 0xa7, 0xca, 0x97,
-        0x54, 0x53, 0x2c, 0x3b, 0xfa, 0x24, 0x6f, 0xd7,
-        0xb6, 0x4b, 0x15, 0x92, 0x47, 0x63, 0x0e, 0x42,
-        0x57, 0x97, 0xfe, 0xb0, 0xae, 0x94, 0xaf, 0xd8,
-        0xf4, 0x79, 0x79, 0x4b, 0x61, 0x82, 0x07, 0x55,
-        0x61, 0x7a, 0x87, 0xb7, 0x12, 0x3c, 0x58, 0xc6,
-        0x31, 0x4d, 0x03, 0x19, 0x32, 0xf3, 0x55, 0x9c,
-        0x0f, 0x9f, 0x92, 0x3a, 0xad, 0x3c, 0x04, 0x74,
-        0xdc, 0x51, 0xe3, 0x2a, 0x40, 0x9a, 0xd6, 0x1c,
-        0x85, 0xbf, 0x35, 0xec, 0xee, 0x18, 0x03, 0x8e,
-        0x0b, 0x93, 0xf4, 0x62, 0x66, 0xb2, 0xe6, 0xce,
-        0x52, 0x4f, 0x65, 0x96, 0xb2, 0x5a, 0xf7, 0xb0,
-        0x4b, 0x8c, 0xec, 0x8d, 0x11, 0x8a, 0xc9, 0xbd,
-        0x41, 0x2b, 0xa1, 0x65, 0xb7, 0x84, 0x4c, 0x99,
-        0x07, 0x78, 0x6a, 0x75, 0x7c, 0x52, 0x27, 0x7a,
-        0x78, 0x18, 0x5d, 0xd2, 0x59, 0xa3, 0x62, 0xba,
-        0x03, 0x4c, 0x0c, 0xab, 0x19, 0xa4, 0x78, 0x0f,
-        0x3b, 0x0d, 0x7e, 0x5f, 0x23, 0xb3, 0x32, 0x18,
-        0x12, 0x03, 0x81, 0x05, 0xc4, 0x38, 0xb0, 0x2a,
-        0x1a, 0x26, 0x85, 0x92, 0x64, 0x7e, 0x45, 0x57,
-        0xbb, 0xa4, 0x48, 0x7a, 0xcb, 0x40, 0x5e, 0x75,
-        0xca, 0x18, 0xa6, 0x2f, 0xff, 0xf9, 0xe6, 0xe5,
-        0x4f, 0x6f, 0xf0, 0xe6, 0xd4, 0x4c, 0x19, 0x4e,
-        0x56, 0xb2, 0x96, 0x61, 0xe5, 0x19, 0x4b, 0x32,
-        0xe6, 0x58, 0x63, 0xe8, 0x58, 0x61, 0x16, 0x61,
-        0x45, 0x16, 0x32, 0xee, 0x38, 0xd0, 0x24, 0x2d,
-        0xaa, 0x64, 0x90, 0x78, 0x17, 0x9c, 0xc4, 0x19,
-        0x6c, 0x0d, 0x13, 0xfe, 0x90, 0x96, 0x9f, 0xe2,
-        0x15, 0xd7, 0x26, 0x23, 0xe9, 0x52, 0x62, 0x30,
-        0x52, 0x74, 0x6c, 0xf2, 0x13, 0x6d, 0x0e, 0x5c,
-        0x68, 0x05, 0x89, 0xc6, 0xd4, 0x44, 0x2d, 0x09,
-        0x72, 0xaf, 0x40, 0xcb, 0x1c, 0xf1, 0xd7, 0x22,
-        0x7c, 0x6b, 0xb3, 0xd8, 0x5e, 0x7e, 0xe3, 0xbc,
-        0x21, 0xf9, 0x4c, 0xad, 0x88, 0x3b, 0x68, 0x28,
-        0x1b, 0x9e, 0x5c, 0x87, 0xe4, 0x4b, 0x3b, 0x8e,
-        0x52, 0x6b, 0x83, 0x6c, 0x9f, 0x61, 0x5a, 0xba,
-        0x93, 0xa6, 0x72, 0xa4, 0x90, 0x0a, 0x08, 0x99,
-        0x07, 0x93, 0x4a, 0xd6, 0x29, 0x9d, 0x95, 0xb4,
-        0x58, 0x05, 0x96, 0x05, 0xc8, 0x2c, 0xcb, 0x4b,
-        0x15, 0x64, 0x56, 0xd2, 0x6c, 0x15, 0xc6, 0xe3,
-        0x0d, 0x79, 0x0a, 0x95, 0x63, 0x7a, 0xab, 0xb5,
-        0x4f, 0x03, 0x6f, 0x4a, 0x36, 0x94, 0x49, 0x9a,
-        0x64, 0x59, 0x77, 0xa6, 0x03, 0x74, 0x66, 0xe6,
-        0x88, 0xc6, 0x46, 0x54, 0x87, 0x57, 0x81, 0x33,
-        0x13, 0x14, 0x9c, 0x3e, 0x06, 0x55, 0xdc, 0x7e,
-        0x20, 0x83, 0x5d, 0x0f, 0xb6, 0xcb, 0x47, 0x35,
-        0x94, 0xd5, 0x15, 0x1b, 0xc0, 0x7c, 0x75, 0x0c,
-        0xbc, 0xe7, 0xb1, 0x65, 0xc9, 0x4e, 0x57, 0x27,
-        0x4b, 0x30, 0x6b, 0xdc, 0xa9, 0xfd, 0x47, 0x5f,
-        0xfd, 0xe1, 0xa9, 0x44, 0x73, 0x0e, 0xac, 0x61,
-        0x2d, 0xac, 0xa1, 0x0d, 0x6b, 0x68, 0xc3, 0x1a,
-        0xba, 0xb0, 0x4a, 0xae, 0x2e, 0xdc, 0xa1, 0x4c,
-        0x39, 0x35, 0xec, 0x68, 0xa2, 0xb4, 0x33, 0xd9,
-        0xf7, 0xe8, 0xb8, 0xb2, 0xc8, 0x52, 0xa7, 0xc9,
-        0xb4, 0x7a, 0xc5, 0x4e, 0x8d, 0x48, 0x83, 0x0b,
-        0xc8, 0xe9, 0x68, 0xe6, 0x52, 0x67, 0xdc, 0xb7,
-        0xe2, 0xd3, 0x27, 0x79, 0x0b, 0xbe, 0x77, 0x0a,
-        0x0b, 0x8d, 0xf9, 0x35, 0xad, 0xd0, 0xfa, 0x75,
-        0xb5, 0x3e, 0x5c, 0x5c, 0x6e, 0x51, 0xeb, 0xf2,
-        0xc3, 0x45, 0xdb, 0x32, 0xcb, 0x19, 0x9a, 0xb4,
-        0x85, 0x10, 0x8c, 0x97, 0x3a, 0x47, 0xb5, 0x5c,
-        0x27, 0xfc, 0x7e, 0x22, 0x74, 0x86, 0x6e, 0xa1,
-        0xb2, 0x5d, 0xc3, 0x54, 0xee, 0xeb, 0xec, 0x3a,
-        0x9c, 0xe8, 0xaf, 0xa5, 0x9a, 0x76, 0xf1, 0x0b,
-        0x87, 0x4c, 0xad, 0x20, 0x7b, 0x6d, 0x01, 0x91,
-        0xe4, 0x6e, 0xcd, 0x08, 0x22, 0xad, 0x38, 0xcd,
-        0x5e, 0x79, 0x47, 0x28, 0x56, 0xa3, 0x20, 0x98,
-        0x5d, 0x67, 0x26, 0x9f, 0xa3, 0xa1, 0xe2, 0x0d,
-        0x80, 0x9a, 0xe1, 0xe2, 0xee, 0xed, 0x88, 0xab,
-        0xbf, 0xb4, 0x4f, 0x6c, 0x88, 0xf0, 0xa1, 0x16,
-        0x20, 0xf6, 0xd6, 0x11, 0xdb, 0x7c, 0xaa, 0x91,
-        0x44, 0xe8, 0xc8, 0x64, 0xf7, 0x2d, 0x85, 0x79,
-        0xc7, 0xf4, 0xd9, 0x51, 0x53, 0x29, 0x69, 0xae,
-        0xa3, 0x7e, 0xb9, 0x1d, 0x41, 0x05, 0x4f, 0x82,
-        0x5c, 0x2e, 0xfc, 0xeb, 0x57, 0x50, 0xab, 0x14,
-        0x10, 0xff, 0xa4, 0xc6, 0x41, 0x45, 0x59, 0xa6,
-        0x6b, 0x1c, 0x54, 0x9c, 0xcf, 0xfb, 0xd8, 0x46,
-        0x5b, 0x8d, 0x0a, 0xd2, 0x89, 0xbe, 0xbf, 0xc5,
-        0x1d, 0x66, 0x1c, 0xc0, 0x14, 0xef, 0xf3, 0x93,
-        0x24, 0x42, 0x1e, 0x9e, 0xb1, 0x73, 0x1d, 0x26,
-        0x7d, 0x18, 0x13, 0xd6, 0x9e, 0x2d, 0x19, 0x15,
-        0x6a, 0xcd, 0x02, 0x8f, 0x8e, 0xb0, 0x72, 0x45,
-        0x3b, 0x0c, 0xe7, 0x9a, 0x2b, 0xe7, 0x94, 0x42,
-        0x55, 0xdd, 0x18, 0x58, 0x31, 0xb1, 0xb5, 0xbb,
-        0x23, 0x25, 0xa6, 0xc8, 0xf2, 0x64, 0x95, 0xf1,
-        0xa1, 0x4e, 0x69, 0x62, 0xf0, 0x08, 0x67, 0x47,
-        0xc9, 0x0c, 0x5d, 0x2b, 0x55, 0x1c, 0xef, 0x86,
-        0x9e, 0x4c, 0x3f, 0x0e, 0x14, 0x0a, 0xac, 0x4c,
-        0x5d, 0x20, 0x4b, 0x96, 0xa8, 0x0b, 0x85, 0x7a,
-        0x0d, 0xbc, 0x09, 0x08, 0x0d, 0xa9, 0x87, 0x96,
+        0x2d, 0x32, 0xa6, 0xd8, 0x2f, 0x31, 0x88, 0xa6,
+        0x89, 0x71, 0x01, 0xd6, 0xef, 0xf4, 0xfd, 0xfd,
+        0xe9, 0xfe, 0xfe, 0x74, 0x7f, 0x7f, 0xfa, 0x49,
+        0xdc, 0x9f, 0xee, 0xaf, 0x4f, 0xf7, 0xd7, 0xa7,
+        0xfb, 0xeb, 0xd3, 0x3f, 0xd7, 0xf5, 0x29, 0x99,
+        0x04, 0xd4, 0xf5, 0xa8, 0x7d, 0x8e, 0x1e, 0x54,
+        0x2c, 0x1e, 0x14, 0x0d, 0xd0, 0x16, 0x12, 0x2c,
+        0xea, 0xaa, 0xd4, 0xbd, 0xa0, 0x60, 0x65, 0xd2,
+        0x24, 0xa2, 0x07, 0x42, 0xa6, 0x86, 0x9d, 0x7a,
+        0x9b, 0x5e, 0xa1, 0xb7, 0xa9, 0xd3, 0xdb, 0xb4,
+        0x7b, 0x85, 0x97, 0x3c, 0x57, 0x88, 0xe6, 0x9d,
+        0x87, 0x73, 0x5a, 0x87, 0xa6, 0xb4, 0x05, 0xf7,
+        0xd2, 0x32, 0xb3, 0x7f, 0x8d, 0xb4, 0x8b, 0x2e,
+        0x7f, 0x97, 0xda, 0xf8, 0x9d, 0x28, 0xd2, 0x7f,
+        0xc0, 0x87, 0x51, 0xcd, 0xd0, 0x2e, 0x75, 0x0c,
+        0x6d, 0xd2, 0x98, 0x2e, 0x55, 0x98, 0xae, 0xa1,
+        0xea, 0xec, 0xaf, 0xdf, 0xff, 0x38, 0xd7, 0xef,
+        0xc0, 0xf1, 0xb1, 0xde, 0x24, 0x68, 0x0a, 0x64,
+        0x4a, 0x5c, 0xbb, 0xdb, 0x0f, 0x4e, 0x6a, 0x1a,
+        0x4d, 0xdb, 0x1a, 0x4d, 0xeb, 0x1b, 0xc9, 0xab,
+        0x43, 0xdd, 0xaf, 0x6f, 0xa0, 0x99, 0x44, 0x1e,
+        0xd8, 0x4a, 0xde, 0x00, 0xbe, 0xf0, 0xf2, 0x55,
+        0x0a, 0x92, 0x67, 0x5e, 0x88, 0x35, 0x25, 0x44,
+        0xea, 0x59, 0xe7, 0x54, 0xe9, 0xf8, 0x54, 0xf9,
+        0x92, 0x1a, 0x8a, 0x65, 0x47, 0x1f, 0xe5, 0xed,
+        0xda, 0x6e, 0xa9, 0x42, 0x8a, 0x78, 0xc2, 0x41,
+        0xe8, 0x9a, 0xd2, 0x1f, 0x36, 0x95, 0xf2, 0x15,
+        0x9b, 0x3e, 0x2f, 0x6f, 0x28, 0x4c, 0xf0, 0xb0,
+        0x2e, 0x4c, 0xef, 0xe8, 0x46, 0x82, 0x07, 0xcb,
+        0x38, 0xa6, 0x99, 0x90, 0x21, 0x33, 0x5f, 0x27,
+        0xc5, 0xe8, 0x31, 0xa9, 0xd3, 0xca, 0x43, 0x40,
+        0xc7, 0x1d, 0x35, 0xae, 0x02, 0xa4, 0x69, 0x2d,
+        0x50, 0xf8, 0xdb, 0xc0, 0xee, 0x4e, 0x30, 0xe0,
+        0xb8, 0x67, 0x92, 0x5e, 0xcc, 0x4d, 0xd6, 0xdc,
+        0x79, 0x16, 0xa8, 0xcc, 0x52, 0x56, 0xeb, 0x3e,
+        0x76, 0x89, 0x91, 0xbd, 0x31, 0x42, 0x31, 0xb9,
+        0x37, 0x68, 0x25, 0xb4, 0xea, 0x96, 0x90, 0x2b,
+        0xf3, 0x00, 0x4f, 0xad, 0x8e, 0x4f, 0xea, 0x44,
+        0x0f, 0x8f, 0xe2, 0x0b, 0x3a, 0x6b, 0x54, 0x4c,
+        0x77, 0x80, 0x89, 0x61, 0x35, 0x45, 0x86, 0xf7,
+        0xb0, 0xa1, 0xf8, 0x6d, 0x83, 0xcc, 0xca, 0x60,
+        0x48, 0x0c, 0x04, 0x16, 0x10, 0xe3, 0xc0, 0xaa,
+        0x68, 0x98, 0x14, 0x4a, 0x92, 0xf9, 0x15, 0x5d,
+        0xed, 0x92, 0x22, 0x19, 0xac, 0x84, 0xbc, 0xea,
+        0x94, 0x31, 0x4c, 0x5f, 0xfd, 0xf3, 0xc7, 0x57,
+        0xdf, 0xfd, 0x88, 0x37, 0xa7, 0x66, 0xca, 0x70,
+        0xb2, 0xd2, 0x8d, 0x0c, 0x2b, 0xcf, 0x58, 0x92,
+        0x31, 0xc7, 0x1a, 0x83, 0x6f, 0x85, 0x59, 0x84,
+        0x15, 0x59, 0xca, 0xb8, 0xe3, 0x40, 0x93, 0xb4,
+        0xa8, 0x92, 0x41, 0xe2, 0x5d, 0x70, 0x9a, 0xe4,
+        0xb0, 0x35, 0x4c, 0xf8, 0x43, 0x5a, 0x7e, 0x8a,
+        0x57, 0xdc, 0x98, 0x8c, 0xa4, 0x47, 0x89, 0xc1,
+        0x48, 0xd1, 0xb1, 0xc9, 0xcf, 0xeb, 0x72, 0xe0,
+        0x42, 0x2b, 0x48, 0x34, 0xa6, 0x26, 0xea, 0x48,
+        0x90, 0x07, 0x25, 0x5a, 0xe6, 0x88, 0xbf, 0x16,
+        0xe1, 0x5b, 0x9b, 0xc5, 0xf6, 0xf2, 0x9b, 0x14,
+        0x2d, 0xc9, 0x67, 0x1a, 0x45, 0xdc, 0x61, 0x4b,
+        0xd9, 0xe8, 0xe4, 0x2a, 0x24, 0x5f, 0xd9, 0x71,
+        0x94, 0x5a, 0x1b, 0x64, 0xfb, 0x1c, 0xd3, 0xd2,
+        0x9d, 0xb4, 0x95, 0x23, 0x85, 0xd4, 0x40, 0xc8,
+        0x03, 0x98, 0x54, 0xb2, 0x4e, 0xe9, 0xac, 0xa4,
+        0xe5, 0x2a, 0xb0, 0x2c, 0x40, 0x66, 0x79, 0x51,
+        0xa9, 0x20, 0xb3, 0x92, 0xe6, 0xeb, 0x28, 0x99,
+        0x6c, 0xc9, 0x53, 0xa8, 0x1a, 0xd3, 0x5b, 0xad,
+        0x7d, 0x26, 0x82, 0x90, 0x6c, 0x28, 0xb3, 0x2c,
+        0xcd, 0xf3, 0xde, 0x5c, 0x07, 0xe8, 0xcc, 0xcd,
+        0x11, 0x8d, 0x8d, 0xa8, 0x0e, 0xaf, 0x02, 0x67,
+        0x26, 0x28, 0x39, 0x7d, 0x0c, 0xeb, 0xb8, 0xfd,
+        0x50, 0x06, 0xbb, 0x1e, 0xee, 0x96, 0x8f, 0x6a,
+        0x24, 0xab, 0x2b, 0x36, 0x80, 0xf9, 0xea, 0x18,
+        0x78, 0x3f, 0x60, 0xcb, 0x92, 0x9d, 0xae, 0x4e,
+        0x96, 0x60, 0xd6, 0xb8, 0x17, 0xf6, 0x1f, 0x03,
+        0xf5, 0x47, 0xa0, 0x12, 0xcd, 0x39, 0xb0, 0x46,
+        0x8d, 0xb0, 0x46, 0x36, 0xac, 0x91, 0x0d, 0x6b,
+        0xe4, 0xc2, 0xaa, 0xb8, 0xba, 0x70, 0x87, 0x32,
+        0xe5, 0xd4, 0xc8, 0xd7, 0x44, 0x69, 0x67, 0xb2,
+        0xef, 0xd3, 0x71, 0x65, 0x91, 0xa5, 0x4e, 0x93,
+        0x69, 0xf5, 0x8a, 0x9d, 0x1a, 0x91, 0x06, 0x17,
+        0x90, 0xd3, 0xd1, 0x2c, 0xa4, 0xce, 0x78, 0x68,
+        0xc5, 0xa7, 0x4f, 0x8b, 0x0e, 0x7c, 0xf7, 0x4b,
+        0x0b, 0x8d, 0xf9, 0x35, 0xad, 0xd0, 0xfa, 0x4d,
+        0xb5, 0xde, 0x9f, 0x5f, 0xec, 0x50, 0xeb, 0xe2,
+        0xfd, 0x79, 0xd7, 0x32, 0xcb, 0x19, 0x9a, 0xb4,
+        0x85, 0x10, 0x8c, 0x97, 0xba, 0x40, 0xb5, 0x5c,
+        0x27, 0xfc, 0x7e, 0xe4, 0xe9, 0x0c, 0xdd, 0x9e,
+        0xca, 0x76, 0x0d, 0x53, 0x79, 0xa8, 0xb3, 0xeb,
+        0x70, 0xa2, 0xbf, 0x8e, 0x6a, 0xda, 0xc3, 0x2f,
+        0x1c, 0x32, 0xb5, 0x86, 0xec, 0xb5, 0x05, 0x44,
+        0x92, 0xbb, 0x35, 0x23, 0x88, 0xb4, 0xe2, 0x34,
+        0x07, 0xd5, 0x1d, 0xa1, 0x58, 0x8d, 0x82, 0x60,
+        0x76, 0x9d, 0x99, 0x7c, 0x8e, 0x86, 0x8a, 0x37,
+        0x00, 0x6a, 0x86, 0xcb, 0xbb, 0xd7, 0xf7, 0x2e,
+        0xff, 0xd2, 0x3d, 0xb1, 0x21, 0xc2, 0x87, 0x46,
+        0x80, 0xd8, 0x9b, 0xef, 0xed, 0xf2, 0xa9, 0x41,
+        0x12, 0xa1, 0x23, 0x93, 0xdd, 0xb7, 0x14, 0xe6,
+        0xbe, 0xe9, 0xd3, 0x57, 0x53, 0x29, 0x69, 0xce,
+        0x57, 0xbf, 0xdc, 0x8c, 0xa0, 0x82, 0x27, 0x41,
+        0x21, 0x17, 0xfe, 0xcd, 0x6b, 0xa8, 0x55, 0x09,
+        0x88, 0x7f, 0xd2, 0xe0, 0xa0, 0xa2, 0x2c, 0xd3,
+        0x0d, 0x0e, 0x2a, 0xce, 0xe7, 0x43, 0x6c, 0xa3,
+        0xad, 0x46, 0x25, 0xe9, 0x44, 0xdf, 0xdf, 0xe2,
+        0x0e, 0x33, 0x0e, 0x60, 0x8a, 0xf7, 0x4d, 0xd3,
+        0x34, 0x46, 0x1e, 0x9e, 0xb3, 0x73, 0x1d, 0x26,
+        0x7d, 0x98, 0x10, 0xd6, 0x81, 0x2d, 0x19, 0x95,
+        0x6a, 0xcd, 0x45, 0x40, 0x47, 0x58, 0xb5, 0xa2,
+        0x1d, 0x86, 0x73, 0xc3, 0x95, 0x0b, 0x4a, 0xa1,
+        0xaa, 0x6e, 0x0c, 0xac, 0x98, 0xd8, 0xda, 0xdd,
+        0x91, 0x12, 0x53, 0xe4, 0x45, 0xba, 0xce, 0xf9,
+        0x50, 0xa7, 0x34, 0x31, 0x78, 0x84, 0xb3, 0xa3,
+        0x64, 0x8e, 0xae, 0x95, 0x2a, 0x8e, 0x77, 0x4b,
+        0x4f, 0xa6, 0x1f, 0x07, 0x0a, 0x05, 0x56, 0xa6,
+        0x2e, 0x90, 0x25, 0x4b, 0xd4, 0x3d, 0x85, 0x7a,
+        0x03, 0xbc, 0x19, 0x08, 0x0d, 0x59, 0x80, 0x96,
         0x35, 0x0c, 0xcf, 0x0b, 0xa7, 0xb1, 0xd2, 0xca,
-        0xea, 0x86, 0xba, 0x0a, 0xf3, 0xc9, 0xa2, 0x34,
-        0x61, 0x6c, 0x5f, 0x1e, 0xb3, 0xb3, 0x68, 0x5d,
-        0x53, 0x0e, 0x58, 0x5c, 0xf4, 0x21, 0x72, 0x8e,
-        0x6b, 0x8e, 0x43, 0x7d, 0xf2, 0xd9, 0x78, 0x88,
-        0x5c, 0xe5, 0x3e, 0xc5, 0x9f, 0x23, 0xcf, 0x0f,
-        0x40, 0x54, 0x89, 0xbc, 0x38, 0xa8, 0xab, 0x32,
-        0x57, 0xd9, 0x6a, 0x75, 0xd2, 0x8e, 0x32, 0x49,
-        0xe2, 0xb9, 0x58, 0x9a, 0x79, 0x5a, 0x0f, 0xb6,
-        0x62, 0x2e, 0xbd, 0x55, 0x39, 0x1b, 0x86, 0x7e,
-        0x04, 0x51, 0x61, 0x42, 0x2b, 0x1b, 0xd0, 0x0a,
-        0x9b, 0x67, 0x6b, 0x67, 0x84, 0x7b, 0xbf, 0x92,
-        0xb7, 0x6f, 0x4f, 0xed, 0xbb, 0x48, 0x66, 0x27,
-        0x74, 0x17, 0x69, 0xd5, 0xd0, 0xd7, 0x61, 0x4e,
-        0xa5, 0x0f, 0x9b, 0x13, 0x07, 0x0e, 0xcc, 0x88,
-        0x7d, 0x03, 0xeb, 0x40, 0xa0, 0x4d, 0xa6, 0x0b,
-        0x75, 0x4b, 0x9b, 0xc0, 0xa5, 0xe3, 0xe1, 0x18,
-        0x28, 0x98, 0xac, 0xd1, 0xdd, 0x02, 0xb3, 0x7a,
-        0x3b, 0x7a, 0xe7, 0x2a, 0xd1, 0xb4, 0x2c, 0x4a,
-        0x06, 0xf9, 0xaa, 0x86, 0x37, 0x61, 0x06, 0xe8,
-        0xaf, 0xea, 0x39, 0x92, 0x2d, 0xac, 0x48, 0x1c,
-        0xf1, 0x0c, 0x60, 0x84, 0xdf, 0x0e, 0xde, 0x75,
-        0x24, 0xee, 0x6f, 0x87, 0xef, 0x3a, 0x9a, 0x51,
-        0xe1, 0xa1, 0x3b, 0x1c, 0xa8, 0x53, 0xf7, 0x0f,
-        0x81, 0xb3, 0x4f, 0x48, 0xdc, 0x1a, 0x0e, 0xba,
-        0xff, 0xba, 0x9e, 0x9a, 0x86, 0x7b, 0xad, 0x9e,
-        0x24, 0x4b, 0xb4, 0xe1, 0x37, 0xd7, 0xa9, 0xba,
-        0xdc, 0x79, 0x4d, 0xee, 0xfb, 0xdb, 0x68, 0xa0,
-        0xf6, 0x82, 0x1b, 0xde, 0x09, 0x0c, 0x73, 0x91,
-        0x18, 0xde, 0x09, 0x90, 0x5c, 0xd0, 0xbd, 0x8d,
-        0xd6, 0x5f, 0xcf, 0x02, 0x72, 0x8b, 0x27, 0x17,
-        0x55, 0x54, 0x16, 0x99, 0x65, 0xa2, 0xf1, 0xa1,
-        0xc7, 0x97, 0x90, 0xa5, 0x6e, 0x14, 0x54, 0x66,
-        0x9c, 0x84, 0xa5, 0xbb, 0xe9, 0xc5, 0x37, 0x46,
-        0x5e, 0xad, 0x45, 0xa9, 0xdf, 0xc4, 0xec, 0xc5,
-        0xb1, 0x86, 0xd0, 0x54, 0xab, 0x5f, 0x0f, 0xbf,
-        0x3c, 0x3b, 0xd6, 0x9d, 0x8a, 0xc6, 0x9c, 0x0d,
-        0x52, 0xba, 0x2f, 0xfc, 0x1f, 0x5b, 0x5f, 0xf8,
-        0xf6, 0xcf, 0x1d, 0x69, 0xa7, 0x50, 0x0f, 0x56,
-        0x01, 0xe6, 0xef, 0x75, 0x1a, 0x9c, 0xd3, 0xdc,
-        0xa1, 0x13, 0x2e, 0x2e, 0xeb, 0x54, 0xc4, 0x81,
-        0x97, 0x76, 0x67, 0x61, 0x10, 0xa9, 0xd7, 0x0a,
-        0x19, 0xdb, 0x0d, 0xf1, 0x8a, 0x6b, 0xda, 0xc7,
+        0x9a, 0x86, 0xba, 0x8e, 0x8a, 0xd9, 0xb2, 0x32,
+        0x61, 0x6c, 0x5f, 0x9e, 0xb0, 0xb3, 0x68, 0x53,
+        0x53, 0x0e, 0x58, 0x5c, 0xf6, 0x21, 0x72, 0x8e,
+        0x6b, 0x8e, 0x43, 0x7d, 0xf2, 0xc9, 0x78, 0x88,
+        0x5c, 0xe6, 0x3e, 0xc5, 0x9f, 0xe3, 0x60, 0x2a,
+        0x40, 0x54, 0x89, 0x83, 0x44, 0x34, 0x55, 0x59,
+        0xa8, 0x6c, 0xb5, 0x3a, 0x69, 0x47, 0x95, 0x24,
+        0xf1, 0x5c, 0xac, 0xcc, 0x3c, 0xad, 0x07, 0x5b,
+        0x31, 0x57, 0xc1, 0xba, 0x9a, 0x0d, 0x43, 0x3f,
+        0x82, 0xa8, 0x31, 0xa1, 0x55, 0x0d, 0x68, 0xa5,
+        0xcd, 0xb3, 0xb3, 0x33, 0xc2, 0x9d, 0x5f, 0xc9,
+        0xdb, 0xb7, 0xa7, 0xf6, 0x5d, 0x24, 0xb3, 0x13,
+        0xba, 0x8b, 0xb4, 0x6a, 0xe8, 0xeb, 0x30, 0xa7,
+        0xd2, 0xfb, 0xed, 0x89, 0x03, 0x07, 0x66, 0xc4,
+        0xbe, 0x81, 0x75, 0x20, 0xd0, 0x26, 0xd3, 0x85,
+        0xba, 0xa5, 0x4d, 0xe0, 0xd2, 0xf1, 0x70, 0x02,
+        0x14, 0x4c, 0xd6, 0xe8, 0x5e, 0x89, 0x59, 0xfd,
+        0x32, 0x7e, 0xeb, 0x2a, 0xd1, 0xb4, 0x2c, 0x4a,
+        0x06, 0xf9, 0x6b, 0x03, 0x6f, 0xc2, 0x0c, 0xd0,
+        0x7f, 0x6d, 0xe6, 0x48, 0xb6, 0xb0, 0x22, 0x71,
+        0xc4, 0x33, 0x80, 0x11, 0xfe, 0x65, 0xf8, 0xd6,
+        0x97, 0xb8, 0xff, 0x32, 0x7a, 0xeb, 0x6b, 0x46,
+        0x85, 0x87, 0xee, 0x68, 0xa8, 0x4e, 0xdd, 0xdf,
+        0x3d, 0x9c, 0x7d, 0x42, 0xe2, 0xc6, 0x70, 0xd0,
+        0xfd, 0x37, 0xf5, 0xd4, 0x36, 0xdc, 0x2b, 0xf5,
+        0x24, 0x59, 0xa2, 0x0d, 0xbf, 0xbd, 0x4e, 0xdd,
+        0xe5, 0xce, 0x1b, 0x72, 0xdf, 0xdf, 0x45, 0x03,
+        0xb5, 0x17, 0xdc, 0xf0, 0x4e, 0x60, 0x98, 0xcb,
+        0xd4, 0xf0, 0x4e, 0x80, 0xe4, 0x82, 0xee, 0x6f,
+        0xb5, 0xfe, 0x7a, 0x2a, 0xc8, 0x2d, 0x9e, 0x5c,
+        0x54, 0x51, 0x59, 0x64, 0x96, 0x89, 0xc6, 0x87,
+        0x3e, 0x5f, 0x42, 0x56, 0xba, 0x51, 0x50, 0x99,
+        0x71, 0x12, 0x96, 0xee, 0xa6, 0xf7, 0xbe, 0x30,
+        0xf2, 0x6a, 0x23, 0x4a, 0x83, 0x36, 0x66, 0xef,
+        0x3d, 0xd7, 0x10, 0xda, 0x6a, 0x0d, 0x9a, 0xe1,
+        0x57, 0x67, 0xc7, 0xba, 0x53, 0xd1, 0x98, 0xb3,
+        0x41, 0x4a, 0xf7, 0x85, 0xff, 0x63, 0xeb, 0x0b,
+        0xdf, 0xfe, 0xb9, 0x23, 0xf5, 0x4b, 0xf5, 0x60,
+        0x15, 0x60, 0xfe, 0xde, 0x64, 0xe2, 0x8c, 0xe6,
+        0x0e, 0x9d, 0x70, 0x71, 0x59, 0x43, 0x2f, 0x11,
+        0x41, 0xd6, 0x9b, 0x47, 0x22, 0x56, 0xaf, 0x15,
+        0x72, 0xb6, 0x1b, 0xe2, 0x15, 0x57, 0x38, 0xc0,
         0x7a, 0x48, 0x62, 0x78, 0x2c, 0x6b, 0xfd, 0x44,
-        0xfd, 0xef, 0xc0, 0x58, 0xb6, 0x88, 0x56, 0x40,
-        0x12, 0x2f, 0xe1, 0xed, 0x6c, 0xda, 0x19, 0x48,
-        0x92, 0x67, 0xf2, 0xba, 0x49, 0x33, 0x65, 0xf1,
-        0x0d, 0xb7, 0xee, 0x8b, 0xd1, 0x01, 0x5d, 0x5f,
-        0x4b, 0x8e, 0x5b, 0xe2, 0x10, 0xbc, 0xd6, 0x74,
-        0x58, 0xb2, 0xc9, 0x43, 0x6f, 0x0d, 0xde, 0x7d,
-        0xce, 0x31, 0x6a, 0x13, 0xfb, 0xd6, 0x84, 0xa3,
-        0x69, 0x9b, 0x79, 0xdc, 0xeb, 0xad, 0x28, 0x5c,
-        0xa5, 0xc8, 0x1b, 0xca, 0xd4, 0x7e, 0x56, 0x1e,
-        0x58, 0xc3, 0x02, 0xcb, 0x44, 0x4d, 0xd7, 0x75,
-        0xd5, 0x84, 0xae, 0x9b, 0xf9, 0xfa, 0x22, 0xf6,
-        0x75, 0x45, 0xe3, 0xca, 0x92, 0x8d, 0xd5, 0x75,
-        0x79, 0xc6, 0x28, 0x67, 0x4e, 0x0b, 0x2f, 0xb6,
-        0xba, 0x02, 0x5f, 0x65, 0x10, 0x61, 0xdb, 0x92,
-        0x45, 0x47, 0xe0, 0x0d, 0x19, 0x16, 0x5e, 0xb8,
-        0x19, 0xc5, 0xed, 0x95, 0x20, 0x1e, 0x3d, 0xc6,
-        0xfc, 0x47, 0xa7, 0x9c, 0xe1, 0xc0, 0xe1, 0xdd,
-        0x4f, 0x8a, 0xfd, 0x56, 0x6c, 0x7e, 0x86, 0x30,
-        0xa1, 0xa3, 0x87, 0xf2, 0x5e, 0x6c, 0x05, 0x01,
-        0xef, 0x9a, 0x85, 0xfa, 0xa6, 0x96, 0xe2, 0x94,
-        0xaf, 0xa0, 0x35, 0xc4, 0x8e, 0xf2, 0xda, 0xd0,
-        0x58, 0x76, 0xca, 0xbf, 0x4e, 0x9c, 0x54, 0x51,
-        0xf6, 0x45, 0x35, 0x1f, 0x87, 0x55, 0x52, 0x87,
-        0xb5, 0xe8, 0x76, 0x6d, 0x58, 0x8b, 0xaa, 0xec,
-        0x0d, 0x8e, 0x65, 0xae, 0x20, 0x9f, 0xe8, 0xdb,
-        0xeb, 0x02, 0x1c, 0x9b, 0x20, 0xe8, 0xd3, 0x06,
-        0xa6, 0xa2, 0x38, 0x5e, 0xb4, 0x96, 0xaa, 0x23,
-        0x19, 0xb4, 0x3f, 0x4e, 0x73, 0xa4, 0x37, 0x56,
-        0xbb, 0x6c, 0x74, 0x3e, 0xd7, 0x47, 0x33, 0xfe,
-        0xdb, 0xb7, 0xa5, 0x1a, 0x4d, 0x68, 0xb6, 0xe4,
-        0x62, 0x44, 0x0f, 0xf9, 0xa1, 0xe5, 0xaa, 0x05,
-        0x6e, 0xd6, 0x4b, 0x23, 0x77, 0x42, 0x3b, 0xbb,
-        0x1a, 0x9c, 0x99, 0x64, 0x11, 0xc0, 0x6c, 0x30,
-        0x8e, 0x7c, 0x8a, 0xe9, 0x97, 0x0a, 0x02, 0x2b,
-        0xa3, 0x59, 0x40, 0x62, 0xe9, 0x5d, 0xb4, 0x68,
-        0x2c, 0x68, 0x82, 0xc7, 0xec, 0x6f, 0x2e, 0x78,
-        0x38, 0x1d, 0x9f, 0xd8, 0xdd, 0x17, 0xf2, 0xd0,
-        0xdb, 0xa6, 0x27, 0x69, 0x12, 0x39, 0xf9, 0x64,
-        0x31, 0x0a, 0x6f, 0x2e, 0x2d, 0xde, 0xe2, 0x0b,
-        0x4e, 0x5b, 0xda, 0x97, 0x57, 0x1c, 0xaa, 0xd1,
-        0x5e, 0x09, 0x9d, 0x2b, 0xf2, 0x46, 0xcb, 0xdf,
-        0xe5, 0xbd, 0x43, 0x5b, 0x3d, 0x1e, 0xfa, 0xc2,
-        0xb5, 0x61, 0x69, 0x2e, 0xe1, 0x03, 0x74, 0xa6,
-        0xe4, 0x5a, 0x5c, 0x57, 0x37, 0x37, 0x5c, 0x7e,
-        0xb9, 0xa2, 0xbb, 0x2d, 0x9d, 0xbd, 0x8b, 0xd3,
-        0xef, 0x28, 0xbd, 0x13, 0x0d, 0xc2, 0xff, 0x8b,
-        0x33, 0xd8, 0x09, 0x01, 0xdc, 0x1f, 0x5d, 0x84,
-        0x42, 0x4f, 0x5e, 0xbe, 0x47, 0xcf, 0x36, 0x29,
-        0xac, 0x65, 0x4a, 0xf6, 0x44, 0xe5, 0x14, 0x8e,
-        0x76, 0xcc, 0xdb, 0x39, 0xd5, 0xb5, 0xb2, 0x64,
-        0x9d, 0x4e, 0x8c, 0xba, 0xcb, 0x89, 0x3b, 0xfd,
-        0x30, 0x46, 0x14, 0xa2, 0x4b, 0xf8, 0x8f, 0xb2,
-        0x65, 0xe3, 0x33, 0x49, 0x3e, 0xe0, 0x8e, 0x39,
-        0x1b, 0x18, 0x7d, 0x05, 0xdc, 0x8a, 0x08, 0x88,
-        0x00, 0x8b, 0xe8, 0xd1, 0x22, 0xdd, 0x08, 0xe0,
-        0xfb, 0xc3, 0x75, 0x4a, 0x86, 0x49, 0x29, 0x47,
-        0x5a, 0x28, 0x16, 0xd5, 0xed, 0xec, 0x18, 0xcb,
-        0xde, 0x12, 0x89, 0x10, 0xb4, 0x16, 0xbd, 0xda,
-        0xfc, 0x1f, 0x10, 0x1c, 0xce, 0x40, 0x61, 0xef,
-        0x28, 0x10, 0xed, 0x0e, 0xd6, 0x13, 0x56, 0x3d,
-        0x7a, 0xc8, 0x59, 0xae, 0x27, 0xde, 0xed, 0x4c,
-        0x0f, 0xca, 0xf4, 0x50, 0x7b, 0xf9, 0x1f, 0x46,
-        0x51, 0xd3, 0x43, 0x19, 0x53, 0xde, 0xf0, 0x5a,
-        0xc6, 0x54, 0xaa, 0x7c, 0x32, 0x63, 0x17, 0x37,
-        0x78, 0x76, 0xb8, 0xd5, 0x1a, 0x5d, 0x16, 0x16,
-        0x5e, 0x94, 0x34, 0x61, 0x6d, 0xca, 0x1b, 0xb0,
-        0x36, 0x95, 0x2a, 0xb1, 0xb6, 0x8b, 0x1b, 0xb0,
-        0x76, 0xab, 0x7d, 0x01, 0x6f, 0x6b, 0x68, 0x40,
-        0x0d, 0x8f, 0x33, 0x4c, 0x79, 0x3d, 0xae, 0xa6,
-        0x4e, 0x25, 0xba, 0x76, 0x71, 0x03, 0xc6, 0x6e,
-        0xb5, 0xab, 0x91, 0xae, 0x7f, 0x52, 0xa5, 0x8b,
-        0xaf, 0x40, 0xb9, 0xf6, 0x71, 0x95, 0x55, 0x7a,
-        0x15, 0xc2, 0x05, 0x0f, 0xa2, 0x87, 0x67, 0x9e,
-        0xba, 0x27, 0xa3, 0xe2, 0xb5, 0x8d, 0x9c, 0xd5,
-        0x56, 0xc8, 0x6d, 0x6d, 0x69, 0x78, 0x3a, 0xbb,
-        0x77, 0x80, 0xfb, 0xf2, 0xeb, 0xf0, 0x3a, 0x56,
-        0x34, 0x8b, 0x1f, 0x92, 0x7c, 0xaa, 0xff, 0xac,
-        0x7c, 0xdc, 0x63, 0x8a, 0x3b, 0x05, 0x5e, 0x59,
-        0xf7, 0xcc, 0xc7, 0x05, 0x58, 0xc9, 0xf3, 0x1a,
-        0xb0, 0xb3, 0xf8, 0x1e, 0xc1, 0xd5, 0x7f, 0x56,
-        0x62, 0x67, 0x8a, 0x3b, 0x05, 0x9e, 0x58, 0x87,
-        0x9d, 0x0b, 0xb0, 0x92, 0xb7, 0x7d, 0x26, 0x8f,
-        0x82, 0x2c, 0x2e, 0xa6, 0x67, 0xaa, 0xfe, 0x75,
-        0x89, 0x29, 0xee, 0x14, 0x38, 0x5c, 0x1d, 0x5e,
-        0x2e, 0xc0, 0x4a, 0x56, 0x75, 0x15, 0x76, 0xda,
-        0x5b, 0x4d, 0xff, 0x55, 0x8f, 0x9b, 0x7a, 0xc7,
-        0x65, 0x31, 0xb2, 0x46, 0xcc, 0xb4, 0xd7, 0x5b,
-        0x15, 0x4b, 0xfa, 0x4c, 0xed, 0xb6, 0x45, 0xb3,
-        0xed, 0xce, 0x6e, 0xfb, 0x27, 0xb3, 0xdb, 0xbe,
-        0x92, 0xb1, 0x5d, 0xf0, 0xac, 0x44, 0x91, 0x57,
-        0x9a, 0x17, 0x4d, 0xc6, 0xd5, 0x25, 0xbe, 0x6d,
-        0x8a, 0xbc, 0xcb, 0x64, 0x4d, 0xaf, 0x3b, 0xa6,
-        0x89, 0x72, 0x5f, 0xe4, 0x7a, 0x19, 0x6c, 0xad,
-        0xa0, 0x63, 0xa5, 0x1c, 0x9d, 0x2c, 0x28, 0xb7,
-        0x68, 0xc6, 0x20, 0xb5, 0xe3, 0x90, 0xc6, 0x45,
-        0xc5, 0x09, 0x48, 0x83, 0x88, 0xdf, 0x18, 0x81,
-        0x64, 0xaf, 0x33, 0x21, 0x13, 0x34, 0xfb, 0x89,
-        0x08, 0x25, 0x56, 0x0e, 0xd0, 0x81, 0x09, 0x9d,
+        0xfd, 0xef, 0xc8, 0x58, 0xb6, 0x88, 0x56, 0x40,
+        0x12, 0xaf, 0xe0, 0xed, 0x6c, 0xda, 0x39, 0x48,
+        0x92, 0xa7, 0xf2, 0xba, 0x49, 0x33, 0x65, 0xef,
+        0x0b, 0x6e, 0x3d, 0xf0, 0xc6, 0x47, 0x74, 0x7d,
+        0x2d, 0x39, 0x6e, 0x85, 0x43, 0xf0, 0x5a, 0xd3,
+        0x61, 0xc9, 0x26, 0x0f, 0xbd, 0x35, 0x78, 0xf7,
+        0x39, 0xc7, 0xa8, 0x4d, 0xec, 0x3b, 0x13, 0x8e,
+        0xa6, 0x6d, 0xe6, 0x71, 0x6f, 0x76, 0xa2, 0x70,
+        0x95, 0x22, 0x6f, 0x24, 0x53, 0xfb, 0x59, 0x79,
+        0x60, 0x0d, 0x0b, 0xac, 0x12, 0x35, 0x5d, 0xd7,
+        0xd5, 0x13, 0xba, 0x6e, 0x36, 0xd5, 0x17, 0xb1,
+        0x6f, 0x6a, 0x1a, 0xd7, 0x96, 0x6c, 0xad, 0xae,
+        0xab, 0x33, 0x46, 0x39, 0x73, 0x3a, 0x78, 0xb1,
+        0xd5, 0xf3, 0xf0, 0x55, 0x06, 0x11, 0xb6, 0x2d,
+        0x59, 0xf8, 0x1e, 0xde, 0x90, 0x61, 0xe1, 0xb9,
+        0x9b, 0x51, 0xdc, 0x5e, 0x09, 0xe2, 0xd1, 0x13,
+        0xcc, 0x7f, 0xf4, 0x82, 0x33, 0x1c, 0x38, 0xbc,
+        0xfb, 0x51, 0xb9, 0xdf, 0x9a, 0xcd, 0xcf, 0x10,
+        0x66, 0x74, 0xf4, 0x50, 0xde, 0x8b, 0x9d, 0x20,
+        0xe0, 0x5d, 0xb3, 0xa7, 0xbe, 0xa9, 0xa5, 0x78,
+        0xc1, 0x57, 0xd0, 0x1a, 0xa2, 0xaf, 0xbc, 0x36,
+        0x34, 0x96, 0x7e, 0xf5, 0xd7, 0x99, 0x93, 0x2a,
+        0xca, 0xbe, 0xa8, 0xe6, 0xe3, 0xb0, 0x4e, 0xea,
+        0xb0, 0x16, 0xdd, 0xae, 0x0d, 0x6b, 0x51, 0x97,
+        0xbd, 0xc1, 0xb1, 0xcc, 0x95, 0xe4, 0x13, 0x7d,
+        0x7b, 0x5d, 0x82, 0x63, 0x13, 0x04, 0x7d, 0xda,
+        0xc2, 0x54, 0x94, 0xc7, 0x8b, 0xd6, 0x52, 0x75,
+        0x24, 0x83, 0xf6, 0xc7, 0x69, 0x8e, 0xf4, 0xc6,
+        0xea, 0x56, 0x8d, 0xce, 0x67, 0xfa, 0x68, 0xc6,
+        0x7f, 0x07, 0xb6, 0x54, 0xa3, 0x09, 0xcd, 0x96,
+        0x5c, 0x8c, 0xe8, 0x21, 0x3f, 0x74, 0x5c, 0xb5,
+        0xc0, 0xcd, 0x7a, 0x69, 0xe4, 0x4e, 0x68, 0x67,
+        0x57, 0x83, 0x33, 0x93, 0x2c, 0x02, 0x98, 0x0d,
+        0xc6, 0x91, 0x4f, 0x31, 0xfd, 0x52, 0x49, 0x60,
+        0x65, 0x34, 0x4b, 0x48, 0xac, 0x82, 0xf3, 0x0e,
+        0x8d, 0x05, 0x4d, 0xf0, 0x98, 0xfd, 0xcd, 0x05,
+        0x0f, 0xa7, 0xe3, 0x23, 0xbb, 0xfb, 0x52, 0x1e,
+        0x7a, 0xdb, 0xf4, 0x24, 0x4d, 0x22, 0x27, 0x1f,
+        0x2d, 0x46, 0xe1, 0xf5, 0xa5, 0xc5, 0x1b, 0x7c,
+        0xc1, 0x69, 0x4b, 0xfb, 0xf2, 0x8a, 0x43, 0x35,
+        0x3a, 0xa8, 0xa0, 0x73, 0x49, 0xde, 0x68, 0xf9,
+        0xbb, 0xbc, 0x77, 0xe8, 0xaa, 0xc7, 0x43, 0x7f,
+        0x70, 0x6d, 0x58, 0x9a, 0x4b, 0xf8, 0x00, 0x9d,
+        0x2b, 0xb9, 0x16, 0xd7, 0xd5, 0xcd, 0x0d, 0x57,
+        0x5c, 0xac, 0xe9, 0x6e, 0x4b, 0x67, 0xef, 0xe2,
+        0xf4, 0x3b, 0x4a, 0xef, 0x44, 0x83, 0xf0, 0xff,
+        0xe1, 0x0c, 0xfa, 0x11, 0x80, 0xfb, 0xbd, 0x87,
+        0x50, 0xe8, 0xc9, 0xcb, 0xd7, 0xe8, 0xd9, 0x26,
+        0x85, 0xb5, 0x5c, 0xc9, 0x9e, 0xa8, 0x9c, 0xc2,
+        0xd1, 0x8e, 0x79, 0x3b, 0x43, 0x5d, 0x2b, 0x4f,
+        0x37, 0xd9, 0xcc, 0xa8, 0xbb, 0x9c, 0xb8, 0x73,
+        0x1a, 0x25, 0x88, 0x42, 0x7c, 0x01, 0xff, 0x51,
+        0xb6, 0x6c, 0x7c, 0x26, 0xc9, 0x07, 0xdc, 0x73,
+        0xce, 0x06, 0x46, 0x5f, 0x01, 0xb7, 0x32, 0x02,
+        0x9e, 0xc0, 0x22, 0x7a, 0xb4, 0x48, 0x37, 0x02,
+        0xf8, 0xfe, 0x70, 0x93, 0x91, 0x61, 0x52, 0xca,
+        0x91, 0x16, 0x8a, 0x65, 0x75, 0x3b, 0x7f, 0x8e,
+        0x65, 0xbf, 0x10, 0x89, 0x10, 0xb4, 0x0e, 0xbd,
+        0xda, 0xfc, 0x17, 0x08, 0x0e, 0xa7, 0xa0, 0xb0,
+        0xfb, 0x0a, 0x44, 0xd7, 0xc7, 0x7a, 0x9e, 0x55,
+        0x8f, 0x1e, 0x72, 0x56, 0xeb, 0x79, 0x6f, 0xf7,
+        0xa6, 0x07, 0x65, 0x7a, 0x68, 0xbc, 0xfc, 0x8f,
+        0xe2, 0xb8, 0xed, 0xa1, 0x8c, 0x29, 0x6f, 0x79,
+        0x2d, 0x63, 0x2a, 0xd5, 0x3e, 0x99, 0xb1, 0x8b,
+        0x5b, 0x3c, 0x3b, 0xdc, 0x6a, 0xad, 0x2e, 0x0b,
+        0xcb, 0x20, 0x4e, 0xdb, 0xb0, 0x36, 0xe5, 0x2d,
+        0x58, 0x9b, 0x4a, 0xb5, 0x58, 0xdb, 0xc5, 0x2d,
+        0x58, 0xbb, 0xd5, 0xfe, 0x00, 0x6f, 0x6b, 0x68,
+        0x40, 0x2d, 0x8f, 0x33, 0x4c, 0x79, 0x33, 0xae,
+        0xa6, 0x4e, 0x2d, 0xba, 0x76, 0x71, 0x0b, 0xc6,
+        0x6e, 0xb5, 0xcb, 0x91, 0x6e, 0x7e, 0x52, 0xa5,
+        0x8b, 0x2f, 0x41, 0xb9, 0xf1, 0x71, 0x95, 0x55,
+        0x7a, 0x19, 0xc2, 0x25, 0x0f, 0xa2, 0xfb, 0x67,
+        0x9e, 0xba, 0x23, 0xa3, 0xe2, 0x95, 0x8d, 0x9c,
+        0xf5, 0x56, 0xc8, 0x5d, 0x6d, 0x69, 0x78, 0x3a,
+        0xbb, 0x77, 0x80, 0x87, 0xf2, 0xeb, 0xe8, 0x2a,
+        0x56, 0x34, 0x8b, 0x1f, 0x92, 0x7c, 0xaa, 0xff,
+        0xac, 0x7d, 0xdc, 0x63, 0x8a, 0xfd, 0x12, 0xaf,
+        0x6c, 0x7a, 0xe6, 0xe3, 0x02, 0xac, 0xe5, 0x79,
+        0x2d, 0xd8, 0x59, 0x7c, 0x8f, 0xe0, 0xea, 0x3f,
+        0x6b, 0xb1, 0x33, 0xc5, 0x7e, 0x89, 0x27, 0x36,
+        0x61, 0xe7, 0x02, 0xac, 0xe5, 0x6d, 0x9f, 0xc8,
+        0xa3, 0x20, 0x8b, 0x8b, 0xe9, 0x99, 0x6a, 0x7e,
+        0x5d, 0x62, 0x8a, 0xfd, 0x12, 0x87, 0x6b, 0xc2,
+        0xcb, 0x05, 0x58, 0xcb, 0xaa, 0x2e, 0xc3, 0x4e,
+        0x7b, 0xab, 0xe9, 0xbf, 0x9a, 0x71, 0x53, 0xef,
+        0xb8, 0x2c, 0x46, 0xd6, 0x8a, 0x99, 0xf6, 0x7a,
+        0xab, 0x63, 0x49, 0x9f, 0xa8, 0xdd, 0xb6, 0x6c,
+        0xb6, 0xdd, 0xdb, 0x6d, 0xff, 0x64, 0x76, 0xdb,
+        0xd7, 0x32, 0xb6, 0x0b, 0x9e, 0x95, 0x28, 0xf2,
+        0x4a, 0xf3, 0xa2, 0xc9, 0xb8, 0xba, 0xc2, 0xb7,
+        0x4d, 0x71, 0x70, 0x91, 0x6e, 0xe8, 0x75, 0x47,
+        0x98, 0x2a, 0xf7, 0x45, 0xae, 0x97, 0xc3, 0xd6,
+        0x12, 0xbe, 0x95, 0x72, 0x74, 0xb6, 0xa4, 0xdc,
+        0xa2, 0x39, 0x83, 0xd4, 0x8e, 0x43, 0x1a, 0x17,
+        0x15, 0x27, 0x20, 0x13, 0x31, 0xbf, 0x31, 0x02,
+        0xc9, 0x5e, 0x67, 0x42, 0x26, 0x68, 0xf6, 0x13,
+        0x11, 0x4a, 0xac, 0x2c, 0xd0, 0x81, 0x09, 0x9d,
         0x31, 0x64, 0x28, 0x1a, 0xf4, 0xc6, 0xe7, 0xd4,
-        0xa7, 0xfe, 0xa5, 0x4e, 0xc0, 0x8a, 0x07, 0x94,
-        0x7c, 0x0f, 0x63, 0x3b, 0xc6, 0xd3, 0x01, 0xda,
-        0xab, 0x19, 0x2d, 0x86, 0x89, 0xa9, 0x1e, 0x30,
-        0x45, 0x91, 0xd1, 0xc3, 0x8e, 0x0b, 0x18, 0x5e,
-        0x67, 0xbc, 0x91, 0x97, 0xce, 0x0b, 0xc3, 0xc5,
-        0x72, 0x49, 0x4a, 0xa0, 0xa9, 0xd0, 0xfb, 0x14,
-        0xcb, 0x11, 0x73, 0xd9, 0xdb, 0x6e, 0xe0, 0x94,
-        0x17, 0xfd, 0xea, 0x51, 0xff, 0x39, 0x4c, 0xee,
-        0xdb, 0x98, 0xdb, 0x6f, 0xdf, 0xd4, 0xfe, 0x19,
-        0x99, 0xd9, 0x99, 0xa5, 0x48, 0x1a, 0x25, 0x5a,
-        0x7f, 0xac, 0x00, 0x75, 0xbd, 0x28, 0x9c, 0xc7,
-        0x78, 0x56, 0x1c, 0x23, 0xf1, 0x3f, 0x26, 0xaf,
-        0x3a, 0x58, 0x91, 0xf0, 0x03, 0x60, 0xeb, 0x45,
-        0x5c, 0x1b, 0xf3, 0x99, 0x53, 0xb2, 0xe1, 0x84,
-        0x5d, 0xec, 0xe8, 0xe5, 0x8a, 0xdd, 0xc1, 0x9b,
-        0x04, 0xe4, 0xb0, 0x39, 0xea, 0xc7, 0xb8, 0x65,
-        0x88, 0x56, 0xf9, 0xe4, 0x09, 0x63, 0xc3, 0x7d,
-        0xe4, 0xf6, 0xa1, 0xed, 0x95, 0x7a, 0x1b, 0x0c,
-        0x1b, 0xb2, 0xc0, 0x5d, 0x65, 0xf5, 0xa6, 0xdc,
-        0x90, 0xb1, 0x17, 0x1b, 0xbe, 0x6c, 0x29, 0x41,
-        0x89, 0x30, 0xe7, 0xe7, 0x93, 0xcb, 0xc0, 0xa3,
-        0xb0, 0x4f, 0x80, 0x4d, 0x6d, 0x7f, 0xbd, 0xdd,
-        0x15, 0xc2, 0xee, 0x0a, 0xe1, 0x8b, 0xbb, 0x42,
-        0x30, 0x5c, 0xc5, 0x7d, 0x2d, 0xe6, 0x3c, 0x34,
-        0xb3, 0x25, 0xca, 0xcf, 0xe2, 0xb2, 0x41, 0x3d,
-        0xe2, 0xd5, 0xa6, 0xbe, 0xe9, 0x2d, 0xdc, 0x3e,
-        0xc8, 0x6b, 0x0c, 0x52, 0x67, 0xd5, 0xe3, 0x30,
-        0x7c, 0x17, 0x7b, 0x41, 0xa1, 0xb9, 0x4c, 0x3c,
-        0x32, 0x56, 0x6d, 0x95, 0x1f, 0x9b, 0x35, 0xad,
-        0x1d, 0xc1, 0xa1, 0xc0, 0x6a, 0xf1, 0xe2, 0x2b,
-        0x0e, 0x15, 0xdf, 0xe8, 0xec, 0xbb, 0xef, 0xc7,
-        0xaf, 0xff, 0x29, 0x8e, 0xac, 0xd0, 0x51, 0x2f,
-        0xbf, 0xfb, 0xe1, 0xe5, 0xf8, 0x87, 0x17, 0x7f,
-        0xff, 0xfb, 0x0b, 0x98, 0x8c, 0xe1, 0xe0, 0xb0,
-        0x5f, 0x7e, 0xfb, 0x50, 0x65, 0x7c, 0x40, 0x55,
-        0xe3, 0x64, 0x0b, 0x3b, 0xe3, 0x7d, 0x5b, 0x08,
-        0xef, 0xd5, 0xb6, 0x77, 0x7f, 0xc6, 0xb9, 0x7b,
-        0xb6, 0xab, 0xdd, 0x89, 0x51, 0xac, 0xf2, 0x7e,
-        0xad, 0xda, 0x80, 0xe4, 0xbc, 0xb3, 0xa9, 0xb3,
-        0x7c, 0xdd, 0x86, 0x51, 0xe8, 0x4a, 0x9b, 0xd0,
-        0xcd, 0xac, 0x39, 0x57, 0x1b, 0x73, 0x6e, 0x64,
-        0x86, 0xb9, 0xeb, 0xf7, 0x6b, 0x05, 0x3b, 0xca,
-        0xcd, 0x2c, 0x20, 0x57, 0x19, 0x40, 0x6e, 0x66,
-        0xbd, 0xe0, 0x33, 0x42, 0x2e, 0xb2, 0x36, 0x3a,
-        0x54, 0x1d, 0x33, 0x72, 0xc9, 0x7b, 0x17, 0x45,
-        0x23, 0x82, 0x55, 0x76, 0x59, 0x3a, 0x23, 0xcc,
-        0x8c, 0xc9, 0x3a, 0x45, 0xef, 0xb1, 0x6b, 0x4b,
-        0xc8, 0xca, 0xde, 0x6c, 0x3c, 0xd4, 0x6d, 0x8a,
-        0x29, 0xca, 0x26, 0xfc, 0x12, 0xea, 0xd4, 0x66,
-        0xc7, 0x7d, 0xd1, 0x32, 0x9d, 0xee, 0xb9, 0xbb,
-        0x42, 0x1e, 0x0c, 0xf6, 0xd3, 0xc7, 0xf5, 0x6c,
-        0x86, 0x9e, 0xd8, 0xa3, 0xc3, 0xa7, 0xf4, 0x60,
-        0x9f, 0xe3, 0x8a, 0x00, 0x62, 0xf8, 0xb7, 0x2d,
-        0x8c, 0x4b, 0xe6, 0x5d, 0xf2, 0xba, 0x87, 0xc6,
-        0x36, 0xed, 0xa9, 0x32, 0x85, 0x58, 0xcb, 0x2c,
-        0xd6, 0x1e, 0x1c, 0xf4, 0xc3, 0xe7, 0x00, 0x5b,
-        0x1e, 0x27, 0x4f, 0x2c, 0xac, 0xdb, 0xdb, 0xa0,
-        0x4d, 0x51, 0x8c, 0x24, 0xbe, 0x8c, 0xad, 0x45,
-        0x5f, 0x7d, 0x4b, 0xae, 0xd0, 0x7d, 0x38, 0x52,
-        0xa1, 0x35, 0x6a, 0xf9, 0x56, 0xad, 0xf2, 0xa2,
-        0x19, 0xaf, 0x99, 0xd5, 0x7b, 0x81, 0xd2, 0x54,
-        0x33, 0x3e, 0x53, 0x0a, 0xa5, 0x81, 0x03, 0xdc,
-        0x13, 0xa5, 0xb7, 0x7d, 0x8e, 0xe8, 0x28, 0xaf,
-        0xbf, 0xad, 0x57, 0x6e, 0x34, 0x80, 0xae, 0x03,
-        0xad, 0xc3, 0xa3, 0x7a, 0x52, 0xf8, 0x78, 0x83,
-        0xe7, 0x6c, 0x28, 0x5d, 0xb9, 0xa7, 0xf8, 0x2d,
-        0x5c, 0x93, 0xff, 0x7f, 0xc9, 0x73, 0xe5, 0xd5
+        0xa7, 0xd3, 0x0b, 0x9d, 0x80, 0x15, 0x0f, 0x28,
+        0xf9, 0x1e, 0xc6, 0x76, 0x8c, 0xa7, 0x03, 0xb4,
+        0xdf, 0x30, 0x5a, 0x0c, 0x13, 0x53, 0x3f, 0x60,
+        0x8a, 0x22, 0xa3, 0x87, 0x9d, 0x94, 0x30, 0xbc,
+        0xca, 0x78, 0xe3, 0x20, 0x5b, 0x94, 0x86, 0x8b,
+        0xe5, 0x92, 0x94, 0x40, 0x53, 0xa1, 0xf7, 0x29,
+        0x96, 0x23, 0xe6, 0xaa, 0xbf, 0xdb, 0xc0, 0x29,
+        0x2f, 0xfa, 0xe5, 0xa3, 0xfe, 0x73, 0x98, 0xdc,
+        0x77, 0x31, 0xb7, 0xdf, 0xbc, 0xa9, 0xfd, 0x13,
+        0x32, 0xb3, 0x33, 0x4b, 0x91, 0x34, 0x4a, 0xb4,
+        0xfe, 0x50, 0x01, 0xea, 0x05, 0x71, 0xb4, 0x48,
+        0xf0, 0xac, 0x78, 0x8e, 0xc4, 0xff, 0x90, 0xbc,
+        0xea, 0x60, 0x45, 0xa2, 0xf7, 0x80, 0x6d, 0x10,
+        0x73, 0x6d, 0xcc, 0x67, 0x4e, 0xc9, 0x86, 0x53,
+        0x76, 0xb1, 0xa3, 0x97, 0x2b, 0x76, 0x07, 0x3f,
+        0xa6, 0x20, 0x87, 0x2d, 0x50, 0x3f, 0xc6, 0x2d,
+        0x43, 0xb4, 0xca, 0x27, 0x4f, 0x94, 0x18, 0xee,
+        0x23, 0xb7, 0x0f, 0x6d, 0xaf, 0x2c, 0xd8, 0x62,
+        0xd8, 0x90, 0x25, 0xee, 0x2a, 0xab, 0x37, 0xe5,
+        0x86, 0x8c, 0xbd, 0xd8, 0xf0, 0x65, 0x4b, 0x09,
+        0xca, 0x8b, 0x0a, 0x7e, 0x3e, 0xb9, 0x12, 0x01,
+        0x85, 0x7d, 0x02, 0x6c, 0x1a, 0xfb, 0xeb, 0xef,
+        0xaf, 0x10, 0xf6, 0x57, 0x08, 0x7f, 0xb8, 0x2b,
+        0x04, 0xc3, 0x55, 0xdc, 0xd7, 0x62, 0xce, 0x43,
+        0x33, 0x5b, 0xa2, 0xfc, 0x24, 0x2e, 0x1b, 0xd4,
+        0x23, 0x5e, 0x6d, 0xea, 0x0b, 0x6f, 0xe0, 0xf6,
+        0x41, 0x5e, 0x63, 0x90, 0x3a, 0xab, 0x1e, 0x87,
+        0xe1, 0xbb, 0xd8, 0x73, 0x0a, 0xcd, 0x65, 0xe2,
+        0x91, 0xb1, 0x6a, 0xab, 0xfc, 0xd8, 0xac, 0x69,
+        0xf5, 0x3d, 0x0e, 0x05, 0xd6, 0x88, 0x17, 0x5f,
+        0x71, 0xa8, 0xf8, 0x46, 0xa7, 0x5f, 0x7d, 0x3d,
+        0x79, 0xf3, 0x4f, 0xef, 0xa9, 0x15, 0x3a, 0xea,
+        0xd5, 0x57, 0xdf, 0xbc, 0x9a, 0x7c, 0xf3, 0xf2,
+        0xef, 0x7f, 0x7f, 0x09, 0x93, 0x31, 0x1a, 0x1e,
+        0x0f, 0xaa, 0x6f, 0x1f, 0xea, 0x8c, 0x0f, 0xa8,
+        0x6a, 0x9c, 0xec, 0x60, 0x67, 0xbc, 0x6b, 0x0b,
+        0xe1, 0x9d, 0xda, 0xf6, 0xee, 0xce, 0x38, 0x77,
+        0xc7, 0x76, 0xb5, 0x5b, 0x31, 0x8a, 0xd5, 0xde,
+        0xaf, 0xd5, 0x1b, 0x90, 0x9c, 0x77, 0x36, 0x4d,
+        0x96, 0xaf, 0x9b, 0x30, 0x0a, 0x5d, 0x6a, 0x13,
+        0xba, 0x9e, 0x35, 0xe7, 0x72, 0x63, 0xce, 0xb5,
+        0xcc, 0x30, 0xb7, 0xfd, 0x7e, 0xad, 0x64, 0x47,
+        0xb9, 0x9e, 0x05, 0xe4, 0x32, 0x03, 0xc8, 0xf5,
+        0xac, 0x17, 0x7c, 0x46, 0xc8, 0x45, 0xd6, 0x46,
+        0x87, 0xba, 0x63, 0x46, 0x2e, 0x79, 0xff, 0xbc,
+        0x6c, 0x44, 0xb0, 0xca, 0x2e, 0x2a, 0x67, 0x84,
+        0x99, 0x31, 0x59, 0xa7, 0xec, 0x3d, 0x76, 0x65,
+        0x09, 0x59, 0xd9, 0x9b, 0x8d, 0x87, 0xba, 0x4d,
+        0x31, 0x65, 0xd9, 0x84, 0x5f, 0x42, 0xbd, 0xb0,
+        0xd9, 0xf1, 0xc0, 0xeb, 0x98, 0x4e, 0x0f, 0xdc,
+        0x5d, 0x21, 0x0f, 0x06, 0xfb, 0xe9, 0xe3, 0x66,
+        0x3e, 0x47, 0x4f, 0xec, 0xf1, 0xf1, 0x63, 0x7a,
+        0xb0, 0xcf, 0x71, 0x45, 0x00, 0x31, 0xfc, 0xdb,
+        0x16, 0xc6, 0x25, 0xf3, 0xae, 0x78, 0xdd, 0x43,
+        0x63, 0x9b, 0xf6, 0x54, 0x99, 0x42, 0xac, 0x63,
+        0x16, 0xeb, 0x00, 0x0e, 0xfa, 0xd1, 0x33, 0x80,
+        0x2d, 0x8f, 0x93, 0x47, 0x16, 0xd6, 0xdd, 0x5d,
+        0xd0, 0xa6, 0x28, 0x46, 0x12, 0x5f, 0xc6, 0xd6,
+        0xa2, 0xaf, 0x81, 0x25, 0x57, 0xe8, 0x3e, 0x1c,
+        0xa9, 0xd0, 0x1a, 0xb5, 0x7c, 0xab, 0x56, 0x7b,
+        0xd1, 0x8c, 0xd7, 0xcc, 0xea, 0xbd, 0x40, 0x65,
+        0xaa, 0x19, 0x9f, 0x90, 0x42, 0x69, 0xe0, 0x00,
+        0x0f, 0xbc, 0xca, 0xdb, 0x3e, 0x47, 0x74, 0x94,
+        0xd7, 0xdf, 0xd6, 0x2b, 0x37, 0x1a, 0x40, 0xcf,
+        0x81, 0xe6, 0xf3, 0xa8, 0x1e, 0x95, 0x3e, 0x5e,
+        0xe3, 0x39, 0x1b, 0x4a, 0x57, 0xee, 0x29, 0x7e,
+        0xfb, 0xaf, 0xdb, 0x24, 0x7f, 0xe5, 0x67, 0x3f,
+        0xd5, 0x1b, 0x04, 0x69, 0x93, 0xdf, 0xa6, 0x59,
+        0x1c, 0x56, 0xed, 0xf8, 0xf4, 0x6a, 0xf4, 0xda,
+        0xb7, 0x02, 0x0d, 0x4f, 0xe1, 0x3e, 0xc9, 0x58,
+        0x7f, 0x59, 0x10, 0x46, 0x9b, 0xbc, 0x1e, 0x3b,
+        0x2e, 0x6b, 0x0d, 0xcb, 0xc6, 0x55, 0x9a, 0xe2,
+        0xb2, 0xa9, 0xd2, 0xf6, 0xa7, 0xe0, 0xa6, 0xd6,
+        0x3e, 0x2a, 0xe1, 0x6d, 0x09, 0x67, 0x79, 0x91,
+        0xa5, 0xef, 0x44, 0x1b, 0x29, 0xda, 0x35, 0x5a,
+        0x28, 0xd2, 0xae, 0x56, 0x4b, 0x98, 0x6e, 0x85,
+        0x16, 0xfa, 0x2c, 0x57, 0xdc, 0x05, 0xff, 0x96,
+        0xbb, 0x5f, 0xbb, 0x46, 0x2b, 0xc9, 0xda, 0x15,
+        0x9b, 0x08, 0xd7, 0xad, 0xd3, 0x4e, 0xbe, 0xe5,
+        0xba, 0xbb, 0x8c, 0xa3, 0x95, 0x68, 0xdc, 0x3a,
+        0xcd, 0xb4, 0xe3, 0xd6, 0xab, 0x25, 0xa1, 0x72,
+        0x95, 0x16, 0x4a, 0xaa, 0x56, 0x2d, 0xb9, 0x7a,
+        0xe9, 0xc5, 0x43, 0xe9, 0x95, 0x79, 0x62, 0x99,
+        0x00, 0x94, 0xe7, 0x17, 0xcb, 0x15, 0x35, 0xf8,
+        0x9c, 0x4d, 0xf4, 0x0b, 0x7b, 0xde, 0x5c, 0xe8,
+        0x2e, 0xf3, 0x55, 0x16, 0x6c, 0x73, 0x4f, 0x04,
+        0xb3, 0xa5, 0x37, 0x8b, 0xb2, 0x59, 0x4c, 0x0f,
+        0x54, 0x03, 0xb4, 0x9a, 0xa0, 0xa1, 0x83, 0x63,
+        0xa7, 0x73, 0x64, 0xf1, 0xbe, 0xf7, 0x53, 0x12,
+        0x47, 0xef, 0xf8, 0x79, 0xed, 0x6f, 0x9b, 0x20,
+        0xcc, 0x55, 0x74, 0x00, 0xd9, 0x90, 0x23, 0x68,
+        0x91, 0x13, 0x0e, 0xb7, 0xc0, 0x07, 0xb0, 0xdb,
+        0xe0, 0x22, 0xc7, 0x77, 0xfc, 0xdc, 0x4c, 0x99,
+        0xa0, 0x7d, 0x7c, 0xbf, 0xca, 0xcd, 0xb0, 0x52,
+        0xb4, 0x48, 0x4a, 0xd6, 0x6b, 0xb4, 0xdf, 0xa1,
+        0x65, 0x1b, 0xe3, 0x0f, 0x93, 0x79, 0x4d, 0x40,
+        0x8d, 0x07, 0x64, 0xad, 0x16, 0x89, 0xae, 0x64,
+        0x6c, 0xfd, 0x7d, 0x4b, 0x68, 0xc7, 0xdf, 0xee,
+        0x79, 0x80, 0x46, 0xc9, 0xf8, 0xe9, 0x55, 0x1c,
+        0xfd, 0x5a, 0x7b, 0xc3, 0xc7, 0x45, 0xbe, 0x75,
+        0x18, 0xb4, 0x84, 0xda, 0x33, 0x70, 0x2a, 0x3c,
+        0x7d, 0x1f, 0x29, 0xf2, 0x12, 0x5c, 0x1c, 0x06,
+        0x4d, 0x86, 0x49, 0xeb, 0x43, 0x2d, 0x71, 0xd8,
+        0x15, 0xfc, 0x0a, 0x03, 0x6f, 0x22, 0x95, 0x32,
+        0xd8, 0x06, 0x36, 0x7c, 0x39, 0xa6, 0x46, 0xf1,
+        0xb2, 0x3f, 0xd4, 0xce, 0x9f, 0x5d, 0xc1, 0xaf,
+        0xb0, 0xea, 0x16, 0x82, 0x2a, 0x43, 0x6e, 0xe0,
+        0xb5, 0x97, 0x23, 0x6b, 0xaf, 0xb4, 0xfb, 0xa9,
+        0x0d, 0x61, 0x6b, 0xdd, 0xcb, 0x3c, 0xb9, 0x69,
+        0xf9, 0xab, 0xc0, 0x9b, 0x19, 0xeb, 0x55, 0x43,
+        0x1c, 0x98, 0xa7, 0xfd, 0x42, 0x6d, 0x35, 0xc9,
+        0xfd, 0x64, 0xde, 0x85, 0x28, 0xc1, 0x20, 0x05,
+        0x2b, 0xa1, 0xde, 0xed, 0x5b, 0xa1, 0x51, 0x9c,
+        0x0b, 0x10, 0xd6, 0x2e, 0x3b, 0x12, 0xc6, 0x23,
+        0x67, 0x9a, 0xf9, 0x45, 0xac, 0x23, 0x1f, 0x1b,
+        0x65, 0xcc, 0x15, 0xb6, 0x2b, 0xd7, 0xb6, 0xf4,
+        0x50, 0xb9, 0xed, 0xb2, 0xaa, 0x64, 0x53, 0xb5,
+        0x94, 0x24, 0x2a, 0x01, 0x46, 0x7f, 0xca, 0xb8,
+        0xb1, 0xc5, 0xd6, 0x52, 0x4f, 0xe5, 0xb0, 0x19,
+        0x64, 0x75, 0xd8, 0xdb, 0x28, 0x09, 0xd3, 0xad,
+        0x13, 0xa5, 0x40, 0x7b, 0x79, 0xc2, 0x94, 0x90,
+        0xe1, 0x5c, 0x85, 0x57, 0x2c, 0x52, 0x72, 0x6a,
+        0x04, 0xee, 0xae, 0x20, 0x6b, 0x6d, 0x04, 0x5a,
+        0xd3, 0x11, 0xa0, 0xe2, 0x15, 0xc8, 0xee, 0x60,
+        0xae, 0x6c, 0xcc, 0x6b, 0xe3, 0x90, 0xe9, 0x9b,
+        0x33, 0x9e, 0x40, 0xa9, 0x77, 0x30, 0x18, 0x39,
+        0xe1, 0xe5, 0xe1, 0xc8, 0x00, 0x0d, 0x68, 0x80,
+        0xa5, 0x0c, 0x01, 0xc4, 0xc0, 0x4c, 0xdc, 0xf7,
+        0x25, 0x39, 0x1f, 0x64, 0x67, 0x78, 0x3c, 0x61,
+        0xb5, 0x79, 0xb0, 0x39, 0xef, 0xb9, 0x01, 0x6a,
+        0x4c, 0x70, 0x0a, 0x73, 0x06, 0xf6, 0x65, 0x00,
+        0x3e, 0x82, 0x46, 0xf0, 0xf9, 0xae, 0xcf, 0x39,
+        0x28, 0x1f, 0xe6, 0xbc, 0x62, 0x32, 0x0a, 0x22,
+        0x19, 0x64, 0x13, 0xbc, 0x98, 0xb6, 0x12, 0x81,
+        0xbc, 0x13, 0x82, 0x93, 0x8d, 0x10, 0x24, 0x64,
+        0xef, 0x18, 0x1b, 0x23, 0xbe, 0xf0, 0x46, 0x6b,
+        0x34, 0xf8, 0xa2, 0x1b, 0xf0, 0x36, 0xa5, 0x4b,
+        0xae, 0x28, 0xc1, 0x1b, 0x40, 0x01, 0x45, 0x74,
+        0x3d, 0x8b, 0x47, 0x21, 0x0f, 0xdc, 0x39, 0xec,
+        0x65, 0x70, 0xbe, 0x86, 0x18, 0xf5, 0x0d, 0xd4,
+        0xc8, 0xd1, 0xc6, 0x3e, 0x52, 0xa4, 0x2e, 0x79,
+        0x44, 0xde, 0x95, 0x6e, 0xf3, 0xa9, 0xc7, 0x04,
+        0x73, 0x8e, 0xb0, 0x8f, 0xa3, 0x19, 0x7c, 0x5c,
+        0x69, 0xfe, 0x93, 0x14, 0xc0, 0xef, 0x3a, 0x10,
+        0x9a, 0x25, 0x77, 0x5e, 0x59, 0x7a, 0xfc, 0x24,
+        0xc2, 0xaa, 0x55, 0x24, 0xb9, 0xeb, 0x4b, 0x5f,
+        0x3b, 0x08, 0x5f, 0x1f, 0x24, 0x30, 0xed, 0x24,
+        0x2f, 0x7d, 0x80, 0x74, 0x33, 0x18, 0xe8, 0x83,
+        0x9d, 0x0f, 0x57, 0xf6, 0x15, 0x0a, 0xce, 0x82,
+        0x28, 0xc6, 0xf7, 0x1e, 0x78, 0x74, 0x87, 0x22,
+        0x7f, 0x57, 0xa4, 0x6b, 0xef, 0x9b, 0x6f, 0x4f,
+        0xbf, 0x45, 0x4b, 0xed, 0xd0, 0xf7, 0x64, 0xc4,
+        0x22, 0x13, 0xc4, 0x17, 0x1d, 0xa6, 0x44, 0x16,
+        0x9d, 0x89, 0xd0, 0x04, 0x63, 0x92, 0x41, 0x66,
+        0xaa, 0x27, 0xbf, 0x3a, 0xe9, 0xf4, 0xb9, 0x1f,
+        0x25, 0x79, 0x21, 0x82, 0xb0, 0xef, 0x2e, 0xc6,
+        0xd8, 0x33, 0x21, 0x5b, 0x3b, 0xb6, 0x04, 0xc0,
+        0xd1, 0xb5, 0xd5, 0x0e, 0x43, 0xa3, 0xee, 0x99,
+        0xe5, 0x68, 0x56, 0x17, 0xc5, 0xd4, 0x44, 0x9b,
+        0x93, 0xdf, 0xdd, 0x70, 0x68, 0x7a, 0xc7, 0x89,
+        0x50, 0x5d, 0x1f, 0xf4, 0xf0, 0xf6, 0x95, 0xd5,
+        0x9a, 0xd2, 0x8e, 0x74, 0x9b, 0x6a, 0x79, 0xd3,
+        0x2b, 0x85, 0x2c, 0x1b, 0xfa, 0x15, 0xb0, 0x7e,
+        0x19, 0xab, 0x5e, 0x35, 0x32, 0x9b, 0x54, 0x0e,
+        0x10, 0x9a, 0x4d, 0x29, 0x7f, 0xa3, 0x64, 0x3c,
+        0x3a, 0xbc, 0xb2, 0xd5, 0x93, 0x16, 0xf0, 0x2a,
+        0xbd, 0x39, 0xfe, 0x40, 0xfa, 0x8f, 0x0a, 0x0a,
+        0x72, 0x57, 0x37, 0x1e, 0xf0, 0xd4, 0xb2, 0xc1,
+        0xdc, 0x6c, 0x46, 0x7f, 0x60, 0xe2, 0xe5, 0x18,
+        0xab, 0xb3, 0xef, 0x6e, 0xa7, 0x03, 0xaf, 0x2c,
+        0xb6, 0x1b, 0x55, 0xe8, 0x06, 0xcc, 0xd1, 0x4d,
+        0x81, 0x30, 0x29, 0xe6, 0x4d, 0x43, 0x56, 0x0b,
+        0x2a, 0x6b, 0x30, 0xa6, 0x8d, 0x75, 0x85, 0x7a,
+        0x26, 0xae, 0xca, 0xea, 0xce, 0x49, 0x1d, 0x44,
+        0x53, 0xd7, 0xb9, 0x0b, 0x1b, 0xef, 0x15, 0x25,
+        0x9d, 0xdd, 0xa2, 0xd3, 0x5d, 0xc5, 0x40, 0xaf,
+        0x0a, 0x49, 0x5a, 0xcd, 0x9d, 0x20, 0x5d, 0x1f,
+        0x6c, 0xbb, 0xff, 0xe0, 0x43, 0x56, 0x7f, 0x95,
+        0xe1, 0xf2, 0x80, 0x49, 0xbd, 0x22, 0x27, 0x43,
+        0x74, 0x24, 0xfc, 0x6c, 0xf8, 0x99, 0xf2, 0x68,
+        0x7c, 0x27, 0xb2, 0x44, 0xc4, 0xc0, 0xcf, 0x68,
+        0x04, 0x3a, 0x48, 0x1c, 0xc6, 0x26, 0x0f, 0x7f,
+        0xdd, 0xe4, 0x85, 0x5d, 0x89, 0x64, 0xf4, 0x02,
+        0x66, 0x40, 0xa5, 0xd7, 0x12, 0xab, 0x75, 0x94,
+        0x45, 0xd0, 0x03, 0xc8, 0xda, 0xb3, 0x65, 0x9a,
+        0x8b, 0x44, 0x45, 0x89, 0x23, 0x25, 0x02, 0xaa,
+        0xa3, 0x27, 0x64, 0x11, 0x61, 0x20, 0xa3, 0x1c,
+        0x5f, 0xeb, 0xa1, 0xcf, 0x5d, 0x1c, 0xac, 0xd7,
+        0x88, 0x21, 0x03, 0xa5, 0x4c, 0x62, 0xa4, 0x1b,
+        0x5d, 0xac, 0x11, 0x92, 0xb7, 0x14, 0x41, 0x81,
+        0x96, 0x2c, 0x0c, 0x58, 0x89, 0x51, 0xbd, 0xf3,
+        0x7c, 0xb3, 0xc2, 0xea, 0xb3, 0x18, 0xb0, 0x11,
+        0x98, 0x70, 0x8c, 0x1f, 0xe3, 0x75, 0x1f, 0xf0,
+        0xc3, 0x45, 0x7b, 0x12, 0xfe, 0xf5, 0xea, 0x87,
+        0xef, 0xb5, 0x5c, 0x3f, 0x3e, 0x3e, 0xa6, 0x7f,
+        0x47, 0x74, 0x85, 0x87, 0xdd, 0x7c, 0x13, 0x6c,
+        0xf2, 0x3c, 0x0a, 0x12, 0x35, 0x9e, 0x59, 0x2a,
+        0xe6, 0xf3, 0x68, 0x16, 0x91, 0x8f, 0xdc, 0x08,
+        0xaa, 0xe6, 0xbf, 0x65, 0x45, 0x67, 0x0c, 0x5b,
+        0xf7, 0xcd, 0xeb, 0xae, 0xf6, 0xf1, 0xf8, 0xe6,
+        0xe5, 0x4f, 0xa7, 0xa7, 0x93, 0x2f, 0xbf, 0x7f,
+        0xf5, 0x35, 0xf0, 0x96, 0xc3, 0x67, 0x4f, 0x9f,
+        0x1d, 0x8d, 0xc7, 0x4f, 0x87, 0x47, 0xc3, 0xd1,
+        0xd1, 0xe1, 0xf8, 0x89, 0x65, 0x31, 0xb4, 0x26,
+        0x0a, 0x58, 0x3e, 0xd9, 0x0f, 0xd9, 0x58, 0xd8,
+        0x64, 0x3e, 0x64, 0xf7, 0x93, 0xd0, 0xab, 0x35,
+        0x21, 0x22, 0x5c, 0x35, 0x15, 0x52, 0x53, 0xc4,
+        0xd0, 0xe8, 0xc6, 0x7c, 0x88, 0x73, 0x62, 0x1b,
+        0x10, 0xaf, 0x68, 0xef, 0x93, 0x8c, 0x82, 0xf2,
+        0x5a, 0x70, 0x1a, 0xc6, 0xda, 0xc4, 0x16, 0x54,
+        0xe4, 0x5b, 0xcc, 0xa3, 0xc6, 0x90, 0x63, 0x33,
+        0x08, 0x8e, 0xd3, 0x5a, 0xe2, 0x03, 0xbb, 0x99,
+        0xfd, 0x9a, 0xc4, 0xaf, 0x5b, 0x33, 0x02, 0xda,
+        0x9a, 0xbc, 0xf4, 0x07, 0x82, 0x4d, 0x41, 0x2e,
+        0x90, 0xb8, 0x08, 0xba, 0x9b, 0xc2, 0xca, 0x9e,
+        0x26, 0x17, 0x78, 0x0e, 0x24, 0x9f, 0x4b, 0xaf,
+        0x5d, 0xd8, 0x50, 0x40, 0xfe, 0xb0, 0x61, 0xde,
+        0x8b, 0xcc, 0xf8, 0x24, 0x63, 0x00, 0x04, 0x6c,
+        0xe0, 0xae, 0xa1, 0x1d, 0x18, 0xf6, 0x14, 0x8f,
+        0x3d, 0x24, 0xb8, 0x1e, 0x9b, 0x17, 0xe2, 0x74,
+        0xd1, 0x21, 0x02, 0x1e, 0xa8, 0xb9, 0x1c, 0xd8,
+        0xcc, 0x05, 0xfe, 0x32, 0x94, 0xd8, 0xd5, 0x91,
+        0xc8, 0xee, 0xc8, 0x6c, 0x03, 0xb4, 0xba, 0xcc,
+        0xa2, 0xe4, 0x1d, 0x07, 0x98, 0x95, 0xde, 0xce,
+        0xc6, 0x1b, 0x1a, 0x28, 0xd8, 0x56, 0xfd, 0x15,
+        0x53, 0x49, 0x45, 0xae, 0xde, 0xe8, 0x2a, 0x87,
+        0x6c, 0x72, 0x33, 0x25, 0x1f, 0xbd, 0xbe, 0x6b,
+        0x8e, 0x38, 0x05, 0x74, 0x25, 0x3e, 0x25, 0x93,
+        0x0f, 0x07, 0x45, 0xbb, 0x9a, 0x1d, 0xe7, 0xe6,
+        0x8c, 0x25, 0xd2, 0x6b, 0xe1, 0xf4, 0xa4, 0xc5,
+        0x32, 0xa4, 0x98, 0xef, 0xa5, 0xe7, 0xf2, 0x8d,
+        0x9d, 0xac, 0xf5, 0xd5, 0xac, 0x93, 0xe8, 0x56,
+        0x4e, 0x90, 0x5b, 0x61, 0xa0, 0xbb, 0x6a, 0x7c,
+        0x16, 0xc7, 0xda, 0x91, 0xef, 0x7c, 0x52, 0x42,
+        0xbf, 0x22, 0xb5, 0x83, 0x5d, 0xc5, 0x7f, 0x85,
+        0xc6, 0xff, 0xba, 0x27, 0xb8, 0xc8, 0x8b, 0x88,
+        0x13, 0xc2, 0xf0, 0xf5, 0x51, 0x50, 0x59, 0x35,
+        0xc0, 0x8d, 0xf6, 0xdc, 0xf1, 0xf9, 0xb1, 0x1d,
+        0xa7, 0x1a, 0xf5, 0x00, 0x76, 0xb5, 0x3f, 0x24,
+        0xa2, 0xe6, 0xff, 0x62, 0x50, 0x45, 0x9d, 0x9c,
+        0xc3, 0xe8, 0x13, 0xa6, 0xdd, 0x19, 0x25, 0xa8,
+        0x91, 0xab, 0x70, 0xe0, 0x70, 0xac, 0x03, 0x7b,
+        0xe9, 0x0f, 0xa0, 0xf5, 0xba, 0x13, 0xb6, 0xc5,
+        0x03, 0x04, 0x50, 0xe4, 0x06, 0x6b, 0xfe, 0x73,
+        0x33, 0xb2, 0xf2, 0xff, 0x07, 0x02, 0x70, 0x42,
+        0x3c
     };
     static std::string decompressed = util::decompress(std::string(reinterpret_cast<const char*>(compressed), sizeof(compressed)));
     return decompressed.c_str();
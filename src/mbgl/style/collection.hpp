@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/style/collection_journal.hpp>
 #include <mbgl/util/immutable.hpp>
 #include <mbgl/util/optional.hpp>
 
@@ -13,7 +14,8 @@ namespace style {
     Manages an ordered collection of elements and their `Immutable<Impl>`s. The latter is
     itself stored in an Immutable container. Using immutability at the collection level
     allows us to short-circuit significant portions of the RenderStyle update logic via
-    a simple pointer equality check, greatly improving performance.
+    a simple pointer equality check, greatly improving performance. When only a few elements
+    changed, the accompanying CollectionJournal tells which ones.
 
     Element types are required to have:
 
@@ -35,6 +37,7 @@ public:
 
     std::vector<T*> getWrappers() const;
     ImmutableVector getImpls() const { return impls; }
+    std::shared_ptr<const CollectionJournal> getJournal() const { return journal; }
 
     auto begin() const { return wrappers.begin(); }
     auto end() const { return wrappers.end(); }
@@ -52,13 +55,18 @@ public:
 private:
     std::size_t index(const std::string&) const;
 
+    // Starts a new journal unless `updated` is given.
+    void record(optional<std::size_t> updated);
+
     WrapperVector wrappers;
     ImmutableVector impls;
+    std::shared_ptr<const CollectionJournal> journal;
 };
 
 template <class T>
 Collection<T>::Collection()
-    : impls(makeMutable<std::vector<Immutable<Impl>>>()) {
+    : impls(makeMutable<std::vector<Immutable<Impl>>>()),
+      journal(std::make_shared<CollectionJournal>()) {
 }
 
 template <class T>
@@ -96,6 +104,7 @@ void Collection<T>::clear() {
     mutate(impls, [&] (auto& impls_) {
         impls_.clear();
     });
+    record({});
 
     wrappers.clear();
 }
@@ -107,6 +116,7 @@ T* Collection<T>::add(std::unique_ptr<T> wrapper, const optional<std::string>& b
     mutate(impls, [&] (auto& impls_) {
         impls_.emplace(impls_.begin() + i, wrapper->baseImpl);
     });
+    record({});
 
     return wrappers.emplace(wrappers.begin() + i, std::move(wrapper))->get();
 }
@@ -124,6 +134,7 @@ std::unique_ptr<T> Collection<T>::remove(const std::string& id) {
     mutate(impls, [&] (auto& impls_) {
         impls_.erase(impls_.begin() + i);
     });
+    record({});
 
     wrappers.erase(wrappers.begin() + i);
 
@@ -132,9 +143,21 @@ std::unique_ptr<T> Collection<T>::remove(const std::string& id) {
 
 template <class T>
 void Collection<T>::update(const T& wrapper) {
+    const std::size_t i = index(wrapper.getID());
+
     mutate(impls, [&] (auto& impls_) {
-        impls_.at(this->index(wrapper.getID())) = wrapper.baseImpl;
+        impls_.at(i) = wrapper.baseImpl;
     });
+    record(i);
+}
+
+template <class T>
+void Collection<T>::record(optional<std::size_t> updated) {
+    if (updated && journal->length < CollectionJournal::maxLength) {
+        journal = std::make_shared<CollectionJournal>(CollectionJournal { updated, journal, journal->length + 1 });
+    } else {
+        journal = std::make_shared<CollectionJournal>();
+    }
 }
 
 } // namespace style
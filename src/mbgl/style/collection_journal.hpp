@@ -0,0 +1,33 @@
+#pragma once
+
+#include <mbgl/util/optional.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace mbgl {
+namespace style {
+
+/*
+    Records the in-place updates of a Collection, so that a consumer that holds an earlier
+    state of the collection can find the elements that changed since, without comparing
+    the two states in full.
+
+    Every state of a collection has an entry. If the state was reached by replacing the
+    Impl of a single element, the entry holds that element's index and links to the entry
+    of the state before. Adding, removing or reordering elements starts a new journal with
+    an entry that has neither, as does every `maxLength`th update, which bounds the number
+    of old entries that are kept alive. Consumers that reach such an entry before the one
+    they hold have to fall back to a full comparison.
+*/
+class CollectionJournal {
+public:
+    static constexpr std::size_t maxLength = 256;
+
+    optional<std::size_t> updated;
+    std::shared_ptr<const CollectionJournal> previous;
+    std::size_t length = 1;
+};
+
+} // namespace style
+} // namespace mbgl
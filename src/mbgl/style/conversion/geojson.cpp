@@ -1,6 +1,15 @@
 #include <mbgl/style/conversion/geojson.hpp>
 #include <mbgl/style/conversion/json.hpp>
 
+#include <rapidjson/reader.h>
+#include <rapidjson/error/en.h>
+
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
 namespace mbgl {
 namespace style {
 namespace conversion {
@@ -9,8 +18,649 @@ optional<GeoJSON> Converter<GeoJSON>::operator()(const Convertible& value, Error
     return toGeoJSON(value, error);
 }
 
+namespace {
+
+using Point = mapbox::geometry::point<double>;
+using Geometry = mapbox::geometry::geometry<double>;
+using Feature = mapbox::geometry::feature<double>;
+using Value = mapbox::geometry::value;
+using PropertyMap = mapbox::geometry::property_map;
+
+// The coordinates of a geometry, kept until the type of the geometry is known, since
+// members can come in any order. Arrays are stored in document order with their number
+// of elements, and numbers in a flat list.
+class Coordinates {
+public:
+    class Array {
+    public:
+        uint32_t size = 0;
+        bool numbers = false;
+        bool arrays = false;
+    };
+
+    std::vector<Array> arrays;
+    std::vector<double> numbers;
+
+    // Indices of the arrays that are being read.
+    std::vector<std::size_t> open;
+
+    // Set when the coordinates contain something other than numbers and arrays.
+    bool invalid = false;
+
+    void clear() {
+        arrays.clear();
+        numbers.clear();
+        open.clear();
+        invalid = false;
+    }
+};
+
+// Reads geometries out of coordinates in the order they were stored.
+class CoordinatesReader {
+public:
+    CoordinatesReader(const Coordinates& coordinates_)
+        : coordinates(coordinates_) {
+        if (coordinates.invalid) {
+            throw std::runtime_error("coordinates must be nested arrays of numbers");
+        }
+    }
+
+    Point point() {
+        const Coordinates::Array& array = coordinates.arrays[arrayIndex++];
+        if (array.arrays || array.size < 2) {
+            throw std::runtime_error("coordinates array must have at least 2 numbers");
+        }
+        Point result { coordinates.numbers[numberIndex], coordinates.numbers[numberIndex + 1] };
+        numberIndex += array.size;
+        return result;
+    }
+
+    template <class Container, class Fn>
+    Container container(Fn&& element) {
+        const Coordinates::Array& array = coordinates.arrays[arrayIndex++];
+        if (array.numbers) {
+            throw std::runtime_error("coordinates must be nested arrays of numbers");
+        }
+        Container result;
+        result.reserve(array.size);
+        for (uint32_t i = 0; i < array.size; i++) {
+            result.push_back(element());
+        }
+        return result;
+    }
+
+    template <class Container>
+    Container points() {
+        return container<Container>([&] { return point(); });
+    }
+
+    template <class Container, class Element>
+    Container lines() {
+        return container<Container>([&] { return points<Element>(); });
+    }
+
+private:
+    const Coordinates& coordinates;
+    std::size_t arrayIndex = 0;
+    std::size_t numberIndex = 0;
+};
+
+enum class Member : uint8_t {
+    None,
+    Type,
+    Coordinates,
+    Geometries,
+    Features,
+    Geometry,
+    Properties,
+    ID
+};
+
+// The members of a GeoJSON object that is being read. Objects are converted once they
+// end, and validated in the same order as mapbox::geojson::convert does, so that
+// malformed documents fail with the same errors as with the DOM.
+class Frame {
+public:
+    // The member whose value is being read.
+    Member member = Member::None;
+
+    // Set while reading the elements of "features" or "geometries".
+    bool inArray = false;
+
+    optional<std::string> type;
+
+    bool hasCoordinates = false;
+    bool coordinatesIsArray = false;
+    std::unique_ptr<Coordinates> coordinates;
+
+    bool hasGeometries = false;
+    bool geometriesIsArray = false;
+    mapbox::geometry::geometry_collection<double> geometries;
+    std::string geometriesError;
+
+    bool hasFeatures = false;
+    bool featuresIsArray = false;
+    mapbox::geometry::feature_collection<double> features;
+    std::string featuresError;
+
+    bool hasGeometry = false;
+    optional<Geometry> geometry;
+    std::string geometryError;
+
+    optional<Value> properties;
+    optional<Value> id;
+
+    bool seen(Member m) const {
+        switch (m) {
+        case Member::Type: return bool(type);
+        case Member::Coordinates: return hasCoordinates;
+        case Member::Geometries: return hasGeometries;
+        case Member::Features: return hasFeatures;
+        case Member::Geometry: return hasGeometry;
+        case Member::Properties: return bool(properties);
+        case Member::ID: return bool(id);
+        case Member::None: return false;
+        }
+        return false;
+    }
+};
+
+Geometry toGeometry(Frame& frame) {
+    if (!frame.type) {
+        throw std::runtime_error("Geometry must have a type property");
+    }
+    const std::string& type = *frame.type;
+
+    if (type == "GeometryCollection") {
+        if (!frame.hasGeometries) {
+            throw std::runtime_error("GeometryCollection must have a geometries property");
+        }
+        if (!frame.geometriesIsArray) {
+            throw std::runtime_error("GeometryCollection geometries property must be an array");
+        }
+        if (!frame.geometriesError.empty()) {
+            throw std::runtime_error(frame.geometriesError);
+        }
+        return Geometry { std::move(frame.geometries) };
+    }
+
+    if (!frame.hasCoordinates) {
+        throw std::runtime_error(type + " geometry must have a coordinates property");
+    }
+    if (!frame.coordinatesIsArray) {
+        throw std::runtime_error("coordinates property must be an array");
+    }
+
+    using namespace mapbox::geometry;
+    CoordinatesReader reader(*frame.coordinates);
+    if (type == "Point") {
+        return Geometry { reader.point() };
+    } else if (type == "MultiPoint") {
+        return Geometry { reader.points<multi_point<double>>() };
+    } else if (type == "LineString") {
+        return Geometry { reader.points<line_string<double>>() };
+    } else if (type == "MultiLineString") {
+        return Geometry { reader.lines<multi_line_string<double>, line_string<double>>() };
+    } else if (type == "Polygon") {
+        return Geometry { reader.lines<polygon<double>, linear_ring<double>>() };
+    } else if (type == "MultiPolygon") {
+        return Geometry { reader.container<multi_polygon<double>>([&] {
+            return reader.lines<polygon<double>, linear_ring<double>>();
+        }) };
+    }
+
+    throw std::runtime_error(type + " not yet implemented");
+}
+
+Feature toFeature(Frame& frame) {
+    if (!frame.type) {
+        throw std::runtime_error("Feature must have a type property");
+    }
+    if (*frame.type != "Feature") {
+        throw std::runtime_error("Feature type must be Feature");
+    }
+    if (!frame.hasGeometry) {
+        throw std::runtime_error("Feature must have a geometry property");
+    }
+    if (!frame.geometryError.empty()) {
+        throw std::runtime_error(frame.geometryError);
+    }
+
+    Feature result { std::move(*frame.geometry) };
+
+    if (frame.id) {
+        Value& id = *frame.id;
+        if (id.is<std::string>()) {
+            result.id = mapbox::geometry::identifier { std::move(id.get<std::string>()) };
+        } else if (id.is<uint64_t>()) {
+            result.id = mapbox::geometry::identifier { id.get<uint64_t>() };
+        } else if (id.is<int64_t>()) {
+            result.id = mapbox::geometry::identifier { id.get<int64_t>() };
+        } else if (id.is<double>()) {
+            result.id = mapbox::geometry::identifier { id.get<double>() };
+        } else {
+            throw std::runtime_error("Feature id must be a string or number");
+        }
+    }
+
+    if (frame.properties && !frame.properties->is<mapbox::geometry::null_value_t>()) {
+        if (!frame.properties->is<PropertyMap>()) {
+            throw std::runtime_error("properties must be an object");
+        }
+        result.properties = std::move(frame.properties->get<PropertyMap>());
+    }
+
+    return result;
+}
+
+GeoJSON toGeoJSON(Frame& frame) {
+    if (!frame.type) {
+        throw std::runtime_error("GeoJSON must have a type property");
+    }
+
+    if (*frame.type == "Feature") {
+        return GeoJSON { toFeature(frame) };
+    }
+
+    if (*frame.type == "FeatureCollection") {
+        if (!frame.hasFeatures) {
+            throw std::runtime_error("FeatureCollection must have features property");
+        }
+        if (!frame.featuresIsArray) {
+            throw std::runtime_error("FeatureCollection features property must be an array");
+        }
+        if (!frame.featuresError.empty()) {
+            throw std::runtime_error(frame.featuresError);
+        }
+        return GeoJSON { std::move(frame.features) };
+    }
+
+    return GeoJSON { toGeometry(frame) };
+}
+
+// Builds GeoJSON from the token stream of rapidjson's SAX reader, without materializing
+// the document. Only the coordinates of the geometry that is being read are buffered.
+class GeoJSONHandler {
+public:
+    optional<GeoJSON> result;
+
+    bool Null() { return scalar(Value { mapbox::geometry::null_value }); }
+    bool Bool(bool b) { return scalar(Value { b }); }
+    bool Int(int i) { return Int64(i); }
+    bool Uint(unsigned u) { return Uint64(u); }
+    bool Int64(int64_t i) {
+        // Matches the DOM, which stores -0 as an unsigned integer.
+        return i >= 0 ? Uint64(uint64_t(i)) : number(double(i), Value { i });
+    }
+    bool Uint64(uint64_t u) { return number(double(u), Value { u }); }
+    bool Double(double d) { return number(d, Value { d }); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        return scalar(Value { std::string(str, length) });
+    }
+
+    bool StartObject() {
+        if (skipping()) {
+            skipDepth++;
+        } else if (!values.empty()) {
+            values.emplace_back(Value { PropertyMap() }, std::string());
+        } else if (coordinates) {
+            coordinates->invalid = true;
+            skip();
+        } else if (frames.empty()) {
+            frames.emplace_back();
+        } else {
+            Frame& frame = frames.back();
+            if (frame.inArray) {
+                frames.emplace_back();
+                return true;
+            }
+            switch (frame.member) {
+            case Member::Geometry:
+                frames.emplace_back();
+                break;
+            case Member::Properties:
+            case Member::ID:
+                values.emplace_back(Value { PropertyMap() }, std::string());
+                break;
+            default:
+                invalidValue(frame);
+                skip();
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        if (skipping()) {
+            return true;
+        }
+        if (!values.empty()) {
+            values.back().second.assign(str, length);
+            return true;
+        }
+
+        Frame& frame = frames.back();
+        frame.member = member(str, length);
+        if (frame.seen(frame.member)) {
+            // Like the DOM lookup, only the first of duplicate members counts.
+            frame.member = Member::None;
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        if (skipping()) {
+            endSkipped();
+        } else if (!values.empty()) {
+            endValue();
+        } else {
+            Frame frame = std::move(frames.back());
+            frames.pop_back();
+            endObject(frame);
+            if (frame.coordinates) {
+                frame.coordinates->clear();
+                pool.push_back(std::move(frame.coordinates));
+            }
+        }
+        return true;
+    }
+
+    bool StartArray() {
+        if (skipping()) {
+            skipDepth++;
+        } else if (!values.empty()) {
+            values.emplace_back(Value { std::vector<Value>() }, std::string());
+        } else if (coordinates) {
+            if (!coordinates->open.empty()) {
+                auto& parent = coordinates->arrays[coordinates->open.back()];
+                parent.size++;
+                parent.arrays = true;
+            }
+            coordinates->open.push_back(coordinates->arrays.size());
+            coordinates->arrays.emplace_back();
+        } else if (frames.empty()) {
+            throw std::runtime_error("GeoJSON must be an object");
+        } else {
+            Frame& frame = frames.back();
+            if (frame.inArray) {
+                invalidElement(frame);
+                skip();
+                return true;
+            }
+            switch (frame.member) {
+            case Member::Coordinates:
+                frame.hasCoordinates = true;
+                frame.coordinatesIsArray = true;
+                if (pool.empty()) {
+                    frame.coordinates = std::make_unique<Coordinates>();
+                } else {
+                    frame.coordinates = std::move(pool.back());
+                    pool.pop_back();
+                }
+                coordinates = frame.coordinates.get();
+                return StartArray();
+            case Member::Geometries:
+                frame.hasGeometries = true;
+                frame.geometriesIsArray = true;
+                frame.inArray = true;
+                break;
+            case Member::Features:
+                frame.hasFeatures = true;
+                frame.featuresIsArray = true;
+                frame.inArray = true;
+                break;
+            case Member::Properties:
+            case Member::ID:
+                values.emplace_back(Value { std::vector<Value>() }, std::string());
+                break;
+            default:
+                invalidValue(frame);
+                skip();
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        if (skipping()) {
+            endSkipped();
+        } else if (!values.empty()) {
+            endValue();
+        } else if (coordinates) {
+            coordinates->open.pop_back();
+            if (coordinates->open.empty()) {
+                coordinates = nullptr;
+                frames.back().member = Member::None;
+            }
+        } else {
+            Frame& frame = frames.back();
+            frame.inArray = false;
+            frame.member = Member::None;
+        }
+        return true;
+    }
+
+private:
+    std::vector<Frame> frames;
+
+    // Values of "properties" and "id" members that are being built, each with the key of
+    // its next member if it is an object.
+    std::vector<std::pair<Value, std::string>> values;
+
+    // The coordinates being read, and buffers that can be reused for the next ones.
+    Coordinates* coordinates = nullptr;
+    std::vector<std::unique_ptr<Coordinates>> pool;
+
+    // Depth of the value that is being skipped, or zero.
+    std::size_t skipDepth = 0;
+
+    static Member member(const char* str, rapidjson::SizeType length) {
+        auto is = [&](const char* name) {
+            return std::strlen(name) == length && std::memcmp(name, str, length) == 0;
+        };
+        if (is("type")) return Member::Type;
+        if (is("coordinates")) return Member::Coordinates;
+        if (is("geometries")) return Member::Geometries;
+        if (is("features")) return Member::Features;
+        if (is("geometry")) return Member::Geometry;
+        if (is("properties")) return Member::Properties;
+        if (is("id")) return Member::ID;
+        return Member::None;
+    }
+
+    bool skipping() const {
+        return skipDepth > 0;
+    }
+
+    void skip() {
+        skipDepth = 1;
+    }
+
+    void endSkipped() {
+        if (--skipDepth == 0 && !coordinates && !frames.empty() && !frames.back().inArray) {
+            frames.back().member = Member::None;
+        }
+    }
+
+    bool number(double d, Value&& v) {
+        if (coordinates && !skipping() && values.empty()) {
+            auto& array = coordinates->arrays[coordinates->open.back()];
+            array.size++;
+            array.numbers = true;
+            coordinates->numbers.push_back(d);
+            return true;
+        }
+        return scalar(std::move(v));
+    }
+
+    bool scalar(Value&& v) {
+        if (skipping()) {
+            return true;
+        }
+        if (!values.empty()) {
+            addValue(std::move(v));
+            return true;
+        }
+        if (coordinates) {
+            auto& array = coordinates->arrays[coordinates->open.back()];
+            array.size++;
+            coordinates->invalid = true;
+            return true;
+        }
+        if (frames.empty()) {
+            throw std::runtime_error("GeoJSON must be an object");
+        }
+
+        Frame& frame = frames.back();
+        if (frame.inArray) {
+            invalidElement(frame);
+            return true;
+        }
+
+        switch (frame.member) {
+        case Member::Type:
+            frame.type = v.is<std::string>() ? std::move(v.get<std::string>()) : std::string();
+            break;
+        case Member::Properties:
+            frame.properties = std::move(v);
+            break;
+        case Member::ID:
+            frame.id = std::move(v);
+            break;
+        default:
+            invalidValue(frame);
+            break;
+        }
+        frame.member = Member::None;
+        return true;
+    }
+
+    // Records a member whose value has the wrong type.
+    static void invalidValue(Frame& frame) {
+        switch (frame.member) {
+        case Member::Type:
+            frame.type = std::string();
+            break;
+        case Member::Coordinates:
+            frame.hasCoordinates = true;
+            break;
+        case Member::Geometries:
+            frame.hasGeometries = true;
+            break;
+        case Member::Features:
+            frame.hasFeatures = true;
+            break;
+        case Member::Geometry:
+            frame.hasGeometry = true;
+            frame.geometryError = "Geometry must be an object";
+            break;
+        default:
+            break;
+        }
+    }
+
+    static void invalidElement(Frame& frame) {
+        if (frame.member == Member::Features) {
+            if (frame.featuresError.empty()) {
+                frame.featuresError = "Feature must be an object";
+            }
+        } else if (frame.geometriesError.empty()) {
+            frame.geometriesError = "Geometry must be an object";
+        }
+    }
+
+    void addValue(Value&& v) {
+        auto& parent = values.back();
+        if (parent.first.is<PropertyMap>()) {
+            parent.first.get<PropertyMap>().emplace(std::move(parent.second), std::move(v));
+        } else {
+            parent.first.get<std::vector<Value>>().push_back(std::move(v));
+        }
+    }
+
+    void endValue() {
+        Value v = std::move(values.back().first);
+        values.pop_back();
+        if (!values.empty()) {
+            addValue(std::move(v));
+            return;
+        }
+
+        Frame& frame = frames.back();
+        if (frame.member == Member::Properties) {
+            frame.properties = std::move(v);
+        } else {
+            frame.id = std::move(v);
+        }
+        frame.member = Member::None;
+    }
+
+    void endObject(Frame& frame) {
+        if (frames.empty()) {
+            result = toGeoJSON(frame);
+            return;
+        }
+
+        Frame& parent = frames.back();
+        try {
+            switch (parent.member) {
+            case Member::Features:
+                if (parent.featuresError.empty()) {
+                    parent.features.push_back(toFeature(frame));
+                }
+                break;
+            case Member::Geometries:
+                if (parent.geometriesError.empty()) {
+                    parent.geometries.push_back(toGeometry(frame));
+                }
+                break;
+            default:
+                parent.hasGeometry = true;
+                parent.member = Member::None;
+                parent.geometry = toGeometry(frame);
+                break;
+            }
+        } catch (const std::exception& ex) {
+            switch (parent.member) {
+            case Member::Features:
+                parent.featuresError = ex.what();
+                break;
+            case Member::Geometries:
+                parent.geometriesError = ex.what();
+                break;
+            default:
+                parent.geometryError = ex.what();
+                break;
+            }
+        }
+    }
+};
+
+} // namespace
+
 optional<GeoJSON> parseGeoJSON(const std::string& value, Error& error) {
-    return convertJSON<GeoJSON>(value, error);
+    GeoJSONHandler handler;
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(value.c_str());
+
+    try {
+        const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(stream, handler);
+        if (result.IsError()) {
+            std::stringstream message;
+            message << result.Offset() << " - " << rapidjson::GetParseError_En(result.Code());
+            error = { message.str() };
+            return {};
+        }
+    } catch (const std::exception& ex) {
+        error = { ex.what() };
+        return {};
+    }
+
+    return std::move(handler.result);
 }
 
 } // namespace conversion
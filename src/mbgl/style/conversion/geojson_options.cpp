@@ -77,6 +77,16 @@ optional<GeoJSONOptions> Converter<GeoJSONOptions>::operator()(const Convertible
         }
     }
 
+    const auto pointCloudValue = objectMember(value, "pointCloud");
+    if (pointCloudValue) {
+        if (toBool(*pointCloudValue)) {
+            options.pointCloud = *toBool(*pointCloudValue);
+        } else {
+            error.message = "GeoJSON source pointCloud value must be a boolean";
+            return nullopt;
+        }
+    }
+
     return { options };
 }
 
@@ -1,6 +1,16 @@
 #include <mbgl/style/parser.hpp>
 #include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/layers/background_layer_impl.hpp>
+#include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/layers/custom_layer.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer_impl.hpp>
+#include <mbgl/style/layers/heatmap_layer_impl.hpp>
+#include <mbgl/style/layers/hillshade_layer_impl.hpp>
+#include <mbgl/style/layers/line_layer_impl.hpp>
+#include <mbgl/style/layers/raster_layer_impl.hpp>
 #include <mbgl/style/layers/symbol_layer.hpp>
+#include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/style/rapidjson_conversion.hpp>
 #include <mbgl/style/conversion.hpp>
 #include <mbgl/style/conversion/coordinate.hpp>
@@ -18,6 +28,7 @@
 #include <rapidjson/error/en.h>
 
 #include <algorithm>
+#include <cassert>
 #include <set>
 #include <sstream>
 
@@ -153,7 +164,21 @@ void Parser::parseSources(const JSValue& value) {
         return;
     }
 
-    for (const auto& property : value.GetObject()) {
+    sourcesDocument.CopyFrom(value, sourcesDocument.GetAllocator());
+    sources = createSources();
+
+    for (const auto& source : sources) {
+        sourcesMap.emplace(source->getID(), source.get());
+    }
+}
+
+std::vector<std::unique_ptr<Source>> Parser::createSources() const {
+    std::vector<std::unique_ptr<Source>> result;
+    if (!sourcesDocument.IsObject()) {
+        return result;
+    }
+
+    for (const auto& property : sourcesDocument.GetObject()) {
         std::string id { property.name.GetString(), property.name.GetStringLength() };
 
         conversion::Error error;
@@ -164,9 +189,10 @@ void Parser::parseSources(const JSValue& value) {
             continue;
         }
 
-        sourcesMap.emplace(id, (*source).get());
-        sources.emplace_back(std::move(*source));
+        result.emplace_back(std::move(*source));
     }
+
+    return result;
 }
 
 void Parser::parseLayers(const JSValue& value) {
@@ -273,6 +299,33 @@ void Parser::parseLayer(const std::string& id, const JSValue& value, std::unique
     }
 }
 
+namespace {
+
+// Creates a layer of the same type, sharing the implementation.
+struct LayerFactory {
+    template <class T>
+    std::unique_ptr<Layer> operator()(T& layer) const {
+        return std::make_unique<T>(staticImmutableCast<typename T::Impl>(layer.baseImpl));
+    }
+
+    // Custom layers can't be declared in a style document.
+    std::unique_ptr<Layer> operator()(CustomLayer&) const {
+        assert(false);
+        return nullptr;
+    }
+};
+
+} // namespace
+
+std::vector<std::unique_ptr<Layer>> Parser::createLayers() const {
+    std::vector<std::unique_ptr<Layer>> result;
+    result.reserve(layers.size());
+    for (const auto& layer : layers) {
+        result.push_back(layer->accept(LayerFactory()));
+    }
+    return result;
+}
+
 std::vector<FontStack> Parser::fontStacks() const {
     std::set<FontStack> result;
 
@@ -44,6 +44,13 @@ public:
     // Statically evaluate layer properties to determine what font stacks are used.
     std::vector<FontStack> fontStacks() const;
 
+    // Create new layers that share their implementations with the parsed ones.
+    std::vector<std::unique_ptr<Layer>> createLayers() const;
+
+    // Convert the sources of the parsed document again. Sources can't be shared,
+    // because they own their loading state and data.
+    std::vector<std::unique_ptr<Source>> createSources() const;
+
 private:
     void parseTransition(const JSValue&);
     void parseLight(const JSValue&);
@@ -51,6 +58,7 @@ private:
     void parseLayers(const JSValue&);
     void parseLayer(const std::string& id, const JSValue&, std::unique_ptr<Layer>&);
 
+    JSDocument sourcesDocument;
     std::unordered_map<std::string, const Source*> sourcesMap;
     std::unordered_map<std::string, std::pair<const JSValue&, std::unique_ptr<Layer>>> layersMap;
 
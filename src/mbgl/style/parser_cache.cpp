@@ -0,0 +1,57 @@
+#include <mbgl/style/parser_cache.hpp>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace mbgl {
+namespace style {
+
+namespace {
+
+std::mutex mutex;
+std::unordered_map<std::string, std::weak_ptr<const Parser>> parsers;
+
+} // namespace
+
+std::shared_ptr<const Parser> ParserCache::parse(const std::string& json,
+                                                 std::vector<std::unique_ptr<Source>>& sources) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = parsers.find(json);
+        if (it != parsers.end()) {
+            if (auto parser = it->second.lock()) {
+                sources = parser->createSources();
+                return parser;
+            }
+            parsers.erase(it);
+        }
+    }
+
+    // Parse without holding the lock, so that Maps loading different documents don't
+    // wait for each other. Maps racing to parse the same document each parse it.
+    auto parser = std::make_shared<Parser>();
+    if (auto error = parser->parse(json)) {
+        std::rethrow_exception(error);
+    }
+    sources = std::move(parser->sources);
+    parser->sources.clear();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto it = parsers.begin(); it != parsers.end();) {
+        it = it->second.expired() ? parsers.erase(it) : std::next(it);
+    }
+    parsers[json] = parser;
+    return parser;
+}
+
+std::size_t ParserCache::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::size_t result = 0;
+    for (const auto& entry : parsers) {
+        result += !entry.second.expired();
+    }
+    return result;
+}
+
+} // namespace style
+} // namespace mbgl
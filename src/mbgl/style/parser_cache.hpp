@@ -0,0 +1,31 @@
+#pragma once
+
+#include <mbgl/style/parser.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mbgl {
+namespace style {
+
+// Shares parsed style documents between the Maps of a process. Maps loading a
+// document that another Map holds get its parser, and create their layers from
+// the parsed layers' immutable implementations instead of parsing the document
+// and converting its expressions again.
+//
+// Parsers are held weakly, keyed by the contents of the document, so a document is
+// parsed again once no Map uses it anymore.
+class ParserCache {
+public:
+    // Returns the parser for the document, parsing it if needed. `sources` receives
+    // sources owned by the caller. Throws if the document can't be parsed.
+    static std::shared_ptr<const Parser> parse(const std::string& json,
+                                               std::vector<std::unique_ptr<Source>>& sources);
+
+    // The number of parsed documents that are still in use.
+    static std::size_t size();
+};
+
+} // namespace style
+} // namespace mbgl
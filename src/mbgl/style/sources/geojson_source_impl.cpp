@@ -2,10 +2,14 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/util/string.hpp>
+#include <mbgl/math/clamp.hpp>
+#include <mbgl/util/geometry.hpp>
+#include <mbgl/util/feature.hpp>
 
 #include <mapbox/geojsonvt.hpp>
 #include <supercluster.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace mbgl {
@@ -39,6 +43,180 @@ private:
     mapbox::supercluster::Supercluster impl;
 };
 
+// Stores a collection of point features once, sorted along a Hilbert curve. Every
+// tile covers a single contiguous range of that curve, so cutting a tile is a pair of
+// binary searches per neighbouring tile instead of a recursive clip. Coordinates are
+// kept in a packed buffer of quantized positions; only properties and identifiers are
+// kept per feature, and only when any feature has them.
+class PointCloudData : public GeoJSONData {
+public:
+    static std::unique_ptr<PointCloudData> create(const GeoJSON& geoJSON, int16_t buffer) {
+        if (!geoJSON.is<mapbox::geometry::feature_collection<double>>()) {
+            return nullptr;
+        }
+
+        const auto& collection = geoJSON.get<mapbox::geometry::feature_collection<double>>();
+        for (const auto& feature : collection) {
+            if (!feature.geometry.is<mapbox::geometry::point<double>>()) {
+                return nullptr;
+            }
+        }
+
+        return std::make_unique<PointCloudData>(collection, buffer);
+    }
+
+    PointCloudData(const mapbox::geometry::feature_collection<double>& collection, int16_t buffer_)
+        : buffer(buffer_) {
+        std::vector<Point<uint32_t>> unsortedPoints;
+        std::vector<std::pair<uint64_t, std::size_t>> order;
+        unsortedPoints.reserve(collection.size());
+        order.reserve(collection.size());
+
+        for (const auto& feature : collection) {
+            const auto& point = feature.geometry.get<mapbox::geometry::point<double>>();
+            const double sine = std::sin(point.y * M_PI / 180);
+            const double x = point.x / 360 + 0.5;
+            const double y = 0.5 - 0.25 * std::log((1 + sine) / (1 - sine)) / M_PI;
+            unsortedPoints.emplace_back(quantize(x), quantize(y));
+            order.emplace_back(hilbertIndex(unsortedPoints.back().x, unsortedPoints.back().y), order.size());
+        }
+
+        std::sort(order.begin(), order.end());
+
+        const bool hasProperties = std::any_of(collection.begin(), collection.end(), [] (const auto& feature) {
+            return !feature.properties.empty();
+        });
+        const bool hasIdentifiers = std::any_of(collection.begin(), collection.end(), [] (const auto& feature) {
+            return bool(feature.id);
+        });
+
+        keys.reserve(order.size());
+        points.reserve(order.size());
+        if (hasProperties) {
+            properties.reserve(order.size());
+        }
+        if (hasIdentifiers) {
+            identifiers.reserve(order.size());
+        }
+
+        for (const auto& entry : order) {
+            keys.push_back(entry.first);
+            points.push_back(unsortedPoints[entry.second]);
+            if (hasProperties) {
+                properties.push_back(collection[entry.second].properties);
+            }
+            if (hasIdentifiers) {
+                identifiers.push_back(collection[entry.second].id);
+            }
+        }
+    }
+
+    bool isPointCloud() const final {
+        return true;
+    }
+
+    mapbox::geometry::feature_collection<int16_t> getTile(const CanonicalTileID& tileID) final {
+        mapbox::geometry::feature_collection<int16_t> result;
+        if (tileID.z > levels) {
+            return result;
+        }
+
+        const uint32_t shift = levels - tileID.z;
+        const int64_t worldTiles = int64_t(1) << tileID.z;
+
+        // Points in the tile's buffer may live in any of its eight neighbours, including
+        // those across the antimeridian.
+        struct Range {
+            std::size_t begin;
+            std::size_t end;
+            int64_t wrap;
+        };
+        std::vector<Range> ranges;
+
+        for (int64_t dy = -1; dy <= 1; dy++) {
+            const int64_t y = int64_t(tileID.y) + dy;
+            if (y < 0 || y >= worldTiles) {
+                continue;
+            }
+            for (int64_t dx = -1; dx <= 1; dx++) {
+                const int64_t x = int64_t(tileID.x) + dx;
+                const int64_t wrap = x < 0 ? -1 : (x >= worldTiles ? 1 : 0);
+                const uint64_t first = hilbertIndex(uint32_t(x - wrap * worldTiles) << shift, uint32_t(y) << shift) >> (2 * shift) << (2 * shift);
+                const uint64_t last = first + (uint64_t(1) << (2 * shift));
+                const auto begin = std::lower_bound(keys.begin(), keys.end(), first);
+                const auto end = std::lower_bound(begin, keys.end(), last);
+                if (begin != end) {
+                    ranges.push_back({ std::size_t(begin - keys.begin()), std::size_t(end - keys.begin()), wrap });
+                }
+            }
+        }
+
+        // Emit points in curve order regardless of which neighbour they come from.
+        std::sort(ranges.begin(), ranges.end(), [] (const Range& a, const Range& b) {
+            return a.begin < b.begin;
+        });
+
+        const double scale = double(util::EXTENT) / double(uint64_t(1) << shift);
+        const double min = -buffer;
+        const double max = util::EXTENT + buffer;
+
+        for (const auto& range : ranges) {
+            for (std::size_t i = range.begin; i < range.end; i++) {
+                const double x = (double(points[i].x) + double(range.wrap) * double(uint64_t(1) << levels)) * scale - double(tileID.x) * util::EXTENT;
+                const double y = double(points[i].y) * scale - double(tileID.y) * util::EXTENT;
+                if (x < min || x > max || y < min || y > max) {
+                    continue;
+                }
+
+                mapbox::geometry::feature<int16_t> feature { mapbox::geometry::point<int16_t>(::round(x), ::round(y)) };
+                if (!properties.empty()) {
+                    feature.properties = properties[i];
+                }
+                if (!identifiers.empty()) {
+                    feature.id = identifiers[i];
+                }
+                result.push_back(std::move(feature));
+            }
+        }
+
+        return result;
+    }
+
+private:
+    // Number of subdivisions of the curve; points are quantized to 2^levels per axis,
+    // which resolves a full tile extent up to zoom levels - log2(EXTENT).
+    static constexpr uint32_t levels = 31;
+
+    static uint32_t quantize(double value) {
+        const double max = double((uint64_t(1) << levels) - 1);
+        return uint32_t(util::clamp(std::floor(value * double(uint64_t(1) << levels)), 0.0, max));
+    }
+
+    static uint64_t hilbertIndex(uint32_t x, uint32_t y) {
+        const uint32_t n = uint32_t(1) << levels;
+        uint64_t d = 0;
+        for (uint32_t s = n >> 1; s > 0; s >>= 1) {
+            const uint32_t rx = (x & s) > 0;
+            const uint32_t ry = (y & s) > 0;
+            d += uint64_t(s) * s * ((3 * rx) ^ ry);
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = n - 1 - x;
+                    y = n - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return d;
+    }
+
+    const int16_t buffer;
+    std::vector<uint64_t> keys;
+    std::vector<Point<uint32_t>> points;
+    std::vector<PropertyMap> properties;
+    std::vector<optional<FeatureIdentifier>> identifiers;
+};
+
 GeoJSONSource::Impl::Impl(std::string id_, GeoJSONOptions options_)
     : Source::Impl(SourceType::GeoJSON, std::move(id_)),
       options(std::move(options_)) {
@@ -59,12 +237,18 @@ GeoJSONSource::Impl::Impl(const Impl& other, const GeoJSON& geoJSON)
         data = std::make_unique<SuperclusterData>(
             geoJSON.get<mapbox::geometry::feature_collection<double>>(), clusterOptions);
     } else {
-        mapbox::geojsonvt::Options vtOptions;
-        vtOptions.maxZoom = options.maxzoom;
-        vtOptions.extent = util::EXTENT;
-        vtOptions.buffer = ::round(scale * options.buffer);
-        vtOptions.tolerance = scale * options.tolerance;
-        data = std::make_unique<GeoJSONVTData>(geoJSON, vtOptions);
+        if (options.pointCloud) {
+            data = PointCloudData::create(geoJSON, ::round(scale * options.buffer));
+        }
+
+        if (!data) {
+            mapbox::geojsonvt::Options vtOptions;
+            vtOptions.maxZoom = options.maxzoom;
+            vtOptions.extent = util::EXTENT;
+            vtOptions.buffer = ::round(scale * options.buffer);
+            vtOptions.tolerance = scale * options.tolerance;
+            data = std::make_unique<GeoJSONVTData>(geoJSON, vtOptions);
+        }
     }
 }
 
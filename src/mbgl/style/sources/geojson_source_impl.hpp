@@ -15,6 +15,10 @@ class GeoJSONData {
 public:
     virtual ~GeoJSONData() = default;
     virtual mapbox::geometry::feature_collection<int16_t> getTile(const CanonicalTileID&) = 0;
+
+    // Whether the tiles hold only points of a point cloud source, which circle and heatmap
+    // layers draw with one vertex per point.
+    virtual bool isPointCloud() const { return false; }
 };
 
 class GeoJSONSource::Impl : public Source::Impl {
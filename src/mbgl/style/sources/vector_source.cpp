@@ -33,6 +33,19 @@ optional<std::string> VectorSource::getURL() const {
     return urlOrTileset.get<std::string>();
 }
 
+void VectorSource::setLineSimplificationTolerance(float tolerance) {
+    if (tolerance == getLineSimplificationTolerance()) {
+        return;
+    }
+
+    baseImpl = makeMutable<Impl>(impl(), tolerance);
+    observer->onSourceChanged(*this);
+}
+
+float VectorSource::getLineSimplificationTolerance() const {
+    return impl().getLineSimplificationTolerance();
+}
+
 void VectorSource::loadDescription(FileSource& fileSource) {
     if (urlOrTileset.is<Tileset>()) {
         baseImpl = makeMutable<Impl>(impl(), urlOrTileset.get<Tileset>());
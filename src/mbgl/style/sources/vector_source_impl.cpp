@@ -9,13 +9,24 @@ VectorSource::Impl::Impl(std::string id_)
 
 VectorSource::Impl::Impl(const Impl& other, Tileset tileset_)
     : Source::Impl(other),
-      tileset(std::move(tileset_)) {
+      tileset(std::move(tileset_)),
+      lineSimplificationTolerance(other.lineSimplificationTolerance) {
+}
+
+VectorSource::Impl::Impl(const Impl& other, float lineSimplificationTolerance_)
+    : Source::Impl(other),
+      tileset(other.tileset),
+      lineSimplificationTolerance(lineSimplificationTolerance_) {
 }
 
 optional<Tileset> VectorSource::Impl::getTileset() const {
     return tileset;
 }
 
+float VectorSource::Impl::getLineSimplificationTolerance() const {
+    return lineSimplificationTolerance;
+}
+
 optional<std::string> VectorSource::Impl::getAttribution() const {
     if (!tileset) {
         return {};
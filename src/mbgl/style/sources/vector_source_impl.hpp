@@ -10,13 +10,16 @@ class VectorSource::Impl : public Source::Impl {
 public:
     Impl(std::string id);
     Impl(const Impl&, Tileset);
+    Impl(const Impl&, float lineSimplificationTolerance);
 
     optional<Tileset> getTileset() const;
+    float getLineSimplificationTolerance() const;
 
     optional<std::string> getAttribution() const final;
 
 private:
     optional<Tileset> tileset;
+    float lineSimplificationTolerance = 0;
 };
 
 } // namespace style
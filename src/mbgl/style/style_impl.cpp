@@ -12,7 +12,7 @@
 #include <mbgl/style/layers/raster_layer.hpp>
 #include <mbgl/style/layers/hillshade_layer.hpp>
 #include <mbgl/style/layer_impl.hpp>
-#include <mbgl/style/parser.hpp>
+#include <mbgl/style/parser_cache.hpp>
 #include <mbgl/style/transition_options.hpp>
 #include <mbgl/sprite/sprite_loader.hpp>
 #include <mbgl/util/exception.hpp>
@@ -74,13 +74,16 @@ void Style::Impl::loadURL(const std::string& url_) {
 }
 
 void Style::Impl::parse(const std::string& json_) {
-    Parser parser;
+    std::shared_ptr<const Parser> parser;
+    std::vector<std::unique_ptr<Source>> parsedSources;
 
-    if (auto error = parser.parse(json_)) {
-        std::string message = "Failed to parse style: " + util::toString(error);
+    try {
+        parser = ParserCache::parse(json_, parsedSources);
+    } catch (...) {
+        std::string message = "Failed to parse style: " + util::toString(std::current_exception());
         Log::Error(Event::ParseStyle, message.c_str());
         observer->onStyleError(std::make_exception_ptr(util::StyleParseException(message)));
-        observer->onResourceError(error);
+        observer->onResourceError(std::current_exception());
         return;
     }
 
@@ -95,25 +98,26 @@ void Style::Impl::parse(const std::string& json_) {
     transitionOptions = {};
     transitionOptions.duration = util::DEFAULT_TRANSITION_DURATION;
 
-    for (auto& source : parser.sources) {
+    for (auto& source : parsedSources) {
         addSource(std::move(source));
     }
 
-    for (auto& layer : parser.layers) {
+    for (auto& layer : parser->createLayers()) {
         addLayer(std::move(layer));
     }
 
-    name = parser.name;
-    defaultCamera.center = parser.latLng;
-    defaultCamera.zoom = parser.zoom;
-    defaultCamera.angle = parser.bearing;
-    defaultCamera.pitch = parser.pitch;
+    name = parser->name;
+    defaultCamera.center = parser->latLng;
+    defaultCamera.zoom = parser->zoom;
+    defaultCamera.angle = parser->bearing;
+    defaultCamera.pitch = parser->pitch;
 
-    setLight(std::make_unique<Light>(parser.light));
+    setLight(std::make_unique<Light>(parser->light));
 
     spriteLoaded = false;
-    spriteLoader->load(parser.spriteURL, scheduler, fileSource);
-    glyphURL = parser.glyphURL;
+    spriteLoader->load(parser->spriteURL, scheduler, fileSource);
+    glyphURL = parser->glyphURL;
+    parsed = std::move(parser);
 
     loaded = true;
     observer->onStyleLoaded();
@@ -358,5 +362,17 @@ Immutable<std::vector<Immutable<Layer::Impl>>> Style::Impl::getLayerImpls() cons
     return layers.getImpls();
 }
 
+std::shared_ptr<const CollectionJournal> Style::Impl::getImageJournal() const {
+    return images.getJournal();
+}
+
+std::shared_ptr<const CollectionJournal> Style::Impl::getSourceJournal() const {
+    return sources.getJournal();
+}
+
+std::shared_ptr<const CollectionJournal> Style::Impl::getLayerJournal() const {
+    return layers.getJournal();
+}
+
 } // namespace style
 } // namespace mbgl
@@ -32,6 +32,8 @@ class SpriteLoader;
 
 namespace style {
 
+class Parser;
+
 class Style::Impl : public SpriteLoaderObserver,
                     public SourceObserver,
                     public LayerObserver,
@@ -89,6 +91,10 @@ public:
     Immutable<std::vector<Immutable<Source::Impl>>> getSourceImpls() const;
     Immutable<std::vector<Immutable<Layer::Impl>>> getLayerImpls() const;
 
+    std::shared_ptr<const CollectionJournal> getImageJournal() const;
+    std::shared_ptr<const CollectionJournal> getSourceJournal() const;
+    std::shared_ptr<const CollectionJournal> getLayerJournal() const;
+
     void dumpDebugLogs() const;
 
     bool mutated = false;
@@ -104,6 +110,9 @@ private:
     std::string url;
     std::string json;
 
+    // Keeps the parsed document shared with other Maps using the same style.
+    std::shared_ptr<const Parser> parsed;
+
     std::unique_ptr<AsyncRequest> styleRequest;
     std::unique_ptr<SpriteLoader> spriteLoader;
 
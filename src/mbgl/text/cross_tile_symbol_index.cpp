@@ -4,17 +4,26 @@
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/tile/tile.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+
 namespace mbgl {
 
 
-TileLayerIndex::TileLayerIndex(OverscaledTileID coord_, std::vector<SymbolInstance>& symbolInstances, uint32_t bucketInstanceId_)
+TileLayerIndex::TileLayerIndex(OverscaledTileID coord_, const std::vector<SymbolInstance>& symbolInstances, const std::vector<LabelKeyID>& keys, uint32_t bucketInstanceId_)
     : coord(coord_), bucketInstanceId(bucketInstanceId_) {
-        for (SymbolInstance& symbolInstance : symbolInstances) {
-            indexedSymbolInstances[symbolInstance.key].emplace_back(symbolInstance.crossTileID, getScaledCoordinates(symbolInstance, coord));
+        assert(symbolInstances.size() == keys.size());
+        indexedSymbolInstances.reserve(symbolInstances.size());
+        for (std::size_t i = 0; i < symbolInstances.size(); i++) {
+            indexedSymbolInstances.emplace_back(symbolInstances[i].crossTileID, getScaledCoordinates(symbolInstances[i], coord), keys[i], static_cast<uint32_t>(i));
         }
+        std::sort(indexedSymbolInstances.begin(), indexedSymbolInstances.end(), [](const IndexedSymbolInstance& a, const IndexedSymbolInstance& b) {
+            return std::tie(a.key, a.coord.x, a.order) < std::tie(b.key, b.coord.x, b.order);
+        });
     }
 
-Point<int64_t> TileLayerIndex::getScaledCoordinates(SymbolInstance& symbolInstance, const OverscaledTileID& childTileCoord) {
+Point<int64_t> TileLayerIndex::getScaledCoordinates(const SymbolInstance& symbolInstance, const OverscaledTileID& childTileCoord) const {
     // Round anchor positions to roughly 4 pixel grid
     const double roundingFactor = 512.0 / util::EXTENT / 2.0;
     const double scale = roundingFactor / std::pow(2, childTileCoord.canonical.z - coord.canonical.z);
@@ -24,37 +33,41 @@ Point<int64_t> TileLayerIndex::getScaledCoordinates(SymbolInstance& symbolInstan
     };
 }
 
-void TileLayerIndex::findMatches(std::vector<SymbolInstance>& symbolInstances, const OverscaledTileID& newCoord, std::set<uint32_t>& zoomCrossTileIDs) {
-    float tolerance = coord.canonical.z < newCoord.canonical.z ? 1 : std::pow(2, coord.canonical.z - newCoord.canonical.z);
+void TileLayerIndex::findMatches(std::vector<SymbolInstance>& symbolInstances, const std::vector<LabelKeyID>& keys, const OverscaledTileID& newCoord, std::unordered_set<uint32_t>& zoomCrossTileIDs) const {
+    const int64_t tolerance = coord.canonical.z < newCoord.canonical.z ? 1 : int64_t(1) << (coord.canonical.z - newCoord.canonical.z);
 
-    for (auto& symbolInstance : symbolInstances) {
+    for (std::size_t i = 0; i < symbolInstances.size(); i++) {
+        SymbolInstance& symbolInstance = symbolInstances[i];
         if (symbolInstance.crossTileID) {
             // already has a match, skip
             continue;
         }
 
-        auto it = indexedSymbolInstances.find(symbolInstance.key);
-        if (it == indexedSymbolInstances.end()) {
-            // No symbol with this key in this bucket
-            continue;
-        }
-
         auto scaledSymbolCoord = getScaledCoordinates(symbolInstance, newCoord);
 
-        for (IndexedSymbolInstance& thisTileSymbol: it->second) {
-            // Return any symbol with the same keys whose coordinates are within 1
-            // grid unit. (with a 4px grid, this covers a 12px by 12px area)
-            if (std::abs(thisTileSymbol.coord.x - scaledSymbolCoord.x) <= tolerance &&
-                std::abs(thisTileSymbol.coord.y - scaledSymbolCoord.y) <= tolerance &&
-                zoomCrossTileIDs.find(thisTileSymbol.crossTileID) == zoomCrossTileIDs.end()) {
-                // Once we've marked ourselves duplicate against this parent symbol,
-                // don't let any other symbols at the same zoom level duplicate against
-                // the same parent (see issue #10844)
-                zoomCrossTileIDs.insert(thisTileSymbol.crossTileID);
-                symbolInstance.crossTileID = thisTileSymbol.crossTileID;
-                break;
+        // Return the first symbol with the same key whose coordinates are within 1
+        // grid unit. (with a 4px grid, this covers a 12px by 12px area)
+        auto it = std::lower_bound(indexedSymbolInstances.begin(), indexedSymbolInstances.end(),
+            std::make_tuple(keys[i], scaledSymbolCoord.x - tolerance),
+            [](const IndexedSymbolInstance& a, const std::tuple<LabelKeyID, int64_t>& b) {
+                return std::tie(a.key, a.coord.x) < b;
+            });
+        const IndexedSymbolInstance* match = nullptr;
+        for (; it != indexedSymbolInstances.end() && it->key == keys[i] && it->coord.x <= scaledSymbolCoord.x + tolerance; ++it) {
+            if (std::abs(it->coord.y - scaledSymbolCoord.y) <= tolerance &&
+                (!match || it->order < match->order) &&
+                zoomCrossTileIDs.find(it->crossTileID) == zoomCrossTileIDs.end()) {
+                match = &*it;
             }
         }
+
+        if (match) {
+            // Once we've marked ourselves duplicate against this parent symbol,
+            // don't let any other symbols at the same zoom level duplicate against
+            // the same parent (see issue #10844)
+            zoomCrossTileIDs.insert(match->crossTileID);
+            symbolInstance.crossTileID = match->crossTileID;
+        }
     }
 }
 
@@ -88,7 +101,7 @@ void CrossTileSymbolLayerIndex::handleWrapJump(float newLng) {
 }
 
 bool CrossTileSymbolLayerIndex::addBucket(const OverscaledTileID& tileID, SymbolBucket& bucket, uint32_t& maxCrossTileID) {
-    const auto& thisZoomIndexes = indexes[tileID.overscaledZ];
+    auto& thisZoomIndexes = indexes[tileID.overscaledZ];
     auto previousIndex = thisZoomIndexes.find(tileID);
     if (previousIndex != thisZoomIndexes.end()) {
         if (previousIndex->second.bucketInstanceId == bucket.bucketInstanceId) {
@@ -106,20 +119,23 @@ bool CrossTileSymbolLayerIndex::addBucket(const OverscaledTileID& tileID, Symbol
         symbolInstance.crossTileID = 0;
     }
 
-    for (auto& it : indexes) {
+    const std::vector<LabelKeyID> bucketKeys = acquireKeys(bucket.symbolInstances);
+    auto& zoomCrossTileIDs = usedCrossTileIDs[tileID.overscaledZ];
+
+    for (const auto& it : indexes) {
         auto zoom = it.first;
-        auto zoomIndexes = it.second;
+        const auto& zoomIndexes = it.second;
         if (zoom > tileID.overscaledZ) {
-            for (auto& childIndex : zoomIndexes) {
+            for (const auto& childIndex : zoomIndexes) {
                 if (childIndex.second.coord.isChildOf(tileID)) {
-                    childIndex.second.findMatches(bucket.symbolInstances, tileID, usedCrossTileIDs[tileID.overscaledZ]);
+                    childIndex.second.findMatches(bucket.symbolInstances, bucketKeys, tileID, zoomCrossTileIDs);
                 }
             }
         } else {
             auto parentTileID = tileID.scaledTo(zoom);
             auto parentIndex = zoomIndexes.find(parentTileID);
             if (parentIndex != zoomIndexes.end()) {
-                parentIndex->second.findMatches(bucket.symbolInstances, tileID, usedCrossTileIDs[tileID.overscaledZ]);
+                parentIndex->second.findMatches(bucket.symbolInstances, bucketKeys, tileID, zoomCrossTileIDs);
             }
         }
     }
@@ -128,20 +144,57 @@ bool CrossTileSymbolLayerIndex::addBucket(const OverscaledTileID& tileID, Symbol
         if (!symbolInstance.crossTileID) {
             // symbol did not match any known symbol, assign a new id
             symbolInstance.crossTileID = ++maxCrossTileID;
-            usedCrossTileIDs[tileID.overscaledZ].insert(symbolInstance.crossTileID);
+            zoomCrossTileIDs.insert(symbolInstance.crossTileID);
         }
     }
 
-
-    indexes[tileID.overscaledZ].erase(tileID);
-    indexes[tileID.overscaledZ].emplace(tileID, TileLayerIndex(tileID, bucket.symbolInstances, bucket.bucketInstanceId));
+    if (previousIndex != thisZoomIndexes.end()) {
+        releaseKeys(previousIndex->second);
+        thisZoomIndexes.erase(previousIndex);
+    }
+    thisZoomIndexes.emplace(tileID, TileLayerIndex(tileID, bucket.symbolInstances, bucketKeys, bucket.bucketInstanceId));
     return true;
 }
 
 void CrossTileSymbolLayerIndex::removeBucketCrossTileIDs(uint8_t zoom, const TileLayerIndex& removedBucket) {
-    for (auto key : removedBucket.indexedSymbolInstances) {
-        for (auto indexedSymbolInstance : key.second) {
-            usedCrossTileIDs[zoom].erase(indexedSymbolInstance.crossTileID);
+    auto& zoomCrossTileIDs = usedCrossTileIDs[zoom];
+    for (const auto& indexedSymbolInstance : removedBucket.indexedSymbolInstances) {
+        zoomCrossTileIDs.erase(indexedSymbolInstance.crossTileID);
+    }
+}
+
+std::vector<LabelKeyID> CrossTileSymbolLayerIndex::acquireKeys(const std::vector<SymbolInstance>& symbolInstances) {
+    std::vector<LabelKeyID> result;
+    result.reserve(symbolInstances.size());
+    for (const auto& symbolInstance : symbolInstances) {
+        auto it = keyIDs.find(symbolInstance.key);
+        if (it == keyIDs.end()) {
+            LabelKeyID id;
+            if (freeKeyIDs.empty()) {
+                id = static_cast<LabelKeyID>(keys.size());
+                keys.push_back({ nullptr, 0 });
+            } else {
+                id = freeKeyIDs.back();
+                freeKeyIDs.pop_back();
+            }
+            it = keyIDs.emplace(symbolInstance.key, id).first;
+            // References to the keys of an unordered_map stay valid until they are erased.
+            keys[id].string = &it->first;
+        }
+        keys[it->second].count++;
+        result.push_back(it->second);
+    }
+    return result;
+}
+
+void CrossTileSymbolLayerIndex::releaseKeys(const TileLayerIndex& removedBucket) {
+    for (const auto& indexedSymbolInstance : removedBucket.indexedSymbolInstances) {
+        LabelKey& key = keys[indexedSymbolInstance.key];
+        assert(key.count > 0);
+        if (--key.count == 0) {
+            keyIDs.erase(*key.string);
+            key.string = nullptr;
+            freeKeyIDs.push_back(indexedSymbolInstance.key);
         }
     }
 }
@@ -152,6 +205,7 @@ bool CrossTileSymbolLayerIndex::removeStaleBuckets(const std::unordered_set<uint
         for (auto it = zoomIndexes.second.begin(); it != zoomIndexes.second.end();) {
             if (!currentIDs.count(it->second.bucketInstanceId)) {
                 removeBucketCrossTileIDs(zoomIndexes.first, it->second);
+                releaseKeys(it->second);
                 it = zoomIndexes.second.erase(it);
                 tilesChanged = true;
             } else {
@@ -206,12 +260,12 @@ bool CrossTileSymbolIndex::addLayer(RenderSymbolLayer& symbolLayer, float lng) {
 
 void CrossTileSymbolIndex::pruneUnusedLayers(const std::set<std::string>& usedLayers) {
     std::vector<std::string> unusedLayers;
-    for (auto layerIndex : layerIndexes) {
+    for (const auto& layerIndex : layerIndexes) {
         if (usedLayers.find(layerIndex.first) == usedLayers.end()) {
             unusedLayers.push_back(layerIndex.first);
         }
     }
-    for (auto unusedLayer : unusedLayers) {
+    for (const auto& unusedLayer : unusedLayers) {
         layerIndexes.erase(unusedLayer);
     }
 }
@@ -10,6 +10,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace mbgl {
@@ -18,40 +19,68 @@ class SymbolInstance;
 class RenderSymbolLayer;
 class SymbolBucket;
 
+// A label key interned by CrossTileSymbolLayerIndex, so that symbols can be matched
+// without comparing strings.
+using LabelKeyID = uint32_t;
+
 class IndexedSymbolInstance {
 public:
-    IndexedSymbolInstance(uint32_t crossTileID_, Point<int64_t> coord_)
-        : crossTileID(crossTileID_), coord(coord_)
+    IndexedSymbolInstance(uint32_t crossTileID_, Point<int64_t> coord_, LabelKeyID key_, uint32_t order_)
+        : crossTileID(crossTileID_), coord(coord_), key(key_), order(order_)
     {}
 
     uint32_t crossTileID;
     Point<int64_t> coord;
+    LabelKeyID key;
+    // The position of the symbol in its bucket. Among several matches, the first one wins.
+    uint32_t order;
 };
 
 class TileLayerIndex {
 public:
-    TileLayerIndex(OverscaledTileID coord, std::vector<SymbolInstance>&, uint32_t bucketInstanceId);
+    TileLayerIndex(OverscaledTileID coord, const std::vector<SymbolInstance>&, const std::vector<LabelKeyID>& keys, uint32_t bucketInstanceId);
 
-    Point<int64_t> getScaledCoordinates(SymbolInstance&, const OverscaledTileID&);
-    void findMatches(std::vector<SymbolInstance>&, const OverscaledTileID&, std::set<uint32_t>&);
+    Point<int64_t> getScaledCoordinates(const SymbolInstance&, const OverscaledTileID&) const;
+    void findMatches(std::vector<SymbolInstance>&, const std::vector<LabelKeyID>& keys, const OverscaledTileID&, std::unordered_set<uint32_t>&) const;
     
     OverscaledTileID coord;
     uint32_t bucketInstanceId;
-    std::map<std::u16string,std::vector<IndexedSymbolInstance>> indexedSymbolInstances;
+    // Sorted by key and then by x coordinate, so that the candidates for a match are
+    // found with a binary search.
+    std::vector<IndexedSymbolInstance> indexedSymbolInstances;
 };
 
 class CrossTileSymbolLayerIndex {
 public:
     CrossTileSymbolLayerIndex();
+
+    // Keys point into `keyIDs`, so a copy would refer to the original's strings.
+    CrossTileSymbolLayerIndex(const CrossTileSymbolLayerIndex&) = delete;
+    CrossTileSymbolLayerIndex& operator=(const CrossTileSymbolLayerIndex&) = delete;
+
     bool addBucket(const OverscaledTileID&, SymbolBucket&, uint32_t& maxCrossTileID);
     bool removeStaleBuckets(const std::unordered_set<uint32_t>& currentIDs);
     void handleWrapJump(float newLng);
 private:
     void removeBucketCrossTileIDs(uint8_t zoom, const TileLayerIndex& removedBucket);
 
+    // Interns the keys of the symbols, which are held until they are released.
+    std::vector<LabelKeyID> acquireKeys(const std::vector<SymbolInstance>&);
+    void releaseKeys(const TileLayerIndex&);
+
     std::map<uint8_t, std::map<OverscaledTileID,TileLayerIndex>> indexes;
-    std::map<uint8_t, std::set<uint32_t>> usedCrossTileIDs;
+    std::map<uint8_t, std::unordered_set<uint32_t>> usedCrossTileIDs;
     float lng = 0;
+
+    // Label keys of the indexed symbols, with the number of symbols holding each one.
+    // Slots of keys that are no longer held are reused.
+    struct LabelKey {
+        const std::u16string* string;
+        uint32_t count;
+    };
+    std::unordered_map<std::u16string, LabelKeyID> keyIDs;
+    std::vector<LabelKey> keys;
+    std::vector<LabelKeyID> freeKeyIDs;
 };
 
 class CrossTileSymbolIndex {
@@ -8,13 +8,14 @@ namespace mbgl {
 GeoJSONTile::GeoJSONTile(const OverscaledTileID& overscaledTileID,
                          std::string sourceID_,
                          const TileParameters& parameters,
-                         mapbox::geometry::feature_collection<int16_t> features)
+                         mapbox::geometry::feature_collection<int16_t> features,
+                         bool pointCloud)
     : GeometryTile(overscaledTileID, sourceID_, parameters) {
-    updateData(std::move(features));
+    updateData(std::move(features), pointCloud);
 }
 
-void GeoJSONTile::updateData(mapbox::geometry::feature_collection<int16_t> features) {
-    setData(std::make_unique<GeoJSONTileData>(std::move(features)));
+void GeoJSONTile::updateData(mapbox::geometry::feature_collection<int16_t> features, bool pointCloud) {
+    setData(std::make_unique<GeoJSONTileData>(std::move(features), pointCloud));
 }
     
 void GeoJSONTile::querySourceFeatures(
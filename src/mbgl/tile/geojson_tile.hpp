@@ -12,9 +12,10 @@ public:
     GeoJSONTile(const OverscaledTileID&,
                 std::string sourceID,
                 const TileParameters&,
-                mapbox::geometry::feature_collection<int16_t>);
+                mapbox::geometry::feature_collection<int16_t>,
+                bool pointCloud = false);
 
-    void updateData(mapbox::geometry::feature_collection<int16_t>);
+    void updateData(mapbox::geometry::feature_collection<int16_t>, bool pointCloud = false);
     
     void querySourceFeatures(
         std::vector<Feature>& result,
@@ -69,26 +69,32 @@ private:
 
 class GeoJSONTileData : public GeometryTileData {
 public:
-    GeoJSONTileData(mapbox::geometry::feature_collection<int16_t> features_)
+    GeoJSONTileData(mapbox::geometry::feature_collection<int16_t> features_, bool pointCloud_ = false)
         : features(std::make_shared<mapbox::geometry::feature_collection<int16_t>>(
-              std::move(features_))) {
+              std::move(features_))),
+          pointCloud(pointCloud_) {
     }
 
-    GeoJSONTileData(std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features_)
-        : features(std::move(features_)) {
+    GeoJSONTileData(std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features_, bool pointCloud_ = false)
+        : features(std::move(features_)),
+          pointCloud(pointCloud_) {
     }
 
     std::unique_ptr<GeometryTileData> clone() const override {
-        return std::make_unique<GeoJSONTileData>(features);
+        return std::make_unique<GeoJSONTileData>(features, pointCloud);
     }
 
     std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const override {
         return std::make_unique<GeoJSONTileLayer>(features);
     }
 
+    bool isPointCloud() const override {
+        return pointCloud;
+    }
 
 private:
     std::shared_ptr<const mapbox::geometry::feature_collection<int16_t>> features;
+    const bool pointCloud;
 };
 
 } // namespace mbgl
@@ -43,17 +43,20 @@ using namespace style;
 
 GeometryTile::GeometryTile(const OverscaledTileID& id_,
                            std::string sourceID_,
-                           const TileParameters& parameters)
+                           const TileParameters& parameters,
+                           const float lineSimplificationTolerance)
     : Tile(id_),
       sourceID(std::move(sourceID_)),
       mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
       worker(parameters.workerScheduler,
              ActorRef<GeometryTile>(*this, mailbox),
+             parameters.workerScheduler,
              id_,
              sourceID,
              obsolete,
              parameters.mode,
              parameters.pixelRatio,
+             lineSimplificationTolerance,
              parameters.debugOptions & MapDebugOptions::Collision),
       glyphManager(parameters.glyphManager),
       imageManager(parameters.imageManager),
@@ -257,7 +260,7 @@ void GeometryTile::querySourceFeatures(
     for (auto sourceLayer : *options.sourceLayers) {
         // Go throught all sourceLayers, if any
         // to gather all the features
-        auto layer = getData()->getLayer(sourceLayer);
+        const GeometryTileLayer* layer = latestFeatureIndex->getLayer(sourceLayer);
         
         if (layer) {
             auto featureCount = layer->featureCount();
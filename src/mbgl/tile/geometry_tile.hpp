@@ -26,7 +26,8 @@ class GeometryTile : public Tile, public GlyphRequestor, ImageRequestor {
 public:
     GeometryTile(const OverscaledTileID&,
                  std::string sourceID,
-                 const TileParameters&);
+                 const TileParameters&,
+                 float lineSimplificationTolerance = 0);
 
     ~GeometryTile() override;
 
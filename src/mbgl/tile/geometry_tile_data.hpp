@@ -4,6 +4,8 @@
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <mapbox/geometry/box.hpp>
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -17,6 +19,7 @@ class CanonicalTileID;
 // Each geometry coordinate represents a point in a bidimensional space,
 // varying from -V...0...+V, where V is the maximum extent applicable.
 using GeometryCoordinate = Point<int16_t>;
+using GeometryBox = mapbox::geometry::box<int16_t>;
 
 class GeometryCoordinates : public std::vector<GeometryCoordinate> {
 public:
@@ -67,6 +70,9 @@ public:
     // Returns the layer with the given name. The returned layer object *may* outlive the data
     // object.
     virtual std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const = 0;
+
+    // Whether the data holds only the points of a point cloud GeoJSON source.
+    virtual bool isPointCloud() const { return false; }
 };
 
 // classifies an array of rings into polygons with outer rings and holes
@@ -13,6 +13,10 @@
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/exception.hpp>
 #include <mbgl/util/stopwatch.hpp>
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/util/string_indexer.hpp>
+
+#include <mapbox/geometry/envelope.hpp>
 
 #include <unordered_set>
 
@@ -22,19 +26,23 @@ using namespace style;
 
 GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        ActorRef<GeometryTile> parent_,
+                                       Scheduler& scheduler_,
                                        OverscaledTileID id_,
                                        const std::string& sourceID_,
                                        const std::atomic<bool>& obsolete_,
                                        const MapMode mode_,
                                        const float pixelRatio_,
+                                       const float lineSimplificationTolerance_,
                                        const bool showCollisionBoxes_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
+      scheduler(scheduler_),
       id(std::move(id_)),
       sourceID(sourceID_),
       obsolete(obsolete_),
       mode(mode_),
       pixelRatio(pixelRatio_),
+      lineSimplificationTolerance(lineSimplificationTolerance_),
       showCollisionBoxes(showCollisionBoxes_) {
 }
 
@@ -331,7 +339,8 @@ void GeometryTileWorker::parse() {
     std::unordered_map<std::string, std::unique_ptr<SymbolLayout>> symbolLayoutMap;
     buckets.clear();
     featureIndex = std::make_unique<FeatureIndex>(*data ? (*data)->clone() : nullptr);
-    BucketParameters parameters { id, mode, pixelRatio };
+    BucketParameters parameters { id, mode, pixelRatio, lineSimplificationTolerance,
+                                  *data && (*data)->isPointCloud() };
 
     GlyphDependencies glyphDependencies;
     ImageDependencies imageDependencies;
@@ -340,6 +349,17 @@ void GeometryTileWorker::parse() {
     std::vector<std::unique_ptr<RenderLayer>> renderLayers = toRenderLayers(*layers, id.overscaledZ);
     std::vector<std::vector<const RenderLayer*>> groups = groupByLayout(renderLayers);
 
+    // Non-symbol buckets don't depend on each other, so they are built in parallel
+    // and merged afterwards in group order, which keeps the bucket map and the
+    // feature index identical to a sequential parse.
+    struct BucketTask {
+        const std::vector<const RenderLayer*>& group;
+        std::unique_ptr<GeometryTileLayer> geometryLayer;
+        std::shared_ptr<Bucket> bucket;
+        std::vector<std::pair<std::size_t, GeometryBox>> envelopes;
+    };
+    std::vector<BucketTask> bucketTasks;
+
     for (auto& group : groups) {
         if (obsolete) {
             return;
@@ -351,6 +371,8 @@ void GeometryTileWorker::parse() {
 
         const RenderLayer& leader = *group.at(0);
 
+        // Layers are retrieved on this thread because GeometryTileData implementations
+        // decode their layer table lazily; the returned layers may be read concurrently.
         auto geometryLayer = (*data)->getLayer(leader.baseImpl->sourceLayer);
         if (!geometryLayer) {
             continue;
@@ -365,33 +387,56 @@ void GeometryTileWorker::parse() {
 
         if (leader.is<RenderSymbolLayer>()) {
             auto layout = leader.as<RenderSymbolLayer>()->createLayout(
-                parameters, group, std::move(geometryLayer), glyphDependencies, imageDependencies);
+                parameters, group, std::move(geometryLayer), *featureIndex, glyphDependencies, imageDependencies);
             symbolLayoutMap.emplace(leader.getID(), std::move(layout));
             symbolLayoutsNeedPreparation = true;
         } else {
-            const Filter& filter = leader.baseImpl->filter;
-            const std::string& sourceLayerID = leader.baseImpl->sourceLayer;
-            std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, group);
-
-            for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
-                std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
+            bucketTasks.push_back({ group, std::move(geometryLayer), nullptr, {} });
+        }
+    }
 
-                if (!filter(expression::EvaluationContext { static_cast<float>(this->id.overscaledZ), feature.get() }))
-                    continue;
+    util::parallelFor(scheduler, bucketTasks.size(), [&] (std::size_t index) {
+        BucketTask& task = bucketTasks[index];
+        const RenderLayer& leader = *task.group.at(0);
+        const Filter& filter = leader.baseImpl->filter;
+        std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, task.group);
 
-                GeometryCollection geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries);
-                featureIndex->insert(geometries, i, sourceLayerID, leader.getID());
-            }
+        for (std::size_t i = 0; !obsolete && i < task.geometryLayer->featureCount(); i++) {
+            std::unique_ptr<GeometryTileFeature> feature = task.geometryLayer->getFeature(i);
 
-            if (!bucket->hasData()) {
+            if (!filter(expression::EvaluationContext { static_cast<float>(this->id.overscaledZ), feature.get() }))
                 continue;
-            }
 
-            for (const auto& layer : group) {
-                buckets.emplace(layer->getID(), bucket);
+            GeometryCollection geometries = feature->getGeometries();
+            bucket->addFeature(*feature, geometries);
+            for (const auto& ring : geometries) {
+                task.envelopes.emplace_back(i, mapbox::geometry::envelope(ring));
             }
         }
+
+        task.bucket = std::move(bucket);
+    });
+
+    if (obsolete) {
+        return;
+    }
+
+    for (auto& task : bucketTasks) {
+        const RenderLayer& leader = *task.group.at(0);
+        const StringIdentity sourceLayerID = featureIndex->intern(leader.baseImpl->sourceLayer);
+        const StringIdentity bucketLeaderID = featureIndex->intern(leader.getID());
+
+        for (const auto& envelope : task.envelopes) {
+            featureIndex->insert(envelope.second, envelope.first, sourceLayerID, bucketLeaderID);
+        }
+
+        if (!task.bucket->hasData()) {
+            continue;
+        }
+
+        for (const auto& layer : task.group) {
+            buckets.emplace(layer->getID(), task.bucket);
+        }
     }
 
     symbolLayouts.clear();
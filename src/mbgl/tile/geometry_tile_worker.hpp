@@ -19,6 +19,7 @@ namespace mbgl {
 class GeometryTile;
 class GeometryTileData;
 class SymbolLayout;
+class Scheduler;
 
 namespace style {
 class Layer;
@@ -28,11 +29,13 @@ class GeometryTileWorker {
 public:
     GeometryTileWorker(ActorRef<GeometryTileWorker> self,
                        ActorRef<GeometryTile> parent,
+                       Scheduler& scheduler,
                        OverscaledTileID,
                        const std::string&,
                        const std::atomic<bool>&,
                        const MapMode,
                        const float pixelRatio,
+                       const float lineSimplificationTolerance,
                        const bool showCollisionBoxes_);
     ~GeometryTileWorker();
 
@@ -60,11 +63,15 @@ private:
     ActorRef<GeometryTileWorker> self;
     ActorRef<GeometryTile> parent;
 
+    // Used to build independent buckets of a single tile in parallel.
+    Scheduler& scheduler;
+
     const OverscaledTileID id;
     const std::string sourceID;
     const std::atomic<bool>& obsolete;
     const MapMode mode;
     const float pixelRatio;
+    const float lineSimplificationTolerance;
     
     std::unique_ptr<FeatureIndex> featureIndex;
     std::unordered_map<std::string, std::shared_ptr<Bucket>> buckets;
@@ -19,7 +19,9 @@ RasterDEMTile::RasterDEMTile(const OverscaledTileID& id_,
       loader(*this, id_, parameters, tileset),
       mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
       worker(parameters.workerScheduler,
-             ActorRef<RasterDEMTile>(*this, mailbox)) {
+             ActorRef<RasterDEMTile>(*this, mailbox),
+             id_.canonical.z,
+             tileset.zoomRange.max) {
 
     encoding = tileset.encoding;
     if ( id.canonical.y == 0 ){
@@ -70,7 +72,7 @@ void RasterDEMTile::onError(std::exception_ptr err, const uint64_t resultCorrela
 }
 
 void RasterDEMTile::upload(gl::Context& context) {
-    if (bucket) {
+    if (bucket && bucket->needsUpload()) {
         bucket->upload(context);
     }
 }
@@ -106,9 +108,8 @@ void RasterDEMTile::backfillBorder(const RasterDEMTile& borderTile, const DEMTil
         tileDEM.backfillBorder(borderDEM, dx, dy);
         // update the bitmask to indicate that this tiles have been backfilled by flipping the relevant bit
         this->neighboringTiles = this->neighboringTiles | mask;
-        // mark HillshadeBucket.prepared as false so it runs through the prepare render pass
-        // with the new texture data we just backfilled
-        bucket->setPrepared(false);
+        // updates the prepared hillshade of the bucket with the new data we just backfilled
+        bucket->backfilled();
     }
 }
 
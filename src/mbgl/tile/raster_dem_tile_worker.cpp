@@ -2,12 +2,16 @@
 #include <mbgl/tile/raster_dem_tile.hpp>
 #include <mbgl/renderer/buckets/hillshade_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/premultiply.hpp>
 
 namespace mbgl {
 
-RasterDEMTileWorker::RasterDEMTileWorker(ActorRef<RasterDEMTileWorker>, ActorRef<RasterDEMTile> parent_)
-    : parent(std::move(parent_)) {
+RasterDEMTileWorker::RasterDEMTileWorker(ActorRef<RasterDEMTileWorker>, ActorRef<RasterDEMTile> parent_,
+                                         uint8_t zoom_, uint8_t maxzoom_)
+    : parent(std::move(parent_)),
+      zoom(zoom_),
+      maxzoom(maxzoom_) {
 }
 
 void RasterDEMTileWorker::parse(std::shared_ptr<const std::string> data, uint64_t correlationID, Tileset::DEMEncoding encoding) {
@@ -17,7 +21,11 @@ void RasterDEMTileWorker::parse(std::shared_ptr<const std::string> data, uint64_
     }
 
     try {
-        auto bucket = std::make_unique<HillshadeBucket>(decodeImage(*data), encoding);
+        PremultipliedImage image = decodeImage(*data);
+        auto bucket = std::make_unique<HillshadeBucket>(DEMData(image, encoding));
+        // Only the elevations are kept, so the decoded image can be reused for the next tile.
+        util::ImagePool::release(std::move(image));
+        bucket->prepare(zoom, maxzoom);
         parent.invoke(&RasterDEMTile::onParsed, std::move(bucket), correlationID);
     } catch (...) {
         parent.invoke(&RasterDEMTile::onError, std::current_exception(), correlationID);
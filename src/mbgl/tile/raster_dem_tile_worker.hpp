@@ -12,12 +12,16 @@ class RasterDEMTile;
 
 class RasterDEMTileWorker {
 public:
-    RasterDEMTileWorker(ActorRef<RasterDEMTileWorker>, ActorRef<RasterDEMTile>);
+    // The hillshade is prepared on the worker for the given zoom level and maximum zoom
+    // level of the source, instead of by the renderer.
+    RasterDEMTileWorker(ActorRef<RasterDEMTileWorker>, ActorRef<RasterDEMTile>, uint8_t zoom, uint8_t maxzoom);
 
     void parse(std::shared_ptr<const std::string> data, uint64_t correlationID, Tileset::DEMEncoding encoding);
 
 private:
     ActorRef<RasterDEMTile> parent;
+    const uint8_t zoom;
+    const uint8_t maxzoom;
 };
 
 } // namespace mbgl
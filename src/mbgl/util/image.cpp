@@ -0,0 +1,38 @@
+#include <mbgl/util/image.hpp>
+
+#include <array>
+
+namespace mbgl {
+
+namespace util {
+
+void flipRows(uint8_t* data, std::size_t stride, std::size_t rows) {
+    // Swapping through a small buffer lets memcpy use the widest vector
+    // instructions the CPU supports.
+    if (rows < 2) {
+        return;
+    }
+    std::array<uint8_t, 4096> buffer;
+    for (std::size_t i = 0, j = rows - 1; i < j; i++, j--) {
+        uint8_t* top = data + i * stride;
+        uint8_t* bottom = data + j * stride;
+        for (std::size_t offset = 0; offset < stride; offset += buffer.size()) {
+            const std::size_t length = std::min(buffer.size(), stride - offset);
+            std::memcpy(buffer.data(), top + offset, length);
+            std::memcpy(top + offset, bottom + offset, length);
+            std::memcpy(bottom + offset, buffer.data(), length);
+        }
+    }
+}
+
+} // namespace util
+
+std::string encodeImage(const PremultipliedImage& image, const ImageEncoderOptions& options) {
+    std::string result;
+    encodeImage(image, options, [&](const char* data, std::size_t length) {
+        result.append(data, length);
+    });
+    return result;
+}
+
+} // namespace mbgl
@@ -0,0 +1,75 @@
+#include <mbgl/util/image_pool.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+std::mutex mutex;
+std::unordered_map<std::size_t, std::vector<std::unique_ptr<uint8_t[]>>> buffers;
+// Lengths of pooled buffers in the order they were released, so that the oldest ones
+// are dropped first when the pool is full.
+std::deque<std::size_t> released;
+std::size_t pooledBytes = 0;
+
+} // namespace
+
+std::unique_ptr<uint8_t[]> ImagePool::acquire(const std::size_t length) {
+    if (length == 0) {
+        return {};
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = buffers.find(length);
+        if (it != buffers.end() && !it->second.empty()) {
+            auto buffer = std::move(it->second.back());
+            it->second.pop_back();
+            released.erase(std::find(released.begin(), released.end(), length));
+            pooledBytes -= length;
+            return buffer;
+        }
+    }
+    // Unlike make_unique, this doesn't zero the buffer.
+    return std::unique_ptr<uint8_t[]>(new uint8_t[length]);
+}
+
+void ImagePool::release(std::unique_ptr<uint8_t[]> buffer, const std::size_t length) {
+    if (!buffer || length == 0 || length > maxBytes) {
+        return;
+    }
+    std::vector<std::unique_ptr<uint8_t[]>> dropped;
+    std::lock_guard<std::mutex> lock(mutex);
+    while (pooledBytes + length > maxBytes) {
+        const std::size_t oldest = released.front();
+        released.pop_front();
+        auto& pooled = buffers[oldest];
+        dropped.push_back(std::move(pooled.front()));
+        pooled.erase(pooled.begin());
+        pooledBytes -= oldest;
+    }
+    buffers[length].push_back(std::move(buffer));
+    released.push_back(length);
+    pooledBytes += length;
+}
+
+std::size_t ImagePool::size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pooledBytes;
+}
+
+void ImagePool::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    buffers.clear();
+    released.clear();
+    pooledBytes = 0;
+}
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <memory>
+
+namespace mbgl {
+namespace util {
+
+// Recycles image buffers between decodes, so that a stream of images of the same
+// size, like raster tiles, doesn't allocate a new buffer for every one of them.
+// Buffers are keyed by their length, and the pool holds on to at most `maxBytes`.
+// Safe to use from any thread.
+class ImagePool {
+public:
+    static constexpr std::size_t maxBytes = 32 * 1024 * 1024;
+
+    // Returns an image of the given size. Its contents are undefined.
+    template <class Image>
+    static Image acquire(const Size size) {
+        return { size, acquire(Image::channels * size.area()) };
+    }
+
+    // Returns the buffer of an image that is no longer needed to the pool.
+    template <class Image>
+    static void release(Image&& image) {
+        const std::size_t length = image.bytes();
+        image.size = { 0, 0 };
+        release(std::move(image.data), length);
+    }
+
+    // The number of bytes held by the pool.
+    static std::size_t size();
+
+    static void clear();
+
+private:
+    static std::unique_ptr<uint8_t[]> acquire(std::size_t length);
+    static void release(std::unique_ptr<uint8_t[]>, std::size_t length);
+};
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,116 @@
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/message.hpp>
+#include <mbgl/actor/scheduler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+class ParallelForState {
+public:
+    ParallelForState(std::size_t count_, std::function<void (std::size_t)> fn_)
+        : count(count_), fn(std::move(fn_)) {
+    }
+
+    // Claims and runs indices until none are left.
+    void run() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            if (!failed) {
+                try {
+                    fn(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++finished == count) {
+                cv.notify_all();
+            }
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return finished == count; });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    const std::size_t count;
+    const std::function<void (std::size_t)> fn;
+
+    std::atomic<std::size_t> next { 0 };
+    std::atomic<bool> failed { false };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t finished = 0;
+    std::exception_ptr error;
+};
+
+class ParallelForMessage : public Message {
+public:
+    ParallelForMessage(std::shared_ptr<ParallelForState> state_)
+        : state(std::move(state_)) {
+    }
+
+    void operator()() override {
+        state->run();
+    }
+
+private:
+    std::shared_ptr<ParallelForState> state;
+};
+
+} // namespace
+
+void parallelFor(Scheduler& scheduler, std::size_t count, std::function<void (std::size_t)> fn) {
+    if (count == 0) {
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(count, std::move(fn));
+
+    // The calling thread takes part in the work, so at most count - 1 helpers
+    // can do anything useful.
+    const std::size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t helperCount = std::min(count - 1, hardwareThreads - 1);
+
+    std::vector<std::shared_ptr<Mailbox>> helpers;
+    helpers.reserve(helperCount);
+    for (std::size_t i = 0; i < helperCount; ++i) {
+        helpers.push_back(std::make_shared<Mailbox>(scheduler));
+        helpers.back()->push(std::make_unique<ParallelForMessage>(state));
+    }
+
+    state->run();
+
+    // Closing blocks until a helper that is currently receiving has returned, and
+    // turns helpers that haven't started yet into no-ops.
+    for (auto& helper : helpers) {
+        helper->close();
+    }
+
+    state->wait();
+}
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+
+class Scheduler;
+
+namespace util {
+
+// Invokes `fn` once for every index in [0, count). Indices are claimed dynamically
+// by the calling thread and by helper tasks scheduled on `scheduler`, so the call
+// order is unspecified. The calling thread works through the indices itself and
+// only ever waits for calls that are already running, which makes it safe to call
+// from a thread that is owned by `scheduler`.
+//
+// Returns once every call has completed. If `fn` throws, remaining indices are
+// skipped and the first exception is rethrown on the calling thread.
+void parallelFor(Scheduler&, std::size_t count, std::function<void (std::size_t)> fn);
+
+} // namespace util
+} // namespace mbgl
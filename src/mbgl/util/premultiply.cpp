@@ -2,9 +2,161 @@
 
 #include <cmath>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace mbgl {
 namespace util {
 
+namespace {
+
+void premultiplyPixel(uint8_t* pixel) {
+    const uint8_t a = pixel[3];
+    pixel[0] = (pixel[0] * a + 127) / 255;
+    pixel[1] = (pixel[1] * a + 127) / 255;
+    pixel[2] = (pixel[2] * a + 127) / 255;
+}
+
+void unpremultiplyPixel(uint8_t* pixel) {
+    const uint8_t a = pixel[3];
+    if (a) {
+        pixel[0] = (255 * pixel[0] + (a / 2)) / a;
+        pixel[1] = (255 * pixel[1] + (a / 2)) / a;
+        pixel[2] = (255 * pixel[2] + (a / 2)) / a;
+    }
+}
+
+#if defined(__SSE2__)
+
+// Whether all four pixels in the vector are opaque, which leaves them unchanged either way.
+bool opaque(const __m128i pixels) {
+    const __m128i alpha = _mm_set1_epi32(int32_t(0xFF000000));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(pixels, alpha), alpha)) == 0xFFFF;
+}
+
+// Premultiplies two pixels widened to 16 bits per channel. (x + 127) / 255 is computed
+// exactly for products of two bytes as (t + (t >> 8)) >> 8 with t = x + 128. The alpha
+// channel is multiplied by 255, which leaves it unchanged.
+__m128i premultiply16(const __m128i pixels) {
+    const __m128i colorMask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i alphaFactor = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i factor = _mm_or_si128(_mm_and_si128(alpha, colorMask), alphaFactor);
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(pixels, factor), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+// Unpremultiplies one channel of four pixels, given as 32 bit integers along with their
+// alpha and its reciprocal. The quotient is computed in single precision and then
+// corrected by one where rounding made it miss the integer division, so that the result
+// matches the scalar code bit for bit.
+__m128i unpremultiply32(const __m128i color, const __m128i alpha, const __m128 a, const __m128 reciprocal) {
+    const __m128i dividend = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(color, 8), color), _mm_srli_epi32(alpha, 1));
+    const __m128 x = _mm_cvtepi32_ps(dividend);
+
+    __m128i q = _mm_cvttps_epi32(_mm_mul_ps(x, reciprocal));
+    const __m128 qf = _mm_cvtepi32_ps(q);
+    // Comparison results are -1 where true.
+    q = _mm_sub_epi32(q, _mm_castps_si128(_mm_cmple_ps(_mm_mul_ps(_mm_add_ps(qf, _mm_set1_ps(1)), a), x)));
+    q = _mm_add_epi32(q, _mm_castps_si128(_mm_cmpgt_ps(_mm_mul_ps(qf, a), x)));
+    return _mm_and_si128(q, _mm_set1_epi32(0xFF));
+}
+
+#endif
+
+} // namespace
+
+void premultiply(uint8_t* data, std::size_t pixels) {
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i * 4);
+        const __m128i v = _mm_loadu_si128(block);
+        if (opaque(v)) {
+            continue;
+        }
+        const __m128i lo = premultiply16(_mm_unpacklo_epi8(v, zero));
+        const __m128i hi = premultiply16(_mm_unpackhi_epi8(v, zero));
+        _mm_storeu_si128(block, _mm_packus_epi16(lo, hi));
+    }
+#elif defined(__ARM_NEON)
+    auto premultiply8 = [] (const uint8x8_t color, const uint8x8_t alpha) {
+        // Same rounding as above: (x + ((x + 128) >> 8) + 128) >> 8.
+        const uint16x8_t x = vmull_u8(color, alpha);
+        return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+    };
+    for (; i + 16 <= pixels; i += 16) {
+        uint8x16x4_t v = vld4q_u8(data + i * 4);
+        const uint8x8_t alphaLo = vget_low_u8(v.val[3]);
+        const uint8x8_t alphaHi = vget_high_u8(v.val[3]);
+        if (vget_lane_u64(vreinterpret_u64_u8(vand_u8(alphaLo, alphaHi)), 0) == ~uint64_t(0)) {
+            continue;
+        }
+        for (int c = 0; c < 3; c++) {
+            v.val[c] = vcombine_u8(premultiply8(vget_low_u8(v.val[c]), alphaLo),
+                                   premultiply8(vget_high_u8(v.val[c]), alphaHi));
+        }
+        vst4q_u8(data + i * 4, v);
+    }
+#endif
+
+    for (; i < pixels; i++) {
+        premultiplyPixel(data + i * 4);
+    }
+}
+
+void unpremultiply(uint8_t* data, std::size_t pixels) {
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 4 <= pixels; i += 4) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i * 4);
+        const __m128i v = _mm_loadu_si128(block);
+        if (opaque(v)) {
+            continue;
+        }
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        const __m128i alpha = _mm_srli_epi32(v, 24);
+        const __m128 a = _mm_cvtepi32_ps(alpha);
+        // One Newton-Raphson step refines the estimate to well within the correction.
+        const __m128 estimate = _mm_rcp_ps(a);
+        const __m128 reciprocal = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(2), _mm_mul_ps(a, estimate)));
+
+        const __m128i r = unpremultiply32(_mm_and_si128(v, mask), alpha, a, reciprocal);
+        const __m128i g = unpremultiply32(_mm_and_si128(_mm_srli_epi32(v, 8), mask), alpha, a, reciprocal);
+        const __m128i b = unpremultiply32(_mm_and_si128(_mm_srli_epi32(v, 16), mask), alpha, a, reciprocal);
+        const __m128i result = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                            _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(alpha, 24)));
+
+        // Transparent pixels are left as they are.
+        const __m128i transparent = _mm_cmpeq_epi32(alpha, _mm_setzero_si128());
+        _mm_storeu_si128(block, _mm_or_si128(_mm_and_si128(transparent, v), _mm_andnot_si128(transparent, result)));
+    }
+#elif defined(__ARM_NEON)
+    // Without a vector division on all NEON targets, only runs of opaque pixels are
+    // skipped here.
+    for (; i + 16 <= pixels; i += 16) {
+        const uint8x16x4_t v = vld4q_u8(data + i * 4);
+        const uint8x8_t alpha = vand_u8(vget_low_u8(v.val[3]), vget_high_u8(v.val[3]));
+        if (vget_lane_u64(vreinterpret_u64_u8(alpha), 0) == ~uint64_t(0)) {
+            continue;
+        }
+        for (std::size_t j = i; j < i + 16; j++) {
+            unpremultiplyPixel(data + j * 4);
+        }
+    }
+#endif
+
+    for (; i < pixels; i++) {
+        unpremultiplyPixel(data + i * 4);
+    }
+}
+
 PremultipliedImage premultiply(UnassociatedImage&& src) {
     PremultipliedImage dst;
 
@@ -12,16 +164,7 @@ PremultipliedImage premultiply(UnassociatedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
-    uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
-        uint8_t& r = data[i + 0];
-        uint8_t& g = data[i + 1];
-        uint8_t& b = data[i + 2];
-        uint8_t& a = data[i + 3];
-        r = (r * a + 127) / 255;
-        g = (g * a + 127) / 255;
-        b = (b * a + 127) / 255;
-    }
+    premultiply(dst.data.get(), dst.size.area());
 
     return dst;
 }
@@ -33,18 +176,7 @@ UnassociatedImage unpremultiply(PremultipliedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
-    uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
-        uint8_t& r = data[i + 0];
-        uint8_t& g = data[i + 1];
-        uint8_t& b = data[i + 2];
-        uint8_t& a = data[i + 3];
-        if (a) {
-            r = (255 * r + (a / 2)) / a;
-            g = (255 * g + (a / 2)) / a;
-            b = (255 * b + (a / 2)) / a;
-        }
-    }
+    unpremultiply(dst.data.get(), dst.size.area());
 
     return dst;
 }
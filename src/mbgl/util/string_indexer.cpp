@@ -0,0 +1,31 @@
+#include <mbgl/util/string_indexer.hpp>
+
+#include <cassert>
+
+namespace mbgl {
+
+StringIdentity StringIndexer::get(const std::string& string) {
+    auto it = identities.find(string);
+    if (it != identities.end()) {
+        return it->second;
+    }
+    const auto identity = static_cast<StringIdentity>(strings.size());
+    strings.push_back(string);
+    identities.emplace(string, identity);
+    return identity;
+}
+
+optional<StringIdentity> StringIndexer::find(const std::string& string) const {
+    auto it = identities.find(string);
+    if (it == identities.end()) {
+        return {};
+    }
+    return it->second;
+}
+
+const std::string& StringIndexer::get(const StringIdentity identity) const {
+    assert(identity < strings.size());
+    return strings[identity];
+}
+
+} // namespace mbgl
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <mbgl/util/optional.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+// A small handle standing in for a string that was interned with a StringIndexer.
+// Two handles from the same indexer are equal if and only if their strings are.
+using StringIdentity = uint32_t;
+
+// Interns strings like layer IDs and source layer names, which are referenced by a
+// great number of objects, so that those can store a StringIdentity rather than a
+// copy of the string. Interning isn't synchronized: strings are interned while the
+// owner of the indexer is being built, and after that the indexer may be read from
+// any number of threads.
+class StringIndexer {
+public:
+    // Returns the identity of the string, interning it if needed.
+    StringIdentity get(const std::string&);
+
+    // Returns the identity of the string if it was interned, without interning it.
+    optional<StringIdentity> find(const std::string&) const;
+
+    // Returns the string with the given identity.
+    const std::string& get(StringIdentity) const;
+
+    // The number of interned strings.
+    std::size_t size() const {
+        return strings.size();
+    }
+
+private:
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, StringIdentity> identities;
+};
+
+} // namespace mbgl
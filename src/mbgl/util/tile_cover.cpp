@@ -4,7 +4,11 @@
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/util/tile_cover_impl.hpp>
 #include <mbgl/util/tile_coordinate.hpp>
+#include <mbgl/util/mat4.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <functional>
 #include <list>
 
@@ -172,6 +176,122 @@ std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z) {
         z);
 }
 
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState& state, int32_t z, int32_t minZ) {
+    assert(state.valid());
+    assert(minZ <= z);
+
+    const double w = state.getSize().width;
+    const double h = state.getSize().height;
+    const std::array<Point<double>, 4> corners {{
+        TileCoordinate::fromScreenCoordinate(state, z, { 0, 0 }).p,
+        TileCoordinate::fromScreenCoordinate(state, z, { w, 0 }).p,
+        TileCoordinate::fromScreenCoordinate(state, z, { w, h }).p,
+        TileCoordinate::fromScreenCoordinate(state, z, { 0, h }).p,
+    }};
+    const Point<double> c = TileCoordinate::fromScreenCoordinate(state, z, { w/2, h/2 }).p;
+
+    // The depth of a point on the ground is a linear function of its position. A tile
+    // appears as large as one of the same zoom level at the center of the screen, scaled
+    // by the ratio of their depths.
+    mat4 projMatrix;
+    state.getProjMatrix(projMatrix);
+    const double scale = util::tileSize * std::pow(2.0, state.getZoom() - z);
+    const double dx = projMatrix[3] * scale;
+    const double dy = projMatrix[7] * scale;
+    auto depth = [&](double x, double y) { return dx * x + dy * y + projMatrix[15]; };
+    const double centerDepth = depth(c.x, c.y);
+
+    // Points are inside of the viewport if they are on the inner side of all edges.
+    double area = 0;
+    for (std::size_t i = 0; i < 4; i++) {
+        const auto& a = corners[i];
+        const auto& b = corners[(i + 1) % 4];
+        area += a.x * b.y - b.x * a.y;
+    }
+    const double orientation = area < 0 ? -1 : 1;
+
+    double minX = corners[0].x, maxX = corners[0].x;
+    double minY = corners[0].y, maxY = corners[0].y;
+    for (const auto& p : corners) {
+        minX = std::min(minX, p.x);
+        maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y);
+        maxY = std::max(maxY, p.y);
+    }
+
+    // Tiles whose interior overlaps the viewport, with x unwrapped at their zoom level.
+    struct Node {
+        int32_t z;
+        int64_t x, y;
+    };
+
+    struct ID {
+        Node node;
+        double sqDist;
+    };
+
+    const double tiles = 1 << z;
+    std::vector<Node> stack;
+    for (int64_t wrap = std::floor(minX / tiles); wrap <= std::floor(maxX / tiles); wrap++) {
+        stack.push_back({ 0, wrap, 0 });
+    }
+
+    std::vector<ID> t;
+    while (!stack.empty()) {
+        const Node node = stack.back();
+        stack.pop_back();
+
+        const double size = 1 << (z - node.z);
+        const double x0 = node.x * size, x1 = x0 + size;
+        const double y0 = node.y * size, y1 = y0 + size;
+        if (x1 <= minX || x0 >= maxX || y1 <= minY || y0 >= maxY) {
+            continue;
+        }
+
+        bool outside = false;
+        for (std::size_t i = 0; i < 4 && !outside; i++) {
+            const auto& a = corners[i];
+            const auto& b = corners[(i + 1) % 4];
+            auto inner = [&](double x, double y) {
+                return orientation * ((b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x)) > 0;
+            };
+            outside = !inner(x0, y0) && !inner(x1, y0) && !inner(x1, y1) && !inner(x0, y1);
+        }
+        if (outside) {
+            continue;
+        }
+
+        if (node.z < z) {
+            // Depth is linear, so the nearest point of the tile is one of its corners.
+            const double nearest = std::min({ depth(x0, y0), depth(x1, y0), depth(x1, y1), depth(x0, y1) });
+            if (node.z < minZ || nearest <= 0 || size * centerDepth > nearest) {
+                for (int64_t cy = 0; cy < 2; cy++) {
+                    for (int64_t cx = 0; cx < 2; cx++) {
+                        stack.push_back({ node.z + 1, node.x * 2 + cx, node.y * 2 + cy });
+                    }
+                }
+                continue;
+            }
+        }
+
+        const double distX = x0 + size / 2 - c.x, distY = y0 + size / 2 - c.y;
+        t.push_back({ node, distX * distX + distY * distY });
+    }
+
+    // Sort first by distance, then by zoom and x/y.
+    std::sort(t.begin(), t.end(), [](const ID& a, const ID& b) {
+        return std::tie(a.sqDist, a.node.z, a.node.x, a.node.y) <
+               std::tie(b.sqDist, b.node.z, b.node.x, b.node.y);
+    });
+
+    std::vector<UnwrappedTileID> result;
+    result.reserve(t.size());
+    for (const auto& id : t) {
+        result.emplace_back(id.node.z, id.node.x, id.node.y);
+    }
+    return result;
+}
+
 std::vector<UnwrappedTileID> tileCover(const Geometry<double>& geometry, int32_t z) {
     std::vector<UnwrappedTileID> result;
     TileCover tc(geometry, z, true);
@@ -34,6 +34,10 @@ private:
 int32_t coveringZoomLevel(double z, style::SourceType type, uint16_t tileSize);
 
 std::vector<UnwrappedTileID> tileCover(const TransformState&, int32_t z);
+// Like the above, but in pitched views, distant parts of the viewport where tiles of zoom
+// level z would appear smaller than at the center are covered with tiles of lower zoom
+// levels, down to minZ.
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState&, int32_t z, int32_t minZ = 0);
 std::vector<UnwrappedTileID> tileCover(const LatLngBounds&, int32_t z);
 std::vector<UnwrappedTileID> tileCover(const Geometry<double>&, int32_t z);
 
@@ -407,3 +407,47 @@ TEST(GenerateClipIDs, SecondSourceHasParentOfFirstSource) {
               }),
               clipIDs);
 }
+
+TEST(GenerateClipIDs, NextFrame) {
+    auto frame = [] {
+        return std::vector<std::vector<Renderable>>{
+            {
+                Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+                Renderable{ UnwrappedTileID{ 1, 1, 1 }, {} },
+            },
+            {
+                Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+                Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+            },
+        };
+    };
+
+    auto render = [](algorithm::ClipIDGenerator& generator, std::vector<std::vector<Renderable>>& renderables) {
+        for (auto& group : renderables) {
+            generator.update<Renderable>({ group.begin(), group.end() });
+        }
+        return generator.getClipIDs();
+    };
+
+    algorithm::ClipIDGenerator generator;
+    auto first = frame();
+    const auto firstClipIDs = render(generator, first);
+
+    // An identical frame reuses the clip IDs of the previous one.
+    generator.nextFrame();
+    auto second = frame();
+    EXPECT_EQ(firstClipIDs, render(generator, second));
+    EXPECT_EQ(first, second);
+
+    // A frame that differs in its second update is computed like the first frame of a
+    // new generator.
+    generator.nextFrame();
+    auto third = frame();
+    third[1][0].needsClipping = false;
+    auto expected = frame();
+    expected[1][0].needsClipping = false;
+    algorithm::ClipIDGenerator fresh;
+    EXPECT_EQ(render(fresh, expected), render(generator, third));
+    EXPECT_EQ(expected, third);
+    EXPECT_NE(firstClipIDs, generator.getClipIDs());
+}
@@ -793,6 +793,37 @@ TEST(UpdateRenderables, UseOverzoomedTileAfterMaxzoom) {
               log);
 }
 
+TEST(UpdateRenderables, MixedZoomIdealTiles) {
+    ActionLog log;
+    MockSource source;
+    auto getTileData = getTileDataFn(log, source.dataTiles);
+    auto createTileData = createTileDataFn(log, source.dataTiles);
+    auto retainTileData = retainTileDataFn(log);
+    auto renderTile = renderTileFn(log);
+
+    // A distant tile of a lower zoom level is overscaled as much as the other ideal tiles.
+    source.zoomRange.max = 2;
+    source.idealTiles.emplace(UnwrappedTileID{ 2, 0, 0 });
+    source.idealTiles.emplace(UnwrappedTileID{ 1, 1, 0 });
+
+    auto tile_3_2_0_0 = source.createTileData(OverscaledTileID{ 3, 0, { 2, 0, 0 } });
+    tile_3_2_0_0->renderable = true;
+    auto tile_2_1_1_0 = source.createTileData(OverscaledTileID{ 2, 0, { 1, 1, 0 } });
+    tile_2_1_1_0->renderable = true;
+
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 3);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 2, 0, { 1, 1, 0 } }, Found },       //
+                  RetainTileDataAction{ { 2, 0, { 1, 1, 0 } }, TileNecessity::Required }, //
+                  RenderTileAction{ { 1, 1, 0 }, *tile_2_1_1_0 },       //
+                  GetTileDataAction{ { 3, 0, { 2, 0, 0 } }, Found },       //
+                  RetainTileDataAction{ { 3, 0, { 2, 0, 0 } }, TileNecessity::Required }, //
+                  RenderTileAction{ { 2, 0, 0 }, *tile_3_2_0_0 },       //
+              }),
+              log);
+}
+
 TEST(UpdateRenderables, AscendToNonOverzoomedTiles) {
     ActionLog log;
     MockSource source;
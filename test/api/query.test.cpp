@@ -86,6 +86,29 @@ TEST(Query, QueryRenderedFeaturesFilter) {
     EXPECT_EQ(features3.size(), 1u);
 }
 
+TEST(Query, QueryRenderedFeaturesBatch) {
+    QueryTest test;
+
+    const std::vector<ScreenLineString> geometries = {
+        { test.map.pixelForLatLng({ 0, 0 }) },
+        { test.map.pixelForLatLng({ 9, 9 }) },
+        { test.map.pixelForLatLng({ 0, 0 }) },
+    };
+
+    auto results = test.frontend.getRenderer()->queryRenderedFeatures(geometries, {{{ "layer1", "layer2" }}, {}});
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0].size(), 2u);
+    EXPECT_EQ(results[1].size(), 0u);
+    EXPECT_EQ(results[2].size(), 2u);
+
+    // Results match those of separate queries.
+    for (std::size_t i = 0; i < geometries.size(); i++) {
+        EXPECT_EQ(results[i].size(), test.frontend.getRenderer()->queryRenderedFeatures(geometries[i], {{{ "layer1", "layer2" }}, {}}).size());
+    }
+
+    EXPECT_TRUE(test.frontend.getRenderer()->queryRenderedFeatures(std::vector<ScreenLineString>()).empty());
+}
+
 TEST(Query, QuerySourceFeatures) {
     QueryTest test;
 
@@ -109,6 +132,19 @@ TEST(Query, QuerySourceFeaturesOptionValidation) {
     ASSERT_EQ(features.size(), 0u);
 }
 
+TEST(Query, QuerySourceFeaturesBatch) {
+    QueryTest test;
+
+    const std::vector<std::string> sourceIDs = { "source3", "source5", "source6", "source3", "foobar" };
+    auto results = test.frontend.getRenderer()->querySourceFeatures(sourceIDs);
+    ASSERT_EQ(results.size(), 5u);
+    EXPECT_EQ(results[0].size(), 1u);
+    EXPECT_EQ(results[1].size(), 0u);
+    EXPECT_EQ(results[2].size(), 0u);
+    EXPECT_EQ(results[3].size(), 1u);
+    EXPECT_EQ(results[4].size(), 0u);
+}
+
 TEST(Query, QuerySourceFeaturesFilter) {
     using namespace mbgl::style::expression::dsl;
 
@@ -35,6 +35,28 @@ TEST(DEMData, ConstructorTerrarium) {
     EXPECT_EQ(demdata.getImage()->bytes(), size_t(32*32*4));
 };
 
+TEST(DEMData, Decode) {
+    // An odd size exercises the scalar tail after the vectorized part of each row.
+    PremultipliedImage image = fakeImage({13, 13});
+    DEMData mapbox(image, Tileset::DEMEncoding::Mapbox);
+    DEMData terrarium(image, Tileset::DEMEncoding::Terrarium);
+
+    for (int32_t y = 0; y < 13; y++) {
+        for (int32_t x = 0; x < 13; x++) {
+            const uint8_t* pixel = image.data.get() + (y * 13 + x) * 4;
+            EXPECT_EQ((pixel[0] * 256 * 256 + pixel[1] * 256 + pixel[2]) / 10 - 10000, mapbox.get(x, y));
+            EXPECT_EQ(pixel[0] * 256 + pixel[1] - 32768, terrarium.get(x, y));
+        }
+    }
+
+    // The one pixel wide border repeats the edges of the tile.
+    EXPECT_EQ(mapbox.get(0, 0), mapbox.get(-1, -1));
+    EXPECT_EQ(mapbox.get(12, 0), mapbox.get(13, -1));
+    EXPECT_EQ(mapbox.get(5, 12), mapbox.get(5, 13));
+    EXPECT_EQ(terrarium.get(0, 7), terrarium.get(-1, 7));
+    EXPECT_EQ(terrarium.get(12, 12), terrarium.get(13, 13));
+}
+
 TEST(DEMData, RoundTrip) {
     PremultipliedImage image = fakeImage({16, 16});
     DEMData demdata(image, Tileset::DEMEncoding::Mapbox);
@@ -147,3 +169,39 @@ TEST(DEMData, BackfillNeighbor) {
     // backfulls BottomLeft neighbor
     EXPECT_TRUE(dem0.get(4, -1) == dem1.get(0, 3));
 };
+
+TEST(DEMData, Slopes) {
+    PremultipliedImage flat({ 8, 8 });
+    for (size_t i = 0; i < flat.bytes(); i++) {
+        flat.data[i] = (i + 1) % 4 == 0 ? 255 : 1;
+    }
+    DEMData dem0(flat, Tileset::DEMEncoding::Mapbox);
+
+    // Flat terrain has no slope, which is encoded as the middle of the range.
+    PremultipliedImage slopes = dem0.computeSlopes(10, 15);
+    ASSERT_EQ(Size(8, 8), slopes.size);
+    for (size_t i = 0; i < slopes.bytes(); i += 4) {
+        EXPECT_EQ(128, slopes.data[i]);
+        EXPECT_EQ(128, slopes.data[i + 1]);
+        EXPECT_EQ(255, slopes.data[i + 2]);
+        EXPECT_EQ(255, slopes.data[i + 3]);
+    }
+
+    // A higher tile to the right makes the right edge of this one slope upwards.
+    PremultipliedImage high = flat.clone();
+    for (size_t i = 0; i < high.bytes(); i += 4) {
+        high.data[i + 1] = 100;
+    }
+    DEMData dem1(high, Tileset::DEMEncoding::Mapbox);
+    dem0.backfillBorder(dem1, 1, 0);
+    dem0.updateSlopeBorder(slopes, 10, 15);
+
+    for (uint32_t y = 0; y < 8; y++) {
+        EXPECT_EQ(128, slopes.data[(y * 8 + 6) * 4]);
+        EXPECT_LT(128, slopes.data[(y * 8 + 7) * 4]);
+    }
+
+    // Only the outermost pixels depend on the border.
+    PremultipliedImage expected = dem0.computeSlopes(10, 15);
+    EXPECT_EQ(0, std::memcmp(expected.data.get(), slopes.data.get(), slopes.bytes()));
+}
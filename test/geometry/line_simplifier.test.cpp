@@ -0,0 +1,36 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/geometry/line_simplifier.hpp>
+
+using namespace mbgl;
+
+TEST(LineSimplifier, KeepsShortLines) {
+    LineSimplifier simplifier;
+    const GeometryCoordinates line { { 0, 0 }, { 1, 1 } };
+    EXPECT_EQ(line, simplifier(line, 10));
+}
+
+TEST(LineSimplifier, Disabled) {
+    LineSimplifier simplifier;
+    const GeometryCoordinates line { { 0, 0 }, { 1, 0 }, { 2, 0 }, { 3, 0 } };
+    EXPECT_EQ(line, simplifier(line, 0));
+}
+
+TEST(LineSimplifier, DropsCollinearAndNearbyVertices) {
+    LineSimplifier simplifier;
+    const GeometryCoordinates line { { 0, 0 }, { 10, 1 }, { 20, 0 }, { 30, -1 }, { 40, 0 }, { 40, 40 } };
+    EXPECT_EQ((GeometryCoordinates { { 0, 0 }, { 40, 0 }, { 40, 40 } }), simplifier(line, 2));
+}
+
+TEST(LineSimplifier, KeepsDistantVertices) {
+    LineSimplifier simplifier;
+    // Zig-zag whose corners are all far from any shortcut.
+    const GeometryCoordinates line { { 0, 0 }, { 10, 10 }, { 20, 0 }, { 30, 10 }, { 40, 0 } };
+    EXPECT_EQ(line, simplifier(line, 2));
+}
+
+TEST(LineSimplifier, ClosedRing) {
+    LineSimplifier simplifier;
+    const GeometryCoordinates ring { { 0, 0 }, { 5, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 5 }, { 0, 0 } };
+    EXPECT_EQ((GeometryCoordinates { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } }), simplifier(ring, 1));
+}
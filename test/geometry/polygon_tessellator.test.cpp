@@ -0,0 +1,111 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/geometry/polygon_tessellator.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+// Sums the absolute area of all triangles, looking up vertices across rings.
+double triangulatedArea(const GeometryCollection& polygon, const std::vector<uint32_t>& indices) {
+    GeometryCoordinates flat;
+    for (const auto& ring : polygon) {
+        flat.insert(flat.end(), ring.begin(), ring.end());
+    }
+
+    double area = 0;
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+        const auto& a = flat[indices[i]];
+        const auto& b = flat[indices[i + 1]];
+        const auto& c = flat[indices[i + 2]];
+        area += std::abs(double(b.x - a.x) * (c.y - a.y) - double(b.y - a.y) * (c.x - a.x)) / 2;
+    }
+    return area;
+}
+
+} // namespace
+
+TEST(PolygonTessellator, Rectangle) {
+    PolygonTessellator tessellator;
+    const GeometryCollection polygon { { { 0, 0 }, { 10, 0 }, { 10, 20 }, { 0, 20 }, { 0, 0 } } };
+
+    const auto& indices = tessellator(polygon);
+    EXPECT_EQ((std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3 }), indices);
+    EXPECT_DOUBLE_EQ(200, triangulatedArea(polygon, indices));
+}
+
+TEST(PolygonTessellator, ConvexWithCollinearPoints) {
+    PolygonTessellator tessellator;
+    const GeometryCollection polygon { { { 0, 0 }, { 5, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } } };
+
+    const auto& indices = tessellator(polygon);
+    EXPECT_EQ(9u, indices.size());
+    EXPECT_DOUBLE_EQ(100, triangulatedArea(polygon, indices));
+}
+
+TEST(PolygonTessellator, Concave) {
+    PolygonTessellator tessellator;
+    // L-shape
+    const GeometryCollection polygon { { { 0, 0 }, { 20, 0 }, { 20, 10 }, { 10, 10 }, { 10, 20 }, { 0, 20 }, { 0, 0 } } };
+
+    const auto& indices = tessellator(polygon);
+    EXPECT_EQ(12u, indices.size());
+    EXPECT_DOUBLE_EQ(300, triangulatedArea(polygon, indices));
+}
+
+TEST(PolygonTessellator, SelfIntersecting) {
+    PolygonTessellator tessellator;
+    // A pentagram turns the same way at every vertex, but winds around twice.
+    const GeometryCollection polygon { { { 0, -100 }, { 59, 81 }, { -95, -31 }, { 95, -31 }, { -59, 81 }, { 0, -100 } } };
+
+    const auto& indices = tessellator(polygon);
+    EXPECT_NE((std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3, 0, 3, 4 }), indices);
+}
+
+TEST(PolygonTessellator, Hole) {
+    PolygonTessellator tessellator;
+    const GeometryCollection polygon {
+        { { 0, 0 }, { 30, 0 }, { 30, 30 }, { 0, 30 }, { 0, 0 } },
+        { { 10, 10 }, { 10, 20 }, { 20, 20 }, { 20, 10 }, { 10, 10 } }
+    };
+
+    const auto& indices = tessellator(polygon);
+    EXPECT_EQ(0u, indices.size() % 3);
+    EXPECT_DOUBLE_EQ(800, triangulatedArea(polygon, indices));
+}
+
+TEST(PolygonTessellator, Degenerate) {
+    PolygonTessellator tessellator;
+    EXPECT_TRUE(tessellator({ { { 0, 0 }, { 10, 0 }, { 0, 0 } } }).empty());
+    EXPECT_TRUE(tessellator({ { { 0, 0 }, { 10, 0 }, { 20, 0 }, { 0, 0 } } }).empty());
+}
+
+TEST(PolygonTessellator, Reuse) {
+    PolygonTessellator tessellator;
+    const GeometryCollection concave { { { 0, 0 }, { 20, 0 }, { 20, 10 }, { 10, 10 }, { 10, 20 }, { 0, 20 }, { 0, 0 } } };
+    const GeometryCollection square { { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } } };
+
+    EXPECT_EQ(12u, tessellator(concave).size());
+    EXPECT_EQ(6u, tessellator(square).size());
+    EXPECT_EQ(12u, tessellator(concave).size());
+}
+
+TEST(PolygonTessellator, Emit) {
+    PolygonTessellator tessellator;
+    const GeometryCollection square { { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } } };
+    const GeometryCollection hole {
+        { { 0, 0 }, { 30, 0 }, { 30, 30 }, { 0, 30 }, { 0, 0 } },
+        { { 10, 10 }, { 10, 20 }, { 20, 20 }, { 20, 10 }, { 10, 10 } }
+    };
+
+    for (const auto& polygon : { square, hole }) {
+        std::vector<uint32_t> emitted;
+        const std::size_t count = tessellator.tessellate(polygon, [&] (uint32_t a, uint32_t b, uint32_t c) {
+            emitted.insert(emitted.end(), { a, b, c });
+        });
+        EXPECT_EQ(emitted.size(), count);
+        EXPECT_EQ(tessellator(polygon), emitted);
+    }
+}
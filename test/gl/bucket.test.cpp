@@ -61,6 +61,30 @@ TEST(Buckets, CircleBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, CircleBucketPointCloud) {
+    HeadlessBackend backend({ 512, 256 });
+    BackendScope scope { backend };
+
+    gl::Context context;
+    CircleBucket bucket { { {0, 0, 0}, MapMode::Static, 1.0, 0.0, true }, {} };
+
+    GeometryCollection points { { { 0, 0 }, { 10, 20 }, { 4000, 4000 } } };
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Point, points, properties }, points);
+    ASSERT_TRUE(bucket.hasData());
+
+    // One vertex and one index per point, instead of a quad.
+    EXPECT_EQ(3u, bucket.vertices.vertexSize());
+    EXPECT_EQ(3u, bucket.sprites.indexSize());
+    EXPECT_EQ(0u, bucket.triangles.indexSize());
+    ASSERT_EQ(1u, bucket.segments.size());
+    EXPECT_EQ(3u, bucket.segments[0].vertexLength);
+    EXPECT_EQ(3u, bucket.segments[0].indexLength);
+
+    bucket.upload(context);
+    EXPECT_TRUE(bucket.spriteIndexBuffer);
+    EXPECT_FALSE(bucket.indexBuffer);
+}
+
 TEST(Buckets, FillBucket) {
     HeadlessBackend backend({ 512, 256 });
     BackendScope scope { backend };
@@ -102,6 +126,40 @@ TEST(Buckets, LineBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, LineBucketSimplification) {
+    GeometryCollection line { { { 0, 0 }, { 100, 4 }, { 200, 0 }, { 300, 5 }, { 400, 0 }, { 400, 400 } } };
+    GeometryCollection simplifiedLine { { { 0, 0 }, { 400, 0 }, { 400, 400 } } };
+
+    // One pixel corresponds to eight tile units at zoom 0 without overscaling.
+    LineBucket bucket { { {0, 0, 0}, MapMode::Static, 1.0, 1.0 }, {}, {} };
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line);
+    ASSERT_TRUE(bucket.hasData());
+
+    LineBucket expected { { {0, 0, 0}, MapMode::Static, 1.0, 0.0 }, {}, {} };
+    expected.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, simplifiedLine, properties }, simplifiedLine);
+    EXPECT_EQ(expected.vertices.vertexSize(), bucket.vertices.vertexSize());
+    EXPECT_EQ(expected.triangles.indexSize(), bucket.triangles.indexSize());
+    EXPECT_EQ(6u, bucket.sourceVertexCount);
+    EXPECT_EQ(3u, bucket.simplifiedVertexCount);
+
+    // A line without redundant vertices is left as it is.
+    LineBucket minimal { { {0, 0, 0}, MapMode::Static, 1.0, 1.0 }, {}, {} };
+    minimal.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, simplifiedLine, properties }, simplifiedLine);
+    EXPECT_EQ(3u, minimal.sourceVertexCount);
+    EXPECT_EQ(3u, minimal.simplifiedVertexCount);
+
+    // The tolerance shrinks in tile units when the tile is overscaled.
+    LineBucket overscaled { { {3, 0, 0, 0, 0}, MapMode::Static, 1.0, 1.0 }, {}, {} };
+    overscaled.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line);
+
+    LineBucket unsimplified { { {3, 0, 0, 0, 0}, MapMode::Static, 1.0, 0.0 }, {}, {} };
+    unsimplified.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line);
+    EXPECT_EQ(unsimplified.vertices.vertexSize(), overscaled.vertices.vertexSize());
+    EXPECT_LT(bucket.vertices.vertexSize(), overscaled.vertices.vertexSize());
+    EXPECT_EQ(6u, overscaled.sourceVertexCount);
+    EXPECT_EQ(6u, overscaled.simplifiedVertexCount);
+}
+
 TEST(Buckets, SymbolBucket) {
     HeadlessBackend backend({ 512, 256 });
     BackendScope scope { backend };
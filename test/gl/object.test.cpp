@@ -3,6 +3,7 @@
 #include <mbgl/renderer/backend_scope.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <memory>
 
@@ -63,3 +64,28 @@ TEST(GLObject, Store) {
     context.reset();
     EXPECT_TRUE(context.empty());
 }
+
+TEST(GLObject, TexturePool) {
+    HeadlessBackend backend { { 256, 256 } };
+    BackendScope scope { backend };
+
+    gl::Context context;
+
+    PremultipliedImage small({ 4, 4 });
+    PremultipliedImage large({ 8, 8 });
+
+    optional<gl::Texture> a = context.createTexture(small);
+    optional<gl::Texture> b = context.createTexture(large);
+    const gl::TextureID smallID = a->texture.get();
+    const gl::TextureID largeID = b->texture.get();
+    a = {};
+    b = {};
+
+    // Textures are reused for images of the size they were allocated for.
+    gl::Texture c = context.createTexture(small);
+    EXPECT_EQ(smallID, c.texture.get());
+    gl::Texture d = context.createTexture(large);
+    EXPECT_EQ(largeID, d.texture.get());
+
+    context.reset();
+}
@@ -18,8 +18,16 @@
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/image.hpp>
 #include <mbgl/style/layers/background_layer.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/heatmap_layer.hpp>
+#include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/util/color.hpp>
 
+#include <mapbox/pixelmatch.hpp>
+
+#include <cstring>
+
 using namespace mbgl;
 using namespace mbgl::style;
 using namespace std::literals::string_literals;
@@ -458,6 +466,142 @@ TEST(Map, WithoutVAOExtension) {
     test::checkImage("test/fixtures/map/no_vao", test.frontend.render(test.map), 0.002);
 }
 
+TEST(Map, QueuedStillImages) {
+    auto render = [&](bool disablePixelBuffers) {
+        MapTest<> test;
+
+        BackendScope scope { *test.frontend.getBackend() };
+        test.frontend.getBackend()->getContext().disablePixelBufferExtension = disablePixelBuffers;
+
+        test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+
+        auto background = std::make_unique<BackgroundLayer>("background");
+        background->setBackgroundColor({ Color::red() });
+        test.map.getStyle().addLayer(std::move(background));
+
+        // Only the northern half is covered, so that the images aren't symmetric.
+        auto source = std::make_unique<GeoJSONSource>("half");
+        source->setGeoJSON(GeoJSON { Polygon<double> { {
+            { -180, 0 }, { 180, 0 }, { 180, 85 }, { -180, 85 }, { -180, 0 }
+        } } });
+        test.map.getStyle().addSource(std::move(source));
+
+        auto layer = std::make_unique<FillLayer>("fill", "half");
+        layer->setFillColor({ Color::blue() });
+        test.map.getStyle().addLayer(std::move(layer));
+
+        const auto expectedRed = test.frontend.render(test.map);
+        test.map.getStyle().getLayer("background")->as<BackgroundLayer>()->setBackgroundColor({ Color::green() });
+        const auto expectedGreen = test.frontend.render(test.map);
+
+        // Render the second frame while the first one is still being read back.
+        test.map.getStyle().getLayer("background")->as<BackgroundLayer>()->setBackgroundColor({ Color::red() });
+        test.frontend.renderQueued(test.map);
+        test.map.getStyle().getLayer("background")->as<BackgroundLayer>()->setBackgroundColor({ Color::green() });
+        test.frontend.renderQueued(test.map);
+
+        const auto red = test.frontend.takeImage();
+        ASSERT_EQ(expectedRed.size, red.size);
+        EXPECT_EQ(0, std::memcmp(expectedRed.data.get(), red.data.get(), red.bytes()));
+
+        const auto green = test.frontend.takeImage(false);
+        ASSERT_EQ(expectedGreen.size, green.size);
+        const std::size_t stride = green.stride();
+        for (uint32_t row = 0; row < green.size.height; row++) {
+            EXPECT_EQ(0, std::memcmp(expectedGreen.data.get() + row * stride,
+                                     green.data.get() + (green.size.height - row - 1) * stride,
+                                     stride)) << row;
+        }
+    };
+
+    render(false);
+    render(true);
+}
+
+TEST(Map, PointCloudRendersLikeRegularSource) {
+    auto render = [](bool pointCloud, bool heatmap) {
+        MapTest<> test;
+
+        test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+        test.map.setLatLngZoom({ 0, 0 }, 2);
+
+        FeatureCollection features;
+        for (int32_t i = 0; i < 400; i++) {
+            features.push_back(Feature { Point<double> { -95 + (i % 20) * 10.0, -47.5 + (i / 20) * 5.0 } });
+        }
+
+        GeoJSONOptions options;
+        options.pointCloud = pointCloud;
+        auto source = std::make_unique<GeoJSONSource>("points", options);
+        source->setGeoJSON(GeoJSON { features });
+        test.map.getStyle().addSource(std::move(source));
+
+        if (heatmap) {
+            auto layer = std::make_unique<HeatmapLayer>("heatmap", "points");
+            layer->setHeatmapRadius(10.0f);
+            test.map.getStyle().addLayer(std::move(layer));
+        } else {
+            auto background = std::make_unique<BackgroundLayer>("background");
+            background->setBackgroundColor({ Color::white() });
+            test.map.getStyle().addLayer(std::move(background));
+
+            auto layer = std::make_unique<CircleLayer>("circle", "points");
+            layer->setCircleRadius(6.0f);
+            layer->setCircleColor({ Color::blue() });
+            layer->setCircleStrokeWidth(2.0f);
+            layer->setCircleStrokeColor({ Color::red() });
+            test.map.getStyle().addLayer(std::move(layer));
+        }
+
+        return test.frontend.render(test.map);
+    };
+
+    for (const bool heatmap : { false, true }) {
+        const auto expected = render(false, heatmap);
+        const auto actual = render(true, heatmap);
+        ASSERT_EQ(expected.size, actual.size);
+
+        // Point sprites are rasterized differently from quads, so only antialiased edges
+        // may differ.
+        PremultipliedImage diff { expected.size };
+        const double pixels = mapbox::pixelmatch(actual.data.get(),
+                                                 expected.data.get(),
+                                                 expected.size.width,
+                                                 expected.size.height,
+                                                 diff.data.get(),
+                                                 0.1);
+        EXPECT_LE(pixels / (expected.size.width * expected.size.height), 0.01) << heatmap;
+    }
+}
+
+TEST(Map, RenderReusesImage) {
+    MapTest<> test;
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+
+    auto background = std::make_unique<BackgroundLayer>("background");
+    background->setBackgroundColor({ Color::red() });
+    test.map.getStyle().addLayer(std::move(background));
+
+    PremultipliedImage image;
+    test.frontend.render(test.map, image);
+    ASSERT_TRUE(image.valid());
+    EXPECT_EQ(255, image.data[0]);
+    EXPECT_EQ(0, image.data[1]);
+    const uint8_t* data = image.data.get();
+
+    test.map.getStyle().getLayer("background")->as<BackgroundLayer>()->setBackgroundColor({ Color::green() });
+    test.frontend.render(test.map, image);
+    EXPECT_EQ(0, image.data[0]);
+    EXPECT_EQ(255, image.data[1]);
+
+    BackendScope scope { *test.frontend.getBackend() };
+    if (test.frontend.getBackend()->getContext().supportsPixelBuffers()) {
+        // Frames read through pixel buffers are copied into the storage of the previous image.
+        EXPECT_EQ(data, image.data.get());
+    }
+}
+
 TEST(Map, RemoveLayer) {
     MapTest<> test;
 
@@ -0,0 +1,179 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/map/snapshot_pool.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <future>
+#include <mutex>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string style = R"STYLE({
+    "version": 8,
+    "sources": {
+        "geojson": {
+            "type": "geojson",
+            "data": {
+                "type": "Polygon",
+                "coordinates": [[[-10, -10], [10, -10], [10, 10], [-10, 10], [-10, -10]]]
+            }
+        }
+    },
+    "layers": [{
+        "id": "background",
+        "type": "background",
+        "paint": { "background-color": "white" }
+    }, {
+        "id": "fill",
+        "type": "fill",
+        "source": "geojson",
+        "paint": { "fill-color": "red" }
+    }]
+})STYLE";
+
+} // end namespace
+
+TEST(SnapshotPool, Render) {
+    util::RunLoop loop;
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+    auto threadPool = std::make_shared<ThreadPool>(4);
+
+    SnapshotPool pool(&fileSource, threadPool, { true, style }, 1, 2, 2);
+
+    const std::vector<Size> sizes = { { 64, 64 }, { 128, 64 }, { 64, 128 } };
+
+    std::mutex mutex;
+    std::vector<std::pair<std::size_t, SnapshotPool::Result>> results;
+
+    for (std::size_t i = 0; i < 9; i++) {
+        SnapshotPool::Job job;
+        job.camera.zoom = double(i % 3);
+        job.size = sizes[i % 3];
+        pool.snapshot(std::move(job), [&, i](SnapshotPool::Result result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.emplace_back(i, std::move(result));
+        });
+    }
+
+    pool.wait();
+
+    ASSERT_EQ(9u, results.size());
+    for (const auto& entry : results) {
+        const SnapshotPool::Result& result = entry.second;
+        EXPECT_FALSE(result.error);
+        ASSERT_EQ(sizes[entry.first % 3], result.image.size);
+        EXPECT_GE(result.queueTime.count(), 0);
+        EXPECT_GT(result.renderTime.count(), 0);
+
+        // The polygon is centered on the camera.
+        const uint8_t* center = result.image.data.get() +
+            (result.image.size.height / 2) * result.image.stride() + (result.image.size.width / 2) * 4;
+        EXPECT_EQ(255, center[0]);
+        EXPECT_EQ(0, center[1]);
+        EXPECT_EQ(0, center[2]);
+        EXPECT_EQ(255, center[3]);
+    }
+}
+
+TEST(SnapshotPool, BackPressure) {
+    util::RunLoop loop;
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+    auto threadPool = std::make_shared<ThreadPool>(4);
+
+    SnapshotPool pool(&fileSource, threadPool, { true, style }, 1, 1, 1);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::mutex mutex;
+    std::size_t completed = 0;
+
+    auto job = [] {
+        SnapshotPool::Job result;
+        result.size = { 32, 32 };
+        return result;
+    };
+
+    // The only renderer is kept busy by the first job, and the second one fills the queue.
+    pool.snapshot(job(), [&](SnapshotPool::Result) {
+        released.wait();
+        std::lock_guard<std::mutex> lock(mutex);
+        completed++;
+    });
+    pool.snapshot(job(), [&](SnapshotPool::Result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        completed++;
+    });
+
+    EXPECT_FALSE(pool.trySnapshot(job(), [](SnapshotPool::Result) {}));
+
+    release.set_value();
+    pool.wait();
+
+    EXPECT_EQ(2u, completed);
+}
+
+TEST(SnapshotPool, Encode) {
+    util::RunLoop loop;
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+    auto threadPool = std::make_shared<ThreadPool>(4);
+
+    SnapshotPool pool(&fileSource, threadPool, { true, style }, 1, 1, 4);
+
+    std::mutex mutex;
+    std::vector<SnapshotPool::Result> results;
+
+    for (std::size_t i = 0; i < 4; i++) {
+        SnapshotPool::Job job;
+        job.size = { 64, 64 };
+        job.encoding = ImageEncoderOptions();
+        pool.snapshot(std::move(job), [&](SnapshotPool::Result result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.push_back(std::move(result));
+        });
+    }
+
+    pool.wait();
+
+    ASSERT_EQ(4u, results.size());
+    for (const auto& result : results) {
+        EXPECT_FALSE(result.error);
+        EXPECT_GT(result.encodeTime.count(), 0);
+
+        PremultipliedImage decoded = decodeImage(result.encoded);
+        ASSERT_EQ(result.image.size, decoded.size);
+        EXPECT_EQ(0, std::memcmp(result.image.data.get(), decoded.data.get(), decoded.bytes()));
+    }
+}
+
+TEST(SnapshotPool, StyleError) {
+    util::RunLoop loop;
+    DefaultFileSource fileSource(":memory:", "test/fixtures/api/assets");
+    auto threadPool = std::make_shared<ThreadPool>(4);
+
+    SnapshotPool pool(&fileSource, threadPool, { true, "invalid" }, 1, 1, 4);
+
+    std::mutex mutex;
+    std::size_t failed = 0;
+
+    // The map fails these jobs right away, without rendering.
+    for (std::size_t i = 0; i < 4; i++) {
+        SnapshotPool::Job job;
+        job.size = { 32, 32 };
+        pool.snapshot(std::move(job), [&](SnapshotPool::Result result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            EXPECT_TRUE(result.error);
+            EXPECT_FALSE(result.image.valid());
+            failed++;
+        });
+    }
+
+    pool.wait();
+
+    EXPECT_EQ(4u, failed);
+}
@@ -609,3 +609,49 @@ TEST(Transform, PitchBounds) {
     transform.setPitch(60.0 * util::DEG2RAD);
     ASSERT_NEAR(transform.getState().getPitch() * util::RAD2DEG, 55.0, 1e-5);
 }
+
+TEST(Transform, PrefetchStates) {
+    Transform transform;
+    transform.resize({ 1000, 1000 });
+    transform.setLatLngZoom({ 0, 0 }, 10);
+    ASSERT_TRUE(transform.getPrefetchStates(Clock::now()).empty());
+
+    const LatLng latLng { 45, 135 };
+    CameraOptions camera;
+    camera.zoom = 12;
+    camera.center = latLng;
+    transform.flyTo(camera, AnimationOptions(Seconds(1)));
+
+    // The path is sampled, ending at the destination.
+    std::vector<TransformState> states = transform.getPrefetchStates(transform.getTransitionStart());
+    ASSERT_EQ(4u, states.size());
+    EXPECT_LT(states.front().getZoom(), 10);
+    EXPECT_NEAR(latLng.latitude(), states.back().getLatLng().latitude(), 0.001);
+    EXPECT_NEAR(latLng.longitude(), states.back().getLatLng().longitude(), 0.001);
+    EXPECT_NEAR(12, states.back().getZoom(), 0.00001);
+
+    // Sampling doesn't move the camera.
+    EXPECT_DOUBLE_EQ(0, transform.getLatLng().longitude());
+    EXPECT_DOUBLE_EQ(10, transform.getZoom());
+
+    // Samples that were passed are dropped.
+    transform.updateTransitions(transform.getTransitionStart() + Milliseconds(600));
+    states = transform.getPrefetchStates(transform.getTransitionStart() + Milliseconds(600));
+    ASSERT_EQ(2u, states.size());
+    EXPECT_NEAR(12, states.back().getZoom(), 0.00001);
+
+    transform.updateTransitions(transform.getTransitionStart() + transform.getTransitionDuration());
+    ASSERT_TRUE(transform.getPrefetchStates(Clock::now()).empty());
+
+    // A pan gesture is extrapolated in the direction it is going.
+    transform.setGestureInProgress(true);
+    transform.moveBy({ -10, 0 });
+    transform.moveBy({ -10, 0 });
+    states = transform.getPrefetchStates(Clock::now());
+    ASSERT_EQ(1u, states.size());
+    EXPECT_GT(states.front().getLatLng().longitude(), transform.getLatLng().longitude());
+    EXPECT_DOUBLE_EQ(transform.getZoom(), states.front().getZoom());
+
+    transform.setGestureInProgress(false);
+    ASSERT_TRUE(transform.getPrefetchStates(Clock::now()).empty());
+}
@@ -0,0 +1,209 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_file_source.hpp>
+
+#include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/map/map.hpp>
+#include <mbgl/renderer/frame_profile.hpp>
+#include <mbgl/renderer/renderer.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/rapidjson.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <algorithm>
+
+using namespace mbgl;
+
+namespace {
+
+class FrameProfilerTest {
+public:
+    FrameProfilerTest() {
+        map.getStyle().loadJSON(R"STYLE({
+            "version": 8,
+            "sources": {
+                "geojson": {
+                    "type": "geojson",
+                    "data": {
+                        "type": "Polygon",
+                        "coordinates": [[[-10, -10], [10, -10], [10, 10], [-10, 10], [-10, -10]]]
+                    }
+                }
+            },
+            "layers": [{
+                "id": "background",
+                "type": "background",
+                "paint": { "background-color": "white" }
+            }, {
+                "id": "fill",
+                "type": "fill",
+                "source": "geojson",
+                "paint": { "fill-color": "red" }
+            }]
+        })STYLE");
+    }
+
+    util::RunLoop loop;
+    StubFileSource fileSource;
+    ThreadPool threadPool { 4 };
+    float pixelRatio { 1 };
+    HeadlessFrontend frontend { pixelRatio, fileSource, threadPool };
+    Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), pixelRatio, fileSource,
+              threadPool, MapMode::Static };
+};
+
+} // end namespace
+
+TEST(FrameProfiler, Disabled) {
+    FrameProfilerTest test;
+
+    test.frontend.render(test.map);
+    EXPECT_TRUE(test.frontend.getRenderer()->getRecentFrameProfiles().empty());
+}
+
+TEST(FrameProfiler, Sections) {
+    FrameProfilerTest test;
+
+    test.frontend.getRenderer()->setFrameProfiling(true);
+    test.frontend.render(test.map);
+
+    const auto profiles = test.frontend.getRenderer()->getRecentFrameProfiles();
+    ASSERT_FALSE(profiles.empty());
+
+    const FrameProfile& profile = profiles.back();
+    EXPECT_GT(profile.counters.drawCalls, 0u);
+    EXPECT_GT(profile.counters.vertices, 0u);
+
+    auto find = [&](const std::string& name) {
+        return std::find_if(profile.sections.begin(), profile.sections.end(),
+                            [&](const auto& section) { return section.name == name; });
+    };
+
+    for (const auto& phase : { "prepare", "placement", "upload", "clear", "opaque", "translucent" }) {
+        auto section = find(phase);
+        ASSERT_NE(profile.sections.end(), section) << phase;
+        EXPECT_TRUE(section->phase.empty());
+        EXPECT_LE(section->cpuTime, profile.cpuTime);
+    }
+
+    auto layer = find("fill");
+    ASSERT_NE(profile.sections.end(), layer);
+    EXPECT_FALSE(layer->phase.empty());
+    EXPECT_GT(layer->counters.drawCalls, 0u);
+    EXPECT_LE(layer->counters.drawCalls, profile.counters.drawCalls);
+
+    // The background is drawn with glClear, so it isn't a layer section.
+    EXPECT_EQ(profile.sections.end(), find("background"));
+
+    test.frontend.getRenderer()->setFrameProfiling(false);
+    test.frontend.render(test.map);
+    EXPECT_TRUE(test.frontend.getRenderer()->getRecentFrameProfiles().empty());
+}
+
+TEST(FrameProfiler, StateChanges) {
+    FrameProfilerTest test;
+
+    // A translucent fill is drawn together with its outline in the translucent pass.
+    test.map.getStyle().getLayer("fill")->as<style::FillLayer>()->setFillOpacity(0.5f);
+    test.map.setZoom(1);
+
+    test.frontend.getRenderer()->setFrameProfiling(true);
+    test.frontend.render(test.map);
+
+    const auto profiles = test.frontend.getRenderer()->getRecentFrameProfiles();
+    ASSERT_FALSE(profiles.empty());
+
+    const FrameProfile& profile = profiles.back();
+    auto layer = std::find_if(profile.sections.begin(), profile.sections.end(), [&](const auto& section) {
+        return section.name == "fill" && section.phase == "translucent";
+    });
+    ASSERT_NE(profile.sections.end(), layer);
+
+    // The polygon covers all four visible tiles. Their fills are drawn before their
+    // outlines, so the layer switches programs once per draw type, not once per tile.
+    EXPECT_EQ(8u, layer->counters.drawCalls);
+    EXPECT_EQ(2u, layer->counters.programSwitches);
+    EXPECT_GT(layer->counters.uniformUploads, 0u);
+    EXPECT_LE(layer->counters.programSwitches, profile.counters.programSwitches);
+}
+
+TEST(FrameProfiler, LineVertices) {
+    FrameProfilerTest test;
+
+    // GeoJSON sources aren't simplified by line buckets, so both counts are the same.
+    test.map.getStyle().addLayer(std::make_unique<style::LineLayer>("line", "geojson"));
+
+    test.frontend.getRenderer()->setFrameProfiling(true);
+    test.frontend.render(test.map);
+
+    const auto profiles = test.frontend.getRenderer()->getRecentFrameProfiles();
+    ASSERT_FALSE(profiles.empty());
+
+    const FrameProfile& profile = profiles.back();
+    auto layer = std::find_if(profile.sections.begin(), profile.sections.end(), [&](const auto& section) {
+        return section.name == "line";
+    });
+    ASSERT_NE(profile.sections.end(), layer);
+    EXPECT_GT(layer->counters.lineSourceVertices, 0u);
+    EXPECT_EQ(layer->counters.lineSourceVertices, layer->counters.lineSimplifiedVertices);
+    EXPECT_EQ(layer->counters.lineSourceVertices, profile.counters.lineSourceVertices);
+
+    auto fill = std::find_if(profile.sections.begin(), profile.sections.end(), [&](const auto& section) {
+        return section.name == "fill";
+    });
+    ASSERT_NE(profile.sections.end(), fill);
+    EXPECT_EQ(0u, fill->counters.lineSourceVertices);
+}
+
+TEST(FrameProfiler, TraceEvents) {
+    FrameProfile profile;
+    profile.frame = 7;
+    profile.cpuTime = Milliseconds(4);
+    profile.counters.drawCalls = 3;
+
+    FrameProfile::Section phase;
+    phase.name = "opaque";
+    phase.begin = Milliseconds(1);
+    phase.cpuTime = Milliseconds(2);
+    phase.gpuBegin = Milliseconds(0);
+    phase.gpuTime = Milliseconds(1);
+    profile.sections.push_back(phase);
+
+    FrameProfile::Section layer;
+    layer.name = "water";
+    layer.phase = "opaque";
+    layer.begin = Milliseconds(1);
+    layer.cpuTime = Milliseconds(1);
+    profile.sections.push_back(layer);
+
+    JSDocument document;
+    document.Parse<0>(encodeTraceEvents({ profile }).c_str());
+    ASSERT_FALSE(document.HasParseError());
+
+    const JSValue& events = document["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+
+    // The frame and the phase on both threads; the layer has no GPU timing.
+    ASSERT_EQ(4u, events.Size());
+
+    EXPECT_STREQ("frame", events[0]["name"].GetString());
+    EXPECT_DOUBLE_EQ(4000, events[0]["dur"].GetDouble());
+    EXPECT_EQ(7u, events[0]["args"]["frame"].GetUint64());
+    EXPECT_EQ(3u, events[0]["args"]["drawCalls"].GetUint64());
+    EXPECT_EQ(0u, events[0]["args"]["programSwitches"].GetUint64());
+
+    EXPECT_STREQ("opaque", events[1]["name"].GetString());
+    EXPECT_STREQ("phase", events[1]["cat"].GetString());
+    EXPECT_EQ(0u, events[1]["tid"].GetUint());
+    EXPECT_DOUBLE_EQ(1000, events[1]["ts"].GetDouble());
+
+    EXPECT_STREQ("opaque", events[2]["name"].GetString());
+    EXPECT_EQ(1u, events[2]["tid"].GetUint());
+    EXPECT_DOUBLE_EQ(1000, events[2]["dur"].GetDouble());
+
+    EXPECT_STREQ("water", events[3]["name"].GetString());
+    EXPECT_STREQ("layer", events[3]["cat"].GetString());
+    EXPECT_STREQ("X", events[3]["ph"].GetString());
+}
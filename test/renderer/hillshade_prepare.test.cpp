@@ -0,0 +1,91 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gl/context.hpp>
+#include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/programs/programs.hpp>
+#include <mbgl/renderer/backend_scope.hpp>
+#include <mbgl/renderer/buckets/hillshade_bucket.hpp>
+#include <mbgl/renderer/layers/render_hillshade_layer.hpp>
+#include <mbgl/renderer/render_static_data.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace mbgl;
+
+namespace {
+
+// Terrain-RGB encoded elevations that rise in both directions at different rates, with
+// some bumps, so that a texture mirrored along either axis has different slopes.
+PremultipliedImage makeDEM(const uint32_t dim) {
+    PremultipliedImage image({ dim, dim });
+    for (uint32_t y = 0; y < dim; y++) {
+        for (uint32_t x = 0; x < dim; x++) {
+            const uint32_t elevation = 20 * x + 10 * y + ((x * y) % 7) * 4;
+            const uint32_t value = (elevation + 10000) * 10;
+            uint8_t* pixel = image.data.get() + (y * dim + x) * 4;
+            pixel[0] = value >> 16;
+            pixel[1] = (value >> 8) & 0xFF;
+            pixel[2] = value & 0xFF;
+            pixel[3] = 0xFF;
+        }
+    }
+    return image;
+}
+
+// Reads the texture in the order its rows were uploaded or rendered.
+PremultipliedImage readTexture(gl::Context& context, const gl::Texture& texture) {
+    gl::Framebuffer framebuffer = context.createFramebuffer(texture);
+    context.bindFramebuffer = framebuffer.framebuffer;
+    return context.readFramebuffer<PremultipliedImage>(texture.size, false);
+}
+
+uint8_t maxDifference(const PremultipliedImage& a, const PremultipliedImage& b) {
+    uint8_t result = 0;
+    for (std::size_t i = 0; i < a.bytes(); i++) {
+        result = std::max<uint8_t>(result, std::abs(a.data[i] - b.data[i]));
+    }
+    return result;
+}
+
+} // namespace
+
+TEST(HillshadePrepare, WorkerMatchesRenderer) {
+    HeadlessBackend backend { { 256, 256 } };
+    BackendScope scope { backend };
+    gl::Context& context = backend.getContext();
+
+    Programs programs(context, ProgramParameters { 1.0, false, {} });
+    RenderStaticData staticData(context, 1.0, {});
+
+    const PremultipliedImage dem = makeDEM(64);
+    const uint8_t zoom = 10;
+    const uint8_t maxzoom = 15;
+
+    // Prepared like the raster DEM tile worker does.
+    HillshadeBucket worker { DEMData(dem, Tileset::DEMEncoding::Mapbox) };
+    worker.prepare(zoom, maxzoom);
+    worker.upload(context);
+
+    // Prepared by the renderer's prepare pass.
+    HillshadeBucket renderer { DEMData(dem, Tileset::DEMEncoding::Mapbox) };
+    renderer.upload(context);
+    ASSERT_FALSE(renderer.isPrepared());
+    RenderHillshadeLayer::prepare(context, programs.hillshadePrepare, staticData, renderer, zoom, maxzoom, "hillshade");
+
+    ASSERT_TRUE(worker.isPrepared());
+    ASSERT_TRUE(renderer.isPrepared());
+    ASSERT_TRUE(worker.texture);
+    ASSERT_TRUE(renderer.texture);
+    ASSERT_EQ(renderer.texture->size, worker.texture->size);
+
+    const PremultipliedImage expected = readTexture(context, *renderer.texture);
+    PremultipliedImage actual = readTexture(context, *worker.texture);
+
+    // Both ways of preparing round the same derivatives, but not always in the same direction.
+    EXPECT_LE(maxDifference(expected, actual), 1);
+
+    // The texture would differ if its rows were in the opposite order.
+    actual.flip();
+    EXPECT_GT(maxDifference(expected, actual), 8);
+}
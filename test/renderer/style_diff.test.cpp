@@ -0,0 +1,101 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/style_diff.hpp>
+#include <mbgl/style/collection.hpp>
+#include <mbgl/style/layers/background_layer.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+class LayerCollection {
+public:
+    LayerCollection() {
+        for (auto id : { "a", "b", "c" }) {
+            layers.add(std::make_unique<BackgroundLayer>(id));
+        }
+    }
+
+    void setColor(const std::string& id, Color color) {
+        auto layer = static_cast<BackgroundLayer*>(layers.get(id));
+        layer->setBackgroundColor(color);
+        layers.update(*layer);
+    }
+
+    Collection<Layer> layers;
+};
+
+} // end namespace
+
+TEST(StyleDiff, JournalUpdates) {
+    LayerCollection test;
+
+    const auto impls = test.layers.getImpls();
+    const auto journal = test.layers.getJournal();
+
+    test.setColor("b", Color::red());
+    test.setColor("c", Color::blue());
+    test.setColor("b", Color::black());
+
+    const LayerDifference diff = diffLayers(impls, test.layers.getImpls(), journal, test.layers.getJournal());
+    EXPECT_TRUE(diff.added.empty());
+    EXPECT_TRUE(diff.removed.empty());
+    ASSERT_EQ(2u, diff.changed.size());
+    EXPECT_EQ(impls->at(1), diff.changed.at("b").before);
+    EXPECT_EQ(test.layers.getImpls()->at(1), diff.changed.at("b").after);
+    EXPECT_EQ(impls->at(2), diff.changed.at("c").before);
+    EXPECT_EQ(test.layers.getImpls()->at(2), diff.changed.at("c").after);
+
+    // Nothing changed since the latest state.
+    const LayerDifference none = diffLayers(test.layers.getImpls(), test.layers.getImpls(),
+                                            test.layers.getJournal(), test.layers.getJournal());
+    EXPECT_TRUE(none.added.empty());
+    EXPECT_TRUE(none.removed.empty());
+    EXPECT_TRUE(none.changed.empty());
+}
+
+TEST(StyleDiff, JournalFallback) {
+    LayerCollection test;
+
+    const auto impls = test.layers.getImpls();
+    const auto journal = test.layers.getJournal();
+
+    test.setColor("a", Color::red());
+    test.layers.remove("b");
+    test.layers.add(std::make_unique<BackgroundLayer>("d"));
+
+    const LayerDifference diff = diffLayers(impls, test.layers.getImpls(), journal, test.layers.getJournal());
+    ASSERT_EQ(1u, diff.added.size());
+    EXPECT_EQ(1u, diff.added.count("d"));
+    ASSERT_EQ(1u, diff.removed.size());
+    EXPECT_EQ(1u, diff.removed.count("b"));
+    ASSERT_EQ(1u, diff.changed.size());
+    EXPECT_EQ(1u, diff.changed.count("a"));
+
+    // Without a journal for the earlier state, the collections are compared in full.
+    const LayerDifference full = diffLayers(impls, test.layers.getImpls(), nullptr, test.layers.getJournal());
+    EXPECT_EQ(1u, full.added.size());
+    EXPECT_EQ(1u, full.removed.size());
+    EXPECT_EQ(1u, full.changed.size());
+}
+
+TEST(StyleDiff, JournalLength) {
+    LayerCollection test;
+
+    const auto impls = test.layers.getImpls();
+    const auto journal = test.layers.getJournal();
+
+    // Long runs of updates start new journals, and fall back to a full comparison.
+    const std::size_t maxLength = CollectionJournal::maxLength;
+    for (std::size_t i = 0; i < maxLength; i++) {
+        test.setColor("a", Color(0, 0, 0, float(i) / maxLength));
+    }
+    EXPECT_LT(test.layers.getJournal()->length, maxLength);
+
+    const LayerDifference diff = diffLayers(impls, test.layers.getImpls(), journal, test.layers.getJournal());
+    EXPECT_TRUE(diff.added.empty());
+    EXPECT_TRUE(diff.removed.empty());
+    ASSERT_EQ(1u, diff.changed.size());
+    EXPECT_EQ(1u, diff.changed.count("a"));
+}
@@ -0,0 +1,218 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_file_source.hpp>
+
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/tile_pyramid.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/tile/tile.hpp>
+#include <mbgl/tile/tile_observer.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// A tile that is renderable as soon as it is created, and that counts the updates of
+// its necessity. Every full update of the pyramid sets the necessity of the tiles it
+// retains, while an update that reuses the previous render tiles doesn't touch them.
+class StubTile : public Tile {
+public:
+    StubTile(const OverscaledTileID& id_, std::size_t& necessityUpdates_)
+        : Tile(id_), necessityUpdates(necessityUpdates_) {
+        renderable = true;
+        loaded = true;
+    }
+
+    void setNecessity(TileNecessity) override {
+        necessityUpdates++;
+    }
+
+    void upload(gl::Context&) override {}
+    Bucket* getBucket(const style::Layer::Impl&) const override { return nullptr; }
+
+    bool holdForFade() const override {
+        return hold;
+    }
+
+    void notifyChanged() {
+        observer->onTileChanged(*this);
+    }
+
+    bool hold = false;
+
+private:
+    std::size_t& necessityUpdates;
+};
+
+class TilePyramidTest {
+public:
+    TilePyramidTest() {
+        transform.resize({ 512, 512 });
+        transform.setLatLngZoom({ 0, 0 }, 1);
+    }
+
+    // Updates the pyramid and returns whether it took the full update.
+    bool update(const TileParameters& parameters) {
+        const std::size_t before = necessityUpdates;
+        pyramid.update({},
+                       true,
+                       false,
+                       parameters,
+                       style::SourceType::Vector,
+                       512,
+                       { 0, 22 },
+                       {},
+                       [&](const OverscaledTileID& tileID) {
+                           createdTiles++;
+                           return std::make_unique<StubTile>(tileID, necessityUpdates);
+                       });
+        return necessityUpdates != before;
+    }
+
+    bool update() {
+        return update(tileParameters);
+    }
+
+    StubTile& tile() {
+        return static_cast<StubTile&>(pyramid.renderTiles.front().tile);
+    }
+
+    util::RunLoop loop;
+    StubFileSource fileSource;
+    ThreadPool threadPool { 1 };
+    Transform transform;
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transform.getState(),
+        threadPool,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0
+    };
+
+    TilePyramid pyramid;
+    std::size_t necessityUpdates = 0;
+    std::size_t createdTiles = 0;
+};
+
+} // end namespace
+
+TEST(TilePyramid, StaticCameraReusesRenderTiles) {
+    TilePyramidTest test;
+
+    EXPECT_TRUE(test.update());
+    ASSERT_FALSE(test.pyramid.renderTiles.empty());
+    const std::size_t renderTiles = test.pyramid.renderTiles.size();
+    const std::size_t createdTiles = test.createdTiles;
+
+    test.pyramid.renderTiles.front().used = true;
+
+    EXPECT_FALSE(test.update());
+    EXPECT_EQ(renderTiles, test.pyramid.renderTiles.size());
+    EXPECT_EQ(createdTiles, test.createdTiles);
+    // The per-frame state of the reused render tiles is reset.
+    EXPECT_FALSE(test.pyramid.renderTiles.front().used);
+
+    // Moving the camera changes the cover.
+    test.transform.moveBy({ 10, 0 });
+    EXPECT_TRUE(test.update());
+    EXPECT_FALSE(test.update());
+}
+
+TEST(TilePyramid, TileChangeForcesFullUpdate) {
+    TilePyramidTest test;
+
+    EXPECT_TRUE(test.update());
+    EXPECT_FALSE(test.update());
+
+    test.tile().notifyChanged();
+    EXPECT_TRUE(test.update());
+    EXPECT_FALSE(test.update());
+}
+
+TEST(TilePyramid, HeldTilesForceFullUpdate) {
+    TilePyramidTest test;
+
+    EXPECT_TRUE(test.update());
+    for (auto& renderTile : test.pyramid.renderTiles) {
+        static_cast<StubTile&>(renderTile.tile).hold = true;
+    }
+
+    // Zooming in replaces the render tiles with their children, while the previous ones
+    // are held for fading.
+    const std::size_t idealTiles = test.pyramid.renderTiles.size();
+    test.transform.setZoom(2);
+    EXPECT_TRUE(test.update());
+    ASSERT_GT(test.pyramid.renderTiles.size(), idealTiles);
+
+    // Held tiles can stop being held without a notification.
+    EXPECT_TRUE(test.update());
+    for (auto& renderTile : test.pyramid.renderTiles) {
+        static_cast<StubTile&>(renderTile.tile).hold = false;
+    }
+    EXPECT_TRUE(test.update());
+
+    // Once nothing is held anymore, the render tiles are reused again.
+    EXPECT_FALSE(test.update());
+}
+
+TEST(TilePyramid, PrefetchForcesFullUpdate) {
+    TilePyramidTest test;
+
+    Transform predicted;
+    predicted.resize({ 512, 512 });
+    predicted.setLatLngZoom({ 10, 10 }, 3);
+
+    const TileParameters prefetchParameters {
+        1.0,
+        MapDebugOptions(),
+        test.transform.getState(),
+        test.threadPool,
+        test.fileSource,
+        MapMode::Continuous,
+        test.annotationManager,
+        test.imageManager,
+        test.glyphManager,
+        0,
+        { predicted.getState() }
+    };
+
+    EXPECT_TRUE(test.update(prefetchParameters));
+    EXPECT_TRUE(test.update(prefetchParameters));
+
+    // The first update without predicted states still releases the prefetched tiles.
+    EXPECT_TRUE(test.update());
+    EXPECT_FALSE(test.update());
+}
+
+TEST(TilePyramid, ClearedTilesForceFullUpdate) {
+    TilePyramidTest test;
+
+    EXPECT_TRUE(test.update());
+    const std::size_t createdTiles = test.createdTiles;
+
+    // Render sources drop all of their tiles when their data changes.
+    test.pyramid.tiles.clear();
+    test.pyramid.renderTiles.clear();
+    test.pyramid.cache.clear();
+
+    EXPECT_TRUE(test.update());
+    EXPECT_FALSE(test.pyramid.renderTiles.empty());
+    EXPECT_EQ(2 * createdTiles, test.createdTiles);
+    EXPECT_FALSE(test.update());
+}
@@ -0,0 +1,82 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/style/conversion/geojson.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style::conversion;
+
+TEST(GeoJSON, StreamingMatchesDOM) {
+    const std::vector<std::string> documents = {
+        R"JSON({ "type": "Point", "coordinates": [1, 2] })JSON",
+        R"JSON({ "coordinates": [1.5, -2.25, 3], "type": "Point" })JSON",
+        R"JSON({ "type": "MultiPoint", "coordinates": [[1, 2], [3, 4]] })JSON",
+        R"JSON({ "type": "LineString", "coordinates": [[1, 2], [3, 4]] })JSON",
+        R"JSON({ "type": "MultiLineString", "coordinates": [[[1, 2], [3, 4]], [[5, 6]]] })JSON",
+        R"JSON({ "type": "Polygon", "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 0]], []] })JSON",
+        R"JSON({ "type": "MultiPolygon", "coordinates": [[[[0, 0], [1, 0], [0, 1]]], [[[2, 2]], [[3, 3]]]] })JSON",
+        R"JSON({ "type": "GeometryCollection", "geometries": [
+            { "type": "Point", "coordinates": [1, 2] },
+            { "coordinates": [[3, 4], [5, 6]], "type": "LineString" }
+        ] })JSON",
+        R"JSON({
+            "type": "Feature",
+            "id": 5,
+            "properties": {
+                "string": "value", "uint": 1, "int": -2, "double": 1.5, "null": null, "bool": true,
+                "array": [1, "two", [3]], "object": { "nested": { "deeper": false } }, "uint": 99
+            },
+            "geometry": { "type": "Point", "coordinates": [1, 2] },
+            "foreign": { "coordinates": "ignored" }
+        })JSON",
+        R"JSON({
+            "features": [
+                { "type": "Feature", "id": "a", "properties": null,
+                  "geometry": { "type": "Point", "coordinates": [1, 2] } },
+                { "geometry": { "type": "LineString", "coordinates": [[3, 4], [5, 6]] },
+                  "type": "Feature", "id": -3 },
+                { "type": "Feature", "id": 0.5, "properties": {},
+                  "geometry": { "type": "Polygon", "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 0]]] } }
+            ],
+            "type": "FeatureCollection"
+        })JSON",
+        R"JSON({ "type": "FeatureCollection", "features": [] })JSON",
+    };
+
+    for (const auto& document : documents) {
+        Error domError;
+        optional<GeoJSON> dom = convertJSON<GeoJSON>(document, domError);
+        ASSERT_TRUE(bool(dom)) << domError.message;
+
+        Error error;
+        optional<GeoJSON> streamed = parseGeoJSON(document, error);
+        ASSERT_TRUE(bool(streamed)) << error.message;
+        EXPECT_TRUE(*dom == *streamed) << document;
+    }
+}
+
+TEST(GeoJSON, StreamingErrors) {
+    const std::vector<std::pair<std::string, std::string>> documents = {
+        { R"JSON([1, 2])JSON", "GeoJSON must be an object" },
+        { R"JSON({ "coordinates": [1, 2] })JSON", "GeoJSON must have a type property" },
+        { R"JSON({ "type": "Circle", "coordinates": [1, 2] })JSON", "Circle not yet implemented" },
+        { R"JSON({ "type": "Point" })JSON", "Point geometry must have a coordinates property" },
+        { R"JSON({ "type": "Point", "coordinates": {} })JSON", "coordinates property must be an array" },
+        { R"JSON({ "type": "Point", "coordinates": [1] })JSON", "coordinates array must have at least 2 numbers" },
+        { R"JSON({ "type": "FeatureCollection" })JSON", "FeatureCollection must have features property" },
+        { R"JSON({ "type": "FeatureCollection", "features": [{ "type": "Feature" }] })JSON",
+          "Feature must have a geometry property" },
+        { R"JSON({ "type": "Feature", "geometry": { "type": "Point", "coordinates": [1, 2] }, "id": true })JSON",
+          "Feature id must be a string or number" },
+    };
+
+    for (const auto& document : documents) {
+        Error error;
+        EXPECT_FALSE(bool(parseGeoJSON(document.first, error))) << document.first;
+        EXPECT_EQ(document.second, error.message);
+    }
+
+    Error error;
+    EXPECT_FALSE(bool(parseGeoJSON(R"JSON({ "type": "Point", "coordinates": [1, 2] )JSON", error)));
+    EXPECT_NE(std::string::npos, error.message.find("Missing a comma or '}' after an object member."));
+}
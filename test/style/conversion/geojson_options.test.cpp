@@ -37,6 +37,9 @@ TEST(GeoJSONOptions, RetainsDefaults) {
     ASSERT_EQ(converted.cluster, defaults.cluster);
     ASSERT_EQ(converted.clusterRadius, defaults.clusterRadius);
     ASSERT_EQ(converted.clusterMaxZoom, defaults.clusterMaxZoom);
+
+    // Point cloud
+    ASSERT_EQ(converted.pointCloud, defaults.pointCloud);
 }
 
 TEST(GeoJSONOptions, FullConversion) {
@@ -47,7 +50,8 @@ TEST(GeoJSONOptions, FullConversion) {
         "tolerance": 3,
         "cluster": true,
         "clusterRadius": 4,
-        "clusterMaxZoom": 5
+        "clusterMaxZoom": 5,
+        "pointCloud": true
     })JSON", error);
 
     // GeoJSON-VT
@@ -60,4 +64,7 @@ TEST(GeoJSONOptions, FullConversion) {
     ASSERT_EQ(converted.cluster, true);
     ASSERT_EQ(converted.clusterRadius, 4);
     ASSERT_EQ(converted.clusterMaxZoom, 5);
+
+    // Point cloud
+    ASSERT_EQ(converted.pointCloud, true);
 }
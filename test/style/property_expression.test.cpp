@@ -121,3 +121,19 @@ TEST(PropertyExpression, Issue8460) {
     EXPECT_NEAR(600.0f, fn2.evaluate(18.0f, oneInteger, -1.0f), 0.00);
     EXPECT_NEAR(600.0f, fn2.evaluate(19.0f, oneInteger, -1.0f), 0.00);
 }
+
+TEST(PropertyExpression, ZoomCache) {
+    PropertyExpression<float> stepExpression(step(zoom(), literal(1.0), 10.0, literal(2.0)));
+    PropertyExpression<float> interpolateExpression(interpolate(linear(), zoom(), 0.0, literal(0.0), 10.0, literal(10.0)));
+
+    // Cached results are only reused for zooms that evaluate to the same output, also
+    // through copies, which share the cache.
+    for (int i = 0; i < 2; i++) {
+        const PropertyExpression<float> stepCopy = stepExpression;
+        for (float z : { 0.0f, 9.5f, 9.99f, 10.0f, 15.0f, 9.0f, 10.0f, 0.0f }) {
+            EXPECT_EQ(z < 10.0f ? 1.0f : 2.0f, stepExpression.evaluate(z));
+            EXPECT_EQ(z < 10.0f ? 1.0f : 2.0f, stepCopy.evaluate(z));
+            EXPECT_FLOAT_EQ(std::min(z, 10.0f), interpolateExpression.evaluate(z));
+        }
+    }
+}
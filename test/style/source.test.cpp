@@ -9,6 +9,7 @@
 #include <mbgl/style/sources/raster_dem_source.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
+#include <mbgl/style/sources/geojson_source_impl.hpp>
 #include <mbgl/style/sources/image_source.hpp>
 #include <mbgl/style/sources/custom_geometry_source.hpp>
 #include <mbgl/style/layers/hillshade_layer.cpp>
@@ -39,7 +40,9 @@
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/text/glyph_manager.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <tuple>
 
 using namespace mbgl;
 using SourceType = mbgl::style::SourceType;
@@ -592,6 +595,86 @@ TEST(Source, VectorTileCancel) {
     test.run();
 }
 
+TEST(Source, VectorTilePrefetch) {
+    SourceTest test;
+
+    PrefetchStatistics statistics;
+    std::vector<CanonicalTileID> requested;
+    test.fileSource.tileResponse = [&] (const Resource& resource) {
+        requested.emplace_back(resource.tileData->z, resource.tileData->x, resource.tileData->y);
+        if (requested.size() == 1 + statistics.requested) {
+            test.end();
+        }
+        Response response;
+        response.noContent = true;
+        return response;
+    };
+
+    LineLayer layer("id", "source");
+    layer.setSourceLayer("water");
+
+    std::vector<Immutable<Layer::Impl>> layers {{ layer.baseImpl }};
+
+    Tileset tileset;
+    tileset.tiles = { "tiles" };
+
+    VectorSource source("source", tileset);
+    source.loadDescription(test.fileSource);
+
+    // The camera is expected to move closer to a point away from the center.
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLngZoom({ 40, 40 }, 3);
+
+    const TileParameters prefetchParameters {
+        1.0,
+        MapDebugOptions(),
+        test.transformState,
+        test.threadPool,
+        test.fileSource,
+        MapMode::Continuous,
+        test.annotationManager,
+        test.imageManager,
+        test.glyphManager,
+        0,
+        { transform.getState() }
+    };
+
+    auto renderSource = RenderSource::create(source.baseImpl);
+    renderSource->setObserver(&test.renderSourceObserver);
+    renderSource->update(source.baseImpl,
+                         layers,
+                         true,
+                         true,
+                         prefetchParameters);
+
+    statistics = renderSource->getPrefetchStatistics();
+    EXPECT_GT(statistics.requested, 0u);
+    EXPECT_EQ(0u, statistics.used);
+    EXPECT_EQ(0u, statistics.discarded);
+
+    test.run();
+
+    // Besides the ideal tile, the tiles at the predicted zoom level are requested.
+    ASSERT_EQ(1 + statistics.requested, requested.size());
+    EXPECT_EQ(1, std::count(requested.begin(), requested.end(), CanonicalTileID(0, 0, 0)));
+    EXPECT_EQ(int(statistics.requested), std::count_if(requested.begin(), requested.end(), [] (const CanonicalTileID& id) {
+        return id.z == 3;
+    }));
+
+    // Once the prediction no longer holds, the prefetched tiles are dropped.
+    renderSource->update(source.baseImpl,
+                         layers,
+                         true,
+                         false,
+                         test.tileParameters);
+
+    statistics = renderSource->getPrefetchStatistics();
+    EXPECT_EQ(0u, statistics.used);
+    EXPECT_EQ(statistics.requested, statistics.discarded);
+    EXPECT_EQ(0, statistics.hitRate());
+}
+
 TEST(Source, RasterTileAttribution) {
     SourceTest test;
 
@@ -708,6 +791,43 @@ TEST(Source, GeoJSonSourceUrlUpdate) {
     test.run();
 }
 
+TEST(Source, GeoJSONSourcePointCloud) {
+    FeatureCollection features;
+    for (int32_t i = 0; i < 1000; i++) {
+        Feature feature { Point<double> { -179.5 + (i % 40) * 9.0, -79.5 + (i / 40) * 6.4 } };
+        feature.id = { uint64_t(i) };
+        features.push_back(std::move(feature));
+    }
+
+    GeoJSONOptions options;
+    GeoJSONSource::Impl reference(GeoJSONSource::Impl("source", options), GeoJSON { features });
+    options.pointCloud = true;
+    GeoJSONSource::Impl pointCloud(GeoJSONSource::Impl("source", options), GeoJSON { features });
+
+    auto tileFeatures = [] (const GeoJSONSource::Impl& impl, const CanonicalTileID& tileID) {
+        std::vector<std::tuple<uint64_t, int16_t, int16_t>> result;
+        for (const auto& feature : impl.getData()->getTile(tileID)) {
+            const auto& point = feature.geometry.get<Point<int16_t>>();
+            result.emplace_back(feature.id->get<uint64_t>(), point.x, point.y);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    for (const auto& tileID : { CanonicalTileID(0, 0, 0), CanonicalTileID(1, 0, 1),
+                                CanonicalTileID(2, 3, 1), CanonicalTileID(4, 15, 7),
+                                CanonicalTileID(4, 0, 8), CanonicalTileID(6, 20, 30) }) {
+        auto expected = tileFeatures(reference, tileID);
+        auto actual = tileFeatures(pointCloud, tileID);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (std::size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(std::get<0>(expected[i]), std::get<0>(actual[i]));
+            EXPECT_NEAR(std::get<1>(expected[i]), std::get<1>(actual[i]), 1);
+            EXPECT_NEAR(std::get<2>(expected[i]), std::get<2>(actual[i]), 1);
+        }
+    }
+}
+
 TEST(Source, ImageSourceImageUpdate) {
     SourceTest test;
 
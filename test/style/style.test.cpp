@@ -3,6 +3,7 @@
 #include <mbgl/test/fixture_log_observer.hpp>
 
 #include <mbgl/style/style_impl.hpp>
+#include <mbgl/style/parser_cache.hpp>
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/layer.hpp>
@@ -99,3 +100,48 @@ TEST(Style, RemoveSourceInUse) {
 
     EXPECT_EQ(log->count(logMessage), 1u);
 }
+
+TEST(Style, SharedParsedStyle) {
+    util::RunLoop loop;
+
+    ThreadPool threadPool{ 1 };
+    StubFileSource fileSource;
+
+    const std::string json = util::read_file("test/fixtures/resources/style-unused-sources.json");
+    const std::size_t cached = ParserCache::size();
+
+    {
+        Style::Impl style1 { threadPool, fileSource, 1.0 };
+        Style::Impl style2 { threadPool, fileSource, 1.0 };
+        style1.loadJSON(json);
+        style2.loadJSON(json);
+
+        EXPECT_EQ(cached + 1, ParserCache::size());
+
+        // Layers share their implementations, sources are separate.
+        auto layers1 = style1.getLayers();
+        auto layers2 = style2.getLayers();
+        ASSERT_FALSE(layers1.empty());
+        ASSERT_EQ(layers1.size(), layers2.size());
+        for (std::size_t i = 0; i < layers1.size(); i++) {
+            EXPECT_NE(layers1[i], layers2[i]);
+            EXPECT_EQ(layers1[i]->baseImpl, layers2[i]->baseImpl);
+        }
+
+        auto sources1 = style1.getSources();
+        auto sources2 = style2.getSources();
+        ASSERT_EQ(2u, sources1.size());
+        ASSERT_EQ(sources1.size(), sources2.size());
+        for (std::size_t i = 0; i < sources1.size(); i++) {
+            EXPECT_NE(sources1[i], sources2[i]);
+            EXPECT_EQ(sources1[i]->getID(), sources2[i]->getID());
+        }
+
+        // Changing a layer of one style leaves the other one alone.
+        layers1[0]->setMaxZoom(10);
+        EXPECT_EQ(10, layers1[0]->getMaxZoom());
+        EXPECT_NE(10, layers2[0]->getMaxZoom());
+    }
+
+    EXPECT_EQ(cached, ParserCache::size());
+}
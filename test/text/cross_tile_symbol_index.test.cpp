@@ -9,7 +9,7 @@ SymbolInstance makeSymbolInstance(float x, float y, std::u16string key) {
     GlyphPositionMap gpm;
     const std::pair<Shaping, Shaping> shaping(Shaping{}, Shaping{});
     style::SymbolLayoutProperties::Evaluated layout_;
-    IndexedSubfeature subfeature(0, "", "", 0);
+    IndexedSubfeature subfeature(0, 0, 0, 0);
     Anchor anchor(x, y, 0, 0);
     return {anchor, line, shaping, {}, layout_, 0, 0, 0, style::SymbolPlacementType::Point, {{0, 0}}, 0, 0, {{0, 0}}, gpm, subfeature, 0, 0, key, 0 };
 }
@@ -205,3 +205,60 @@ TEST(CrossTileSymbolLayerIndex, bucketReplacement) {
     ASSERT_EQ(secondBucket.symbolInstances.at(2).crossTileID, 3u); // C' gets new ID
 }
 
+
+TEST(CrossTileSymbolLayerIndex, repeatedKeys) {
+    uint32_t maxCrossTileID = 0;
+    uint32_t maxBucketInstanceId = 0;
+    CrossTileSymbolLayerIndex index;
+
+    style::SymbolLayoutProperties::PossiblyEvaluated layout;
+    bool sdfIcons = false;
+    bool iconsNeedLinear = false;
+    bool sortFeaturesByY = false;
+    std::string bucketLeaderID = "test";
+
+    OverscaledTileID mainID(6, 0, 6, 8, 8);
+    std::vector<SymbolInstance> mainInstances;
+    mainInstances.push_back(makeSymbolInstance(500, 500, u"I-95"));
+    mainInstances.push_back(makeSymbolInstance(500, 1500, u"I-95"));
+    mainInstances.push_back(makeSymbolInstance(1500, 500, u"I-95"));
+    SymbolBucket mainBucket { layout, {}, 16.0f, 1.0f, 0, sdfIcons, iconsNeedLinear, sortFeaturesByY, bucketLeaderID, std::move(mainInstances) };
+    mainBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(mainID, mainBucket, maxCrossTileID);
+
+    OverscaledTileID childID(7, 0, 7, 16, 16);
+    std::vector<SymbolInstance> childInstances;
+    childInstances.push_back(makeSymbolInstance(3000, 3000, u"I-95"));
+    childInstances.push_back(makeSymbolInstance(3000, 1000, u"I-95"));
+    childInstances.push_back(makeSymbolInstance(1000, 3000, u"I-95"));
+    childInstances.push_back(makeSymbolInstance(1000, 1000, u"I-95"));
+    SymbolBucket childBucket { layout, {}, 16.0f, 1.0f, 0, sdfIcons, iconsNeedLinear, sortFeaturesByY, bucketLeaderID, std::move(childInstances) };
+    childBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(childID, childBucket, maxCrossTileID);
+
+    // Each symbol matches the one at its own location
+    ASSERT_EQ(childBucket.symbolInstances.at(0).crossTileID, 4u);
+    ASSERT_EQ(childBucket.symbolInstances.at(1).crossTileID, 3u);
+    ASSERT_EQ(childBucket.symbolInstances.at(2).crossTileID, 2u);
+    ASSERT_EQ(childBucket.symbolInstances.at(3).crossTileID, 1u);
+
+    // Removing the buckets releases their keys, and new buckets don't match them
+    std::unordered_set<uint32_t> currentIDs;
+    index.removeStaleBuckets(currentIDs);
+
+    std::vector<SymbolInstance> otherInstances;
+    otherInstances.push_back(makeSymbolInstance(1000, 1000, u"I-93"));
+    SymbolBucket otherBucket { layout, {}, 16.0f, 1.0f, 0, sdfIcons, iconsNeedLinear, sortFeaturesByY, bucketLeaderID, std::move(otherInstances) };
+    otherBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(childID, otherBucket, maxCrossTileID);
+    ASSERT_EQ(otherBucket.symbolInstances.at(0).crossTileID, 5u);
+
+    std::vector<SymbolInstance> parentInstances;
+    parentInstances.push_back(makeSymbolInstance(500, 500, u"I-95"));
+    parentInstances.push_back(makeSymbolInstance(500, 500, u"I-93"));
+    SymbolBucket parentBucket { layout, {}, 16.0f, 1.0f, 0, sdfIcons, iconsNeedLinear, sortFeaturesByY, bucketLeaderID, std::move(parentInstances) };
+    parentBucket.bucketInstanceId = ++maxBucketInstanceId;
+    index.addBucket(mainID, parentBucket, maxCrossTileID);
+    ASSERT_EQ(parentBucket.symbolInstances.at(0).crossTileID, 6u);
+    ASSERT_EQ(parentBucket.symbolInstances.at(1).crossTileID, 5u);
+}
@@ -0,0 +1,169 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/fake_file_source.hpp>
+
+#include <mbgl/annotation/annotation.hpp>
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/annotation/annotation_tile.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/layers/circle_layer.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <memory>
+#include <set>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// Holds an annotation tile for each of the 16 tiles at zoom level 2. At that zoom level,
+// a tile spans 90 degrees of longitude, and the buffer around it about 5.6 degrees.
+class AnnotationTileTest {
+public:
+    AnnotationTileTest() {
+        annotationManager.onStyleLoaded();
+
+        for (uint32_t x = 0; x < 4; x++) {
+            for (uint32_t y = 0; y < 4; y++) {
+                tiles.push_back(std::make_unique<AnnotationTile>(OverscaledTileID(2, x, y), tileParameters));
+                tiles.back()->setLayers({{ layer.baseImpl }});
+            }
+        }
+
+        wait();
+    }
+
+    // Applies the pending annotation changes, and returns the tiles that got new data.
+    std::set<CanonicalTileID> updateData() {
+        annotationManager.updateData();
+
+        std::set<CanonicalTileID> updated;
+        for (const auto& tile : tiles) {
+            if (!tile->isComplete()) {
+                updated.insert(tile->id.canonical);
+            }
+        }
+
+        wait();
+        return updated;
+    }
+
+    void wait() {
+        for (const auto& tile : tiles) {
+            while (!tile->isComplete()) {
+                loop.runOnce();
+            }
+        }
+    }
+
+    static LineAnnotation line(const LineString<double>& geometry) {
+        return LineAnnotation { geometry };
+    }
+
+    FakeFileSource fileSource;
+    TransformState transformState;
+    util::RunLoop loop;
+    ThreadPool threadPool { 1 };
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+    CircleLayer layer { "circle", AnnotationManager::SourceID };
+
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transformState,
+        threadPool,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0
+    };
+
+    std::vector<std::unique_ptr<AnnotationTile>> tiles;
+};
+
+} // end namespace
+
+TEST(AnnotationTile, UpdatesContainingTile) {
+    AnnotationTileTest test;
+
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 45, 30 }, { 50, 35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 2, 1 } }), test.updateData());
+
+    // Nothing changed since.
+    EXPECT_TRUE(test.updateData().empty());
+}
+
+TEST(AnnotationTile, UpdatesBufferedEdges) {
+    AnnotationTileTest test;
+
+    // Next to the corner shared by four tiles, inside all of their buffers.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 0.5, 0.5 }, { 1, 1 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 1, 1 }, { 2, 2, 1 }, { 2, 1, 2 }, { 2, 2, 2 } }),
+              test.updateData());
+
+    // Just outside of the buffer of the tiles to the west and south.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 7, 7 }, { 8, 8 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 2, 1 } }), test.updateData());
+}
+
+TEST(AnnotationTile, UpdatesAcrossAntimeridian) {
+    AnnotationTileTest test;
+
+    // A line crossing the antimeridian from the east.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 170, 30 }, { 190, 35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 3, 1 }, { 2, 0, 1 } }), test.updateData());
+
+    // And from the west.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { -190, -30 }, { -170, -35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 3, 2 }, { 2, 0, 2 } }), test.updateData());
+}
+
+TEST(AnnotationTile, UpdatesWorldCopies) {
+    AnnotationTileTest test;
+
+    // Within the buffer of the easternmost tiles, by way of their copy in the next world.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { -178, 30 }, { -177, 35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 0, 1 }, { 2, 3, 1 } }), test.updateData());
+
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 177, -30 }, { 178, -35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 0, 2 }, { 2, 3, 2 } }), test.updateData());
+
+    // Far from the antimeridian, the copies don't reach any tile.
+    test.annotationManager.addAnnotation(AnnotationTileTest::line({ { -135, 30 }, { -130, 35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 0, 1 } }), test.updateData());
+}
+
+TEST(AnnotationTile, UpdatesOnUpdateAndRemove) {
+    AnnotationTileTest test;
+
+    const AnnotationID line = test.annotationManager.addAnnotation(AnnotationTileTest::line({ { 45, 30 }, { 50, 35 } }));
+    const AnnotationID symbol = test.annotationManager.addAnnotation(SymbolAnnotation { Point<double> { -45, 30 }, "default_marker" });
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 2, 1 }, { 2, 1, 1 } }), test.updateData());
+
+    // Moving a shape updates the tiles at its old and new position.
+    test.annotationManager.updateAnnotation(line, AnnotationTileTest::line({ { -45, -30 }, { -50, -35 } }));
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 2, 1 }, { 2, 1, 2 } }), test.updateData());
+
+    // Updating a symbol without changing it doesn't update any tile.
+    test.annotationManager.updateAnnotation(symbol, SymbolAnnotation { Point<double> { -45, 30 }, "default_marker" });
+    EXPECT_TRUE(test.updateData().empty());
+
+    test.annotationManager.updateAnnotation(symbol, SymbolAnnotation { Point<double> { 135, -30 }, "default_marker" });
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 1, 1 }, { 2, 3, 2 } }), test.updateData());
+
+    test.annotationManager.removeAnnotation(line);
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 1, 2 } }), test.updateData());
+
+    test.annotationManager.removeAnnotation(symbol);
+    EXPECT_EQ((std::set<CanonicalTileID> { { 2, 3, 2 } }), test.updateData());
+}
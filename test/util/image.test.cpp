@@ -2,6 +2,7 @@
 
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/io.hpp>
 
 using namespace mbgl;
@@ -34,6 +35,114 @@ TEST(Image, PNGRoundTripAlpha) {
     EXPECT_EQ(128, image.data[3]);
 }
 
+TEST(Image, EncodePNGOptions) {
+    PremultipliedImage rgba({ 64, 32 });
+    for (uint32_t i = 0; i < rgba.size.area(); i++) {
+        rgba.data[i * 4 + 0] = (i % 64) * 4;
+        rgba.data[i * 4 + 1] = (i / 64) * 8;
+        rgba.data[i * 4 + 2] = 0;
+        rgba.data[i * 4 + 3] = 255;
+    }
+
+    for (uint8_t effort : { 0, 3, 9 }) {
+        ImageEncoderOptions options;
+        options.effort = effort;
+
+        std::string streamed;
+        std::size_t writes = 0;
+        encodeImage(rgba, options, [&](const char* data, std::size_t length) {
+            streamed.append(data, length);
+            writes++;
+        });
+#if !defined(__QT__)
+        // Qt's image writer delivers the file in one piece.
+        EXPECT_GT(writes, 1u);
+#endif // !defined(__QT__)
+        EXPECT_EQ(encodeImage(rgba, options), streamed);
+
+        PremultipliedImage image = decodeImage(streamed);
+        ASSERT_EQ(rgba.size, image.size);
+        EXPECT_EQ(0, std::memcmp(rgba.data.get(), image.data.get(), rgba.bytes()));
+    }
+}
+
+#if !defined(__QT__)
+// Qt converts to a palette with its own quantizer, which may not preserve every color.
+TEST(Image, EncodePNGPalette) {
+    // With fewer than 256 colors, the palette holds all of them.
+    PremultipliedImage rgba({ 16, 16 });
+    for (uint32_t i = 0; i < rgba.size.area(); i++) {
+        const bool translucent = i % 7 == 0;
+        rgba.data[i * 4 + 0] = translucent || i % 3 ? 128 : 0;
+        rgba.data[i * 4 + 1] = translucent || i % 5 == 0 ? 0 : 64;
+        rgba.data[i * 4 + 2] = 0;
+        rgba.data[i * 4 + 3] = translucent ? 128 : 255;
+    }
+
+    ImageEncoderOptions options;
+    options.palette = true;
+
+    PremultipliedImage image = decodeImage(encodeImage(rgba, options));
+    ASSERT_EQ(rgba.size, image.size);
+    EXPECT_EQ(0, std::memcmp(rgba.data.get(), image.data.get(), rgba.bytes()));
+}
+#endif // !defined(__QT__)
+
+#if !defined(__ANDROID__)
+TEST(Image, EncodeJPEG) {
+    PremultipliedImage rgba({ 32, 32 });
+    for (uint32_t i = 0; i < rgba.size.area(); i++) {
+        rgba.data[i * 4 + 0] = 200;
+        rgba.data[i * 4 + 1] = 100;
+        rgba.data[i * 4 + 2] = 50;
+        rgba.data[i * 4 + 3] = 255;
+    }
+
+    ImageEncoderOptions options;
+    options.encoding = ImageEncoding::JPEG;
+    options.quality = 95;
+
+    PremultipliedImage image = decodeImage(encodeImage(rgba, options));
+    ASSERT_EQ(rgba.size, image.size);
+    EXPECT_NEAR(200, image.data[0], 3);
+    EXPECT_NEAR(100, image.data[1], 3);
+    EXPECT_NEAR(50, image.data[2], 3);
+    EXPECT_EQ(255, image.data[3]);
+}
+#endif // !defined(__ANDROID__)
+
+#if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(__QT__)
+TEST(Image, EncodeWebP) {
+    PremultipliedImage rgba({ 32, 32 });
+    for (uint32_t i = 0; i < rgba.size.area(); i++) {
+        rgba.data[i * 4 + 0] = (i % 32) * 8;
+        rgba.data[i * 4 + 1] = (i / 32) * 8;
+        rgba.data[i * 4 + 2] = 50;
+        rgba.data[i * 4 + 3] = 255;
+    }
+
+    // A quality of 100 is lossless.
+    ImageEncoderOptions options;
+    options.encoding = ImageEncoding::WebP;
+    options.quality = 100;
+
+    for (uint8_t effort : { 0, 9 }) {
+        options.effort = effort;
+        PremultipliedImage image = decodeImage(encodeImage(rgba, options));
+        ASSERT_EQ(rgba.size, image.size);
+        EXPECT_EQ(0, std::memcmp(rgba.data.get(), image.data.get(), rgba.bytes()));
+    }
+}
+#endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(__QT__)
+
+#if defined(__APPLE__) && !defined(__QT__)
+TEST(Image, EncodeUnsupported) {
+    ImageEncoderOptions options;
+    options.encoding = ImageEncoding::WebP;
+    EXPECT_THROW(encodeImage(PremultipliedImage({ 1, 1 }), options), std::runtime_error);
+}
+#endif // defined(__APPLE__) && !defined(__QT__)
+
 TEST(Image, PNGReadNoProfile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/no_profile.png"));
     EXPECT_EQ(128, image.data[0]);
@@ -163,3 +272,83 @@ TEST(Image, Premultiply) {
     EXPECT_EQ(0u, rgba.size.width);
     EXPECT_EQ(0u, rgba.size.height);
 }
+
+TEST(Image, PremultiplyAllValues) {
+    // Every combination of color and alpha, followed by a few pixels that don't fill a
+    // whole vector.
+    UnassociatedImage rgba({ 256 * 256 + 3, 1 });
+    for (uint32_t i = 0; i < rgba.size.width; i++) {
+        rgba.data[i * 4 + 0] = uint8_t(i >> 8);
+        rgba.data[i * 4 + 1] = uint8_t(255 - (i >> 8));
+        rgba.data[i * 4 + 2] = uint8_t(i * 3);
+        rgba.data[i * 4 + 3] = uint8_t(i);
+    }
+
+    const UnassociatedImage original = rgba.clone();
+    PremultipliedImage premultiplied = util::premultiply(std::move(rgba));
+    for (uint32_t i = 0; i < premultiplied.size.width; i++) {
+        const uint8_t* src = original.data.get() + i * 4;
+        const uint8_t* dst = premultiplied.data.get() + i * 4;
+        for (std::size_t c = 0; c < 3; c++) {
+            ASSERT_EQ((src[c] * src[3] + 127) / 255, dst[c]);
+        }
+        ASSERT_EQ(src[3], dst[3]);
+    }
+
+    // Also unpremultiply colors that exceed their alpha.
+    std::memcpy(premultiplied.data.get(), original.data.get(), original.bytes());
+    UnassociatedImage unpremultiplied = util::unpremultiply(std::move(premultiplied));
+    for (uint32_t i = 0; i < unpremultiplied.size.width; i++) {
+        const uint8_t* src = original.data.get() + i * 4;
+        const uint8_t* dst = unpremultiplied.data.get() + i * 4;
+        for (std::size_t c = 0; c < 3; c++) {
+            ASSERT_EQ(src[3] ? uint8_t((255 * src[c] + src[3] / 2) / src[3]) : src[c], dst[c]);
+        }
+        ASSERT_EQ(src[3], dst[3]);
+    }
+}
+
+TEST(Image, Flip) {
+    AlphaImage image({ 3, 5 });
+    for (uint32_t y = 0; y < image.size.height; y++) {
+        std::memset(image.data.get() + y * image.stride(), y, image.stride());
+    }
+
+    image.flip();
+    for (uint32_t y = 0; y < image.size.height; y++) {
+        for (uint32_t x = 0; x < image.size.width; x++) {
+            EXPECT_EQ(image.size.height - y - 1, image.data[y * image.stride() + x]);
+        }
+    }
+
+    AlphaImage empty;
+    empty.flip();
+}
+
+TEST(Image, Pool) {
+    util::ImagePool::clear();
+
+    PremultipliedImage image = util::ImagePool::acquire<PremultipliedImage>({ 16, 16 });
+    ASSERT_EQ(Size({ 16, 16 }), image.size);
+    const uint8_t* buffer = image.data.get();
+    EXPECT_EQ(0u, util::ImagePool::size());
+
+    util::ImagePool::release(std::move(image));
+    EXPECT_EQ(0u, image.size.width);
+    EXPECT_EQ(1024u, util::ImagePool::size());
+
+    // Buffers are only reused for images of the same size in bytes.
+    AlphaImage alpha = util::ImagePool::acquire<AlphaImage>({ 16, 16 });
+    EXPECT_NE(buffer, alpha.data.get());
+    UnassociatedImage unassociated = util::ImagePool::acquire<UnassociatedImage>({ 32, 8 });
+    EXPECT_EQ(buffer, unassociated.data.get());
+    EXPECT_EQ(0u, util::ImagePool::size());
+
+    // The pool drops the oldest buffers once it is full.
+    util::ImagePool::release(util::ImagePool::acquire<AlphaImage>({ 1024, 1024 * 24 }));
+    util::ImagePool::release(util::ImagePool::acquire<AlphaImage>({ 1024, 1024 * 12 }));
+    EXPECT_EQ(12u * 1024 * 1024, util::ImagePool::size());
+
+    util::ImagePool::clear();
+    EXPECT_EQ(0u, util::ImagePool::size());
+}
@@ -0,0 +1,102 @@
+#include <mbgl/util/parallel_for.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/message.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ParallelFor, Empty) {
+    ThreadPool pool(2);
+
+    bool called = false;
+    util::parallelFor(pool, 0, [&] (std::size_t) {
+        called = true;
+    });
+
+    EXPECT_FALSE(called);
+}
+
+TEST(ParallelFor, VisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto& visit : visits) {
+        visit = 0;
+    }
+
+    util::parallelFor(pool, visits.size(), [&] (std::size_t i) {
+        ++visits[i];
+    });
+
+    for (auto& visit : visits) {
+        EXPECT_EQ(1, visit.load());
+    }
+}
+
+TEST(ParallelFor, CalledFromPoolThread) {
+    // Every pool thread blocks in parallelFor; the work must still complete.
+    ThreadPool pool(2);
+
+    std::atomic<int> pending { 4 };
+    std::atomic<std::size_t> total { 0 };
+    std::vector<std::shared_ptr<Mailbox>> mailboxes;
+
+    class Outer {
+    public:
+        Outer(Scheduler& scheduler_, std::atomic<std::size_t>& total_, std::atomic<int>& pending_)
+            : scheduler(scheduler_), total(total_), pending(pending_) {}
+
+        void run() {
+            util::parallelFor(scheduler, 100, [&] (std::size_t) { ++total; });
+            --pending;
+        }
+
+        Scheduler& scheduler;
+        std::atomic<std::size_t>& total;
+        std::atomic<int>& pending;
+    };
+
+    Outer outer { pool, total, pending };
+    for (int i = 0; i < 4; ++i) {
+        mailboxes.push_back(std::make_shared<Mailbox>(pool));
+        mailboxes.back()->push(actor::makeMessage(outer, &Outer::run));
+    }
+
+    while (pending) {
+        std::this_thread::yield();
+    }
+
+    EXPECT_EQ(400u, total.load());
+}
+
+TEST(ParallelFor, SameThreadScheduler) {
+    // Helpers scheduled on the calling thread's run loop never get to run
+    // before parallelFor returns; the calling thread does all the work.
+    util::RunLoop loop;
+
+    std::size_t count = 0;
+    util::parallelFor(loop, 10, [&] (std::size_t) {
+        ++count;
+    });
+
+    EXPECT_EQ(10u, count);
+    loop.runOnce();
+}
+
+TEST(ParallelFor, RethrowsException) {
+    ThreadPool pool(2);
+
+    EXPECT_THROW(util::parallelFor(pool, 10, [&] (std::size_t i) {
+        if (i == 5) {
+            throw std::runtime_error("test");
+        }
+    }), std::runtime_error);
+}
@@ -0,0 +1,38 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/string_indexer.hpp>
+
+using namespace mbgl;
+
+TEST(StringIndexer, Identity) {
+    StringIndexer indexer;
+    const StringIdentity water = indexer.get("water");
+    const StringIdentity roads = indexer.get("roads");
+
+    EXPECT_NE(water, roads);
+    EXPECT_EQ(water, indexer.get(std::string("water")));
+    EXPECT_EQ("water", indexer.get(water));
+    EXPECT_EQ("roads", indexer.get(roads));
+    EXPECT_EQ(2u, indexer.size());
+}
+
+TEST(StringIndexer, Find) {
+    StringIndexer indexer;
+    const StringIdentity water = indexer.get("water");
+
+    EXPECT_EQ(water, *indexer.find("water"));
+    EXPECT_FALSE(indexer.find("roads"));
+    // Looking a string up doesn't intern it.
+    EXPECT_EQ(1u, indexer.size());
+}
+
+TEST(StringIndexer, Independent) {
+    StringIndexer first;
+    StringIndexer second;
+    first.get("water");
+    const StringIdentity roads = second.get("roads");
+
+    EXPECT_EQ("roads", second.get(roads));
+    EXPECT_FALSE(first.find("roads"));
+    EXPECT_FALSE(second.find("water"));
+}
@@ -45,6 +45,46 @@ TEST(TileCover, Pitch) {
               util::tileCover(transform.getState(), 2));
 }
 
+TEST(TileCover, PitchWithLOD) {
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLng({ 0.1, -0.1 });
+    transform.setZoom(2);
+    transform.setAngle(5.0);
+    transform.setPitch(40.0 * M_PI / 180.0);
+
+    // Moderately pitched views are covered at a single zoom level.
+    EXPECT_EQ(util::tileCover(transform.getState(), 2),
+              util::tileCoverWithLOD(transform.getState(), 2));
+}
+
+TEST(TileCover, HighPitchWithLOD) {
+    Transform transform;
+    transform.resize({ 1000, 1000 });
+    transform.setLatLng({ 37.7749, -122.4194 });
+    transform.setZoom(15.5);
+    transform.setAngle(0.3);
+    transform.setPitch(60.0 * M_PI / 180.0);
+
+    const auto tiles = util::tileCover(transform.getState(), 15);
+    const auto lodTiles = util::tileCoverWithLOD(transform.getState(), 15);
+    EXPECT_LT(lodTiles.size(), tiles.size());
+    EXPECT_EQ(15, lodTiles.front().canonical.z);
+    EXPECT_TRUE(std::any_of(lodTiles.begin(), lodTiles.end(), [](const auto& id) {
+        return id.canonical.z == 14;
+    }));
+
+    // Every tile of the single zoom level cover is covered by exactly one tile.
+    for (const auto& id : tiles) {
+        EXPECT_EQ(1, std::count_if(lodTiles.begin(), lodTiles.end(), [&](const auto& lodID) {
+            return lodID == id || id.isChildOf(lodID);
+        }));
+    }
+
+    // No tiles below the minimum zoom level are used.
+    EXPECT_EQ(tiles, util::tileCoverWithLOD(transform.getState(), 15, 15));
+}
+
 TEST(TileCover, WorldZ1) {
     EXPECT_EQ((std::vector<UnwrappedTileID>{
         { 1, 0, 0 }, { 1, 0, 1 }, { 1, 1, 0 }, { 1, 1, 1 },